@@ -0,0 +1,73 @@
+#include "building_tools/goal_tests/single_state_goal_test.h"
+#include "engines/best_first_search/beam_search.h"
+#include "engines/best_first_search/beam_search_params.h"
+#include "engines/engine_components/eval_functions/f_cost_evaluator.h"
+#include "engines/engine_components/open_lists/evaluator_and_comparing_usage.h"
+#include "environments/sliding_tile_puzzle/sliding_tile_action.h"
+#include "environments/sliding_tile_puzzle/sliding_tile_hash_function.h"
+#include "environments/sliding_tile_puzzle/sliding_tile_manhattan_heuristic.h"
+#include "environments/sliding_tile_puzzle/sliding_tile_state.h"
+#include "environments/sliding_tile_puzzle/sliding_tile_transitions.h"
+#include "environments/sliding_tile_puzzle/sliding_tile_utils.h"
+#include "utils/timer.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+/**
+ * Solves the 3x4 sliding tile problems with beam search at a range of beam widths, and prints the number of problems
+ * solved, the average solution cost, and the total time at each width.
+ */
+int main() {
+    int num_rows = 3;
+    int num_cols = 4;
+
+    std::string problems_file = HSEF_DIR "/apps/input/3x4_puzzle.probs";  // HSEF_DIR is the root directory of the HSEF code
+    std::vector<SlidingTileState> start_states = readSlidingTileStatesFromFile(problems_file, num_rows, num_cols);
+
+    SlidingTileState goal_state(num_rows, num_cols);
+    SingleStateGoalTest<SlidingTileState> goal_test(goal_state);
+    SlidingTileTransitions transitions(num_rows, num_cols);
+    SlidingTileManhattanHeuristic heuristic(goal_state, SlidingTileCostType::unit);
+    FCostEvaluator<SlidingTileState, BlankSlide> f_cost_evaluator(heuristic);
+    SlidingTileHashFunction hash_function;
+
+    // Breaks ties on f-cost towards a low heuristic value
+    EvalsAndUsageVec<SlidingTileState, BlankSlide> evals;
+    evals.emplace_back(f_cost_evaluator, true);
+    evals.emplace_back(heuristic, true);
+
+    BeamSearchParams params;
+    BeamSearch<SlidingTileState, BlankSlide, uint64_t> engine(params);
+    engine.setEvaluators(evals);
+    engine.setTransitionSystem(transitions);
+    engine.setGoalTest(goal_test);
+    engine.setHashFunction(hash_function);
+    Timer timer;
+
+    for (std::size_t width : {1U, 10U, 100U, 1000U}) {
+        params.m_beam_width = width;
+        engine.setEngineParams(params);
+
+        int num_solved = 0;
+        double total_cost = 0.0;
+        timer.startTimer();
+        for (const SlidingTileState& start_state : start_states) {
+            engine.searchForPlan(start_state);
+            if (engine.hasFoundSolution()) {
+                num_solved++;
+                total_cost += engine.getLastSolutionPlanCost();
+            }
+        }
+        timer.endTimer();
+
+        std::cout << "Beam width " << width << ", solved: " << num_solved << "/" << start_states.size()
+                  << ", average cost: " << (num_solved > 0 ? total_cost / num_solved : 0.0)
+                  << ", seconds: " << timer.getLastTimePeriodDuration() << "\n";
+    }
+
+    return 0;
+}
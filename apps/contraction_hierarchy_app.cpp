@@ -0,0 +1,121 @@
+#include "building_tools/evaluators/constant_heuristic.h"
+#include "engines/best_first_search/best_first_search.h"
+#include "engines/best_first_search/best_first_search_params.h"
+#include "engines/engine_components/eval_functions/f_cost_evaluator.h"
+#include "environments/graph/contraction_hierarchy.h"
+#include "environments/graph/contraction_hierarchy_search.h"
+#include "environments/graph/graph.h"
+#include "environments/graph/graph_transitions.h"
+#include "environments/graph/vertex_hash_function.h"
+#include "experiment_running/experiment_results.h"
+#include "experiment_running/experiment_runner.h"
+#include "experiment_running/search_resource_limits.h"
+#include "utils/floating_point_utils.h"
+#include "utils/timer.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * Gets the average search time of the given results.
+ */
+double getAverageSearchSeconds(const std::vector<ExperimentResults<GraphAction>>& results) {
+    double total_seconds = 0.0;
+    for (const auto& result : results) {
+        total_seconds += result.m_standard_stats.m_search_time_seconds;
+    }
+    return total_seconds / results.size();
+}
+
+/**
+ * Compares the query latency of contraction hierarchies to Dijkstra's algorithm with BestFirstSearch, on many random
+ * queries in the same graph. The graph is a synthetic road network: a square grid of intersections with two-way roads of
+ * random length between neighbours, and some missing roads. Prints the time to build the hierarchy with one thread and
+ * with all available threads, the size of the saved hierarchy, the average query times, and the number of queries
+ * whose costs differ.
+ */
+int main() {
+    const int side = 100;
+    const int num_queries = 200;
+    std::mt19937 random(42);
+    std::uniform_int_distribution<int> road_length(100, 1000);
+    std::uniform_int_distribution<int> percent(0, 99);
+
+    Graph graph;
+    auto label = [](int row, int col) { return std::to_string(row) + "_" + std::to_string(col); };
+    for (int row = 0; row < side; ++row) {
+        for (int col = 0; col < side; ++col) {
+            graph.addVertex(label(row, col));
+        }
+    }
+    for (int row = 0; row < side; ++row) {
+        for (int col = 0; col < side; ++col) {
+            for (auto [other_row, other_col] : {std::pair(row, col + 1), std::pair(row + 1, col)}) {
+                if (other_row < side && other_col < side && percent(random) >= 10) {
+                    double cost = road_length(random);
+                    graph.addEdge(label(row, col), label(other_row, other_col), cost);
+                    graph.addEdge(label(other_row, other_col), label(row, col), cost);
+                }
+            }
+        }
+    }
+    std::cout << "Vertices: " << graph.getNumVertices() << ", edges: " << graph.getNumEdges() << "\n";
+
+    GraphTransitions transitions(graph);
+    std::uniform_int_distribution<VertexID> vertex_dist(0, graph.getNumVertices() - 1);
+    std::vector<GraphState> starts;
+    std::vector<GraphState> goals;
+    for (int query = 0; query < num_queries; ++query) {
+        starts.push_back({vertex_dist(random), &graph});
+        goals.push_back({vertex_dist(random), &graph});
+    }
+    SearchResourceLimits limits;
+    Timer timer;
+
+    unsigned num_threads = std::max(1u, std::thread::hardware_concurrency());
+    ContractionHierarchy hierarchy(graph);
+    for (unsigned threads : {1u, num_threads}) {
+        timer.startTimer();
+        hierarchy.build(threads);
+        timer.endTimer();
+        std::cout << "Build seconds with " << threads << " threads: " << timer.getLastTimePeriodDuration() << "\n";
+    }
+    std::ostringstream saved;
+    hierarchy.save(saved);
+    std::cout << "Arcs: " << hierarchy.getNumArcs() << ", shortcuts: " << hierarchy.getNumShortcuts()
+              << ", saved bytes: " << saved.str().size() << "\n";
+
+    ContractionHierarchySearch ch_search;
+    ch_search.setHierarchy(hierarchy);
+    auto ch_results = runExperiments<GraphState, GraphAction>(ch_search, transitions, limits, starts, goals);
+
+    VertexHashFunction hash;
+    ConstantHeuristic<GraphState, GraphAction> zero_heuristic;
+    FCostEvaluator<GraphState, GraphAction> f_cost_evaluator(zero_heuristic);
+    BestFirstSearchParams params;
+    params.m_use_reopened = false;
+    BestFirstSearch<GraphState, GraphAction, uint32_t> dijkstra(params);
+    dijkstra.setEvaluator(f_cost_evaluator);
+    dijkstra.setHashFunction(hash);
+    auto dijkstra_results = runExperiments<GraphState, GraphAction>(dijkstra, transitions, limits, starts, goals);
+
+    int num_mismatches = 0;
+    for (std::size_t query = 0; query < starts.size(); ++query) {
+        if (ch_results[query].m_has_found_plan != dijkstra_results[query].m_has_found_plan ||
+                  !fpEqual(ch_results[query].m_plan_cost, dijkstra_results[query].m_plan_cost)) {
+            num_mismatches++;
+        }
+    }
+    std::cout << "Queries: " << starts.size() << ", cost mismatches: " << num_mismatches << "\n";
+    std::cout << "Dijkstra average query seconds: " << getAverageSearchSeconds(dijkstra_results) << "\n";
+    std::cout << "Contraction hierarchy average query seconds: " << getAverageSearchSeconds(ch_results) << "\n";
+
+    return 0;
+}
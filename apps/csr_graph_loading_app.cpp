@@ -0,0 +1,113 @@
+#include "environments/graph/csr_graph.h"
+#include "environments/graph/csr_graph_loading.h"
+#include "environments/graph/graph.h"
+#include "environments/graph/graph_utils.h"
+#include "utils/io_utils.h"
+#include "utils/timer.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <optional>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * Compares the time to load a large graph with the CSV adjacency list parser, the DIMACS loader with one thread and with
+ * all available threads, the binary edge list loader, and the binary cache. The graph is a synthetic road network: a
+ * square grid of intersections with two-way roads of random length between neighbours, written to the temporary
+ * directory in each format.
+ */
+int main() {
+    const int side = 500;
+    std::mt19937 random(42);
+    std::uniform_int_distribution<int> road_length(100, 1000);
+    std::vector<CsrGraphEdge> edges;
+    for (int row = 0; row < side; ++row) {
+        for (int col = 0; col < side; ++col) {
+            auto vertex = static_cast<CsrVertexID>(row * side + col);
+            if (col + 1 < side) {
+                double cost = road_length(random);
+                edges.push_back({vertex, vertex + 1, cost});
+                edges.push_back({vertex + 1, vertex, cost});
+            }
+            if (row + 1 < side) {
+                double cost = road_length(random);
+                edges.push_back({vertex, static_cast<CsrVertexID>(vertex + side), cost});
+                edges.push_back({static_cast<CsrVertexID>(vertex + side), vertex, cost});
+            }
+        }
+    }
+    std::size_t num_vertices = static_cast<std::size_t>(side) * side;
+
+    std::filesystem::path temp_dir = std::filesystem::temp_directory_path();
+    std::string dimacs_file = (temp_dir / "csr_graph_loading_app.gr").string();
+    std::string csv_file = (temp_dir / "csr_graph_loading_app.csv").string();
+    std::string binary_file = (temp_dir / "csr_graph_loading_app.bin").string();
+    std::string cache_file = (temp_dir / "csr_graph_loading_app.gr.cache").string();
+    {
+        std::ofstream dimacs(dimacs_file);
+        dimacs << "c Synthetic grid road network\n";
+        dimacs << "p sp " << num_vertices << " " << edges.size() << "\n";
+        for (const CsrGraphEdge& edge : edges) {
+            dimacs << "a " << edge.m_from_vertex_id + 1 << " " << edge.m_to_vertex_id + 1 << " " << edge.m_cost << "\n";
+        }
+
+        CsrGraph graph(num_vertices, edges);
+        std::ofstream csv(csv_file);
+        for (std::size_t vertex = 0; vertex < num_vertices; ++vertex) {
+            csv << vertex;
+            for (CsrEdgeID edge_id : graph.getOutEdges(static_cast<CsrVertexID>(vertex))) {
+                csv << ";" << graph.getEdgeTarget(edge_id) << " " << graph.getEdgeCost(edge_id);
+            }
+            csv << "\n";
+        }
+    }
+    writeBinaryEdgeList(edges, binary_file);
+    std::filesystem::remove(cache_file);
+
+    std::cout << "Vertices: " << num_vertices << ", arcs: " << edges.size()
+              << ", DIMACS bytes: " << std::filesystem::file_size(dimacs_file) << "\n";
+    Timer timer;
+
+    timer.startTimer();
+    std::stringstream csv_ss = loadFileIntoStringSteam(csv_file);
+    Graph legacy_graph = getGraphFromCSVAdjacencyList(csv_ss);
+    timer.endTimer();
+    std::cout << "CSV adjacency list into Graph seconds: " << timer.getLastTimePeriodDuration()
+              << ", edges: " << legacy_graph.getNumEdges() << "\n";
+
+    unsigned num_threads = std::max(1u, std::thread::hardware_concurrency());
+    for (unsigned threads : {1u, num_threads}) {
+        timer.startTimer();
+        std::optional<CsrGraph> graph = loadDimacsGraph(dimacs_file, threads);
+        timer.endTimer();
+        std::cout << "DIMACS with " << threads << " threads seconds: " << timer.getLastTimePeriodDuration()
+                  << ", edges: " << (graph ? graph->getNumEdges() : 0) << "\n";
+    }
+
+    timer.startTimer();
+    std::optional<CsrGraph> binary_graph = loadBinaryEdgeList(binary_file, num_vertices);
+    timer.endTimer();
+    std::cout << "Binary edge list seconds: " << timer.getLastTimePeriodDuration()
+              << ", edges: " << (binary_graph ? binary_graph->getNumEdges() : 0) << "\n";
+
+    auto loader = [num_threads](const std::string& file_name) { return loadDimacsGraph(file_name, num_threads); };
+    for (const char* pass : {"miss", "hit"}) {
+        timer.startTimer();
+        std::optional<CsrGraph> graph = loadCsrGraphWithCache(dimacs_file, cache_file, loader);
+        timer.endTimer();
+        std::cout << "Cache " << pass << " seconds: " << timer.getLastTimePeriodDuration()
+                  << ", edges: " << (graph ? graph->getNumEdges() : 0) << "\n";
+    }
+
+    for (const std::string& file : {dimacs_file, csv_file, binary_file, cache_file}) {
+        std::filesystem::remove(file);
+    }
+    return 0;
+}
@@ -0,0 +1,129 @@
+#include "building_tools/goal_tests/single_state_goal_test.h"
+#include "engines/best_first_search/best_first_search.h"
+#include "engines/best_first_search/best_first_search_params.h"
+#include "engines/best_first_search/d_star_lite.h"
+#include "engines/best_first_search/d_star_lite_params.h"
+#include "engines/engine_components/eval_functions/f_cost_evaluator.h"
+#include "environments/grid_pathfinding/grid_location.h"
+#include "environments/grid_pathfinding/grid_location_hash_function.h"
+#include "environments/grid_pathfinding/grid_map.h"
+#include "environments/grid_pathfinding/grid_map_change_recorder.h"
+#include "environments/grid_pathfinding/grid_pathfinding_action.h"
+#include "environments/grid_pathfinding/grid_pathfinding_octile_heuristic.h"
+#include "environments/grid_pathfinding/grid_pathfinding_scenario_running.h"
+#include "environments/grid_pathfinding/grid_pathfinding_transitions.h"
+#include "utils/io_utils.h"
+#include "utils/timer.h"
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+/**
+ * For a sample of the arena2 benchmark scenarios, toggles random locations between passable and obstacle, and after each
+ * batch of toggles replans with D* Lite, which repairs its previous search, and with A* from scratch. Prints the
+ * average replanning time of each.
+ */
+int main() {
+    const int num_scenarios = 20;
+    const int num_replans = 20;
+    const int toggles_per_replan = 5;
+    std::mt19937 rand_gen(42);
+
+    std::string scenario_file = HSEF_DIR "/apps/input/arena2.map.scen";
+    std::string map_dir = HSEF_DIR "/apps/input/";
+    std::vector<GridPathfindingScenario> scenarios = loadScenarioFile(scenario_file, map_dir);
+
+    std::string map_str = loadFileIntoStringSteam(scenarios[0].m_map_path).str();
+    std::stringstream map_info(map_str.substr(map_str.find('\n') + 1));  // Removes the 'type octile' line
+    const GridMap original_map(map_info);
+
+    double a_star_seconds = 0.0;
+    double d_star_lite_seconds = 0.0;
+    double d_star_lite_initial_seconds = 0.0;
+    int num_mismatched = 0;
+    Timer timer;
+
+    std::uniform_int_distribution<std::size_t> scenario_dist(0, scenarios.size() - 1);
+    for (int scenario_num = 0; scenario_num < num_scenarios; ++scenario_num) {
+        const GridPathfindingScenario& scenario = scenarios[scenario_dist(rand_gen)];
+        GridMap map = original_map;
+        GridPathfindingTransitions transitions(&map, GridConnectionType::eight);
+        GridLocationHashFunction hash_func;
+        hash_func.setMapWidth(transitions);
+        GridMapChangeRecorder recorder(map);
+        SingleStateGoalTest<GridLocation> goal_test(scenario.m_goal_state);
+
+        GridPathfindingOctileHeuristic d_star_lite_heuristic;
+        DStarLiteParams d_star_lite_params;
+        DStarLite<GridLocation, GridDirection, uint32_t> d_star_lite(d_star_lite_params);
+        d_star_lite.setHeuristic(d_star_lite_heuristic);
+        d_star_lite.setHashFunction(hash_func);
+        d_star_lite.setTransitionSystem(transitions);
+        d_star_lite.setGoalTest(goal_test);
+
+        GridPathfindingOctileHeuristic a_star_heuristic(scenario.m_goal_state);
+        FCostEvaluator<GridLocation, GridDirection> f_cost_evaluator(a_star_heuristic);
+        BestFirstSearchParams a_star_params;
+        a_star_params.m_use_reopened = false;
+        BestFirstSearch<GridLocation, GridDirection, uint32_t> a_star(a_star_params);
+        a_star.setEvaluator(f_cost_evaluator);
+        a_star.setHashFunction(hash_func);
+        a_star.setTransitionSystem(transitions);
+        a_star.setGoalTest(goal_test);
+
+        timer.startTimer();
+        d_star_lite.searchForPlan(scenario.m_start_state);
+        timer.endTimer();
+        d_star_lite_initial_seconds += timer.getLastTimePeriodDuration();
+
+        std::uniform_int_distribution<int> x_dist(0, map.getWidth() - 1);
+        std::uniform_int_distribution<int> y_dist(0, map.getHeight() - 1);
+        for (int replan = 0; replan < num_replans; ++replan) {
+            recorder.clearChanges();
+            for (int toggle = 0; toggle < toggles_per_replan; ++toggle) {
+                GridLocation location(x_dist(rand_gen), y_dist(rand_gen));
+                if (location == scenario.m_start_state || location == scenario.m_goal_state) {
+                    continue;
+                }
+                GridLocationType type = map.getLocationType(location.m_x_coord, location.m_y_coord);
+                if (type == GridLocationType::passable) {
+                    map.setLocationType(location.m_x_coord, location.m_y_coord, GridLocationType::obstacle);
+                } else if (type == GridLocationType::obstacle) {
+                    map.setLocationType(location.m_x_coord, location.m_y_coord, GridLocationType::passable);
+                }
+            }
+
+            timer.startTimer();
+            for (const GridLocation& affected : recorder.getAffectedLocations()) {
+                d_star_lite.notifyStateChanged(affected);
+            }
+            d_star_lite.searchForPlan(scenario.m_start_state);
+            timer.endTimer();
+            d_star_lite_seconds += timer.getLastTimePeriodDuration();
+
+            timer.startTimer();
+            a_star.searchForPlan(scenario.m_start_state);
+            timer.endTimer();
+            a_star_seconds += timer.getLastTimePeriodDuration();
+
+            if (std::abs(a_star.getLastSolutionPlanCost() - d_star_lite.getLastSolutionPlanCost()) > 1e-6) {
+                num_mismatched++;
+            }
+        }
+    }
+
+    int total_replans = num_scenarios * num_replans;
+    std::cout << "Replans: " << total_replans << ", toggles per replan: " << toggles_per_replan
+              << ", mismatched costs: " << num_mismatched << "\n";
+    std::cout << "D* Lite initial search average seconds: " << d_star_lite_initial_seconds / num_scenarios << "\n";
+    std::cout << "D* Lite replan average seconds: " << d_star_lite_seconds / total_replans << "\n";
+    std::cout << "A* from scratch average seconds: " << a_star_seconds / total_replans << "\n";
+
+    return 0;
+}
@@ -0,0 +1,113 @@
+#include "building_tools/goal_tests/single_state_goal_test.h"
+#include "building_tools/hashing/state_hash_function.h"
+#include "engines/best_first_search/best_first_search.h"
+#include "engines/best_first_search/best_first_search_params.h"
+#include "environments/grid_pathfinding/grid_location.h"
+#include "environments/grid_pathfinding/grid_location_hash_function.h"
+#include "environments/grid_pathfinding/grid_map.h"
+#include "environments/grid_pathfinding/grid_pathfinding_action.h"
+#include "environments/grid_pathfinding/grid_pathfinding_octile_heuristic.h"
+#include "environments/grid_pathfinding/grid_pathfinding_transitions.h"
+#include "environments/sliding_tile_puzzle/sliding_tile_action.h"
+#include "environments/sliding_tile_puzzle/sliding_tile_hash_function.h"
+#include "environments/sliding_tile_puzzle/sliding_tile_manhattan_heuristic.h"
+#include "environments/sliding_tile_puzzle/sliding_tile_state.h"
+#include "environments/sliding_tile_puzzle/sliding_tile_transitions.h"
+#include "search_basics/node_evaluator.h"
+#include "search_basics/transition_system.h"
+#include "utils/timer.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+/**
+ * Runs greedy best-first search with the given heuristic on the given instance, with either eager or deferred
+ * evaluation, and prints the solution cost, the number of evaluations and of evaluations saved, and the search time.
+ */
+template<class State_t, class Action_t, class Hash_t>
+void runGreedySearch(const std::string& domain_name, bool use_deferred_evaluation,
+          const TransitionSystem<State_t, Action_t>& transitions, NodeEvaluator<State_t, Action_t>& heuristic,
+          const StateHashFunction<State_t, Hash_t>& hash_function, const State_t& start_state, const State_t& goal_state) {
+    SingleStateGoalTest<State_t> goal_test(goal_state);
+
+    BestFirstSearchParams params;
+    params.m_use_deferred_evaluation = use_deferred_evaluation;
+    params.m_use_reopened = false;
+    BestFirstSearch<State_t, Action_t, Hash_t> engine(params);
+    engine.setEvaluator(heuristic);
+    engine.setTransitionSystem(transitions);
+    engine.setGoalTest(goal_test);
+    engine.setHashFunction(hash_function);
+
+    Timer timer;
+    timer.startTimer();
+    engine.searchForPlan(start_state);
+    timer.endTimer();
+
+    StringMap stats = engine.getEngineSpecificStatistics();
+    std::cout << domain_name << " GBFS (" << (use_deferred_evaluation ? "deferred" : "eager")
+              << "), solution cost: " << engine.getLastSolutionPlanCost()
+              << ", generated: " << engine.getStandardEngineStatistics().m_num_states_generated
+              << ", evals: " << engine.getStandardEngineStatistics().m_num_evals
+              << ", evals saved: " << stats["num_evals_saved"]
+              << ", reinsertions: " << stats["num_deferred_reinsertions"]
+              << ", seconds: " << timer.getLastTimePeriodDuration() << "\n";
+}
+
+/**
+ * Creates a map of the given size with a vertical wall through its middle that has a single gap at the bottom, so
+ * that greedy search has to move away from the goal to get around it.
+ */
+GridMap getWallMap(int size) {
+    std::stringstream map_stream;
+    map_stream << "type octile\nheight " << size << "\nwidth " << size << "\nmap\n";
+    for (int y = 0; y < size; ++y) {
+        for (int x = 0; x < size; ++x) {
+            map_stream << ((x == size / 2 && y < size - 8) ? '@' : '.');
+        }
+        map_stream << "\n";
+    }
+    return GridMap(map_stream);
+}
+
+int main() {
+    const int map_size = 512;
+    GridMap grid_map = getWallMap(map_size);
+    GridPathfindingTransitions grid_transitions(&grid_map, GridConnectionType::eight);
+    GridLocationHashFunction grid_hash_function;
+    grid_hash_function.setMapWidth(grid_transitions);
+    GridLocation grid_start(10, 10);
+    GridLocation grid_goal(map_size - 10, 10);
+    GridPathfindingOctileHeuristic grid_heuristic(grid_goal);
+
+    for (bool use_deferred_evaluation : {false, true}) {
+        runGreedySearch("Grid 512x512 wall (octile)", use_deferred_evaluation, grid_transitions, grid_heuristic,
+                  grid_hash_function, grid_start, grid_goal);
+    }
+
+    // Scrambles the goal with a random walk to get a 15-puzzle instance
+    const int walk_length = 1000;
+    std::mt19937 rand_gen(42);
+    SlidingTileTransitions tile_transitions(4, 4);
+    SlidingTileState tile_goal(4, 4);
+    SlidingTileState tile_start(4, 4);
+    for (int i = 0; i < walk_length; ++i) {
+        std::vector<BlankSlide> actions = tile_transitions.getActions(tile_start);
+        std::uniform_int_distribution<std::size_t> dist(0, actions.size() - 1);
+        tile_transitions.applyAction(tile_start, actions[dist(rand_gen)]);
+    }
+    SlidingTileHashFunction tile_hash_function;
+    SlidingTileManhattanHeuristic tile_heuristic(tile_goal, SlidingTileCostType::unit);
+
+    for (bool use_deferred_evaluation : {false, true}) {
+        runGreedySearch("15-puzzle (Manhattan)", use_deferred_evaluation, tile_transitions, tile_heuristic,
+                  tile_hash_function, tile_start, tile_goal);
+    }
+
+    return 0;
+}
@@ -0,0 +1,216 @@
+#include "building_tools/evaluators/evaluation_schedule.h"
+#include "building_tools/evaluators/evaluation_store.h"
+#include "engines/engine_components/eval_functions/f_cost_evaluator.h"
+#include "engines/engine_components/eval_functions/g_cost_evaluator.h"
+#include "engines/engine_components/node_containers/node_list.h"
+#include "environments/grid_pathfinding/grid_location.h"
+#include "environments/grid_pathfinding/grid_map.h"
+#include "environments/grid_pathfinding/grid_pathfinding_action.h"
+#include "environments/grid_pathfinding/grid_pathfinding_octile_heuristic.h"
+#include "environments/grid_pathfinding/grid_pathfinding_transitions.h"
+#include "environments/pancake_puzzle/gap_heuristic.h"
+#include "environments/pancake_puzzle/pancake_action.h"
+#include "environments/pancake_puzzle/pancake_state.h"
+#include "environments/pancake_puzzle/pancake_transitions.h"
+#include "environments/sliding_tile_puzzle/sliding_tile_action.h"
+#include "environments/sliding_tile_puzzle/sliding_tile_manhattan_heuristic.h"
+#include "environments/sliding_tile_puzzle/sliding_tile_state.h"
+#include "environments/sliding_tile_puzzle/sliding_tile_transitions.h"
+#include "search_basics/node_evaluator.h"
+#include "search_basics/transition_system.h"
+#include "utils/timer.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * Fills the node list with the children of a sequence of expansions along a random walk from the given state. The
+ * returned vector gives the IDs of the children of each expansion, which correspond to the batches a search engine
+ * would evaluate.
+ */
+template<class State_t, class Action_t>
+std::vector<std::vector<NodeID>> generateExpansionBatches(const TransitionSystem<State_t, Action_t>& transitions,
+          State_t state, int num_expansions, NodeList<State_t, Action_t>& nodes, std::mt19937& rand_gen) {
+    std::vector<std::vector<NodeID>> batches;
+    NodeID parent_id = nodes.addNode(state);
+
+    for (int i = 0; i < num_expansions; ++i) {
+        std::vector<Action_t> actions = transitions.getActions(state);
+        std::vector<NodeID> batch;
+
+        for (const Action_t& action : actions) {
+            State_t child = transitions.getChildState(state, action);
+            batch.push_back(nodes.addNode(child, parent_id, nodes.getGValue(parent_id) + 1.0, action, 1.0));
+        }
+
+        std::uniform_int_distribution<std::size_t> dist(0, batch.size() - 1);
+        parent_id = batch[dist(rand_gen)];
+        state = nodes.getState(parent_id);
+        batches.push_back(batch);
+    }
+    return batches;
+}
+
+/**
+ * Evaluates every batch using the given evaluators, either one node at a time or one batch at a time, and returns the
+ * number of evaluations per second.
+ */
+template<class State_t, class Action_t>
+double measureThroughput(const std::vector<NodeEvaluator<State_t, Action_t>*>& evaluators,
+          const std::vector<std::vector<NodeID>>& batches, bool use_batches, int repetitions) {
+    Timer timer;
+    std::size_t num_evals = 0;
+    timer.startTimer();
+
+    for (int rep = 0; rep < repetitions; ++rep) {
+        for (const auto& batch : batches) {
+            if (use_batches) {
+                for (auto* eval : evaluators) {
+                    eval->prepareToEvaluate();
+                }
+                for (auto* eval : evaluators) {
+                    eval->evaluateBatch(batch);
+                }
+            } else {
+                for (NodeID node_id : batch) {
+                    for (auto* eval : evaluators) {
+                        eval->prepareToEvaluate();
+                    }
+                    for (auto* eval : evaluators) {
+                        eval->evaluate(node_id);
+                    }
+                }
+            }
+            num_evals += batch.size();
+        }
+    }
+    timer.endTimer();
+    return static_cast<double>(num_evals) / timer.getLastTimePeriodDuration();
+}
+
+/**
+ * Evaluates every batch using the given schedule and returns the number of evaluations per second.
+ */
+template<class Schedule_t>
+double measureScheduleThroughput(Schedule_t& schedule, const std::vector<std::vector<NodeID>>& batches, int repetitions) {
+    Timer timer;
+    std::size_t num_evals = 0;
+    timer.startTimer();
+
+    for (int rep = 0; rep < repetitions; ++rep) {
+        for (const auto& batch : batches) {
+            schedule.evaluateBatch(batch);
+            num_evals += batch.size();
+        }
+    }
+    timer.endTimer();
+    return static_cast<double>(num_evals) / timer.getLastTimePeriodDuration();
+}
+
+/**
+ * Prints the throughput of per-node, batched, and scheduled evaluation with an f-cost evaluator over the given heuristic.
+ */
+template<class State_t, class Action_t, class Heuristic_t>
+void runBenchmark(const std::string& domain_name, Heuristic_t& heuristic,
+          const NodeList<State_t, Action_t>& nodes, const std::vector<std::vector<NodeID>>& batches, int repetitions) {
+    FCostEvaluator<State_t, Action_t> f_cost(heuristic);
+    f_cost.setNodeContainer(nodes);
+    std::vector<NodeEvaluator<State_t, Action_t>*> evaluators = {&heuristic, &f_cost};
+
+    double per_node = measureThroughput(evaluators, batches, false, repetitions);
+    double batched = measureThroughput(evaluators, batches, true, repetitions);
+
+    EvaluationSchedule<State_t, Action_t> schedule;
+    schedule.compile({&f_cost});
+    double scheduled = measureScheduleThroughput(schedule, batches, repetitions);
+
+    StaticEvaluationSchedule<Heuristic_t, FCostEvaluator<State_t, Action_t>> static_schedule(heuristic, f_cost);
+    double static_scheduled = measureScheduleThroughput(static_schedule, batches, repetitions);
+
+    std::cout << domain_name << ", per-node evals/sec: " << per_node << ", batched evals/sec: " << batched
+              << ", scheduled evals/sec: " << scheduled << ", static scheduled evals/sec: " << static_scheduled
+              << ", speedup: " << batched / per_node << ", scheduled speedup: " << static_scheduled / per_node << "\n";
+}
+
+/**
+ * Prints the bytes per node used to store the evaluations of an f-cost evaluator, a g-cost evaluator, and the given
+ * heuristic (including its distance-to-go estimates) for each of the given pairs of heuristic and f-cost storage
+ * types, along with the throughput of scheduled evaluation.
+ */
+template<class State_t, class Action_t, class Heuristic_t>
+void reportMemoryPerNode(const std::string& domain_name, Heuristic_t& heuristic, const NodeList<State_t, Action_t>& nodes,
+          const std::vector<std::vector<NodeID>>& batches,
+          const std::vector<std::pair<EvaluationStorageType, EvaluationStorageType>>& storage_types, int repetitions) {
+    FCostEvaluator<State_t, Action_t> f_cost(heuristic);
+    GCostEvaluator<State_t, Action_t> g_cost;
+    f_cost.setNodeContainer(nodes);
+    g_cost.setNodeContainer(nodes);
+
+    for (auto [h_storage_type, f_storage_type] : storage_types) {
+        heuristic.setEvaluationStorageType(h_storage_type);
+        f_cost.setEvaluationStorageType(f_storage_type);
+
+        EvaluationSchedule<State_t, Action_t> schedule;
+        schedule.compile({&f_cost, &g_cost});
+        double scheduled = measureScheduleThroughput(schedule, batches, repetitions);
+
+        std::cout << domain_name << ", h storage: " << h_storage_type << ", f storage: " << f_storage_type << ", bytes/node: "
+                  << schedule.getEvaluationStore()->getBytesPerNode() << ", scheduled evals/sec: " << scheduled << "\n";
+    }
+}
+
+int main() {
+    const int num_expansions = 200000;
+    const int repetitions = 5;
+    std::mt19937 rand_gen(42);
+
+    GridMap grid_map(512, 512);
+    GridPathfindingTransitions grid_transitions(&grid_map, GridConnectionType::eight);
+    NodeList<GridLocation, GridDirection> grid_nodes;
+    auto grid_batches = generateExpansionBatches(grid_transitions, GridLocation(256, 256), num_expansions, grid_nodes, rand_gen);
+    GridPathfindingOctileHeuristic octile(GridLocation(200, 200));
+    runBenchmark("Grid pathfinding (octile)", octile, grid_nodes, grid_batches, repetitions);
+    reportMemoryPerNode("Grid pathfinding (octile)", octile, grid_nodes, grid_batches,
+              {{EvaluationStorageType::float64, EvaluationStorageType::float64},
+                        {EvaluationStorageType::float32, EvaluationStorageType::float32}},
+              repetitions);
+
+    SlidingTileState goal_state(4, 4);
+    SlidingTileTransitions tile_transitions(4, 4);
+    NodeList<SlidingTileState, BlankSlide> tile_nodes;
+    auto tile_batches = generateExpansionBatches(tile_transitions, goal_state, num_expansions, tile_nodes, rand_gen);
+    SlidingTileManhattanHeuristic manhattan(goal_state, SlidingTileCostType::unit);
+    runBenchmark("Sliding tile 4x4 (Manhattan)", manhattan, tile_nodes, tile_batches, repetitions);
+    reportMemoryPerNode("Sliding tile 4x4 (Manhattan)", manhattan, tile_nodes, tile_batches,
+              {{EvaluationStorageType::float64, EvaluationStorageType::float64},
+                        {EvaluationStorageType::float32, EvaluationStorageType::float32},
+                        {EvaluationStorageType::int32, EvaluationStorageType::int32},
+                        {EvaluationStorageType::int16, EvaluationStorageType::int32}},
+              repetitions);
+
+    const int num_pancakes = 50;
+    std::vector<Pancake> perm(num_pancakes);
+    std::iota(perm.begin(), perm.end(), 0);
+    std::shuffle(perm.begin(), perm.end(), rand_gen);
+    PancakeTransitions pancake_transitions(num_pancakes, PancakePuzzleCostType::heavy);
+    NodeList<PancakeState, NumToFlip> pancake_nodes;
+    auto pancake_batches = generateExpansionBatches(pancake_transitions, PancakeState(perm), num_expansions / 10, pancake_nodes, rand_gen);
+
+    GapHeuristic full_gap(PancakePuzzleCostType::heavy);
+    GapHeuristic incremental_gap(PancakePuzzleCostType::heavy);
+    incremental_gap.setUseIncrementalEvaluation(true);
+    full_gap.setNodeContainer(pancake_nodes);
+    incremental_gap.setNodeContainer(pancake_nodes);
+    double full = measureThroughput<PancakeState, NumToFlip>({&full_gap}, pancake_batches, false, repetitions);
+    double incremental = measureThroughput<PancakeState, NumToFlip>({&incremental_gap}, pancake_batches, false, repetitions);
+    std::cout << "Pancake 50 (heavy gap), full evals/sec: " << full << ", incremental evals/sec: " << incremental
+              << ", speedup: " << incremental / full << "\n";
+
+    return 0;
+}
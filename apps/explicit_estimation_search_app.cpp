@@ -0,0 +1,106 @@
+#include "building_tools/evaluators/distance_to_go_wrapper_evaluator.h"
+#include "building_tools/goal_tests/single_state_goal_test.h"
+#include "engines/best_first_search/best_first_search.h"
+#include "engines/best_first_search/best_first_search_params.h"
+#include "engines/best_first_search/explicit_estimation_search.h"
+#include "engines/best_first_search/explicit_estimation_search_params.h"
+#include "engines/engine_components/eval_functions/f_cost_evaluator.h"
+#include "engines/engine_components/eval_functions/weighted_f_cost_evaluator.h"
+#include "environments/sliding_tile_puzzle/sliding_tile_action.h"
+#include "environments/sliding_tile_puzzle/sliding_tile_hash_function.h"
+#include "environments/sliding_tile_puzzle/sliding_tile_manhattan_heuristic.h"
+#include "environments/sliding_tile_puzzle/sliding_tile_state.h"
+#include "environments/sliding_tile_puzzle/sliding_tile_transitions.h"
+#include "environments/sliding_tile_puzzle/sliding_tile_utils.h"
+#include "experiment_running/experiment_results.h"
+#include "experiment_running/experiment_runner.h"
+#include "experiment_running/search_resource_limits.h"
+#include "search_basics/search_engine.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+/**
+ * Runs the given engine on all the given start states, and prints the average ratio of its solution costs to the
+ * optimal costs, the average number of evaluations, and the average search time.
+ */
+void printResults(const std::string& engine_name, SearchEngine<SlidingTileState, BlankSlide>& engine,
+          const SlidingTileTransitions& transitions, const SingleStateGoalTest<SlidingTileState>& goal_test,
+          const std::vector<SlidingTileState>& starts, const std::vector<double>& optimal_costs) {
+    SearchResourceLimits limits;
+    std::vector<ExperimentResults<BlankSlide>> results = runExperiments(engine, transitions, goal_test, limits, starts);
+
+    double total_cost_ratio = 0.0;
+    double total_evals = 0.0;
+    double total_seconds = 0.0;
+    for (std::size_t i = 0; i < results.size(); ++i) {
+        total_cost_ratio += results[i].m_plan_cost / optimal_costs[i];
+        total_evals += results[i].m_standard_stats.m_num_evals;
+        total_seconds += results[i].m_standard_stats.m_search_time_seconds;
+    }
+    std::cout << engine_name << ", " << total_cost_ratio / results.size() << ", " << total_evals / results.size() << ", "
+              << total_seconds / results.size() << "\n";
+}
+
+/**
+ * Compares Explicit Estimation Search to weighted A* with the same suboptimality bound, and to Speedy search (greedy
+ * best-first search on distance-to-go), on the 3x4 sliding tile puzzle with heavy and inverse costs. The Manhattan
+ * distance heuristic gives both the cost-to-go and the distance-to-go. Prints the average ratio of each engine's
+ * solution costs to the optimal costs found by A*, the average number of evaluations, and the average search time.
+ */
+int main() {
+    const int num_rows = 3;
+    const int num_cols = 4;
+    const double weight = 2.0;
+
+    std::string problems_file = HSEF_DIR "/apps/input/3x4_puzzle.probs";  // HSEF_DIR is the root directory of the HSEF code
+    std::vector<SlidingTileState> starts = readSlidingTileStatesFromFile(problems_file, num_rows, num_cols);
+    starts.resize(20);
+
+    SlidingTileState goal_state(num_rows, num_cols);
+    SingleStateGoalTest<SlidingTileState> goal_test(goal_state);
+    SlidingTileHashFunction hash_function;
+    SearchResourceLimits limits;
+
+    for (SlidingTileCostType cost_type : {SlidingTileCostType::heavy, SlidingTileCostType::inverse}) {
+        SlidingTileTransitions transitions(num_rows, num_cols, cost_type);
+        SlidingTileManhattanHeuristic heuristic(goal_state, cost_type);
+        std::cout << (cost_type == SlidingTileCostType::heavy ? "Heavy" : "Inverse") << " costs, weight " << weight
+                  << "\nengine, cost ratio, evals, seconds\n";
+
+        BestFirstSearchParams params;
+        params.m_use_reopened = false;
+        BestFirstSearch<SlidingTileState, BlankSlide, uint64_t> a_star(params);
+        FCostEvaluator<SlidingTileState, BlankSlide> f_cost_evaluator(heuristic);
+        a_star.setEvaluator(f_cost_evaluator);
+        a_star.setHashFunction(hash_function);
+        std::vector<double> optimal_costs;
+        for (const auto& result : runExperiments<SlidingTileState, BlankSlide>(a_star, transitions, goal_test, limits, starts)) {
+            optimal_costs.push_back(result.m_plan_cost);
+        }
+
+        BestFirstSearch<SlidingTileState, BlankSlide, uint64_t> weighted_a_star(params);
+        WeightedFCostEvaluator<SlidingTileState, BlankSlide> weighted_f_cost_evaluator(heuristic, weight);
+        weighted_a_star.setEvaluator(weighted_f_cost_evaluator);
+        weighted_a_star.setHashFunction(hash_function);
+        printResults("WeightedAStar", weighted_a_star, transitions, goal_test, starts, optimal_costs);
+
+        ExplicitEstimationSearchParams ees_params;
+        ees_params.m_weight = weight;
+        ExplicitEstimationSearch<SlidingTileState, BlankSlide, uint64_t> ees(ees_params);
+        ees.setHeuristic(heuristic);
+        ees.setHashFunction(hash_function);
+        printResults("ExplicitEstimationSearch", ees, transitions, goal_test, starts, optimal_costs);
+
+        BestFirstSearch<SlidingTileState, BlankSlide, uint64_t> speedy(params);
+        DistanceToGoWrapperEvaluator<SlidingTileState, BlankSlide> distance_evaluator(heuristic);
+        speedy.setEvaluator(distance_evaluator);
+        speedy.setHashFunction(hash_function);
+        printResults("Speedy", speedy, transitions, goal_test, starts, optimal_costs);
+    }
+
+    return 0;
+}
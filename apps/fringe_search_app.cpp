@@ -0,0 +1,87 @@
+#include "engines/best_first_search/best_first_search.h"
+#include "engines/best_first_search/best_first_search_params.h"
+#include "engines/engine_components/eval_functions/f_cost_evaluator.h"
+#include "engines/iterative_deepening/fringe_search.h"
+#include "engines/iterative_deepening/fringe_search_params.h"
+#include "environments/grid_pathfinding/grid_location.h"
+#include "environments/grid_pathfinding/grid_location_hash_function.h"
+#include "environments/grid_pathfinding/grid_map.h"
+#include "environments/grid_pathfinding/grid_pathfinding_action.h"
+#include "environments/grid_pathfinding/grid_pathfinding_octile_heuristic.h"
+#include "environments/grid_pathfinding/grid_pathfinding_scenario_running.h"
+#include "environments/grid_pathfinding/grid_pathfinding_transitions.h"
+#include "experiment_running/experiment_runner.h"
+#include "utils/evaluator_utils.h"
+#include "utils/io_utils.h"
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+/**
+ * Runs the given engine on all the scenarios, and prints the total search time, the number of evaluations, and the
+ * number of solutions whose cost does not match the optimal cost given in the scenario file.
+ */
+void runScenarios(const std::string& name, SearchEngine<GridLocation, GridDirection>& engine,
+          const std::vector<GridPathfindingScenario>& scenarios) {
+    auto base_evals = engine.getBaseEvaluators();
+    auto all_evaluators = getAllEvaluators(base_evals);
+
+    double total_seconds = 0.0;
+    int64_t total_evals = 0;
+    int num_mismatched = 0;
+    for (const auto& scenario : scenarios) {
+        auto result = runExperiment(engine, scenario.m_start_state, scenario.m_goal_state, all_evaluators);
+        total_seconds += result.m_standard_stats.m_search_time_seconds;
+        total_evals += result.m_standard_stats.m_num_evals;
+        if (std::abs(result.m_plan_cost - scenario.m_octile_optimal_cost) > 1e-3) {
+            num_mismatched++;
+        }
+    }
+
+    std::cout << name << ", scenarios: " << scenarios.size() << ", mismatched costs: " << num_mismatched
+              << ", evals: " << total_evals << ", seconds: " << total_seconds << "\n";
+}
+
+int main() {
+    // Compares fringe search and A* on a MovingAI benchmark scenario set, with the octile heuristic on an
+    // eight-connected grid. See https://movingai.com/benchmarks/grids.html
+    std::string scenario_file = HSEF_DIR "/apps/input/arena2.map.scen";
+    std::string map_dir = HSEF_DIR "/apps/input/";
+    std::vector<GridPathfindingScenario> scenarios = loadScenarioFile(scenario_file, map_dir);
+
+    // All the scenarios in the file are on the same map
+    std::string map_str = loadFileIntoStringSteam(scenarios[0].m_map_path).str();
+    std::stringstream map_info(map_str.substr(map_str.find('\n') + 1));  // Removes the 'type octile' line
+    GridMap map(map_info);
+    GridPathfindingTransitions transitions(&map, GridConnectionType::eight);
+
+    // Gives one hash value, and so one fringe search cell, per grid location
+    GridLocationHashFunction hash_func;
+    hash_func.setMapWidth(transitions);
+
+    GridPathfindingOctileHeuristic a_star_heuristic;
+    FCostEvaluator<GridLocation, GridDirection> f_cost_evaluator(a_star_heuristic);
+    BestFirstSearchParams a_star_params;
+    a_star_params.m_use_reopened = false;
+    BestFirstSearch<GridLocation, GridDirection, uint32_t> a_star(a_star_params);
+    a_star.setEvaluator(f_cost_evaluator);
+    a_star.setHashFunction(hash_func);
+    a_star.setTransitionSystem(transitions);
+    runScenarios("A*", a_star, scenarios);
+
+    GridPathfindingOctileHeuristic fringe_heuristic;
+    FringeSearchParams fringe_params;
+    fringe_params.m_num_cells = static_cast<std::size_t>(map.getWidth()) * static_cast<std::size_t>(map.getHeight());
+    FringeSearch<GridLocation, GridDirection, uint32_t> fringe(fringe_params);
+    fringe.setHeuristic(fringe_heuristic);
+    fringe.setHashFunction(hash_func);
+    fringe.setTransitionSystem(transitions);
+    runScenarios("Fringe", fringe, scenarios);
+
+    return 0;
+}
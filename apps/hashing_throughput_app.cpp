@@ -0,0 +1,265 @@
+#include "building_tools/hashing/hash_128.h"
+#include "building_tools/hashing/permutation_hash_function.h"
+#include "building_tools/hashing/serialized_state_hash_function.h"
+#include "building_tools/hashing/signed_permutation_hash_function.h"
+#include "building_tools/hashing/state_string_hash_function.h"
+#include "environments/burnt_pancake_puzzle/burnt_pancake_state.h"
+#include "environments/k_ary_tree/k_ary_tree_action.h"
+#include "environments/k_ary_tree/k_ary_tree_state.h"
+#include "environments/pancake_puzzle/pancake_action.h"
+#include "environments/pancake_puzzle/pancake_state.h"
+#include "environments/pancake_puzzle/pancake_transitions.h"
+#include "environments/pancake_puzzle/pancake_zobrist_hash_function.h"
+#include "environments/sliding_tile_puzzle/sliding_tile_action.h"
+#include "environments/sliding_tile_puzzle/sliding_tile_state.h"
+#include "environments/sliding_tile_puzzle/sliding_tile_transitions.h"
+#include "environments/sliding_tile_puzzle/sliding_tile_zobrist_hash_function.h"
+#include "search_basics/transition_system.h"
+#include "utils/combinatorics.h"
+#include "utils/timer.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+/**
+ * Calculates the rank of the given permutation the way it was calculated before the linear-time ranking, by copying
+ * the permutation and updating all later entries after each one is ranked. Used as a baseline.
+ */
+uint64_t getQuadraticPermutationRank(const std::vector<int>& permutation) {
+    std::vector<int> perm = permutation;
+    auto num_left = static_cast<unsigned>(perm.size());
+    uint64_t hash_value = 0;
+    for (unsigned i = 0; i < perm.size(); i++) {
+        hash_value += perm[i] * get64BitFactorial(num_left - 1);
+        num_left--;
+        for (unsigned j = i + 1; j < perm.size(); j++) {
+            if (perm[j] > perm[i]) {
+                perm[j]--;
+            }
+        }
+    }
+    return hash_value;
+}
+
+/**
+ * Hashes every state using the given function and returns the number of hashes per second. The sum of the hash values
+ * is written to the given checksum so that the hashing cannot be optimized away.
+ */
+template<class State_t, class HashFunction_t>
+double measureHashThroughput(const std::vector<State_t>& states, HashFunction_t hash_function, int repetitions,
+          uint64_t& checksum) {
+    Timer timer;
+    std::size_t num_hashes = 0;
+    timer.startTimer();
+
+    for (int rep = 0; rep < repetitions; ++rep) {
+        for (const State_t& state : states) {
+            checksum += hash_function(state);
+        }
+        num_hashes += states.size();
+    }
+    timer.endTimer();
+    return static_cast<double>(num_hashes) / timer.getLastTimePeriodDuration();
+}
+
+/**
+ * A step of a random walk, given by the parent state and the action applied to it.
+ */
+template<class State_t, class Action_t>
+struct WalkStep {
+    State_t m_parent;  ///< The parent state
+    Action_t m_action;  ///< The action applied to the parent
+    State_t m_child;  ///< The resulting child state
+};
+
+/**
+ * Generates a random walk of the given length from the given state.
+ */
+template<class State_t, class Action_t>
+std::vector<WalkStep<State_t, Action_t>> generateRandomWalk(const TransitionSystem<State_t, Action_t>& transitions,
+          State_t state, int num_steps, std::mt19937& rand_gen) {
+    std::vector<WalkStep<State_t, Action_t>> walk;
+    for (int i = 0; i < num_steps; ++i) {
+        std::vector<Action_t> actions = transitions.getActions(state);
+        Action_t action = actions[std::uniform_int_distribution<std::size_t>(0, actions.size() - 1)(rand_gen)];
+        State_t child = transitions.getChildState(state, action);
+        walk.push_back({state, action, child});
+        state = child;
+    }
+    return walk;
+}
+
+/**
+ * Prints the throughput of hashing the children along the given walk from scratch with the permutation hash function,
+ * from scratch with the Zobrist hash function, and incrementally with the Zobrist hash function. Also prints the number
+ * of distinct states along the walk next to the number of distinct 64-bit and 32-bit Zobrist hash values, to show how
+ * many collisions there are.
+ */
+template<class State_t, class Action_t, class Zobrist_t>
+void compareZobristHashing(const std::string& domain_name, const std::vector<WalkStep<State_t, Action_t>>& walk,
+          const Zobrist_t& zobrist, int repetitions, uint64_t& checksum) {
+    PermutationHashFunction<State_t> perm_hash;
+    std::vector<State_t> children;
+    std::vector<uint64_t> parent_hashes;
+    for (const auto& step : walk) {
+        children.push_back(step.m_child);
+        parent_hashes.push_back(zobrist.getHashValue(step.m_parent));
+    }
+
+    double perm = measureHashThroughput(children, [&perm_hash](const State_t& state) { return perm_hash.getHashValue(state); },
+              repetitions, checksum);
+    double full = measureHashThroughput(children, [&zobrist](const State_t& state) { return zobrist.getHashValue(state); },
+              repetitions, checksum);
+
+    Timer timer;
+    timer.startTimer();
+    for (int rep = 0; rep < repetitions; ++rep) {
+        for (std::size_t i = 0; i < walk.size(); ++i) {
+            checksum += zobrist.getChildHash(parent_hashes[i], walk[i].m_parent, walk[i].m_action);
+        }
+    }
+    timer.endTimer();
+    double incremental = static_cast<double>(walk.size() * repetitions) / timer.getLastTimePeriodDuration();
+
+    std::unordered_set<uint64_t> distinct_states;
+    std::unordered_set<uint64_t> distinct_hashes;
+    std::unordered_set<uint32_t> distinct_32_bit_hashes;
+    for (const State_t& child : children) {
+        uint64_t hash_value = zobrist.getHashValue(child);
+        distinct_states.insert(perm_hash.getHashValue(child));
+        distinct_hashes.insert(hash_value);
+        distinct_32_bit_hashes.insert(static_cast<uint32_t>(hash_value));
+    }
+
+    std::cout << domain_name << ", permutation hashes/sec: " << perm << ", Zobrist hashes/sec: " << full
+              << ", incremental Zobrist hashes/sec: " << incremental << ", speedup: " << incremental / perm
+              << ", distinct states: " << distinct_states.size() << ", distinct 64-bit hashes: " << distinct_hashes.size()
+              << ", distinct 32-bit hashes: " << distinct_32_bit_hashes.size() << "\n";
+}
+
+/**
+ * Prints the throughput of the string hash function and the 64-bit and 128-bit serialized state hash functions on the
+ * given states, and the average number of bytes used by each hash key.
+ */
+template<class State_t>
+void compareSerializedHashing(const std::string& domain_name, const std::vector<State_t>& states, int repetitions,
+          uint64_t& checksum) {
+    StateStringHashFunction<State_t> string_hash;
+    SerializedStateHashFunction<State_t> serialized_hash;
+    SerializedStateHashFunction<State_t, Hash128> serialized_hash_128;
+
+    double string_hashes = measureHashThroughput(states,
+              [&string_hash](const State_t& state) { return string_hash.getHashValue(state).size(); }, repetitions, checksum);
+    double serialized_hashes = measureHashThroughput(states,
+              [&serialized_hash](const State_t& state) { return serialized_hash.getHashValue(state); }, repetitions, checksum);
+    double serialized_hashes_128 = measureHashThroughput(states,
+              [&serialized_hash_128](const State_t& state) { return serialized_hash_128.getHashValue(state).m_low; },
+              repetitions, checksum);
+
+    // Strings longer than the small string buffer also use a heap allocation of their capacity
+    std::size_t string_key_bytes = 0;
+    for (const State_t& state : states) {
+        std::string key = string_hash.getHashValue(state);
+        string_key_bytes += sizeof(std::string);
+        if (key.capacity() > std::string().capacity()) {
+            string_key_bytes += key.capacity() + 1;
+        }
+    }
+
+    std::cout << domain_name << ", string hashes/sec: " << string_hashes << ", serialized hashes/sec: " << serialized_hashes
+              << ", serialized 128-bit hashes/sec: " << serialized_hashes_128 << ", speedup: " << serialized_hashes / string_hashes
+              << ", string key bytes: " << static_cast<double>(string_key_bytes) / static_cast<double>(states.size())
+              << ", serialized key bytes: " << sizeof(uint64_t) << ", serialized 128-bit key bytes: " << sizeof(Hash128) << "\n";
+}
+
+int main() {
+    const int num_states = 100000;
+    const int repetitions = 20;
+    std::mt19937 rand_gen(42);
+    uint64_t checksum = 0;
+
+    for (unsigned size : {12U, 16U, 20U}) {
+        std::vector<PancakeState> states;
+        for (int i = 0; i < num_states; ++i) {
+            states.emplace_back(getRandomPermutation(size, rand_gen));
+        }
+
+        PermutationHashFunction<PancakeState> hash_function;
+        double quadratic = measureHashThroughput(states,
+                  [](const PancakeState& state) { return getQuadraticPermutationRank(state.m_permutation); },
+                  repetitions, checksum);
+        double linear = measureHashThroughput(states,
+                  [&hash_function](const PancakeState& state) { return hash_function.getHashValue(state); },
+                  repetitions, checksum);
+
+        std::cout << "Permutation " << size << ", quadratic hashes/sec: " << quadratic << ", linear hashes/sec: " << linear
+                  << ", speedup: " << linear / quadratic << "\n";
+    }
+
+    for (unsigned size : {12U, 16U}) {
+        std::vector<BurntPancakeState> states;
+        std::uniform_int_distribution<int> sign_dist(0, 1);
+        for (int i = 0; i < num_states; ++i) {
+            std::vector<int> perm = getRandomPermutation(size, rand_gen);
+            for (int& value : perm) {
+                value = sign_dist(rand_gen) == 0 ? value + 1 : -(value + 1);
+            }
+            states.emplace_back(perm);
+        }
+
+        SignedPermutationHashFunction<BurntPancakeState> hash_function;
+        double signed_hashes = measureHashThroughput(states,
+                  [&hash_function](const BurntPancakeState& state) { return hash_function.getHashValue(state); },
+                  repetitions, checksum);
+        std::cout << "Signed permutation " << size << ", hashes/sec: " << signed_hashes << "\n";
+    }
+
+    SlidingTileTransitions tile_transitions(4, 4);
+    auto tile_walk = generateRandomWalk(tile_transitions, SlidingTileState(4, 4), num_states * 10, rand_gen);
+    SlidingTileZobristHashFunction<> tile_zobrist(4, 4);
+    compareZobristHashing("Sliding tile 4x4", tile_walk, tile_zobrist, repetitions, checksum);
+
+    PancakeTransitions pancake_transitions(16);
+    auto pancake_walk = generateRandomWalk(pancake_transitions, PancakeState(getRandomPermutation(16, rand_gen)),
+              num_states * 10, rand_gen);
+    PancakeZobristHashFunction<> pancake_zobrist(16);
+    compareZobristHashing("Pancake 16", pancake_walk, pancake_zobrist, repetitions, checksum);
+
+    SlidingTileZobristHashFunction<Hash128> tile_zobrist_128(4, 4);
+    Hash128 parent_hash = tile_zobrist_128.getHashValue(tile_walk[0].m_parent);
+    Timer timer;
+    timer.startTimer();
+    for (const auto& step : tile_walk) {
+        parent_hash = tile_zobrist_128.getChildHash(parent_hash, step.m_parent, step.m_action);
+    }
+    timer.endTimer();
+    checksum += parent_hash.m_low;
+    std::cout << "Sliding tile 4x4, incremental 128-bit Zobrist hashes/sec: "
+              << static_cast<double>(tile_walk.size()) / timer.getLastTimePeriodDuration() << "\n";
+
+    std::vector<KAryTreeState> tree_states;
+    std::uniform_int_distribution<int> depth_dist(0, 30);
+    std::uniform_int_distribution<KAryTreeAction> action_dist(0, 3);
+    for (int i = 0; i < num_states; ++i) {
+        std::vector<KAryTreeAction> actions(static_cast<std::size_t>(depth_dist(rand_gen)));
+        for (KAryTreeAction& action : actions) {
+            action = action_dist(rand_gen);
+        }
+        tree_states.emplace_back(actions);
+    }
+    compareSerializedHashing("K-ary tree (k = 4, depth <= 30)", tree_states, repetitions, checksum);
+
+    std::vector<PancakeState> pancake_states;
+    for (int i = 0; i < num_states; ++i) {
+        pancake_states.emplace_back(getRandomPermutation(16, rand_gen));
+    }
+    compareSerializedHashing("Pancake 16", pancake_states, repetitions, checksum);
+
+    std::cout << "Checksum: " << checksum << "\n";
+    return 0;
+}
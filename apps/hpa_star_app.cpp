@@ -0,0 +1,114 @@
+#include "building_tools/goal_tests/single_state_goal_test.h"
+#include "engines/best_first_search/best_first_search.h"
+#include "engines/best_first_search/best_first_search_params.h"
+#include "engines/engine_components/eval_functions/f_cost_evaluator.h"
+#include "environments/grid_pathfinding/grid_cluster_abstraction.h"
+#include "environments/grid_pathfinding/grid_location.h"
+#include "environments/grid_pathfinding/grid_location_hash_function.h"
+#include "environments/grid_pathfinding/grid_map.h"
+#include "environments/grid_pathfinding/grid_pathfinding_action.h"
+#include "environments/grid_pathfinding/grid_pathfinding_octile_heuristic.h"
+#include "environments/grid_pathfinding/grid_pathfinding_scenario_running.h"
+#include "environments/grid_pathfinding/grid_pathfinding_transitions.h"
+#include "utils/io_utils.h"
+#include "utils/plan_and_path_utils.h"
+#include "utils/timer.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+/**
+ * Compares HPA* with different cluster sizes to A* on a MovingAI benchmark scenario set, with an eight-connected grid.
+ * For HPA*, prints the time to build the abstraction with one thread and with all available threads, the size of the
+ * saved abstraction, the average time to find and refine a path, and how much more the paths cost than the optimal
+ * costs given in the scenario file. See https://movingai.com/benchmarks/grids.html
+ */
+int main() {
+    std::string scenario_file = HSEF_DIR "/apps/input/arena2.map.scen";
+    std::string map_dir = HSEF_DIR "/apps/input/";
+    std::vector<GridPathfindingScenario> scenarios = loadScenarioFile(scenario_file, map_dir);
+
+    // All the scenarios in the file are on the same map
+    std::string map_str = loadFileIntoStringSteam(scenarios[0].m_map_path).str();
+    std::stringstream map_info(map_str.substr(map_str.find('\n') + 1));  // Removes the 'type octile' line
+    GridMap map(map_info);
+    GridPathfindingTransitions transitions(&map, GridConnectionType::eight);
+    GridLocationHashFunction hash_func;
+    hash_func.setMapWidth(transitions);
+    Timer timer;
+
+    GridPathfindingOctileHeuristic a_star_heuristic;
+    FCostEvaluator<GridLocation, GridDirection> f_cost_evaluator(a_star_heuristic);
+    BestFirstSearchParams a_star_params;
+    a_star_params.m_use_reopened = false;
+    BestFirstSearch<GridLocation, GridDirection, uint32_t> a_star(a_star_params);
+    a_star.setEvaluator(f_cost_evaluator);
+    a_star.setHashFunction(hash_func);
+    a_star.setTransitionSystem(transitions);
+
+    double a_star_seconds = 0.0;
+    for (const auto& scenario : scenarios) {
+        SingleStateGoalTest<GridLocation> goal_test(scenario.m_goal_state);
+        a_star_heuristic.setGoalState(scenario.m_goal_state);
+        a_star.setGoalTest(goal_test);
+        timer.startTimer();
+        a_star.searchForPlan(scenario.m_start_state);
+        timer.endTimer();
+        a_star_seconds += timer.getLastTimePeriodDuration();
+    }
+    std::cout << "A*, scenarios: " << scenarios.size() << ", average query seconds: " << a_star_seconds / scenarios.size()
+              << "\n";
+
+    unsigned num_threads = std::max(1u, std::thread::hardware_concurrency());
+    for (int cluster_size : {8, 16, 32}) {
+        GridClusterAbstraction abstraction(transitions, cluster_size);
+        timer.startTimer();
+        abstraction.build(1);
+        timer.endTimer();
+        double serial_build_seconds = timer.getLastTimePeriodDuration();
+
+        timer.startTimer();
+        abstraction.build(num_threads);
+        timer.endTimer();
+        double parallel_build_seconds = timer.getLastTimePeriodDuration();
+
+        std::ostringstream saved;
+        abstraction.save(saved);
+
+        double query_seconds = 0.0;
+        double total_suboptimality = 0.0;
+        double max_suboptimality = 1.0;
+        int num_invalid = 0;
+        for (const auto& scenario : scenarios) {
+            timer.startTimer();
+            GridAbstractPath path = abstraction.findAbstractPath(scenario.m_start_state, scenario.m_goal_state);
+            std::vector<GridDirection> plan = abstraction.refinePath(path);
+            timer.endTimer();
+            query_seconds += timer.getLastTimePeriodDuration();
+
+            SingleStateGoalTest<GridLocation> goal_test(scenario.m_goal_state);
+            if (!path.m_found_path || !checkSolutionPlan(scenario.m_start_state, plan, transitions, goal_test).m_is_valid) {
+                num_invalid++;
+                continue;
+            }
+            double suboptimality = scenario.m_octile_optimal_cost > 0.0 ? path.m_cost / scenario.m_octile_optimal_cost : 1.0;
+            total_suboptimality += suboptimality;
+            max_suboptimality = std::max(max_suboptimality, suboptimality);
+        }
+
+        std::cout << "HPA* cluster size " << cluster_size << ", vertices: " << abstraction.getNumVertices()
+                  << ", edges: " << abstraction.getNumEdges() << ", saved bytes: " << saved.str().size() << "\n";
+        std::cout << "    build seconds with 1 thread: " << serial_build_seconds << ", with " << num_threads
+                  << " threads: " << parallel_build_seconds << "\n";
+        std::cout << "    average query seconds: " << query_seconds / scenarios.size() << ", invalid paths: " << num_invalid
+                  << ", average suboptimality: " << total_suboptimality / (scenarios.size() - num_invalid)
+                  << ", max suboptimality: " << max_suboptimality << "\n";
+    }
+
+    return 0;
+}
@@ -0,0 +1,102 @@
+#include "building_tools/goal_tests/single_state_goal_test.h"
+#include "building_tools/hashing/permutation_hash_selection.h"
+#include "building_tools/hashing/state_string_hash_function.h"
+#include "engines/best_first_search/best_first_search.h"
+#include "engines/best_first_search/best_first_search_params.h"
+#include "engines/engine_components/eval_functions/f_cost_evaluator.h"
+#include "environments/pancake_puzzle/gap_heuristic.h"
+#include "environments/pancake_puzzle/pancake_action.h"
+#include "environments/pancake_puzzle/pancake_state.h"
+#include "environments/pancake_puzzle/pancake_transitions.h"
+#include "environments/sliding_tile_puzzle/sliding_tile_action.h"
+#include "environments/sliding_tile_puzzle/sliding_tile_manhattan_heuristic.h"
+#include "environments/sliding_tile_puzzle/sliding_tile_state.h"
+#include "environments/sliding_tile_puzzle/sliding_tile_transitions.h"
+#include "search_basics/node_evaluator.h"
+#include "search_basics/transition_system.h"
+#include "utils/timer.h"
+
+#include <cstddef>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+/**
+ * Scrambles the given state with a random walk of the given length.
+ */
+template<class State_t, class Action_t>
+State_t getRandomWalkState(const TransitionSystem<State_t, Action_t>& transitions, State_t state, int walk_length,
+          std::mt19937& rand_gen) {
+    for (int i = 0; i < walk_length; ++i) {
+        std::vector<Action_t> actions = transitions.getActions(state);
+        std::uniform_int_distribution<std::size_t> dist(0, actions.size() - 1);
+        transitions.applyAction(state, actions[dist(rand_gen)]);
+    }
+    return state;
+}
+
+/**
+ * Runs A* with the given heuristic and hash function on the given instance, and prints the solution cost, the number
+ * of nodes generated, and the number of nodes generated per second.
+ */
+template<class State_t, class Action_t, class HashFunction_t>
+void runAStar(const std::string& domain_name, const TransitionSystem<State_t, Action_t>& transitions,
+          NodeEvaluator<State_t, Action_t>& heuristic, const HashFunction_t& hash_function, const State_t& start_state,
+          const State_t& goal_state) {
+    using Hash_t = decltype(hash_function.getHashValue(start_state));
+
+    SingleStateGoalTest<State_t> goal_test(goal_state);
+    FCostEvaluator<State_t, Action_t> f_cost_evaluator(heuristic);
+
+    BestFirstSearchParams params;
+    BestFirstSearch<State_t, Action_t, Hash_t> engine(params);
+    engine.setEvaluator(f_cost_evaluator);
+    engine.setTransitionSystem(transitions);
+    engine.setGoalTest(goal_test);
+    engine.setHashFunction(hash_function);
+
+    Timer timer;
+    timer.startTimer();
+    engine.searchForPlan(start_state);
+    timer.endTimer();
+
+    std::size_t num_nodes = engine.getNodes().size();
+    std::cout << domain_name << " A* (" << hash_function.getName() << "), solution cost: " << engine.getLastSolutionPlanCost()
+              << ", nodes: " << num_nodes << ", nodes/sec: " << static_cast<double>(num_nodes) / timer.getLastTimePeriodDuration()
+              << "\n";
+}
+
+int main() {
+    std::mt19937 tile_rand_gen(42);
+    SlidingTileState tile_goal(5, 5);
+    SlidingTileTransitions tile_transitions(5, 5);
+    SlidingTileState tile_start = getRandomWalkState(tile_transitions, tile_goal, 150, tile_rand_gen);
+    SlidingTileManhattanHeuristic manhattan(tile_goal, SlidingTileCostType::unit);
+
+    std::cout << "24-puzzle hash type: " << getPermutationHashType(25, false) << "\n";
+    runAStar(std::string("24-puzzle"), tile_transitions, manhattan, StateStringHashFunction<SlidingTileState>(), tile_start,
+              tile_goal);
+    callWithPermutationHashFunction<SlidingTileState>(25, false, [&](const auto& hash_function) {
+        runAStar(std::string("24-puzzle"), tile_transitions, manhattan, hash_function, tile_start, tile_goal);
+    });
+
+    std::mt19937 pancake_rand_gen(42);
+    const unsigned num_pancakes = 40;
+    std::vector<Pancake> pancake_goal_perm(num_pancakes);
+    std::iota(pancake_goal_perm.begin(), pancake_goal_perm.end(), 0);
+    PancakeState pancake_goal(pancake_goal_perm);
+    PancakeTransitions pancake_transitions(num_pancakes);
+    PancakeState pancake_start = getRandomWalkState(pancake_transitions, pancake_goal, 16, pancake_rand_gen);
+    GapHeuristic gap;
+
+    std::cout << "40-pancake hash type: " << getPermutationHashType(num_pancakes, false) << "\n";
+    runAStar(std::string("40-pancake"), pancake_transitions, gap, StateStringHashFunction<PancakeState>(), pancake_start,
+              pancake_goal);
+    callWithPermutationHashFunction<PancakeState>(num_pancakes, false, [&](const auto& hash_function) {
+        runAStar(std::string("40-pancake"), pancake_transitions, gap, hash_function, pancake_start, pancake_goal);
+    });
+
+    return 0;
+}
@@ -0,0 +1,101 @@
+#include "building_tools/goal_tests/single_state_goal_test.h"
+#include "engines/real_time/lss_lrta_star.h"
+#include "engines/real_time/lss_lrta_star_params.h"
+#include "environments/grid_pathfinding/grid_location.h"
+#include "environments/grid_pathfinding/grid_location_hash_function.h"
+#include "environments/grid_pathfinding/grid_map.h"
+#include "environments/grid_pathfinding/grid_pathfinding_action.h"
+#include "environments/grid_pathfinding/grid_pathfinding_octile_heuristic.h"
+#include "environments/grid_pathfinding/grid_pathfinding_scenario_running.h"
+#include "environments/grid_pathfinding/grid_pathfinding_transitions.h"
+#include "utils/io_utils.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+/**
+ * For a sample of the arena2 benchmark scenarios, runs LSS-LRTA* trials with several lookahead sizes until the learned
+ * heuristic converges. For each lookahead size, prints the suboptimality of the first trial, the 50th and 99th
+ * percentiles and maximum of the time taken per move in the first trial, and the average number of trials to
+ * convergence. The lookahead of one expansion is LRTA*.
+ */
+int main() {
+    const int num_scenarios = 10;
+    const int max_trials = 100;
+    std::mt19937 rand_gen(42);
+
+    std::string scenario_file = HSEF_DIR "/apps/input/arena2.map.scen";
+    std::string map_dir = HSEF_DIR "/apps/input/";
+    std::vector<GridPathfindingScenario> scenarios = loadScenarioFile(scenario_file, map_dir);
+
+    std::string map_str = loadFileIntoStringSteam(scenarios[0].m_map_path).str();
+    std::stringstream map_info(map_str.substr(map_str.find('\n') + 1));  // Removes the 'type octile' line
+    GridMap map(map_info);
+    GridPathfindingTransitions transitions(&map, GridConnectionType::eight);
+    GridLocationHashFunction hash_func;
+    hash_func.setMapWidth(transitions);
+
+    std::vector<GridPathfindingScenario> sample;
+    std::uniform_int_distribution<std::size_t> scenario_dist(0, scenarios.size() - 1);
+    while (static_cast<int>(sample.size()) < num_scenarios) {
+        const GridPathfindingScenario& scenario = scenarios[scenario_dist(rand_gen)];
+        if (scenario.m_octile_optimal_cost > 0.0) {
+            sample.push_back(scenario);
+        }
+    }
+
+    std::cout << "lookahead, first trial suboptimality, p50 move us, p99 move us, max move us, trials to converge\n";
+    for (int64_t lookahead : {1, 4, 16, 64, 256, 1024}) {
+        LssLrtaStarParams params;
+        params.m_lookahead_expansions = lookahead;
+        params.m_max_moves_per_trial = 100000;
+        LssLrtaStar<GridLocation, GridDirection, uint32_t> engine(params);
+        GridPathfindingOctileHeuristic heuristic;
+        engine.setTransitionSystem(transitions);
+        engine.setHeuristic(heuristic);
+        engine.setHashFunction(hash_func);
+
+        double total_suboptimality = 0.0;
+        std::vector<double> first_trial_latencies;
+        int total_trials = 0;
+        int num_unconverged = 0;
+        for (const GridPathfindingScenario& scenario : sample) {
+            SingleStateGoalTest<GridLocation> goal_test(scenario.m_goal_state);
+            heuristic.setGoalState(scenario.m_goal_state);
+            engine.setGoalTest(goal_test);
+            engine.clearLearnedHeuristic();
+
+            engine.searchForPlan(scenario.m_start_state);
+            total_suboptimality += engine.getLastSolutionPlanCost() / scenario.m_octile_optimal_cost;
+            first_trial_latencies.insert(first_trial_latencies.end(), engine.getMoveLatencies().begin(),
+                      engine.getMoveLatencies().end());
+            while (!engine.hasConverged() && engine.getNumTrials() < max_trials) {
+                engine.searchForPlan(scenario.m_start_state);
+            }
+            total_trials += engine.getNumTrials();
+            if (!engine.hasConverged()) {
+                num_unconverged++;
+            }
+        }
+
+        std::sort(first_trial_latencies.begin(), first_trial_latencies.end());
+        auto percentile = [&first_trial_latencies](double fraction) {
+            return first_trial_latencies[static_cast<std::size_t>(fraction * (first_trial_latencies.size() - 1))] * 1e6;
+        };
+        std::cout << lookahead << ", " << total_suboptimality / num_scenarios << ", " << percentile(0.5) << ", "
+                  << percentile(0.99) << ", " << percentile(1.0) << ", "
+                  << static_cast<double>(total_trials) / num_scenarios;
+        if (num_unconverged > 0) {
+            std::cout << " (" << num_unconverged << " stopped at " << max_trials << ")";
+        }
+        std::cout << "\n";
+    }
+
+    return 0;
+}
@@ -0,0 +1,80 @@
+#include "building_tools/goal_tests/single_state_goal_test.h"
+#include "engines/best_first_search/best_first_search.h"
+#include "engines/best_first_search/best_first_search_params.h"
+#include "engines/engine_components/eval_functions/f_cost_evaluator.h"
+#include "engines/engine_components/node_containers/node_list.h"
+#include "engines/engine_components/node_containers/ranked_node_list.h"
+#include "environments/sliding_tile_puzzle/sliding_tile_action.h"
+#include "environments/sliding_tile_puzzle/sliding_tile_hash_function.h"
+#include "environments/sliding_tile_puzzle/sliding_tile_manhattan_heuristic.h"
+#include "environments/sliding_tile_puzzle/sliding_tile_state.h"
+#include "environments/sliding_tile_puzzle/sliding_tile_transitions.h"
+#include "utils/timer.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <optional>
+#include <random>
+#include <string>
+#include <vector>
+
+/**
+ * Gets the number of bytes each node needs for the values that every node container stores besides the state.
+ */
+std::size_t getNodeValueBytes() {
+    return sizeof(std::optional<BlankSlide>) + sizeof(double) + sizeof(NodeID) + sizeof(double);
+}
+
+/**
+ * Runs A* with the Manhattan distance heuristic on the given 15-puzzle instance using the given node container type,
+ * and prints the number of nodes stored, an estimate of the bytes needed per node by the node container, and the
+ * number of nodes generated per second.
+ */
+template<class NodeContainer_t>
+void runAStar(const std::string& container_name, const SlidingTileState& start_state, std::size_t bytes_per_state) {
+    SlidingTileState goal_state(4, 4);
+    SingleStateGoalTest<SlidingTileState> goal_test(goal_state);
+    SlidingTileTransitions transitions(4, 4);
+    SlidingTileHashFunction hash_function;
+    SlidingTileManhattanHeuristic heuristic(goal_state, SlidingTileCostType::unit);
+    FCostEvaluator<SlidingTileState, BlankSlide> f_cost_evaluator(heuristic);
+
+    BestFirstSearchParams params;
+    BestFirstSearch<SlidingTileState, BlankSlide, uint64_t, NodeContainer_t> engine(params);
+    engine.setEvaluator(f_cost_evaluator);
+    engine.setTransitionSystem(transitions);
+    engine.setGoalTest(goal_test);
+    engine.setHashFunction(hash_function);
+
+    Timer timer;
+    timer.startTimer();
+    engine.searchForPlan(start_state);
+    timer.endTimer();
+
+    std::size_t num_nodes = engine.getNodes().size();
+    std::cout << "15-puzzle A* (" << container_name << "), solution cost: " << engine.getLastSolutionPlanCost()
+              << ", nodes: " << num_nodes << ", bytes/node: " << bytes_per_state + getNodeValueBytes()
+              << ", nodes/sec: " << static_cast<double>(num_nodes) / timer.getLastTimePeriodDuration() << "\n";
+}
+
+int main() {
+    const int walk_length = 200;
+    std::mt19937 rand_gen(42);
+
+    // Scrambles the goal with a random walk to get an instance that A* can solve quickly
+    SlidingTileTransitions transitions(4, 4);
+    SlidingTileState start_state(4, 4);
+    for (int i = 0; i < walk_length; ++i) {
+        std::vector<BlankSlide> actions = transitions.getActions(start_state);
+        std::uniform_int_distribution<std::size_t> dist(0, actions.size() - 1);
+        transitions.applyAction(start_state, actions[dist(rand_gen)]);
+    }
+
+    // A NodeList stores the state object and its heap-allocated permutation, a RankedNodeList only the rank
+    std::size_t state_bytes = sizeof(SlidingTileState) + start_state.m_permutation.size() * sizeof(Tile);
+    runAStar<NodeList<SlidingTileState, BlankSlide>>("NodeList", start_state, state_bytes);
+    runAStar<RankedNodeList<SlidingTileState, BlankSlide>>("RankedNodeList", start_state, sizeof(uint64_t));
+
+    return 0;
+}
@@ -0,0 +1,116 @@
+#include "building_tools/goal_tests/single_state_goal_test.h"
+#include "building_tools/hashing/permutation_hash_selection.h"
+#include "engines/best_first_search/best_first_search.h"
+#include "engines/best_first_search/best_first_search_params.h"
+#include "engines/best_first_search/partial_expansion_a_star.h"
+#include "engines/best_first_search/partial_expansion_a_star_params.h"
+#include "engines/engine_components/eval_functions/f_cost_evaluator.h"
+#include "engines/engine_components/open_lists/evaluator_and_comparing_usage.h"
+#include "environments/pancake_puzzle/gap_heuristic.h"
+#include "environments/pancake_puzzle/gap_operator_selection_function.h"
+#include "environments/pancake_puzzle/pancake_action.h"
+#include "environments/pancake_puzzle/pancake_state.h"
+#include "environments/pancake_puzzle/pancake_transitions.h"
+#include "utils/timer.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <iostream>
+#include <numeric>
+#include <optional>
+#include <random>
+#include <string>
+#include <vector>
+
+/**
+ * Gets an estimate of the number of megabytes used to store the given number of pancake puzzle nodes, counting the
+ * state with its permutation, the values stored with each node, and the node's entry in the hash map.
+ */
+double getNodeMegabytes(std::size_t num_nodes, std::size_t num_pancakes, std::size_t hash_bytes) {
+    std::size_t node_bytes = sizeof(PancakeState) + num_pancakes * sizeof(Pancake) + sizeof(std::optional<NumToFlip>) +
+                             2 * sizeof(double) + sizeof(NodeID) + hash_bytes + sizeof(NodeID);
+    return static_cast<double>(num_nodes * node_bytes) / (1024.0 * 1024.0);
+}
+
+/**
+ * Prints the solution cost, number of stored nodes, estimated memory, and time of the given engine's last search.
+ */
+template<class Engine_t>
+void printResults(const std::string& name, const Engine_t& engine, double seconds, std::size_t num_pancakes, std::size_t hash_bytes) {
+    std::size_t num_nodes = engine.getNodes().size();
+    std::cout << "  " << name << ", solution cost: " << engine.getLastSolutionPlanCost() << ", stored nodes: " << num_nodes
+              << ", MB: " << getNodeMegabytes(num_nodes, num_pancakes, hash_bytes)
+              << ", evals: " << engine.getStandardEngineStatistics().m_num_evals << ", seconds: " << seconds << "\n";
+}
+
+/**
+ * Solves the given pancake instance with A*, PEA*, and EPEA* using the gap heuristic and the given hash function.
+ */
+template<class HashFunction_t>
+void runInstance(const PancakeState& start_state, const PancakeState& goal_state, const HashFunction_t& hash_function) {
+    using Hash_t = decltype(hash_function.getHashValue(start_state));
+    std::size_t num_pancakes = start_state.m_permutation.size();
+
+    PancakeTransitions transitions(static_cast<int>(num_pancakes));
+    SingleStateGoalTest<PancakeState> goal_test(goal_state);
+    Timer timer;
+
+    GapHeuristic a_star_heuristic;
+    FCostEvaluator<PancakeState, NumToFlip> f_cost_evaluator(a_star_heuristic);
+    BestFirstSearchParams bfs_params;
+    BestFirstSearch<PancakeState, NumToFlip, Hash_t> a_star(bfs_params);
+    // Breaks ties towards a low heuristic value, as partial expansion A* does
+    EvalsAndUsageVec<PancakeState, NumToFlip> a_star_evals;
+    a_star_evals.emplace_back(f_cost_evaluator, true);
+    a_star_evals.emplace_back(a_star_heuristic, true);
+    a_star.setEvaluators(a_star_evals);
+    a_star.setTransitionSystem(transitions);
+    a_star.setGoalTest(goal_test);
+    a_star.setHashFunction(hash_function);
+    timer.startTimer();
+    a_star.searchForPlan(start_state);
+    timer.endTimer();
+    printResults("A*", a_star, timer.getLastTimePeriodDuration(), num_pancakes, sizeof(Hash_t));
+
+    GapOperatorSelectionFunction op_selection;
+    for (bool use_op_selection : {false, true}) {
+        GapHeuristic heuristic;
+        PartialExpansionAStarParams params;
+        PartialExpansionAStar<PancakeState, NumToFlip, Hash_t> engine(params);
+        engine.setHeuristic(heuristic);
+        if (use_op_selection) {
+            engine.setOperatorSelectionFunction(op_selection);
+        }
+        engine.setTransitionSystem(transitions);
+        engine.setGoalTest(goal_test);
+        engine.setHashFunction(hash_function);
+        timer.startTimer();
+        engine.searchForPlan(start_state);
+        timer.endTimer();
+        printResults(use_op_selection ? "EPEA*" : "PEA*", engine, timer.getLastTimePeriodDuration(), num_pancakes, sizeof(Hash_t));
+    }
+}
+
+int main() {
+    const unsigned num_instances = 3;
+    std::mt19937 rand_gen(42);
+
+    for (unsigned num_pancakes : {20U, 30U, 40U}) {
+        std::vector<Pancake> goal_perm(num_pancakes);
+        std::iota(goal_perm.begin(), goal_perm.end(), 0);
+        PancakeState goal_state(goal_perm);
+
+        for (unsigned instance = 0; instance < num_instances; ++instance) {
+            std::vector<Pancake> start_perm = goal_perm;
+            std::shuffle(start_perm.begin(), start_perm.end(), rand_gen);
+            PancakeState start_state(start_perm);
+
+            std::cout << num_pancakes << "-pancake instance " << instance << ":\n";
+            callWithPermutationHashFunction<PancakeState>(num_pancakes, false, [&](const auto& hash_function) {
+                runInstance(start_state, goal_state, hash_function);
+            });
+        }
+    }
+
+    return 0;
+}
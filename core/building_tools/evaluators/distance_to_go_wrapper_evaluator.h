@@ -37,6 +37,9 @@ public:
     const NodeContainer<State_t, Action_t>* getNodeContainer() const override { return m_base_evaluator->getNodeContainer(); }
     void prepareToEvaluate() override { m_base_evaluator->prepareToEvaluate(); }
     void evaluate(NodeID to_evaluate) override { m_base_evaluator->evaluate(to_evaluate); }
+    void evaluateBatch(const std::vector<NodeID>& to_evaluate) override { m_base_evaluator->evaluateBatch(to_evaluate); }
+    void scheduledEvaluate(NodeID to_evaluate) override;
+    void scheduledEvaluateBatch(const std::vector<NodeID>& to_evaluate) override;
     void reEvaluate(NodeID to_evaluate) override { m_base_evaluator->reEvaluate(to_evaluate); }
     void reset() override { m_base_evaluator->reset(); }
     NodeID getIDofLastEvaluatedNode() const override { return m_base_evaluator->getIDofLastEvaluatedNode(); }
@@ -56,7 +59,32 @@ protected:
     SearchSettingsMap getSubComponentSettings() const override { return {{evaluatorToolsTerms::SETTING_BASE_EVALUATOR, m_base_evaluator->getAllSettings()}}; }
 
 private:
+    /**
+     * Returns if the base evaluator has already been evaluated up to the given node, as it is when it comes before
+     * this evaluator in an evaluation schedule.
+     *
+     * @param node_id The ID of the node
+     * @return If the base evaluator's last evaluation was for the given node
+     */
+    bool isBaseEvaluated(NodeID node_id) const {
+        return m_base_evaluator->isEvalComputed() && m_base_evaluator->getIDofLastEvaluatedNode() == node_id;
+    }
+
     CostAndDistanceToGoEvaluator<State_t, Action_t>* m_base_evaluator;  ///< The base evaluator this object wraps
 };
 
+template<class State_t, class Action_t>
+void DistanceToGoWrapperEvaluator<State_t, Action_t>::scheduledEvaluate(NodeID to_evaluate) {
+    if (!isBaseEvaluated(to_evaluate)) {
+        m_base_evaluator->scheduledEvaluate(to_evaluate);
+    }
+}
+
+template<class State_t, class Action_t>
+void DistanceToGoWrapperEvaluator<State_t, Action_t>::scheduledEvaluateBatch(const std::vector<NodeID>& to_evaluate) {
+    if (!to_evaluate.empty() && !isBaseEvaluated(to_evaluate.back())) {
+        m_base_evaluator->scheduledEvaluateBatch(to_evaluate);
+    }
+}
+
 #endif  //DISTANCE_TO_GO_WRAPPER_EVALUATOR_H_
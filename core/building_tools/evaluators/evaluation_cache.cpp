@@ -5,44 +5,103 @@
 
 
 void EvaluationCache::setValues(NodeID node_id, double value, bool is_dead_end) {
+    if (m_store) {
+        m_store->setValues(m_column, node_id, value, is_dead_end);
+        return;
+    }
     updateCacheSizesForSet(node_id);
 
     m_evals[node_id] = value;
-    m_is_dead_ends[node_id] = is_dead_end;
+    setIsDeadEnd(node_id, is_dead_end);
+    m_has_values[node_id] = true;
 }
 
 void EvaluationCache::setEvaluation(NodeID node_id, double value) {
+    if (m_store) {
+        m_store->setEvaluation(m_column, node_id, value);
+        return;
+    }
     updateCacheSizesForSet(node_id);
 
     m_evals[node_id] = value;
 }
 
 void EvaluationCache::setIsDeadEnd(NodeID node_id, bool is_dead_end) {
+    if (m_store) {
+        m_store->setIsDeadEnd(m_column, node_id, is_dead_end);
+        return;
+    }
     updateCacheSizesForSet(node_id);
 
-    m_is_dead_ends[node_id] = is_dead_end;
+    if (m_stores_dead_ends) {
+        m_is_dead_ends[node_id] = is_dead_end;
+    } else {
+        assert(!is_dead_end);
+    }
 }
 
 double EvaluationCache::getEvaluation(NodeID node_id) const {
+    if (m_store) {
+        return m_store->getEvaluation(m_column, node_id);
+    }
     assert(m_evals.size() > node_id);
     return m_evals[node_id];
 }
 
 bool EvaluationCache::getIsDeadEnd(NodeID node_id) const {
-    assert(m_is_dead_ends.size() > node_id);
-    return m_is_dead_ends[node_id];
+    if (m_store) {
+        return m_store->getIsDeadEnd(m_column, node_id);
+    }
+    assert(m_evals.size() > node_id);
+    return m_stores_dead_ends && m_is_dead_ends[node_id];
+}
+
+bool EvaluationCache::hasValues(NodeID node_id) const {
+    if (m_store) {
+        return m_store->hasValues(m_column, node_id);
+    }
+    return node_id < m_has_values.size() && m_has_values[node_id];
+}
+
+void EvaluationCache::clearHasValues() {
+    if (m_store) {
+        m_store->clearHasValues(m_column);
+        return;
+    }
+    m_has_values.assign(m_has_values.size(), false);
 }
 
 void EvaluationCache::clearCache() {
+    if (m_store) {
+        m_store->clearColumn(m_column);
+    }
     m_evals.clear();
     m_is_dead_ends.clear();
+    m_has_values.clear();
+}
+
+std::size_t EvaluationCache::size() const {
+    if (m_store) {
+        return m_store->getColumnSize(m_column);
+    }
+    return m_evals.size();
+}
+
+void EvaluationCache::bindToStore(const std::shared_ptr<EvaluationStore>& store, EvaluationStorageType storage_type) {
+    assert(store);
+    clearCache();
+    m_store = store;
+    m_column = m_store->addColumn(storage_type, m_stores_dead_ends);
 }
 
 void EvaluationCache::updateCacheSizesForSet(NodeID node_id) {
-    assert(m_evals.size() == m_is_dead_ends.size());
     if (node_id >= m_evals.size()) {
         m_evals.resize(node_id + 1, 0.0);
-        m_is_dead_ends.resize(node_id + 1, false);
+
+        if (m_stores_dead_ends) {
+            m_is_dead_ends.resize(node_id + 1, false);
+        }
+        m_has_values.resize(node_id + 1, false);
     }
-    assert(m_evals.size() == m_is_dead_ends.size());
+    assert(!m_stores_dead_ends || m_evals.size() == m_is_dead_ends.size());
 }
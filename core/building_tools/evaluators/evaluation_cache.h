@@ -1,21 +1,30 @@
 #ifndef EVALUATION_CACHE_H_
 #define EVALUATION_CACHE_H_
 
+#include "building_tools/evaluators/evaluation_store.h"
 #include "search_basics/node_container.h"
 
 #include <cstddef>
+#include <memory>
 #include <vector>
 
 /**
  * A cache for node evaluations. Internally, stores the evaluations in a vector, indexed by the ID of a node.
+ *
+ * The cache can instead be bound to a column of a shared EvaluationStore, in which case all values are read from and
+ * written to that column.
  */
 class EvaluationCache {
 
 public:
     /**
      * Creates an evaluation cache.
+     *
+     * @param stores_dead_ends Whether the cache stores if nodes are dead ends. Caches that only hold values, such as
+     * distance-to-go estimates, can skip them to save space
      */
-    EvaluationCache() = default;
+    explicit EvaluationCache(bool stores_dead_ends = true)
+              : m_stores_dead_ends(stores_dead_ends) {}
 
     /**
      * Sets the cached values of the evaluation and is dead end value of the node with the given ID.
@@ -64,6 +73,20 @@ public:
      */
     bool getIsDeadEnd(NodeID node_id) const;
 
+    /**
+     * Returns if the node with the given ID has had its values set with setValues since the cache or its flags were
+     * last cleared.
+     *
+     * @param node_id The ID of the node to check
+     * @return If the cache has values for the node
+     */
+    bool hasValues(NodeID node_id) const;
+
+    /**
+     * Clears the flags that record which nodes have had their values set, without clearing the values themselves.
+     */
+    void clearHasValues();
+
     /**
      * Clears the cache of all stored evaluations.
      */
@@ -73,12 +96,40 @@ public:
      * Gets the number of values stored in the cache.
      * @return
      */
-    std::size_t size() const { return m_evals.size(); }
+    std::size_t size() const;
+
+    /**
+     * Binds the cache to a new column of the given store. Any values previously cached are discarded, and all later
+     * values are stored in the new column.
+     *
+     * @param store The store to use
+     * @param storage_type The type used to store the evaluations in the new column
+     */
+    void bindToStore(const std::shared_ptr<EvaluationStore>& store, EvaluationStorageType storage_type = EvaluationStorageType::float64);
+
+    /**
+     * Returns if the cache is bound to a shared store.
+     *
+     * @return If the cache stores its values in a shared store
+     */
+    bool isBoundToStore() const { return m_store != nullptr; }
+
+    /**
+     * Gets the shared store the cache is bound to.
+     *
+     * @return The store, or null if the values are stored locally
+     */
+    const std::shared_ptr<EvaluationStore>& getStore() const { return m_store; }
 
 private:
     void updateCacheSizesForSet(NodeID node_id);
 
     std::vector<double> m_evals;  ///< The evaluations of all nodes, indexed by their ID
     std::vector<bool> m_is_dead_ends;  ///< Whether each node is a dead end, indexed by their ID
+    std::vector<bool> m_has_values;  ///< Whether each node has had its values set with setValues, indexed by their ID
+    bool m_stores_dead_ends = true;  ///< Whether the cache stores if nodes are dead ends
+
+    std::shared_ptr<EvaluationStore> m_store = nullptr;  ///< The shared store the values are kept in, or null if stored locally
+    EvaluationStore::ColumnID m_column = 0;  ///< The column of the shared store used by this cache
 };
 #endif  //EVALUATION_CACHE_H_
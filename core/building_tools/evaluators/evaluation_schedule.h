@@ -0,0 +1,218 @@
+#ifndef EVALUATION_SCHEDULE_H_
+#define EVALUATION_SCHEDULE_H_
+
+#include "building_tools/evaluators/evaluation_store.h"
+#include "building_tools/evaluators/node_evaluator_with_cache.h"
+#include "search_basics/node_container.h"
+#include "search_basics/node_evaluator.h"
+#include "utils/evaluator_utils.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <tuple>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+/**
+ * A compiled plan for evaluating nodes with a set of evaluators and all of their sub-evaluators.
+ *
+ * The evaluator DAG is flattened and deduplicated once when the schedule is compiled, with leaf evaluators (those
+ * without sub-evaluators) placed first and each composite evaluator placed after all of its sub-evaluators. Nodes are
+ * then evaluated by a single pass over the schedule using scheduledEvaluate, so that each evaluator is called exactly
+ * once per node and composites read the cached values of their sub-evaluators rather than re-running the
+ * prepare/evaluate protocol on them.
+ *
+ * Sub-evaluators that are only used by evaluators that evaluate their sub-evaluators lazily are left out of the
+ * schedule, since those evaluators decide for themselves which sub-evaluators to call.
+ *
+ * When compiled, the caches of evaluators derived from NodeEvaluatorWithCache are moved into columns of an
+ * EvaluationStore owned by the schedule, which is grown once per batch for all evaluators. Evaluators whose caches are
+ * already bound to the store of another schedule, such as a heuristic shared by two engines, are left bound to that
+ * store while that schedule exists, since its owner may still need their cached values. Such columns simply grow as
+ * values are set.
+ *
+ * @tparam State_t The type of state
+ * @tparam Action_t The type of action
+ * @class EvaluationSchedule
+ */
+template<class State_t, class Action_t>
+class EvaluationSchedule {
+public:
+    /**
+     * Creates an empty schedule.
+     */
+    EvaluationSchedule() = default;
+
+    /**
+     * Compiles the schedule for the given evaluators and all of their sub-evaluators. Also moves the caches of the
+     * evaluators that are not bound to the store of another existing schedule into a new evaluation store, which
+     * discards their cached values. The evaluators are not otherwise reset.
+     *
+     * @param base_evaluators The evaluators whose evaluations are needed
+     */
+    void compile(std::vector<NodeEvaluator<State_t, Action_t>*> base_evaluators);
+
+    /**
+     * Evaluates the node with the given ID with every evaluator in the schedule.
+     *
+     * @param to_evaluate The ID of the node to evaluate
+     */
+    void evaluate(NodeID to_evaluate);
+
+    /**
+     * Evaluates all of the nodes with the given IDs with every evaluator in the schedule.
+     *
+     * @param to_evaluate The IDs of the nodes to evaluate
+     */
+    void evaluateBatch(const std::vector<NodeID>& to_evaluate);
+
+    /**
+     * Gets the evaluators in the order they are evaluated in.
+     *
+     * @return The scheduled evaluators
+     */
+    const std::vector<NodeEvaluator<State_t, Action_t>*>& getEvaluators() const { return m_evaluators; }
+
+    /**
+     * Gets the number of evaluators in the schedule that do not have scheduled sub-evaluators. These come first in the
+     * schedule.
+     *
+     * @return The number of leaf evaluators
+     */
+    std::size_t getNumLeafEvaluators() const { return m_num_leaf_evaluators; }
+
+    /**
+     * Gets the store holding the caches of the scheduled evaluators.
+     *
+     * @return The evaluation store, or null if the schedule has not been compiled
+     */
+    const std::shared_ptr<EvaluationStore>& getEvaluationStore() const { return m_store; }
+
+private:
+    std::vector<NodeEvaluator<State_t, Action_t>*> m_evaluators;  ///< The evaluators in the order they are evaluated
+    std::size_t m_num_leaf_evaluators = 0;  ///< The number of evaluators without scheduled sub-evaluators
+    std::shared_ptr<EvaluationStore> m_store = nullptr;  ///< The store holding the caches of the evaluators
+    std::shared_ptr<const void> m_owner_token = std::make_shared<bool>(true);  ///< Marks the stores of this schedule as owned while it exists
+};
+
+/**
+ * An evaluation schedule for when the concrete types of the evaluators are known at compile time.
+ *
+ * The evaluators are given in the order in which they should be evaluated, which must have every sub-evaluator before
+ * the evaluators that use it. Since the evaluators are held by their concrete types, calls to overrides marked as
+ * final are resolved at compile time and can be inlined.
+ *
+ * @tparam Evaluator_ts The types of the evaluators, in evaluation order
+ * @class StaticEvaluationSchedule
+ */
+template<class... Evaluator_ts>
+class StaticEvaluationSchedule {
+public:
+    /**
+     * Creates a schedule for the given evaluators.
+     *
+     * @param evaluators The evaluators, in evaluation order
+     */
+    explicit StaticEvaluationSchedule(Evaluator_ts&... evaluators)
+              : m_evaluators(&evaluators...) {}
+
+    /**
+     * Evaluates the node with the given ID with every evaluator in the schedule.
+     *
+     * @param to_evaluate The ID of the node to evaluate
+     */
+    void evaluate(NodeID to_evaluate) {
+        std::apply([to_evaluate](auto*... evaluators) { (evaluators->scheduledEvaluate(to_evaluate), ...); }, m_evaluators);
+    }
+
+    /**
+     * Evaluates all of the nodes with the given IDs with every evaluator in the schedule.
+     *
+     * @param to_evaluate The IDs of the nodes to evaluate
+     */
+    void evaluateBatch(const std::vector<NodeID>& to_evaluate) {
+        std::apply([&to_evaluate](auto*... evaluators) { (evaluators->scheduledEvaluateBatch(to_evaluate), ...); }, m_evaluators);
+    }
+
+private:
+    std::tuple<Evaluator_ts*...> m_evaluators;  ///< The evaluators in evaluation order
+};
+
+template<class State_t, class Action_t>
+void EvaluationSchedule<State_t, Action_t>::compile(std::vector<NodeEvaluator<State_t, Action_t>*> base_evaluators) {
+    m_evaluators = getAllEvaluators(base_evaluators);
+
+    // Going from users to sub-evaluators, keep only the evaluators reachable without passing through a lazy evaluator
+    std::unordered_set<NodeEvaluator<State_t, Action_t>*> needed(base_evaluators.begin(), base_evaluators.end());
+    for (auto eval_iter = m_evaluators.rbegin(); eval_iter != m_evaluators.rend(); ++eval_iter) {
+        if (needed.count(*eval_iter) > 0 && !(*eval_iter)->evaluatesSubEvaluatorsLazily()) {
+            for (auto* sub_eval : (*eval_iter)->getSubEvaluators()) {
+                needed.insert(sub_eval);
+            }
+        }
+    }
+    m_evaluators.erase(std::remove_if(m_evaluators.begin(), m_evaluators.end(),
+                                 [&needed](auto* eval) { return needed.count(eval) == 0; }),
+              m_evaluators.end());
+
+    // The topological sort puts sub-evaluators first, so each level can be computed from those already seen
+    std::unordered_map<NodeEvaluator<State_t, Action_t>*, int> levels;
+    for (auto* eval : m_evaluators) {
+        int level = 0;
+        for (auto* sub_eval : eval->getSubEvaluators()) {
+            if (levels.count(sub_eval) == 0) {
+                continue;
+            }
+            level = std::max(level, levels[sub_eval] + 1);
+        }
+        levels[eval] = level;
+    }
+
+    std::stable_sort(m_evaluators.begin(), m_evaluators.end(), [&levels](auto* eval1, auto* eval2) {
+        return levels[eval1] < levels[eval2];
+    });
+    m_num_leaf_evaluators = static_cast<std::size_t>(std::count_if(m_evaluators.begin(), m_evaluators.end(),
+              [&levels](auto* eval) { return levels[eval] == 0; }));
+
+    std::shared_ptr<EvaluationStore> old_store = m_store;
+    m_store = std::make_shared<EvaluationStore>();
+    m_store->setOwner(m_owner_token);
+    for (auto* eval : m_evaluators) {
+        auto* cached_eval = dynamic_cast<NodeEvaluatorWithCache<State_t, Action_t>*>(eval);
+        if (cached_eval == nullptr) {
+            continue;
+        }
+
+        // Take over caches that are unbound, were bound by an earlier compilation, or whose schedule no longer exists
+        const std::shared_ptr<EvaluationStore>& eval_store = cached_eval->getEvaluationStore();
+        if (eval_store == nullptr || eval_store == old_store || !eval_store->hasOwner()) {
+            cached_eval->bindEvaluationStore(m_store);
+        }
+    }
+}
+
+template<class State_t, class Action_t>
+void EvaluationSchedule<State_t, Action_t>::evaluate(NodeID to_evaluate) {
+    for (auto* eval : m_evaluators) {
+        eval->scheduledEvaluate(to_evaluate);
+    }
+}
+
+template<class State_t, class Action_t>
+void EvaluationSchedule<State_t, Action_t>::evaluateBatch(const std::vector<NodeID>& to_evaluate) {
+    if (to_evaluate.empty()) {
+        return;
+    }
+
+    if (m_store) {
+        m_store->growToFit(*std::max_element(to_evaluate.begin(), to_evaluate.end()));
+    }
+
+    for (auto* eval : m_evaluators) {
+        eval->scheduledEvaluateBatch(to_evaluate);
+    }
+}
+
+#endif  //EVALUATION_SCHEDULE_H_
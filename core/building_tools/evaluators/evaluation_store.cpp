@@ -0,0 +1,256 @@
+#include "building_tools/evaluators/evaluation_store.h"
+#include "search_basics/node_container.h"
+
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+namespace {
+    /**
+     * Converts an evaluation to the given integer type. Infinite evaluations are mapped to the largest or smallest
+     * value of the type. Throws a std::domain_error if the evaluation is not an integer or is out of range, since it
+     * could not be stored exactly.
+     */
+    template<class Int_t>
+    Int_t quantizeEvaluation(double value) {
+        if (std::isinf(value)) {
+            return value > 0 ? std::numeric_limits<Int_t>::max() : std::numeric_limits<Int_t>::min();
+        }
+        if (value != std::round(value)) {
+            throw std::domain_error("Cannot store non-integer evaluation " + std::to_string(value) + " in an integer column");
+        }
+        if (value >= std::numeric_limits<Int_t>::max() || value <= std::numeric_limits<Int_t>::min()) {
+            throw std::domain_error("Evaluation " + std::to_string(value) + " is out of range for its integer column");
+        }
+        return static_cast<Int_t>(value);
+    }
+
+    /**
+     * Converts a stored integer back to an evaluation.
+     */
+    template<class Int_t>
+    double dequantizeEvaluation(Int_t value) {
+        if (value == std::numeric_limits<Int_t>::max()) {
+            return std::numeric_limits<double>::infinity();
+        } else if (value == std::numeric_limits<Int_t>::min()) {
+            return -std::numeric_limits<double>::infinity();
+        }
+        return static_cast<double>(value);
+    }
+}  // namespace
+
+std::ostream& operator<<(std::ostream& out, EvaluationStorageType storage_type) {
+    switch (storage_type) {
+        case EvaluationStorageType::float64:
+            out << "float64";
+            break;
+        case EvaluationStorageType::float32:
+            out << "float32";
+            break;
+        case EvaluationStorageType::int32:
+            out << "int32";
+            break;
+        case EvaluationStorageType::int16:
+            out << "int16";
+            break;
+    }
+    return out;
+}
+
+EvaluationStore::ColumnID EvaluationStore::addColumn(EvaluationStorageType storage_type, bool stores_dead_ends) {
+    Column column;
+    column.m_storage_type = storage_type;
+    column.m_stores_dead_ends = stores_dead_ends;
+    m_columns.push_back(column);
+    return m_columns.size() - 1;
+}
+
+EvaluationStorageType EvaluationStore::getStorageType(ColumnID column) const {
+    assert(column < m_columns.size());
+    return m_columns[column].m_storage_type;
+}
+
+void EvaluationStore::growToFit(NodeID node_id) {
+    for (auto& column : m_columns) {
+        updateColumnSizeForSet(column, node_id);
+    }
+}
+
+void EvaluationStore::reserve(std::size_t num_nodes) {
+    for (auto& column : m_columns) {
+        switch (column.m_storage_type) {
+            case EvaluationStorageType::float64:
+                column.m_float64_evals.reserve(num_nodes);
+                break;
+            case EvaluationStorageType::float32:
+                column.m_float32_evals.reserve(num_nodes);
+                break;
+            case EvaluationStorageType::int32:
+                column.m_int32_evals.reserve(num_nodes);
+                break;
+            case EvaluationStorageType::int16:
+                column.m_int16_evals.reserve(num_nodes);
+                break;
+        }
+        if (column.m_stores_dead_ends) {
+            column.m_is_dead_ends.reserve(num_nodes);
+        }
+        column.m_has_values.reserve(num_nodes);
+    }
+}
+
+void EvaluationStore::setValues(ColumnID column, NodeID node_id, double value, bool is_dead_end) {
+    setEvaluation(column, node_id, value);
+    setIsDeadEnd(column, node_id, is_dead_end);
+    m_columns[column].m_has_values[node_id] = true;
+}
+
+void EvaluationStore::setEvaluation(ColumnID column, NodeID node_id, double value) {
+    assert(column < m_columns.size());
+    Column& col = m_columns[column];
+    updateColumnSizeForSet(col, node_id);
+
+    switch (col.m_storage_type) {
+        case EvaluationStorageType::float64:
+            col.m_float64_evals[node_id] = value;
+            break;
+        case EvaluationStorageType::float32:
+            col.m_float32_evals[node_id] = static_cast<float>(value);
+            break;
+        case EvaluationStorageType::int32:
+            col.m_int32_evals[node_id] = quantizeEvaluation<std::int32_t>(value);
+            break;
+        case EvaluationStorageType::int16:
+            col.m_int16_evals[node_id] = quantizeEvaluation<std::int16_t>(value);
+            break;
+    }
+}
+
+void EvaluationStore::setIsDeadEnd(ColumnID column, NodeID node_id, bool is_dead_end) {
+    assert(column < m_columns.size());
+    Column& col = m_columns[column];
+    updateColumnSizeForSet(col, node_id);
+
+    if (col.m_stores_dead_ends) {
+        col.m_is_dead_ends[node_id] = is_dead_end;
+    } else {
+        assert(!is_dead_end);
+    }
+}
+
+double EvaluationStore::getEvaluation(ColumnID column, NodeID node_id) const {
+    assert(column < m_columns.size());
+    const Column& col = m_columns[column];
+    assert(col.m_size > node_id);
+
+    switch (col.m_storage_type) {
+        case EvaluationStorageType::float32:
+            return static_cast<double>(col.m_float32_evals[node_id]);
+        case EvaluationStorageType::int32:
+            return dequantizeEvaluation(col.m_int32_evals[node_id]);
+        case EvaluationStorageType::int16:
+            return dequantizeEvaluation(col.m_int16_evals[node_id]);
+        default:
+            return col.m_float64_evals[node_id];
+    }
+}
+
+bool EvaluationStore::getIsDeadEnd(ColumnID column, NodeID node_id) const {
+    assert(column < m_columns.size());
+    const Column& col = m_columns[column];
+    assert(col.m_size > node_id);
+
+    return col.m_stores_dead_ends && col.m_is_dead_ends[node_id];
+}
+
+bool EvaluationStore::hasValues(ColumnID column, NodeID node_id) const {
+    assert(column < m_columns.size());
+    const Column& col = m_columns[column];
+
+    return node_id < col.m_size && col.m_has_values[node_id];
+}
+
+void EvaluationStore::clearColumn(ColumnID column) {
+    assert(column < m_columns.size());
+    Column& col = m_columns[column];
+
+    col.m_float64_evals.clear();
+    col.m_float32_evals.clear();
+    col.m_int32_evals.clear();
+    col.m_int16_evals.clear();
+    col.m_is_dead_ends.clear();
+    col.m_has_values.clear();
+    col.m_size = 0;
+}
+
+void EvaluationStore::clearHasValues(ColumnID column) {
+    assert(column < m_columns.size());
+    Column& col = m_columns[column];
+
+    col.m_has_values.assign(col.m_size, false);
+}
+
+void EvaluationStore::clearAllColumns() {
+    for (ColumnID column = 0; column < m_columns.size(); ++column) {
+        clearColumn(column);
+    }
+}
+
+std::size_t EvaluationStore::getColumnSize(ColumnID column) const {
+    assert(column < m_columns.size());
+    return m_columns[column].m_size;
+}
+
+double EvaluationStore::getBytesPerNode() const {
+    double bytes = 0.0;
+    for (const auto& column : m_columns) {
+        switch (column.m_storage_type) {
+            case EvaluationStorageType::float64:
+                bytes += sizeof(double);
+                break;
+            case EvaluationStorageType::float32:
+                bytes += sizeof(float);
+                break;
+            case EvaluationStorageType::int32:
+                bytes += sizeof(std::int32_t);
+                break;
+            case EvaluationStorageType::int16:
+                bytes += sizeof(std::int16_t);
+                break;
+        }
+        if (column.m_stores_dead_ends) {
+            bytes += 1.0 / 8.0;  // std::vector<bool> packs the values into bits
+        }
+        bytes += 1.0 / 8.0;  // for the flags of which nodes have values
+    }
+    return bytes;
+}
+
+void EvaluationStore::updateColumnSizeForSet(Column& column, NodeID node_id) {
+    if (node_id < column.m_size) {
+        return;
+    }
+    column.m_size = node_id + 1;
+
+    switch (column.m_storage_type) {
+        case EvaluationStorageType::float64:
+            column.m_float64_evals.resize(column.m_size, 0.0);
+            break;
+        case EvaluationStorageType::float32:
+            column.m_float32_evals.resize(column.m_size, 0.0F);
+            break;
+        case EvaluationStorageType::int32:
+            column.m_int32_evals.resize(column.m_size, 0);
+            break;
+        case EvaluationStorageType::int16:
+            column.m_int16_evals.resize(column.m_size, 0);
+            break;
+    }
+    if (column.m_stores_dead_ends) {
+        column.m_is_dead_ends.resize(column.m_size, false);
+    }
+    column.m_has_values.resize(column.m_size, false);
+}
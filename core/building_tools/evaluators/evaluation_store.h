@@ -0,0 +1,232 @@
+#ifndef EVALUATION_STORE_H_
+#define EVALUATION_STORE_H_
+
+#include "search_basics/node_container.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+/**
+ * The type used to store the evaluations of a column of an EvaluationStore.
+ *
+ * The integer types are for evaluators whose evaluations are always integers (such as unit-cost heuristics) or
+ * infinite, and store each evaluation exactly in less space.
+ */
+enum class EvaluationStorageType : std::uint8_t {
+    float64,  ///< Stores evaluations as doubles
+    float32,  ///< Stores evaluations as floats. Evaluations are rounded to float precision
+    int32,  ///< Stores integer evaluations in 32 bits
+    int16  ///< Stores integer evaluations in 16 bits
+};
+
+/**
+ * Outputs the given storage type to the given output stream.
+ *
+ * @param out The output stream
+ * @param storage_type The storage type to output
+ * @return The output stream
+ */
+std::ostream& operator<<(std::ostream& out, EvaluationStorageType storage_type);
+
+/**
+ * A columnar store of node evaluations that is shared by several evaluators. Each evaluator registers a column, and
+ * the evaluations and dead-end values of each column are stored in their own arrays indexed by node ID.
+ *
+ * The store is intended to be owned by a search engine, so that the caches of all of its evaluators can be grown
+ * together as nodes are added rather than one evaluator at a time. Each column stores its evaluations with its own
+ * storage type, and columns that only hold values (such as distance-to-go estimates) can skip the dead-end values.
+ * Each column also records which nodes have had their values set with setValues, as opposed to only having room in
+ * the column.
+ *
+ * @class EvaluationStore
+ */
+class EvaluationStore {
+public:
+    using ColumnID = std::size_t;  ///< Identifies a column of the store
+
+    /**
+     * Creates an empty evaluation store.
+     */
+    EvaluationStore() = default;
+
+    /**
+     * Adds a new, empty column to the store.
+     *
+     * @param storage_type The type used to store the evaluations of the column
+     * @param stores_dead_ends Whether the column also stores if each node is a dead end
+     * @return The ID of the new column
+     */
+    ColumnID addColumn(EvaluationStorageType storage_type = EvaluationStorageType::float64, bool stores_dead_ends = true);
+
+    /**
+     * Gets the number of columns in the store.
+     *
+     * @return The number of columns
+     */
+    std::size_t getNumColumns() const { return m_columns.size(); }
+
+    /**
+     * Sets the object that owns the store, such as an evaluation schedule. The store is considered owned for as long
+     * as the owner exists.
+     *
+     * @param owner The owner of the store
+     */
+    void setOwner(const std::shared_ptr<const void>& owner) { m_owner = owner; }
+
+    /**
+     * Returns if the owner of the store still exists.
+     *
+     * @return If the store is owned
+     */
+    bool hasOwner() const { return !m_owner.expired(); }
+
+    /**
+     * Gets the storage type of the given column.
+     *
+     * @param column The column
+     * @return The storage type of the column
+     */
+    EvaluationStorageType getStorageType(ColumnID column) const;
+
+    /**
+     * Grows every column so that values can be stored for all nodes with IDs up to and including the given ID.
+     * Values that have not been set are 0.0 and not dead ends.
+     *
+     * @param node_id The largest node ID to make room for
+     */
+    void growToFit(NodeID node_id);
+
+    /**
+     * Reserves space in every column for the given number of nodes, so that they are not reallocated as they grow.
+     *
+     * @param num_nodes The number of nodes to make space for
+     */
+    void reserve(std::size_t num_nodes);
+
+    /**
+     * Sets the evaluation and is dead end value of the node with the given ID in the given column.
+     *
+     * @param column The column to update
+     * @param node_id The ID of the node to set values for
+     * @param value The new node evaluation
+     * @param is_dead_end The new value for is dead end
+     */
+    void setValues(ColumnID column, NodeID node_id, double value, bool is_dead_end);
+
+    /**
+     * Sets the evaluation of the node with the given ID in the given column.
+     *
+     * Throws a std::domain_error if the column uses an integer storage type and the evaluation is a finite value that
+     * is not an integer or does not fit in the type.
+     *
+     * @param column The column to update
+     * @param node_id The ID of the node whose value is to be set.
+     * @param value The evaluation to store for the corresponding node.
+     */
+    void setEvaluation(ColumnID column, NodeID node_id, double value);
+
+    /**
+     * Sets whether the node with the given ID is a dead end in the given column.
+     *
+     * @param column The column to update
+     * @param node_id The ID of the node whose value is to be set.
+     * @param is_dead_end Whether the node is identified as a dead end or not.
+     */
+    void setIsDeadEnd(ColumnID column, NodeID node_id, bool is_dead_end);
+
+    /**
+     * Gets the evaluation of the node with the given ID in the given column.
+     *
+     * @param column The column to read from
+     * @param node_id The ID of the node whose value is required.
+     * @return The evaluation of the node with the corresponding ID.
+     */
+    double getEvaluation(ColumnID column, NodeID node_id) const;
+
+    /**
+     * Returns if the node with the given ID has had its values set with setValues in the given column since the
+     * column or its flags were last cleared.
+     *
+     * @param column The column to read from
+     * @param node_id The ID of the node to check
+     * @return If the column has values for the node
+     */
+    bool hasValues(ColumnID column, NodeID node_id) const;
+
+    /**
+     * Gets whether the node with the given ID is a dead end in the given column.
+     *
+     * @param column The column to read from
+     * @param node_id The ID of the node whose value is required.
+     * @return Whether the node for the corresponding ID is a dead end.
+     */
+    bool getIsDeadEnd(ColumnID column, NodeID node_id) const;
+
+    /**
+     * Clears the values stored in the given column. The column remains registered.
+     *
+     * @param column The column to clear
+     */
+    void clearColumn(ColumnID column);
+
+    /**
+     * Clears the flags of the given column that record which nodes have had their values set, without clearing the
+     * values themselves.
+     *
+     * @param column The column whose flags are cleared
+     */
+    void clearHasValues(ColumnID column);
+
+    /**
+     * Clears the values stored in all columns. The columns remain registered.
+     */
+    void clearAllColumns();
+
+    /**
+     * Gets the number of values stored in the given column.
+     *
+     * @param column The column
+     * @return The number of values stored in the column
+     */
+    std::size_t getColumnSize(ColumnID column) const;
+
+    /**
+     * Gets the number of bytes used to store the values of a single node across all columns.
+     *
+     * @return The number of bytes per node
+     */
+    double getBytesPerNode() const;
+
+private:
+    /**
+     * The values of a single column. Only the evaluation vector matching the storage type is used.
+     */
+    struct Column {
+        EvaluationStorageType m_storage_type = EvaluationStorageType::float64;  ///< The type used to store the evaluations
+        bool m_stores_dead_ends = true;  ///< Whether the column stores the dead end values
+        std::size_t m_size = 0;  ///< The number of nodes with values in the column
+
+        std::vector<double> m_float64_evals;  ///< The evaluations when stored as doubles
+        std::vector<float> m_float32_evals;  ///< The evaluations when stored as floats
+        std::vector<std::int32_t> m_int32_evals;  ///< The evaluations when stored as 32-bit integers
+        std::vector<std::int16_t> m_int16_evals;  ///< The evaluations when stored as 16-bit integers
+        std::vector<bool> m_is_dead_ends;  ///< Whether each node is a dead end
+        std::vector<bool> m_has_values;  ///< Whether each node has had its values set with setValues
+    };
+
+    /**
+     * Resizes the given column if needed so that it has a value for the given node ID.
+     *
+     * @param column The column to resize
+     * @param node_id The node ID that needs a value
+     */
+    void updateColumnSizeForSet(Column& column, NodeID node_id);
+
+    std::vector<Column> m_columns;  ///< The columns of the store
+    std::weak_ptr<const void> m_owner;  ///< The owner of the store, if any
+};
+
+#endif  //EVALUATION_STORE_H_
@@ -15,6 +15,7 @@ namespace evaluatorToolsTerms {
     inline const std::string SETTING_BASE_EVALUATOR = "base_evaluator";  ///< The base evaluator of a DistanceToGoWrapperEvaluator
 
     inline const std::string OP_NAME_MAX = "max";  ///< Operator label for a max SetAggregateEvaluator
+    inline const std::string OP_NAME_MIN = "min";  ///< Operator label for a min SetAggregateEvaluator
     inline const std::string OP_NAME_SUM = "sum";  ///< Operator label for a sum SetAggregateEvaluator
 }  // namespace evaluatorToolsTerms
 
@@ -2,11 +2,15 @@
 #define NODE_EVALUATOR_WITH_CACHE_H_
 
 #include "building_tools/evaluators/evaluation_cache.h"
+#include "building_tools/evaluators/evaluation_store.h"
 #include "search_basics/node_container.h"
 #include "search_basics/node_evaluator.h"
 
 #include <cassert>
+#include <cstdint>
+#include <memory>
 #include <optional>
+#include <vector>
 
 /**
  * A NodeEvaluator with a built-in cache to store the evaluations.
@@ -20,10 +24,13 @@ template<class State_t, class Action_t>
 class NodeEvaluatorWithCache : virtual public NodeEvaluator<State_t, Action_t> {
 public:
     // Overriden public NodeEvaluator functions
-    void setNodeContainer(const NodeContainer<State_t, Action_t>& nodes) override { m_nodes = &nodes; }
+    void setNodeContainer(const NodeContainer<State_t, Action_t>& nodes) override;
     const NodeContainer<State_t, Action_t>* getNodeContainer() const override { return m_nodes; }
     void prepareToEvaluate() override;
     void evaluate(NodeID to_evaluate) override;
+    void evaluateBatch(const std::vector<NodeID>& to_evaluate) override;
+    void scheduledEvaluate(NodeID to_evaluate) final;
+    void scheduledEvaluateBatch(const std::vector<NodeID>& to_evaluate) final;
     void reEvaluate(NodeID to_evaluate) override;
     void reset() override;
     NodeID getIDofLastEvaluatedNode() const override;
@@ -33,6 +40,37 @@ public:
     void setCachedEval(NodeID node_id, double eval) override { m_evals.setEvaluation(node_id, eval); }
     void setIsDeadEnd(NodeID node_id, bool is_dead_end) override { m_evals.setIsDeadEnd(node_id, is_dead_end); }
 
+    /**
+     * Moves the cache of this evaluator into a new column of the given shared store. Any cached values are discarded.
+     *
+     * Evaluators with additional caches should override this to bind them as well.
+     *
+     * @param store The shared store
+     */
+    virtual void bindEvaluationStore(const std::shared_ptr<EvaluationStore>& store);
+
+    /**
+     * Gets the shared store the cache of this evaluator is bound to.
+     *
+     * @return The store, or null if the cache is not bound to a shared store
+     */
+    const std::shared_ptr<EvaluationStore>& getEvaluationStore() const { return m_evals.getStore(); }
+
+    /**
+     * Sets the type used to store the evaluations of this evaluator when it is bound to a shared store. Integer types
+     * should only be used if all evaluations are integers or infinite.
+     *
+     * @param storage_type The storage type
+     */
+    void setEvaluationStorageType(EvaluationStorageType storage_type) { m_storage_type = storage_type; }
+
+    /**
+     * Gets the type used to store the evaluations of this evaluator when it is bound to a shared store.
+     *
+     * @return The storage type
+     */
+    EvaluationStorageType getEvaluationStorageType() const { return m_storage_type; }
+
 protected:
     /**
      * Sets the cached values for both the evaluation and whether the node is a dead end.
@@ -41,7 +79,17 @@ protected:
      * @param eval The new value for the evaluation
      * @param is_dead_end Whether the node is a dead end or not
      */
-    void setCachedValues(NodeID node_id, double eval, bool is_dead_end) { m_evals.setValues(node_id, eval, is_dead_end); }
+    void setCachedValues(NodeID node_id, double eval, bool is_dead_end);
+
+    /**
+     * Returns if the node with the given ID has had its values set with setCachedValues since the last reset, and since
+     * the node container was last cleared. Nodes that only have room in the cache, such as those added when a shared
+     * store is grown, or nodes whose IDs have been reused, do not have a cached value.
+     *
+     * @param node_id The ID of the node to check
+     * @return If the cache has a value for the node
+     */
+    bool hasCachedValue(NodeID node_id) const;
 
 private:
     /**
@@ -60,6 +108,29 @@ private:
      */
     virtual void doEvaluateAndCache(NodeID to_evaluate) = 0;
 
+    /**
+     * Performs the evaluator specific part of evaluating a batch of nodes. Also caches the values.
+     *
+     * The default implementation prepares the sub-evaluators and calls doEvaluateAndCache for each node in turn, which
+     * is always correct. Evaluators can override this to process the whole batch at once. Composite evaluators that
+     * do so should call evaluateBatch on their sub-evaluators and then read the sub-evaluators' cached values.
+     *
+     * @param to_evaluate The IDs of the nodes to evaluate
+     */
+    virtual void doEvaluateBatchAndCache(const std::vector<NodeID>& to_evaluate);
+
+    /**
+     * Performs the evaluator specific part of a scheduled evaluation, for which all sub-evaluators already have an
+     * evaluation cached for the node. Also caches the value.
+     *
+     * The default implementation prepares the sub-evaluators and calls doEvaluateAndCache, which is correct for any
+     * evaluator. Composite evaluators should override this to compute their value directly from the cached values of
+     * their sub-evaluators.
+     *
+     * @param to_evaluate The ID of the node to evaluate
+     */
+    virtual void doScheduledEvaluateAndCache(NodeID to_evaluate);
+
     /**
      * Performs the evaluator specific part of the re-evaluation. Caches the value if need be.
      *
@@ -79,8 +150,17 @@ private:
     const NodeContainer<State_t, Action_t>* m_nodes = nullptr;  ///< The container of nodes this evaluator is acting on
     std::optional<NodeID> m_last_eval_node_id = std::nullopt;  ///< The NodeID of the last evaluation computed
     EvaluationCache m_evals;  ///< The cache of node evaluations
+    std::uint64_t m_num_container_clears = 0;  ///< The number of clears of the node container when the cache's value flags were last valid
+    EvaluationStorageType m_storage_type = EvaluationStorageType::float64;  ///< The type used to store evaluations in a shared store
 };
 
+template<class State_t, class Action_t>
+void NodeEvaluatorWithCache<State_t, Action_t>::setNodeContainer(const NodeContainer<State_t, Action_t>& nodes) {
+    m_nodes = &nodes;
+    m_evals.clearHasValues();
+    m_num_container_clears = nodes.getNumClears();
+}
+
 template<class State_t, class Action_t>
 void NodeEvaluatorWithCache<State_t, Action_t>::prepareToEvaluate() {
     assert(m_nodes);
@@ -107,6 +187,59 @@ void NodeEvaluatorWithCache<State_t, Action_t>::evaluate(NodeID to_evaluate) {
     assert(m_last_eval_node_id.value() == to_evaluate);
 }
 
+template<class State_t, class Action_t>
+void NodeEvaluatorWithCache<State_t, Action_t>::evaluateBatch(const std::vector<NodeID>& to_evaluate) {
+    assert(m_nodes);
+
+    if (to_evaluate.empty()) {
+        return;
+    }
+
+    if (!m_last_eval_node_id.has_value()) {
+        doEvaluateBatchAndCache(to_evaluate);
+
+        m_last_eval_node_id = to_evaluate.back();
+    }
+
+    assert(m_last_eval_node_id.has_value());
+    assert(m_last_eval_node_id.value() == to_evaluate.back());
+}
+
+template<class State_t, class Action_t>
+void NodeEvaluatorWithCache<State_t, Action_t>::doEvaluateBatchAndCache(const std::vector<NodeID>& to_evaluate) {
+    for (NodeID node_id : to_evaluate) {
+        doPrepare();
+        doEvaluateAndCache(node_id);
+    }
+}
+
+template<class State_t, class Action_t>
+void NodeEvaluatorWithCache<State_t, Action_t>::scheduledEvaluate(NodeID to_evaluate) {
+    assert(m_nodes);
+
+    doScheduledEvaluateAndCache(to_evaluate);
+    m_last_eval_node_id = to_evaluate;
+}
+
+template<class State_t, class Action_t>
+void NodeEvaluatorWithCache<State_t, Action_t>::scheduledEvaluateBatch(const std::vector<NodeID>& to_evaluate) {
+    assert(m_nodes);
+
+    for (NodeID node_id : to_evaluate) {
+        doScheduledEvaluateAndCache(node_id);
+    }
+
+    if (!to_evaluate.empty()) {
+        m_last_eval_node_id = to_evaluate.back();
+    }
+}
+
+template<class State_t, class Action_t>
+void NodeEvaluatorWithCache<State_t, Action_t>::doScheduledEvaluateAndCache(NodeID to_evaluate) {
+    doPrepare();
+    doEvaluateAndCache(to_evaluate);
+}
+
 template<class State_t, class Action_t>
 void NodeEvaluatorWithCache<State_t, Action_t>::reEvaluate(NodeID to_evaluate) {
     assert(m_nodes);
@@ -129,6 +262,29 @@ void NodeEvaluatorWithCache<State_t, Action_t>::reset() {
     doReset();
 }
 
+template<class State_t, class Action_t>
+void NodeEvaluatorWithCache<State_t, Action_t>::bindEvaluationStore(const std::shared_ptr<EvaluationStore>& store) {
+    m_evals.bindToStore(store, m_storage_type);
+}
+
+template<class State_t, class Action_t>
+void NodeEvaluatorWithCache<State_t, Action_t>::setCachedValues(NodeID node_id, double eval, bool is_dead_end) {
+    // Any flags set before the container was last cleared refer to nodes that no longer exist
+    if (m_nodes && m_nodes->getNumClears() != m_num_container_clears) {
+        m_evals.clearHasValues();
+        m_num_container_clears = m_nodes->getNumClears();
+    }
+    m_evals.setValues(node_id, eval, is_dead_end);
+}
+
+template<class State_t, class Action_t>
+bool NodeEvaluatorWithCache<State_t, Action_t>::hasCachedValue(NodeID node_id) const {
+    if (m_nodes && m_nodes->getNumClears() != m_num_container_clears) {
+        return false;
+    }
+    return m_evals.hasValues(node_id);
+}
+
 template<class State_t, class Action_t>
 NodeID NodeEvaluatorWithCache<State_t, Action_t>::getIDofLastEvaluatedNode() const {
     assert(m_last_eval_node_id.has_value());
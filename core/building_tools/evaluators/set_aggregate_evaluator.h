@@ -2,6 +2,7 @@
 #define SET_AGGREGATE_EVALUATOR_H_
 
 #include "building_tools/evaluators/node_evaluator_with_cache.h"
+#include "building_tools/evaluators/set_aggregate_operators.h"
 #include "evaluator_tools_terms.h"
 #include "logging/logging_terms.h"
 #include "logging/search_component_settings.h"
@@ -9,8 +10,10 @@
 #include "search_basics/node_evaluator.h"
 
 #include <cassert>
+#include <cstddef>
 #include <cstdint>
 #include <functional>
+#include <limits>
 #include <string>
 #include <tuple>
 #include <vector>
@@ -24,12 +27,23 @@ enum class SetAggregateReEvaluateType : std::uint8_t {
 /**
  * Represents an evaluator that returns values by aggregating the results from several evaluators according to some
  * binary aggregator operator (ie. max, min, sum, etc.). The operator is assumed to be commutative and associative
+ *
+ * The operator type defaults to a std::function, but can also be one of the operators in set_aggregate_operators.h (or
+ * any other callable type) so that the operator is called directly. Operators with AggregateOperatorTraits also
+ * support counting how often each sub-evaluator determines the aggregate, and skipping sub-evaluators by their upper
+ * bounds.
+ *
+ * By default, every sub-evaluator is evaluated for every node. If lazy evaluation is on, the sub-evaluators are
+ * evaluated in order and evaluation stops as soon as one identifies a dead end. Sub-evaluators skipped this way have
+ * no cached value for the node. When the operator allows it, a sub-evaluator is also skipped if its upper bound is
+ * no larger than the current aggregate, but only if it has been marked as never reporting dead ends. Otherwise,
+ * skipping it could miss a dead end that it would have identified.
  * 
  * TODO: Can't handle single heuristics
  * 
  * @class SetAggregateEvaluator
  */
-template<class State_t, class Action_t>
+template<class State_t, class Action_t, class Operator_t = std::function<double(double, double)>>
 class SetAggregateEvaluator : public NodeEvaluatorWithCache<State_t, Action_t> {
 
 public:
@@ -44,12 +58,62 @@ public:
      * @param re_evaluate_type Defines how the evaluator is to behave on re-evaluation
      */
     SetAggregateEvaluator(const std::vector<NodeEvaluator<State_t, Action_t>*>& sub_evaluators,
-              const std::function<double(double, double)>& aggregator_operator, const std::string& op_label,
+              const Operator_t& aggregator_operator, const std::string& op_label,
               SetAggregateReEvaluateType re_evaluate_type = SetAggregateReEvaluateType::standard);
 
+    /**
+     * Sets whether the sub-evaluators are evaluated lazily. When set, evaluation stops at the first sub-evaluator that
+     * identifies a dead end, and sub-evaluators that cannot identify dead ends and whose upper bound cannot improve the
+     * aggregate are skipped.
+     *
+     * Lazily evaluated sub-evaluators are evaluated rather than re-evaluated when this evaluator re-evaluates a node,
+     * since they may not have a cached value for it.
+     *
+     * @param lazy_evaluation Whether to evaluate the sub-evaluators lazily
+     */
+    void setLazyEvaluation(bool lazy_evaluation) { m_lazy_evaluation = lazy_evaluation; }
+
+    /**
+     * Sets an upper bound on the evaluations of the sub-evaluator at the given index. Only used when evaluating lazily
+     * with an operator for which AggregateOperatorTraits::CAN_SKIP_BY_UPPER_BOUND is true, and when the sub-evaluator
+     * has been marked as never reporting dead ends.
+     *
+     * @param sub_evaluator_index The index of the sub-evaluator
+     * @param upper_bound The largest evaluation the sub-evaluator can return
+     */
+    void setSubEvaluatorUpperBound(std::size_t sub_evaluator_index, double upper_bound);
+
+    /**
+     * Sets whether the sub-evaluator at the given index may identify dead ends. Sub-evaluators are only skipped by
+     * their upper bound if they cannot, so this must be set to false for upper bounds to be used. Defaults to true.
+     *
+     * @param sub_evaluator_index The index of the sub-evaluator
+     * @param may_report_dead_ends Whether the sub-evaluator may identify dead ends
+     */
+    void setSubEvaluatorMayReportDeadEnds(std::size_t sub_evaluator_index, bool may_report_dead_ends);
+
+    /**
+     * Gets the number of nodes for which each sub-evaluator gave the aggregate evaluation. If several sub-evaluators
+     * give the same value, the first is counted. Only counted for operators for which AggregateOperatorTraits::IS_SELECTIVE
+     * is true, and for nodes that are not dead ends.
+     *
+     * A sub-evaluator that rarely or never wins is a candidate for removal.
+     *
+     * @return The win count of each sub-evaluator, in the order they were given
+     */
+    const std::vector<std::uint64_t>& getWinCounts() const { return m_win_counts; }
+
+    /**
+     * Gets the number of sub-evaluator evaluations skipped by lazy evaluation.
+     *
+     * @return The number of skipped evaluations
+     */
+    std::uint64_t getNumSkippedEvaluations() const { return m_num_skipped_evals; }
+
     // Overriden public NodeEvaluator functions
     void setNodeContainer(const NodeContainer<State_t, Action_t>& nodes) override;
     std::vector<NodeEvaluator<State_t, Action_t>*> getSubEvaluators() const override { return m_sub_evaluators; }
+    bool evaluatesSubEvaluatorsLazily() const override { return m_lazy_evaluation; }
 
     // Overriden public SettingsLogger methods
     std::string getName() const override { return CLASS_NAME; }
@@ -58,6 +122,8 @@ protected:
     // Overriden protected NodeEvaluatorWithStorage functions
     void doPrepare() override;
     void doEvaluateAndCache(NodeID to_evaluate) override;
+    void doEvaluateBatchAndCache(const std::vector<NodeID>& to_evaluate) override;
+    void doScheduledEvaluateAndCache(NodeID to_evaluate) override;
     void doReset() override;
     void doReEvaluateAndCache(NodeID to_evaluate) override;
 
@@ -67,87 +133,173 @@ protected:
 
 private:
     /**
-     * Calculates the aggregate evaluation.
+     * Calculates the aggregate evaluation, and updates the win counts.
      *
-     * Assumes that evaluate or re-evaluate has been called for all the sub-evaluators.
-     * Also ignores the previous calculated value and does not cache anything.
+     * The given function is called for each sub-evaluator that is not skipped, and should evaluate the node with that
+     * sub-evaluator if needed and return its evaluation and is_dead_end value. Does not cache anything.
      *
+     * @param get_sub_values Gets the values of the sub-evaluator at the given index
      * @return The newly calculated aggregate eval and is_dead_end value.
      */
-    std::tuple<double, bool> calculateEvaluation();
+    template<class SubValuesFunction_t>
+    std::tuple<double, bool> calculateEvaluation(const SubValuesFunction_t& get_sub_values);
 
     std::vector<NodeEvaluator<State_t, Action_t>*> m_sub_evaluators;  ///< The collection of sub-evaluators to aggregate over
-    std::function<double(double, double)> m_aggregator_operator;  ///< The operator for aggregating heuristic values
+    Operator_t m_aggregator_operator;  ///< The operator for aggregating heuristic values
     std::string m_op_label;  ///< The name of the operation (max, min, sum, etc.)
     SetAggregateReEvaluateType m_re_evaluate_type;  ///< Defines the behaviour to use when re-evaluating
+    bool m_lazy_evaluation = false;  ///< Whether the sub-evaluators are evaluated lazily
+    std::vector<double> m_upper_bounds;  ///< Upper bounds on the evaluations of each sub-evaluator
+    std::vector<bool> m_may_report_dead_ends;  ///< Whether each sub-evaluator may identify dead ends
+    std::vector<std::uint64_t> m_win_counts;  ///< The number of nodes for which each sub-evaluator gave the aggregate
+    std::uint64_t m_num_skipped_evals = 0;  ///< The number of sub-evaluator evaluations skipped by lazy evaluation
 };
 
-template<class State_t, class Action_t>
-void SetAggregateEvaluator<State_t, Action_t>::setNodeContainer(const NodeContainer<State_t, Action_t>& nodes) {
+template<class State_t, class Action_t, class Operator_t>
+void SetAggregateEvaluator<State_t, Action_t, Operator_t>::setNodeContainer(const NodeContainer<State_t, Action_t>& nodes) {
     for (auto* sub_eval : m_sub_evaluators) {
         sub_eval->setNodeContainer(nodes);
     }
     NodeEvaluatorWithCache<State_t, Action_t>::setNodeContainer(nodes);
 }
 
-template<class State_t, class Action_t>
-SetAggregateEvaluator<State_t, Action_t>::SetAggregateEvaluator(
+template<class State_t, class Action_t, class Operator_t>
+SetAggregateEvaluator<State_t, Action_t, Operator_t>::SetAggregateEvaluator(
           const std::vector<NodeEvaluator<State_t, Action_t>*>& sub_evaluators,
-          const std::function<double(double, double)>& aggregator_operator,
+          const Operator_t& aggregator_operator,
           const std::string& op_label, SetAggregateReEvaluateType re_evaluate_type)
-          : m_sub_evaluators(sub_evaluators), m_aggregator_operator(aggregator_operator), m_op_label(op_label), m_re_evaluate_type(re_evaluate_type) {
+          : m_sub_evaluators(sub_evaluators), m_aggregator_operator(aggregator_operator), m_op_label(op_label), m_re_evaluate_type(re_evaluate_type),
+            m_upper_bounds(sub_evaluators.size(), std::numeric_limits<double>::infinity()),
+            m_may_report_dead_ends(sub_evaluators.size(), true), m_win_counts(sub_evaluators.size(), 0) {
+}
+
+template<class State_t, class Action_t, class Operator_t>
+void SetAggregateEvaluator<State_t, Action_t, Operator_t>::setSubEvaluatorUpperBound(std::size_t sub_evaluator_index, double upper_bound) {
+    assert(sub_evaluator_index < m_upper_bounds.size());
+    m_upper_bounds[sub_evaluator_index] = upper_bound;
 }
 
-template<class State_t, class Action_t>
-void SetAggregateEvaluator<State_t, Action_t>::doPrepare() {
+template<class State_t, class Action_t, class Operator_t>
+void SetAggregateEvaluator<State_t, Action_t, Operator_t>::setSubEvaluatorMayReportDeadEnds(std::size_t sub_evaluator_index,
+          bool may_report_dead_ends) {
+    assert(sub_evaluator_index < m_may_report_dead_ends.size());
+    m_may_report_dead_ends[sub_evaluator_index] = may_report_dead_ends;
+}
+
+template<class State_t, class Action_t, class Operator_t>
+void SetAggregateEvaluator<State_t, Action_t, Operator_t>::doPrepare() {
     for (auto* sub_eval : m_sub_evaluators) {
         sub_eval->prepareToEvaluate();
     }
 }
 
-template<class State_t, class Action_t>
-std::tuple<double, bool> SetAggregateEvaluator<State_t, Action_t>::calculateEvaluation() {
+template<class State_t, class Action_t, class Operator_t>
+template<class SubValuesFunction_t>
+std::tuple<double, bool> SetAggregateEvaluator<State_t, Action_t, Operator_t>::calculateEvaluation(const SubValuesFunction_t& get_sub_values) {
     double eval = 0.0;
     bool is_dead_end = false;
     bool first = true;
+    std::size_t winner = 0;
 
-    for (auto& evaluator : m_sub_evaluators) {
-
-        double current_value = evaluator->getLastNodeEval();
-        if (evaluator->isLastNodeADeadEnd()) {
-            is_dead_end = true;
+    for (std::size_t i = 0; i < m_sub_evaluators.size(); ++i) {
+        if constexpr (AggregateOperatorTraits<Operator_t>::CAN_SKIP_BY_UPPER_BOUND) {
+            if (m_lazy_evaluation && !first && !m_may_report_dead_ends[i] && m_upper_bounds[i] <= eval) {
+                m_num_skipped_evals++;
+                continue;
+            }
         }
+
+        auto [current_value, current_is_dead_end] = get_sub_values(i);
         if (first) {
             eval = current_value;
             first = false;
         } else {
-            eval = m_aggregator_operator(eval, current_value);
+            double new_eval = m_aggregator_operator(eval, current_value);
+            if (new_eval != eval) {
+                winner = i;
+            }
+            eval = new_eval;
+        }
+
+        if (current_is_dead_end) {
+            is_dead_end = true;
+
+            if (m_lazy_evaluation) {
+                m_num_skipped_evals += m_sub_evaluators.size() - i - 1;
+                break;
+            }
         }
     }
 
+    if constexpr (AggregateOperatorTraits<Operator_t>::IS_SELECTIVE) {
+        if (!is_dead_end) {
+            m_win_counts[winner]++;
+        }
+    }
     return {eval, is_dead_end};
 }
 
-template<class State_t, class Action_t>
-void SetAggregateEvaluator<State_t, Action_t>::doEvaluateAndCache(NodeID to_evaluate) {
+template<class State_t, class Action_t, class Operator_t>
+void SetAggregateEvaluator<State_t, Action_t, Operator_t>::doEvaluateBatchAndCache(const std::vector<NodeID>& to_evaluate) {
+    assert(!m_sub_evaluators.empty());
+
+    if (m_lazy_evaluation) {
+        for (NodeID node_id : to_evaluate) {
+            doPrepare();
+            doEvaluateAndCache(node_id);
+        }
+        return;
+    }
+
     for (auto& evaluator : m_sub_evaluators) {
-        evaluator->evaluate(to_evaluate);
+        evaluator->evaluateBatch(to_evaluate);
     }
 
-    auto [eval, is_dead_end] = calculateEvaluation();
+    for (NodeID node_id : to_evaluate) {
+        doScheduledEvaluateAndCache(node_id);
+    }
+}
+
+template<class State_t, class Action_t, class Operator_t>
+void SetAggregateEvaluator<State_t, Action_t, Operator_t>::doScheduledEvaluateAndCache(NodeID to_evaluate) {
+    assert(!m_sub_evaluators.empty());
+
+    // Lazily evaluated sub-evaluators are not part of the schedule, so they must be evaluated here
+    if (m_lazy_evaluation) {
+        doPrepare();
+        doEvaluateAndCache(to_evaluate);
+        return;
+    }
+
+    auto [eval, is_dead_end] = calculateEvaluation([this, to_evaluate](std::size_t i) {
+        return std::make_tuple(m_sub_evaluators[i]->getCachedEval(to_evaluate), m_sub_evaluators[i]->getCachedIsDeadEnd(to_evaluate));
+    });
     NodeEvaluatorWithCache<State_t, Action_t>::setCachedValues(to_evaluate, eval, is_dead_end);
 }
 
-template<class State_t, class Action_t>
-void SetAggregateEvaluator<State_t, Action_t>::doReEvaluateAndCache(NodeID to_evaluate) {
+template<class State_t, class Action_t, class Operator_t>
+void SetAggregateEvaluator<State_t, Action_t, Operator_t>::doEvaluateAndCache(NodeID to_evaluate) {
+    auto [eval, is_dead_end] = calculateEvaluation([this, to_evaluate](std::size_t i) {
+        m_sub_evaluators[i]->evaluate(to_evaluate);
+        return std::make_tuple(m_sub_evaluators[i]->getLastNodeEval(), m_sub_evaluators[i]->isLastNodeADeadEnd());
+    });
+    NodeEvaluatorWithCache<State_t, Action_t>::setCachedValues(to_evaluate, eval, is_dead_end);
+}
+
+template<class State_t, class Action_t, class Operator_t>
+void SetAggregateEvaluator<State_t, Action_t, Operator_t>::doReEvaluateAndCache(NodeID to_evaluate) {
     if (m_re_evaluate_type == SetAggregateReEvaluateType::none) {
         return;
     }
-    for (auto& evaluator : m_sub_evaluators) {
-        evaluator->reEvaluate(to_evaluate);
-    }
 
-    auto [eval, is_dead_end] = calculateEvaluation();
+    auto [eval, is_dead_end] = calculateEvaluation([this, to_evaluate](std::size_t i) {
+        if (m_lazy_evaluation) {
+            m_sub_evaluators[i]->evaluate(to_evaluate);
+        } else {
+            m_sub_evaluators[i]->reEvaluate(to_evaluate);
+        }
+        return std::make_tuple(m_sub_evaluators[i]->getLastNodeEval(), m_sub_evaluators[i]->isLastNodeADeadEnd());
+    });
 
     if (m_re_evaluate_type == SetAggregateReEvaluateType::max) {
         eval = std::max(eval, NodeEvaluatorWithCache<State_t, Action_t>::getCachedEval(to_evaluate));
@@ -156,15 +308,17 @@ void SetAggregateEvaluator<State_t, Action_t>::doReEvaluateAndCache(NodeID to_ev
     NodeEvaluatorWithCache<State_t, Action_t>::setCachedValues(to_evaluate, eval, is_dead_end);
 }
 
-template<class State_t, class Action_t>
-void SetAggregateEvaluator<State_t, Action_t>::doReset() {
+template<class State_t, class Action_t, class Operator_t>
+void SetAggregateEvaluator<State_t, Action_t, Operator_t>::doReset() {
     for (auto& evaluator : m_sub_evaluators) {
         evaluator->reset();
     }
+    m_win_counts.assign(m_sub_evaluators.size(), 0);
+    m_num_skipped_evals = 0;
 }
 
-template<class State_t, class Action_t>
-SearchSettingsMap SetAggregateEvaluator<State_t, Action_t>::getSubComponentSettings() const {
+template<class State_t, class Action_t, class Operator_t>
+SearchSettingsMap SetAggregateEvaluator<State_t, Action_t, Operator_t>::getSubComponentSettings() const {
     SearchSettingsMap sub_components;
     for (int i = 0; i < static_cast<int>(m_sub_evaluators.size()); ++i) {
         std::string subeval_role = evaluatorToolsTerms::SETTING_SUBEVALUATOR_PREFIX + std::to_string(i);
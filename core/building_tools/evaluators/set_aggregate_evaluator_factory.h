@@ -2,6 +2,7 @@
 #define SET_AGGREGATE_EVALUATOR_FACTORY_H_
 
 #include "building_tools/evaluators/set_aggregate_evaluator.h"
+#include "building_tools/evaluators/set_aggregate_operators.h"
 #include "evaluator_tools_terms.h"
 #include "search_basics/node_evaluator.h"
 
@@ -43,4 +44,52 @@ SetAggregateEvaluator<State_t, Action_t> getSumEvaluator(
               evaluatorToolsTerms::OP_NAME_SUM, re_evaluate_type);
 }
 
+/**
+ * Generates an evaluator that returns the max evaluation over a set of given evaluators, with the operator known at
+ * compile time. This version also supports win counts and skipping sub-evaluators by their upper bounds.
+ *
+ * @param sub_evaluators The list of sub-evaluators aggregated over
+ * @param re_evaluate_type Defines how the evaluator is to behave on re-evaluation
+ * @return The max evaluator
+ */
+template<class State_t, class Action_t>
+SetAggregateEvaluator<State_t, Action_t, MaxAggregateOperator> getStaticMaxEvaluator(
+          const std::vector<NodeEvaluator<State_t, Action_t>*>& sub_evaluators,
+          SetAggregateReEvaluateType re_evaluate_type = SetAggregateReEvaluateType::standard) {
+    return SetAggregateEvaluator<State_t, Action_t, MaxAggregateOperator>(
+              sub_evaluators, MaxAggregateOperator(), evaluatorToolsTerms::OP_NAME_MAX, re_evaluate_type);
+}
+
+/**
+ * Generates an evaluator that returns the min evaluation over a set of given evaluators, with the operator known at
+ * compile time. This version also supports win counts.
+ *
+ * @param sub_evaluators The list of sub-evaluators aggregated over
+ * @param re_evaluate_type Defines how the evaluator is to behave on re-evaluation
+ * @return The min evaluator
+ */
+template<class State_t, class Action_t>
+SetAggregateEvaluator<State_t, Action_t, MinAggregateOperator> getStaticMinEvaluator(
+          const std::vector<NodeEvaluator<State_t, Action_t>*>& sub_evaluators,
+          SetAggregateReEvaluateType re_evaluate_type = SetAggregateReEvaluateType::standard) {
+    return SetAggregateEvaluator<State_t, Action_t, MinAggregateOperator>(
+              sub_evaluators, MinAggregateOperator(), evaluatorToolsTerms::OP_NAME_MIN, re_evaluate_type);
+}
+
+/**
+ * Generates an evaluator that returns the sum of the evaluations of a given set of evaluators, with the operator known
+ * at compile time.
+ *
+ * @param sub_evaluators The list of sub-evaluators aggregated over
+ * @param re_evaluate_type Defines how the evaluator is to behave on re-evaluation
+ * @return The sum evaluator
+ */
+template<class State_t, class Action_t>
+SetAggregateEvaluator<State_t, Action_t, SumAggregateOperator> getStaticSumEvaluator(
+          const std::vector<NodeEvaluator<State_t, Action_t>*>& sub_evaluators,
+          SetAggregateReEvaluateType re_evaluate_type = SetAggregateReEvaluateType::standard) {
+    return SetAggregateEvaluator<State_t, Action_t, SumAggregateOperator>(
+              sub_evaluators, SumAggregateOperator(), evaluatorToolsTerms::OP_NAME_SUM, re_evaluate_type);
+}
+
 #endif  //SET_AGGREGATE_EVALUATOR_FACTORY_H_
@@ -0,0 +1,61 @@
+#ifndef SET_AGGREGATE_OPERATORS_H_
+#define SET_AGGREGATE_OPERATORS_H_
+
+#include <algorithm>
+#include <functional>
+
+/**
+ * An aggregator operator that takes the max of two evaluations. Can be used as the operator type of a
+ * SetAggregateEvaluator to avoid calling the operator through a std::function.
+ */
+struct MaxAggregateOperator {
+    double operator()(double eval1, double eval2) const { return std::max(eval1, eval2); }  ///< Returns the max of the two evaluations
+};
+
+/**
+ * An aggregator operator that takes the min of two evaluations. Can be used as the operator type of a
+ * SetAggregateEvaluator to avoid calling the operator through a std::function.
+ */
+struct MinAggregateOperator {
+    double operator()(double eval1, double eval2) const { return std::min(eval1, eval2); }  ///< Returns the min of the two evaluations
+};
+
+/**
+ * An aggregator operator that sums two evaluations. Can be used as the operator type of a SetAggregateEvaluator to
+ * avoid calling the operator through a std::function.
+ */
+struct SumAggregateOperator {
+    double operator()(double eval1, double eval2) const { return eval1 + eval2; }  ///< Returns the sum of the two evaluations
+};
+
+/**
+ * Describes the properties of an aggregator operator that a SetAggregateEvaluator can take advantage of. By default,
+ * nothing is assumed about the operator.
+ *
+ * @tparam Operator_t The type of the aggregator operator
+ */
+template<class Operator_t>
+struct AggregateOperatorTraits {
+    static constexpr bool IS_SELECTIVE = false;  ///< Whether the aggregate is always the value of one of the sub-evaluators
+    static constexpr bool CAN_SKIP_BY_UPPER_BOUND = false;  ///< Whether a sub-evaluator whose upper bound is no larger than the current aggregate cannot change it
+};
+
+/**
+ * The properties of the max operator.
+ */
+template<>
+struct AggregateOperatorTraits<MaxAggregateOperator> {
+    static constexpr bool IS_SELECTIVE = true;  ///< The max is always one of the sub-evaluator values
+    static constexpr bool CAN_SKIP_BY_UPPER_BOUND = true;  ///< A value no larger than the current max cannot change it
+};
+
+/**
+ * The properties of the min operator.
+ */
+template<>
+struct AggregateOperatorTraits<MinAggregateOperator> {
+    static constexpr bool IS_SELECTIVE = true;  ///< The min is always one of the sub-evaluator values
+    static constexpr bool CAN_SKIP_BY_UPPER_BOUND = false;  ///< Upper bounds do not help with the min
+};
+
+#endif  //SET_AGGREGATE_OPERATORS_H_
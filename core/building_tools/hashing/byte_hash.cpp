@@ -0,0 +1,125 @@
+#include "building_tools/hashing/byte_hash.h"
+#include "building_tools/hashing/hash_128.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace {
+    const uint64_t SECRET_0 = 0x2d358dccaa6c78a5ULL;  ///< The first mixing constant
+    const uint64_t SECRET_1 = 0x8bb84b93962eacc9ULL;  ///< The second mixing constant
+    const uint64_t SECRET_2 = 0x4b33a62ed433d4a3ULL;  ///< The third mixing constant
+    const uint64_t SECRET_3 = 0x4d5a2da51de1aa47ULL;  ///< The fourth mixing constant
+    const uint64_t SECOND_SEED_OFFSET = 0x9e3779b97f4a7c15ULL;  ///< Changes the seed for the high half of 128-bit hashes
+
+    /**
+     * Replaces the two values with the low and high halves of their 128-bit product.
+     */
+    inline void multiplyFull(uint64_t& value1, uint64_t& value2) {
+#if defined(__SIZEOF_INT128__)
+        __extension__ using UInt128 = unsigned __int128;
+        UInt128 product = static_cast<UInt128>(value1) * value2;
+        value1 = static_cast<uint64_t>(product);
+        value2 = static_cast<uint64_t>(product >> 64U);
+#else
+        uint64_t high1 = value1 >> 32U;
+        uint64_t low1 = static_cast<uint32_t>(value1);
+        uint64_t high2 = value2 >> 32U;
+        uint64_t low2 = static_cast<uint32_t>(value2);
+
+        uint64_t high_high = high1 * high2;
+        uint64_t high_low = high1 * low2;
+        uint64_t low_high = low1 * high2;
+        uint64_t low_low = low1 * low2;
+
+        uint64_t middle = (low_low >> 32U) + static_cast<uint32_t>(high_low) + static_cast<uint32_t>(low_high);
+        value1 = (middle << 32U) | static_cast<uint32_t>(low_low);
+        value2 = high_high + (high_low >> 32U) + (low_high >> 32U) + (middle >> 32U);
+#endif
+    }
+
+    /**
+     * Mixes the two values by XORing the halves of their 128-bit product.
+     */
+    inline uint64_t mix(uint64_t value1, uint64_t value2) {
+        multiplyFull(value1, value2);
+        return value1 ^ value2;
+    }
+
+    /**
+     * Reads 8 bytes as an integer.
+     */
+    inline uint64_t read64(const uint8_t* data) {
+        uint64_t value = 0;
+        std::memcpy(&value, data, sizeof(value));
+        return value;
+    }
+
+    /**
+     * Reads 4 bytes as an integer.
+     */
+    inline uint64_t read32(const uint8_t* data) {
+        uint32_t value = 0;
+        std::memcpy(&value, data, sizeof(value));
+        return value;
+    }
+
+    /**
+     * Combines 1 to 3 bytes into an integer.
+     */
+    inline uint64_t readSmall(const uint8_t* data, std::size_t size) {
+        return (static_cast<uint64_t>(data[0]) << 16U) | (static_cast<uint64_t>(data[size >> 1U]) << 8U) | data[size - 1];
+    }
+}  // namespace
+
+uint64_t hashBytes64(const uint8_t* data, std::size_t size, uint64_t seed) {
+    seed ^= mix(seed ^ SECRET_0, SECRET_1);
+    uint64_t first = 0;
+    uint64_t second = 0;
+
+    if (size <= 16) {
+        if (size >= 4) {
+            std::size_t offset = (size >> 3U) << 2U;
+            first = (read32(data) << 32U) | read32(data + offset);
+            second = (read32(data + size - 4) << 32U) | read32(data + size - 4 - offset);
+        } else if (size > 0) {
+            first = readSmall(data, size);
+        }
+    } else {
+        const uint8_t* pos = data;
+        std::size_t remaining = size;
+
+        if (remaining > 48) {
+            uint64_t seed1 = seed;
+            uint64_t seed2 = seed;
+            do {
+                seed = mix(read64(pos) ^ SECRET_1, read64(pos + 8) ^ seed);
+                seed1 = mix(read64(pos + 16) ^ SECRET_2, read64(pos + 24) ^ seed1);
+                seed2 = mix(read64(pos + 32) ^ SECRET_3, read64(pos + 40) ^ seed2);
+                pos += 48;
+                remaining -= 48;
+            } while (remaining > 48);
+            seed ^= seed1 ^ seed2;
+        }
+
+        while (remaining > 16) {
+            seed = mix(read64(pos) ^ SECRET_1, read64(pos + 8) ^ seed);
+            pos += 16;
+            remaining -= 16;
+        }
+        first = read64(pos + remaining - 16);
+        second = read64(pos + remaining - 8);
+    }
+
+    first ^= SECRET_1;
+    second ^= seed;
+    multiplyFull(first, second);
+    return mix(first ^ SECRET_0 ^ size, second ^ SECRET_1);
+}
+
+Hash128 hashBytes128(const uint8_t* data, std::size_t size, uint64_t seed) {
+    Hash128 hash_value;
+    hash_value.m_low = hashBytes64(data, size, seed);
+    hash_value.m_high = hashBytes64(data, size, seed + SECOND_SEED_OFFSET);
+    return hash_value;
+}
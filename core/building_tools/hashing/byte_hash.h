@@ -0,0 +1,30 @@
+#ifndef BYTE_HASH_H_
+#define BYTE_HASH_H_
+
+#include "building_tools/hashing/hash_128.h"
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * Calculates a 64-bit hash of the given bytes. Uses a multiply-and-fold construction in the style of wyhash, which
+ * consumes 16 or 48 bytes per step and is far faster than formatting the data as a string.
+ *
+ * @param data The first byte to hash
+ * @param size The number of bytes to hash
+ * @param seed The seed of the hash
+ * @return The hash value
+ */
+uint64_t hashBytes64(const uint8_t* data, std::size_t size, uint64_t seed = 0);
+
+/**
+ * Calculates a 128-bit hash of the given bytes, made up of two 64-bit hashes with independent seeds.
+ *
+ * @param data The first byte to hash
+ * @param size The number of bytes to hash
+ * @param seed The seed of the hash
+ * @return The hash value
+ */
+Hash128 hashBytes128(const uint8_t* data, std::size_t size, uint64_t seed = 0);
+
+#endif  //BYTE_HASH_H_
@@ -0,0 +1,91 @@
+#ifndef HASH_128_H_
+#define HASH_128_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+
+/**
+ * A 128-bit hash value. Can be used as the hash value type of search engines that need duplicate detection to be safe
+ * from collisions in very large searches, where 64-bit hash values are expected to collide.
+ *
+ * @class Hash128
+ */
+struct Hash128 {
+    uint64_t m_low = 0;  ///< The low 64 bits of the hash value
+    uint64_t m_high = 0;  ///< The high 64 bits of the hash value
+
+    /**
+     * XORs the given hash value into this one.
+     *
+     * @param other The hash value to XOR in
+     * @return This hash value
+     */
+    Hash128& operator^=(const Hash128& other) {
+        m_low ^= other.m_low;
+        m_high ^= other.m_high;
+        return *this;
+    }
+};
+
+/**
+ * Returns the XOR of the two hash values.
+ *
+ * @param hash1 The first hash value
+ * @param hash2 The second hash value
+ * @return The XOR of the hash values
+ */
+inline Hash128 operator^(Hash128 hash1, const Hash128& hash2) {
+    hash1 ^= hash2;
+    return hash1;
+}
+
+/**
+ * Defines equality of two 128-bit hash values.
+ *
+ * @param hash1 The first hash value
+ * @param hash2 The second hash value
+ * @return If the hash values are equal
+ */
+inline bool operator==(const Hash128& hash1, const Hash128& hash2) {
+    return hash1.m_low == hash2.m_low && hash1.m_high == hash2.m_high;
+}
+
+/**
+ * Defines inequality of two 128-bit hash values.
+ *
+ * @param hash1 The first hash value
+ * @param hash2 The second hash value
+ * @return If the hash values are not equal
+ */
+inline bool operator!=(const Hash128& hash1, const Hash128& hash2) {
+    return !(hash1 == hash2);
+}
+
+/**
+ * Outputs the given hash value as a hexadecimal number to the given output stream.
+ *
+ * @param out The output stream
+ * @param hash The hash value to output
+ * @return The output stream
+ */
+inline std::ostream& operator<<(std::ostream& out, const Hash128& hash) {
+    std::ios_base::fmtflags flags = out.flags();
+    out << std::hex << hash.m_high << ":" << hash.m_low;
+    out.flags(flags);
+    return out;
+}
+
+/**
+ * Hashes 128-bit hash values for use in unordered containers. Since the values are already random, this just uses the
+ * low bits.
+ */
+namespace std {
+template<>
+struct hash<Hash128> {
+    std::size_t operator()(const Hash128& hash_value) const noexcept { return static_cast<std::size_t>(hash_value.m_low); }  ///< Returns the low bits of the hash value
+};
+}  // namespace std
+
+#endif  //HASH_128_H_
@@ -0,0 +1,29 @@
+#ifndef INCREMENTAL_STATE_HASH_FUNCTION_H_
+#define INCREMENTAL_STATE_HASH_FUNCTION_H_
+
+#include "building_tools/hashing/state_hash_function.h"
+
+/**
+ * A state hash function that can also calculate the hash value of a child state from the hash value of its parent and
+ * the action that generated it, which is faster when an action only changes a small part of the state.
+ *
+ * Search engines given a hash function of this type use getChildHash for all generated children.
+ *
+ * @class IncrementalStateHashFunction
+ */
+template<class State_t, class Action_t, class Hash_t>
+class IncrementalStateHashFunction : public StateHashFunction<State_t, Hash_t> {
+public:
+    /**
+     * Gets the hash value of the state that results from applying the given action to the given parent state. Must
+     * equal getHashValue of the child state.
+     *
+     * @param parent_hash The hash value of the parent state
+     * @param parent_state The parent state
+     * @param action The action applied to the parent state
+     * @return The hash value of the child state
+     */
+    virtual Hash_t getChildHash(Hash_t parent_hash, const State_t& parent_state, const Action_t& action) const = 0;
+};
+
+#endif  //INCREMENTAL_STATE_HASH_FUNCTION_H_
@@ -0,0 +1,80 @@
+#ifndef LARGE_PERMUTATION_HASH_FUNCTION_H_
+#define LARGE_PERMUTATION_HASH_FUNCTION_H_
+
+#include "building_tools/hashing/hash_128.h"
+#include "building_tools/hashing/permutation_hash_function.h"
+#include "building_tools/hashing/state_hash_function.h"
+#include "logging/logging_terms.h"
+#include "logging/search_component_settings.h"
+#include "utils/combinatorics.h"
+
+#include <cassert>
+#include <string>
+
+/**
+ * A perfect hash function that ranks permutations of up to 34 elements into 128 bits, for problems such as the
+ * 24-puzzle that are too large for PermutationHashFunction. Gives the same ranks as PermutationHashFunction for
+ * permutations of up to 20 elements.
+ *
+ * Recovering a state with unrank only sets its permutation, so the hash function is only invertible for states that
+ * are fully described by their permutation, as given by isPermutationOnlyState.
+ *
+ * @class LargePermutationHashFunction
+ */
+template<class State_t>
+class LargePermutationHashFunction : public StateHashFunction<State_t, Hash128> {
+public:
+    inline static const std::string CLASS_NAME = "LargePermutationHashFunction";  ///< The name of the class. Defines this component's name
+
+    Hash128 getHashValue(const State_t& state) const override {
+        return getPermutationRank128(state.m_permutation.data(), state.m_permutation.size());
+    }
+    bool isPerfectHashFunction() const override { return true; }
+    bool isInvertible() const override { return isPermutationOnlyState<State_t>; }
+    void unrank(const Hash128& hash_value, State_t& state) const override {
+        getPermutationFromRank128(hash_value, state.m_permutation.data(), state.m_permutation.size());
+    }
+
+    // Overriden public SettingsLogger methods
+    std::string getName() const override { return CLASS_NAME; }
+
+protected:
+    // Overriden protected SettingsLogger methods
+    StringMap getComponentSettings() const override { return {}; }
+    SearchSettingsMap getSubComponentSettings() const override { return {}; }
+};
+
+/**
+ * A perfect hash function that ranks signed permutations of up to 28 elements into 128 bits, for problems such as the
+ * burnt pancake puzzle that are too large for SignedPermutationHashFunction. Gives the same ranks as
+ * SignedPermutationHashFunction for signed permutations of up to 16 elements.
+ *
+ * Recovering a state with unrank only sets its permutation, so the hash function is only invertible for states that
+ * are fully described by their permutation, as given by isPermutationOnlyState.
+ *
+ * @class LargeSignedPermutationHashFunction
+ */
+template<class State_t>
+class LargeSignedPermutationHashFunction : public StateHashFunction<State_t, Hash128> {
+public:
+    inline static const std::string CLASS_NAME = "LargeSignedPermutationHashFunction";  ///< The name of the class. Defines this component's name
+
+    Hash128 getHashValue(const State_t& state) const override {
+        return getSignedPermutationRank128(state.m_permutation.data(), state.m_permutation.size());
+    }
+    bool isPerfectHashFunction() const override { return true; }
+    bool isInvertible() const override { return isPermutationOnlyState<State_t>; }
+    void unrank(const Hash128& hash_value, State_t& state) const override {
+        getSignedPermutationFromRank128(hash_value, state.m_permutation.data(), state.m_permutation.size());
+    }
+
+    // Overriden public SettingsLogger methods
+    std::string getName() const override { return CLASS_NAME; }
+
+protected:
+    // Overriden protected SettingsLogger methods
+    StringMap getComponentSettings() const override { return {}; }
+    SearchSettingsMap getSubComponentSettings() const override { return {}; }
+};
+
+#endif  //LARGE_PERMUTATION_HASH_FUNCTION_H_
@@ -0,0 +1,153 @@
+#ifndef PACKED_PERMUTATION_HASH_FUNCTION_H_
+#define PACKED_PERMUTATION_HASH_FUNCTION_H_
+
+#include "building_tools/hashing/byte_hash.h"
+#include "building_tools/hashing/permutation_hash_function.h"
+#include "building_tools/hashing/state_hash_function.h"
+#include "logging/logging_terms.h"
+#include "logging/search_component_settings.h"
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+inline constexpr std::size_t DEFAULT_PACKED_PERMUTATION_CAPACITY = 64;  ///< The default largest permutation size of a packed key
+
+/**
+ * A perfect key for a permutation that stores each entry in a single byte. Entries must be between -128 and 127, so
+ * the key works for signed and unsigned permutations of any size up to the capacity. The bytes are stored inline, so
+ * keys can be copied and stored in hash maps without heap allocations.
+ *
+ * @tparam CAPACITY The largest permutation size that can be stored
+ * @class PackedPermutationKey
+ */
+template<std::size_t CAPACITY = DEFAULT_PACKED_PERMUTATION_CAPACITY>
+struct PackedPermutationKey {
+    static_assert(CAPACITY <= 255, "The size of the permutation is stored in a single byte");
+
+    std::array<uint8_t, CAPACITY> m_bytes{};  ///< The entries of the permutation. Unused bytes are 0
+    uint8_t m_size = 0;  ///< The number of entries in the permutation
+};
+
+/**
+ * Defines equality of two packed permutation keys.
+ *
+ * @param key1 The first key
+ * @param key2 The second key
+ * @return If the keys are equal
+ */
+template<std::size_t CAPACITY>
+bool operator==(const PackedPermutationKey<CAPACITY>& key1, const PackedPermutationKey<CAPACITY>& key2) {
+    return key1.m_size == key2.m_size && std::memcmp(key1.m_bytes.data(), key2.m_bytes.data(), key1.m_size) == 0;
+}
+
+/**
+ * Defines inequality of two packed permutation keys.
+ *
+ * @param key1 The first key
+ * @param key2 The second key
+ * @return If the keys are not equal
+ */
+template<std::size_t CAPACITY>
+bool operator!=(const PackedPermutationKey<CAPACITY>& key1, const PackedPermutationKey<CAPACITY>& key2) {
+    return !(key1 == key2);
+}
+
+/**
+ * Outputs the entries of the given key, separated by spaces, to the given output stream.
+ *
+ * @param out The output stream
+ * @param key The key to output
+ * @return The output stream
+ */
+template<std::size_t CAPACITY>
+std::ostream& operator<<(std::ostream& out, const PackedPermutationKey<CAPACITY>& key) {
+    for (std::size_t i = 0; i < key.m_size; i++) {
+        if (i > 0) {
+            out << " ";
+        }
+        out << static_cast<int>(static_cast<int8_t>(key.m_bytes[i]));
+    }
+    return out;
+}
+
+/**
+ * Hashes packed permutation keys for use in unordered containers, using the fast byte hash.
+ */
+namespace std {
+template<std::size_t CAPACITY>
+struct hash<PackedPermutationKey<CAPACITY>> {
+    std::size_t operator()(const PackedPermutationKey<CAPACITY>& key) const noexcept {
+        return static_cast<std::size_t>(hashBytes64(key.m_bytes.data(), key.m_size));
+    }  ///< Returns the byte hash of the entries of the key
+};
+}  // namespace std
+
+/**
+ * A perfect hash function for permutations of any size (up to the capacity of the key) that packs each entry of the
+ * permutation into a byte. Used for problems that are too large to be ranked in 128 bits, such as the 40-pancake
+ * puzzle, in place of hashing the state as a string.
+ *
+ * Recovering a state with unrank only sets its permutation, so the hash function is only invertible for states that
+ * are fully described by their permutation, as given by isPermutationOnlyState.
+ *
+ * Throws a std::length_error when hashing a permutation larger than the capacity, and a std::domain_error when an entry
+ * does not fit in a byte.
+ *
+ * @tparam State_t The type of state, which must store its permutation in m_permutation
+ * @tparam CAPACITY The largest permutation size that can be hashed
+ * @class PackedPermutationHashFunction
+ */
+template<class State_t, std::size_t CAPACITY = DEFAULT_PACKED_PERMUTATION_CAPACITY>
+class PackedPermutationHashFunction : public StateHashFunction<State_t, PackedPermutationKey<CAPACITY>> {
+public:
+    inline static const std::string CLASS_NAME = "PackedPermutationHashFunction";  ///< The name of the class. Defines this component's name
+
+    PackedPermutationKey<CAPACITY> getHashValue(const State_t& state) const override;
+    bool isPerfectHashFunction() const override { return true; }
+    bool isInvertible() const override { return isPermutationOnlyState<State_t>; }
+    void unrank(const PackedPermutationKey<CAPACITY>& hash_value, State_t& state) const override;
+
+    // Overriden public SettingsLogger methods
+    std::string getName() const override { return CLASS_NAME; }
+
+protected:
+    // Overriden protected SettingsLogger methods
+    StringMap getComponentSettings() const override { return {}; }
+    SearchSettingsMap getSubComponentSettings() const override { return {}; }
+};
+
+template<class State_t, std::size_t CAPACITY>
+PackedPermutationKey<CAPACITY> PackedPermutationHashFunction<State_t, CAPACITY>::getHashValue(const State_t& state) const {
+    if (state.m_permutation.size() > CAPACITY) {
+        throw std::length_error("Cannot pack a permutation of size " + std::to_string(state.m_permutation.size())
+                  + " into a key of capacity " + std::to_string(CAPACITY));
+    }
+    PackedPermutationKey<CAPACITY> key;
+    key.m_size = static_cast<uint8_t>(state.m_permutation.size());
+
+    for (std::size_t i = 0; i < state.m_permutation.size(); i++) {
+        if (state.m_permutation[i] < -128 || state.m_permutation[i] > 127) {
+            throw std::domain_error("Permutation entry " + std::to_string(state.m_permutation[i]) + " does not fit in a byte");
+        }
+        key.m_bytes[i] = static_cast<uint8_t>(static_cast<int8_t>(state.m_permutation[i]));
+    }
+    return key;
+}
+
+template<class State_t, std::size_t CAPACITY>
+void PackedPermutationHashFunction<State_t, CAPACITY>::unrank(const PackedPermutationKey<CAPACITY>& hash_value,
+          State_t& state) const {
+    state.m_permutation.resize(hash_value.m_size);
+    for (std::size_t i = 0; i < hash_value.m_size; i++) {
+        state.m_permutation[i] = static_cast<int8_t>(hash_value.m_bytes[i]);
+    }
+}
+
+#endif  //PACKED_PERMUTATION_HASH_FUNCTION_H_
@@ -9,7 +9,22 @@
 #include <cassert>
 #include <cstdint>
 #include <string>
+#include <type_traits>
 
+/**
+ * Whether states of the given type are fully described by their permutation, so that a permutation hash function can
+ * recover them with unrank. States opt in by defining a static constexpr bool IS_PERMUTATION_ONLY set to true.
+ * Otherwise, such as for sliding tile states that also store the location of the blank, permutation hash functions are
+ * not invertible.
+ *
+ * @tparam State_t The type of state
+ */
+template<class State_t, class = void>
+inline constexpr bool isPermutationOnlyState = false;
+
+template<class State_t>
+inline constexpr bool isPermutationOnlyState<State_t, std::void_t<decltype(State_t::IS_PERMUTATION_ONLY)>> =
+          State_t::IS_PERMUTATION_ONLY;
 
 /**
  * A simple hash function that compute non-repeating hashes by overlaying factorial value based on each state 
@@ -17,6 +32,8 @@
  * In the case of the pancake puzzle, the incoming numbers represent different sizes of pancakes. 
  * 
  * In the case of the sliding puzzle, the incoming numbers represent the positions of the different squares
+ *
+ * Only invertible for states that are fully described by their permutation, as given by isPermutationOnlyState.
  * 
  * @class PermutationHashFunction
  */
@@ -27,6 +44,8 @@ public:
 
     uint64_t getHashValue(const State_t& state) const override;
     bool isPerfectHashFunction() const override { return true; };
+    bool isInvertible() const override { return isPermutationOnlyState<State_t>; }
+    void unrank(const uint64_t& hash_value, State_t& state) const override;
 
     // Overriden public SettingsLogger methods
     std::string getName() const override { return CLASS_NAME; }
@@ -43,4 +62,9 @@ uint64_t PermutationHashFunction<State_t>::getHashValue(const State_t& state) co
     return getPermutationRank(state.m_permutation);
 }
 
+template<class State_t>
+void PermutationHashFunction<State_t>::unrank(const uint64_t& hash_value, State_t& state) const {
+    getPermutationFromRank(hash_value, state.m_permutation.data(), state.m_permutation.size());
+}
+
 #endif  //PERMUTATION_HASH_FUNCTION_H_
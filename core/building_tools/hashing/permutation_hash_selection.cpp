@@ -0,0 +1,37 @@
+#include "building_tools/hashing/permutation_hash_selection.h"
+#include "utils/combinatorics.h"
+
+#include <cstddef>
+#include <iostream>
+
+std::ostream& operator<<(std::ostream& out, PermutationHashType hash_type) {
+    switch (hash_type) {
+        case PermutationHashType::rank64:
+            out << "rank64";
+            break;
+        case PermutationHashType::rank128:
+            out << "rank128";
+            break;
+        case PermutationHashType::packed_bytes:
+            out << "packed_bytes";
+            break;
+        case PermutationHashType::state_string:
+            out << "state_string";
+            break;
+    }
+    return out;
+}
+
+PermutationHashType getPermutationHashType(std::size_t num_elements, bool is_signed) {
+    std::size_t max_rank64_size = is_signed ? 16 : 20;
+    std::size_t max_rank128_size = is_signed ? MAX_128_BIT_SIGNED_PERMUTATION_RANK_SIZE : MAX_128_BIT_PERMUTATION_RANK_SIZE;
+
+    if (num_elements <= max_rank64_size) {
+        return PermutationHashType::rank64;
+    } else if (num_elements <= max_rank128_size) {
+        return PermutationHashType::rank128;
+    } else if (num_elements <= DEFAULT_PACKED_PERMUTATION_CAPACITY) {
+        return PermutationHashType::packed_bytes;
+    }
+    return PermutationHashType::state_string;
+}
@@ -0,0 +1,80 @@
+#ifndef PERMUTATION_HASH_SELECTION_H_
+#define PERMUTATION_HASH_SELECTION_H_
+
+#include "building_tools/hashing/large_permutation_hash_function.h"
+#include "building_tools/hashing/packed_permutation_hash_function.h"
+#include "building_tools/hashing/permutation_hash_function.h"
+#include "building_tools/hashing/signed_permutation_hash_function.h"
+#include "building_tools/hashing/state_string_hash_function.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+
+/**
+ * The kinds of perfect hash functions available for permutation problems, from fastest to most general.
+ */
+enum class PermutationHashType : uint8_t {
+    rank64,  ///< Ranks the permutation into 64 bits
+    rank128,  ///< Ranks the permutation into 128 bits
+    packed_bytes,  ///< Packs each entry of the permutation into a byte
+    state_string  ///< Hashes the state as a string
+};
+
+/**
+ * Outputs the given permutation hash type to the given output stream.
+ *
+ * @param out The output stream
+ * @param hash_type The hash type to output
+ * @return The output stream
+ */
+std::ostream& operator<<(std::ostream& out, PermutationHashType hash_type);
+
+/**
+ * Gets the fastest perfect hash function type that can hash permutations of the given size. Unsigned permutations
+ * are ranked into 64 bits for up to 20 elements and into 128 bits for up to 34, and signed permutations for up to 16
+ * and 28 elements respectively. Larger permutations are packed into bytes for up to DEFAULT_PACKED_PERMUTATION_CAPACITY
+ * elements, and states with even larger permutations are hashed as strings.
+ *
+ * @param num_elements The size of the permutations
+ * @param is_signed Whether the permutations are signed, as in the burnt pancake puzzle
+ * @return The hash function type to use
+ */
+PermutationHashType getPermutationHashType(std::size_t num_elements, bool is_signed);
+
+/**
+ * Calls the given function with the fastest perfect hash function for permutations of the given size, as selected by
+ * getPermutationHashType. Since the type of the hash values depends on the size, the function should be generic in the
+ * type of hash function (such as a lambda with an auto parameter), and is instantiated for each of them.
+ *
+ * @param num_elements The size of the permutations
+ * @param is_signed Whether the permutations are signed, as in the burnt pancake puzzle
+ * @param function The function to call with the hash function
+ */
+template<class State_t, class Function_t>
+void callWithPermutationHashFunction(std::size_t num_elements, bool is_signed, Function_t function) {
+    switch (getPermutationHashType(num_elements, is_signed)) {
+        case PermutationHashType::rank64:
+            if (is_signed) {
+                function(SignedPermutationHashFunction<State_t>());
+            } else {
+                function(PermutationHashFunction<State_t>());
+            }
+            break;
+        case PermutationHashType::rank128:
+            if (is_signed) {
+                function(LargeSignedPermutationHashFunction<State_t>());
+            } else {
+                function(LargePermutationHashFunction<State_t>());
+            }
+            break;
+        case PermutationHashType::packed_bytes:
+            function(PackedPermutationHashFunction<State_t>());
+            break;
+        case PermutationHashType::state_string:
+            function(StateStringHashFunction<State_t>());
+            break;
+    }
+}
+
+#endif  //PERMUTATION_HASH_SELECTION_H_
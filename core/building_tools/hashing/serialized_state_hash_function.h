@@ -0,0 +1,74 @@
+#ifndef SERIALIZED_STATE_HASH_FUNCTION_H_
+#define SERIALIZED_STATE_HASH_FUNCTION_H_
+
+#include "building_tools/hashing/byte_hash.h"
+#include "building_tools/hashing/hash_128.h"
+#include "building_tools/hashing/state_hash_function.h"
+#include "logging/search_component_settings.h"
+#include "utils/byte_sink.h"
+
+#include <cstdint>
+#include <string>
+#include <type_traits>
+
+/**
+ * A generic hash function that serializes the state into bytes and hashes them with a fast 64-bit or 128-bit byte hash.
+ * Can be used for any state type with an overload of serialize(ByteSink&, const State_t&), and is a much faster and
+ * more compact alternative to StateStringHashFunction, since it only stores a fixed-size digest per state.
+ *
+ * The hash function is not perfect, so search engines can be set to verify that states with matching hash values are
+ * actually equal. Using Hash128 as the hash value type makes collisions extremely unlikely.
+ *
+ * The sink used for serialization is reused between calls to avoid allocating, so a single hash function should not
+ * be used from multiple threads at once.
+ *
+ * @tparam State_t The type of state
+ * @tparam Hash_t The hash value type, which is either uint64_t or Hash128
+ * @class SerializedStateHashFunction
+ */
+template<class State_t, class Hash_t = uint64_t>
+class SerializedStateHashFunction : public StateHashFunction<State_t, Hash_t> {
+    static_assert(std::is_same_v<Hash_t, uint64_t> || std::is_same_v<Hash_t, Hash128>,
+              "SerializedStateHashFunction needs uint64_t or Hash128 hash values");
+
+public:
+    inline static const std::string CLASS_NAME = "SerializedStateHashFunction";  ///< The name of the class. Defines this component's name
+
+    /**
+     * Creates the hash function with the given seed.
+     *
+     * @param seed The seed of the byte hash
+     */
+    explicit SerializedStateHashFunction(uint64_t seed = 0)
+              : m_seed(seed) {}
+
+    // Overriden HashFunction methods
+    Hash_t getHashValue(const State_t& state) const override;
+    bool isPerfectHashFunction() const override { return false; }
+
+    // Overriden public SettingsLogger methods
+    std::string getName() const override { return CLASS_NAME; }
+
+protected:
+    // Overriden protected SettingsLogger methods
+    StringMap getComponentSettings() const override { return {{"seed", std::to_string(m_seed)}}; };
+    SearchSettingsMap getSubComponentSettings() const override { return {}; }
+
+private:
+    uint64_t m_seed = 0;  ///< The seed of the byte hash
+    mutable ByteSink m_sink;  ///< The sink states are serialized into
+};
+
+template<class State_t, class Hash_t>
+Hash_t SerializedStateHashFunction<State_t, Hash_t>::getHashValue(const State_t& state) const {
+    m_sink.clear();
+    serialize(m_sink, state);
+
+    if constexpr (std::is_same_v<Hash_t, Hash128>) {
+        return hashBytes128(m_sink.getData(), m_sink.getSize(), m_seed);
+    } else {
+        return hashBytes64(m_sink.getData(), m_sink.getSize(), m_seed);
+    }
+}
+
+#endif  //SERIALIZED_STATE_HASH_FUNCTION_H_
@@ -1,13 +1,22 @@
 #ifndef SIGNED_PERMUTATION_HASH_FUNCTION_H_
 #define SIGNED_PERMUTATION_HASH_FUNCTION_H_
 
+#include "building_tools/hashing/permutation_hash_function.h"
 #include "building_tools/hashing/state_hash_function.h"
 #include "utils/combinatorics.h"
 
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
 
 /**
  * A hash function for burnt pancake puzzle, based on the regular permutation hash function,
  * will consider the burnt side to generate a unique hash function
+ *
+ * Only invertible for states that are fully described by their permutation, as given by isPermutationOnlyState.
  */
 template<class State_t>
 class SignedPermutationHashFunction : public StateHashFunction<State_t, uint64_t> {
@@ -16,6 +25,8 @@ public:
 
     uint64_t getHashValue(const State_t& state) const override;
     bool isPerfectHashFunction() const override { return true; }
+    bool isInvertible() const override { return isPermutationOnlyState<State_t>; }
+    void unrank(const uint64_t& hash_value, State_t& state) const override;
 
     // Overriden public SettingsLogger methods
     std::string getName() const override { return CLASS_NAME; }
@@ -29,15 +40,28 @@ protected:
 template<class State_t>
 inline uint64_t SignedPermutationHashFunction<State_t>::getHashValue(const State_t& state) const {
     assert(state.m_permutation.size() <= 16);
+    const std::vector<int>& permutation = state.m_permutation;
+    uint64_t signed_ranking = getBitVectorRanking(permutation.data(), permutation.size());
+    uint64_t max_unsigned_ranking = get64BitFactorial(static_cast<unsigned>(permutation.size()));
+    uint64_t unsigned_ranking = getUnsignedPermutationRank(permutation.data(), permutation.size());
+    return signed_ranking * max_unsigned_ranking + unsigned_ranking;
+}
 
-    std::vector<int> permutation = state.m_permutation;
-    uint64_t signed_ranking = getBitVectorRanking(permutation);
-    auto max_unsigned_ranking = static_cast<uint16_t>(get64BitFactorial(static_cast<unsigned>(permutation.size())));
+template<class State_t>
+void SignedPermutationHashFunction<State_t>::unrank(const uint64_t& hash_value, State_t& state) const {
+    std::vector<int>& permutation = state.m_permutation;
+    uint64_t max_unsigned_ranking = get64BitFactorial(static_cast<unsigned>(permutation.size()));
+    uint64_t signed_ranking = hash_value / max_unsigned_ranking;
 
-    convertPermutationState(permutation);
-    uint64_t unsigned_ranking = getPermutationRank(permutation);
+    getPermutationFromRank(hash_value % max_unsigned_ranking, permutation.data(), permutation.size());
+    for (std::size_t i = 0; i < permutation.size(); i++) {
+        permutation[i] += 1;
 
-    return signed_ranking * max_unsigned_ranking + unsigned_ranking;
+        // The sign of the first entry is the highest bit of the signed ranking
+        if ((signed_ranking >> (permutation.size() - 1 - i)) % 2 == 1) {
+            permutation[i] *= -1;
+        }
+    }
 }
 
 #endif  //SIGNED_PERMUTATION_HASH_FUNCTION_H_
\ No newline at end of file
@@ -3,6 +3,8 @@
 
 #include "logging/settings_logger.h"
 
+#include <cassert>
+
 /**
  * A class defining a hash function for states. The hash value type should be a type that std::hash already has
  * a built in specialization setup for.
@@ -26,6 +28,28 @@ public:
      * @return Whether the hash function is guaranteed to return unique values.
      */
     virtual bool isPerfectHashFunction() const = 0;
+
+    /**
+     * Can states be recovered from their hash values with unrank. Only perfect hash functions can be invertible, and
+     * only if unrank restores every member of the state.
+     *
+     * @return Whether the hash function is invertible
+     */
+    virtual bool isInvertible() const { return false; }
+
+    /**
+     * Recovers the state with the given hash value, writing it into the given state. The given state must have the
+     * same shape (such as the number of rows and columns) as the state that was hashed, so that a single scratch state
+     * can be reused without allocating.
+     *
+     * Only supported if isInvertible returns true.
+     *
+     * @param hash_value The hash value of the state to recover
+     * @param state The state to write the recovered state into
+     */
+    virtual void unrank([[maybe_unused]] const Hash_t& hash_value, [[maybe_unused]] State_t& state) const {
+        assert(false && "This hash function is not invertible");
+    }
 };
 
 #endif  //STATE_HASH_FUNCTION_H_
\ No newline at end of file
@@ -0,0 +1,125 @@
+#ifndef ZOBRIST_HASH_FUNCTION_H_
+#define ZOBRIST_HASH_FUNCTION_H_
+
+#include "building_tools/hashing/hash_128.h"
+#include "building_tools/hashing/incremental_state_hash_function.h"
+#include "logging/search_component_settings.h"
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+/**
+ * Generates a random key for a Zobrist hash table.
+ *
+ * @tparam Hash_t The hash value type, which is either an unsigned integer type or Hash128
+ * @param rand_gen The random number generator to use
+ * @return The random key
+ */
+template<class Hash_t>
+Hash_t getRandomZobristKey(std::mt19937_64& rand_gen) {
+    if constexpr (std::is_same_v<Hash_t, Hash128>) {
+        Hash128 key;
+        key.m_low = rand_gen();
+        key.m_high = rand_gen();
+        return key;
+    } else {
+        static_assert(std::is_unsigned_v<Hash_t>, "Zobrist hash values must be unsigned integers or Hash128");
+        return static_cast<Hash_t>(rand_gen());
+    }
+}
+
+/**
+ * A Zobrist hash function for states represented by a permutation of values stored in m_permutation.
+ *
+ * A random key is generated for every pair of a position and a value, and the hash value of a state is the XOR of the
+ * keys of the value in each position. Since applying an action only XORs out the keys of the changed positions and XORs
+ * in the new ones, the hash value of a child can be calculated from that of its parent in time proportional to the
+ * number of positions the action changes. Derived classes implement this for the actions of their domain.
+ *
+ * The hash function is not perfect, so engines that use it compare generated states to the stored state with the same
+ * hash value. Using Hash128 as the hash value type makes such collisions extremely unlikely even in very large searches.
+ *
+ * @tparam State_t The type of state, which must have a vector of int values called m_permutation
+ * @tparam Action_t The type of action
+ * @tparam Hash_t The hash value type, which is either an unsigned integer type or Hash128
+ * @class ZobristHashFunction
+ */
+template<class State_t, class Action_t, class Hash_t>
+class ZobristHashFunction : public IncrementalStateHashFunction<State_t, Action_t, Hash_t> {
+public:
+    /**
+     * Creates a Zobrist hash function for permutations of the given size whose values are all in the given range.
+     *
+     * @param num_positions The number of positions in a permutation
+     * @param min_value The smallest value that can be in a position
+     * @param max_value The largest value that can be in a position
+     * @param seed The seed used to generate the random keys
+     */
+    ZobristHashFunction(std::size_t num_positions, int min_value, int max_value, uint64_t seed);
+
+    Hash_t getHashValue(const State_t& state) const override;
+    bool isPerfectHashFunction() const override { return false; }
+
+    /**
+     * Gets the seed used to generate the random keys.
+     *
+     * @return The seed
+     */
+    uint64_t getSeed() const { return m_seed; }
+
+protected:
+    /**
+     * Gets the random key for the given value in the given position.
+     *
+     * @param position The position
+     * @param value The value in the position
+     * @return The key for the value in the position
+     */
+    const Hash_t& getKey(std::size_t position, int value) const {
+        assert(position < m_num_positions && value >= m_min_value && value - m_min_value < m_num_values);
+        return m_keys[position * m_num_values + static_cast<std::size_t>(value - m_min_value)];
+    }
+
+    // Overriden protected SettingsLogger methods
+    StringMap getComponentSettings() const override { return {{"seed", std::to_string(m_seed)}}; }
+    SearchSettingsMap getSubComponentSettings() const override { return {}; }
+
+private:
+    std::size_t m_num_positions = 0;  ///< The number of positions in a permutation
+    int m_min_value = 0;  ///< The smallest value that can be in a position
+    int m_num_values = 0;  ///< The number of values that can be in a position
+    uint64_t m_seed = 0;  ///< The seed used to generate the keys
+
+    std::vector<Hash_t> m_keys;  ///< The keys of each position and value, with the values for each position stored together
+};
+
+template<class State_t, class Action_t, class Hash_t>
+ZobristHashFunction<State_t, Action_t, Hash_t>::ZobristHashFunction(std::size_t num_positions, int min_value,
+          int max_value, uint64_t seed)
+          : m_num_positions(num_positions), m_min_value(min_value), m_num_values(max_value - min_value + 1), m_seed(seed) {
+    assert(max_value >= min_value);
+    std::mt19937_64 rand_gen(seed);
+
+    m_keys.resize(m_num_positions * static_cast<std::size_t>(m_num_values));
+    for (Hash_t& key : m_keys) {
+        key = getRandomZobristKey<Hash_t>(rand_gen);
+    }
+}
+
+template<class State_t, class Action_t, class Hash_t>
+Hash_t ZobristHashFunction<State_t, Action_t, Hash_t>::getHashValue(const State_t& state) const {
+    assert(state.m_permutation.size() == m_num_positions);
+    Hash_t hash_value{};
+
+    for (std::size_t pos = 0; pos < m_num_positions; ++pos) {
+        hash_value ^= getKey(pos, state.m_permutation[pos]);
+    }
+    return hash_value;
+}
+
+#endif  //ZOBRIST_HASH_FUNCTION_H_
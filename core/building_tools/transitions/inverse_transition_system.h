@@ -0,0 +1,77 @@
+#ifndef INVERSE_TRANSITION_SYSTEM_H_
+#define INVERSE_TRANSITION_SYSTEM_H_
+
+#include "building_tools/transitions/transitions_tools_terms.h"
+#include "logging/logging_terms.h"
+#include "logging/search_component_settings.h"
+#include "search_basics/transition_system.h"
+
+#include <cassert>
+#include <optional>
+#include <string>
+#include <vector>
+
+/**
+ * The backward transition system of a domain in which every action has an inverse. Applying an action in a state
+ * generates one of the predecessors of that state in the forward transition system.
+ *
+ * The actions of the backward transition system are those of the forward transition system, and the inverse of an
+ * action applied in a state is the forward action that leads from the generated predecessor back to that state. The
+ * cost of an action is the cost of that forward action, so that the g-cost of a node in a backward search is the cost
+ * of the forward path from the node to the state the search was started from.
+ *
+ * @tparam State_t The type of state
+ * @tparam Action_t The type of action
+ * @class InverseTransitionSystem
+ */
+template<class State_t, class Action_t>
+class InverseTransitionSystem : public TransitionSystem<State_t, Action_t> {
+public:
+    inline static const std::string CLASS_NAME = "InverseTransitionSystem";  ///< The name of the class. Defines this component's name
+
+    /**
+     * Creates the backward transition system of the given forward transition system. Assumes every action of the
+     * forward transition system has an inverse.
+     *
+     * @param forward_transitions The forward transition system
+     */
+    explicit InverseTransitionSystem(const TransitionSystem<State_t, Action_t>& forward_transitions)
+              : m_forward_transitions(&forward_transitions) {}
+
+    // Overriden TransitionSystem methods
+    std::vector<Action_t> getActions(const State_t& state) const override { return m_forward_transitions->getActions(state); }
+    bool isApplicable(const State_t& state, const Action_t& action) const override { return m_forward_transitions->isApplicable(state, action); }
+    void applyAction(State_t& state, const Action_t& action) const override { m_forward_transitions->applyAction(state, action); }
+    double getActionCost(const State_t& state, const Action_t& action) const override;
+    std::optional<Action_t> getInverse(const State_t& state, const Action_t& action) const override { return m_forward_transitions->getInverse(state, action); }
+    bool isValidState(const State_t& state) const override { return m_forward_transitions->isValidState(state); }
+
+    // Overriden public SettingsLogger methods
+    std::string getName() const override { return CLASS_NAME; }
+
+protected:
+    // Overriden protected SettingsLogger methods
+    StringMap getComponentSettings() const override { return {}; }
+    SearchSettingsMap getSubComponentSettings() const override;
+
+private:
+    const TransitionSystem<State_t, Action_t>* m_forward_transitions;  ///< The forward transition system
+};
+
+template<class State_t, class Action_t>
+double InverseTransitionSystem<State_t, Action_t>::getActionCost(const State_t& state, const Action_t& action) const {
+    State_t predecessor = m_forward_transitions->getChildState(state, action);
+    std::optional<Action_t> forward_action = m_forward_transitions->getInverse(state, action);
+    assert(forward_action.has_value());
+
+    return m_forward_transitions->getActionCost(predecessor, forward_action.value());
+}
+
+template<class State_t, class Action_t>
+SearchSettingsMap InverseTransitionSystem<State_t, Action_t>::getSubComponentSettings() const {
+    SearchSettingsMap sub_components;
+    sub_components[transitionsToolsTerms::SETTING_FORWARD_TRANSITIONS] = m_forward_transitions->getAllSettings();
+    return sub_components;
+}
+
+#endif  //INVERSE_TRANSITION_SYSTEM_H_
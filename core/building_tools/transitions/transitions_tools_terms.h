@@ -0,0 +1,13 @@
+#ifndef TRANSITIONS_TOOLS_TERMS_H_
+#define TRANSITIONS_TOOLS_TERMS_H_
+
+#include <string>
+
+/**
+ * Terms to use for logging of the transition system tools.
+ */
+namespace transitionsToolsTerms {
+    inline const std::string SETTING_FORWARD_TRANSITIONS = "forward_transitions";  ///< The forward transition system used by an InverseTransitionSystem
+}  // namespace transitionsToolsTerms
+
+#endif  //TRANSITIONS_TOOLS_TERMS_H_
@@ -2,6 +2,7 @@
 #define A_STAR_EPSILON_H_
 
 #include "a_star_epsilon_params.h"
+#include "building_tools/hashing/incremental_state_hash_function.h"
 #include "building_tools/hashing/state_hash_function.h"
 #include "engines/engine_components/eval_functions/f_cost_evaluator.h"
 #include "engines/engine_components/node_containers/node_list.h"
@@ -56,7 +57,9 @@ public:
     void setHeuristic(NodeEvaluator<State_t, Action_t>& heuristic);
 
     /** 
-     * Sets the Hash function used in the search
+     * Sets the Hash function used in the search. If it is an IncrementalStateHashFunction, the hash value of each child
+     * is calculated from the hash value of its parent. If the hash function is not perfect, every generated state is
+     * compared to the stored state with the same hash value, so that states with colliding hash values are kept apart.
      * 
      * @param hash The new hash function
      */
@@ -126,6 +129,18 @@ public:
      */
     std::optional<NodeID> getNodeID(Hash_t hash_value) const;
 
+    /**
+     * Returns the ID of the node for the given state, among the nodes whose hash value was already associated with a
+     * different state when they were generated.
+     *
+     * Returns std::nullopt if there is no such node
+     *
+     * @param hash_value The hash value of the state
+     * @param state The state searching for
+     * @return The ID of the node for the given state, or null value
+     */
+    std::optional<NodeID> getCollidingNodeID(Hash_t hash_value, const State_t& state) const;
+
     /**
      * Returns the f-cost evaluator.
      *
@@ -194,6 +209,7 @@ private:
     AStarEpsilonParams m_params;
     NodeList<State_t, Action_t> m_nodes;  ///< The list of nodes
     NodeMap m_node_map;  ///< The map used to determine if a hash value is already associated with a node.
+    std::unordered_map<Hash_t, std::vector<NodeID>> m_colliding_nodes;  ///< The nodes whose hash value was already associated with a different state in the map
     HeapBasedOpenList<State_t, Action_t> m_open_list;  ///< The open list.
     HeapBasedOpenList<State_t, Action_t> m_focal;
     HeapBasedOpenList<State_t, Action_t> m_not_in_focal;
@@ -203,14 +219,18 @@ private:
     // TODO Get m_evaluator off the heap
     FCostEvaluator<State_t, Action_t>* m_evaluator = nullptr;  ///< The evaluator
     const StateHashFunction<State_t, Hash_t>* m_hash_func = nullptr;  ///< The hash function
+    const IncrementalStateHashFunction<State_t, Action_t, Hash_t>* m_incremental_hash_func = nullptr;  ///< The hash function, if it can hash children incrementally
+    std::vector<Hash_t> m_node_hashes;  ///< The hash value of each node. Only stored when hashing incrementally
 
     int64_t m_num_reex = 0;  ///< The number of re-expansions
     int64_t m_num_reopenings = 0;  ///< The number of reopenings
+    int64_t m_num_hash_collisions = 0;  ///< The number of generated states found to share a hash value with a different stored state
 
     double m_max_eval = 0;  ///< The maximum f-cost of all open nodes in focal
 
     std::vector<NodeID> m_expansion_order;  ///< A vector to store the order of the expanded node IDs
     std::vector<NodeID> m_children;  ///< The indices corresponding to the children of the current node
+    std::vector<NodeID> m_new_children;  ///< The indices of the children of the current node that are yet to be evaluated
     std::vector<double> m_edge_costs;  ///< The edge costs of all the children of the current node
 };
 
@@ -225,6 +245,7 @@ StringMap AStarEpsilon<State_t, Action_t, Hash_t>::getEngineSpecificStatistics()
     StringMap stats = SingleStepSearchEngine<State_t, Action_t>::getEngineSpecificStatistics();
     stats["num_reexpansions"] = std::to_string(m_num_reex);
     stats["num_reopenings"] = std::to_string(m_num_reopenings);
+    stats["num_hash_collisions"] = std::to_string(m_num_hash_collisions);
 
     return stats;
 }
@@ -240,6 +261,8 @@ template<class State_t, class Action_t, class Hash_t>
 void AStarEpsilon<State_t, Action_t, Hash_t>::doReset() {
     m_nodes.clear();
     m_node_map.clear();
+    m_colliding_nodes.clear();
+    m_node_hashes.clear();
     m_open_list.clear();
     m_focal.clear();
     m_not_in_focal.clear();
@@ -251,11 +274,13 @@ void AStarEpsilon<State_t, Action_t, Hash_t>::doReset() {
 
     m_num_reex = 0;
     m_num_reopenings = 0;
+    m_num_hash_collisions = 0;
 }
 
 template<class State_t, class Action_t, class Hash_t>
 inline void AStarEpsilon<State_t, Action_t, Hash_t>::setHashFunction(const StateHashFunction<State_t, Hash_t>& hash) {
     m_hash_func = &hash;
+    m_incremental_hash_func = dynamic_cast<const IncrementalStateHashFunction<State_t, Action_t, Hash_t>*>(&hash);
     SE::reset();
 }
 
@@ -336,6 +361,9 @@ void AStarEpsilon<State_t, Action_t, Hash_t>::doSearchInitialization(const State
     Hash_t init_hash = m_hash_func->getHashValue(initial_state);
     NodeID init_id = m_nodes.addNode(initial_state);
     m_node_map[init_hash] = init_id;
+    if (m_incremental_hash_func) {
+        m_node_hashes.push_back(init_hash);
+    }
 
     m_open_list.addToOpen(init_id);
 
@@ -353,16 +381,32 @@ void AStarEpsilon<State_t, Action_t, Hash_t>::generateChildrenNodes() {
 
     std::vector<Action_t> applicable_actions = SE::getApplicableActions(m_nodes.getState(best_id));
     m_children.clear();
+    m_new_children.clear();
     m_edge_costs.clear();
+    NodeID first_new_child_id = m_nodes.size();
 
     for (auto action : applicable_actions) {
-        if (SE::hasHitResourceLimit()) {
+        if (SE::hasHitResourceLimitWithPendingEvals(static_cast<int64_t>(m_new_children.size()))) {
             break;
         }
         State_t child_state = SE::getChildState(m_nodes.getState(best_id), action);
-        Hash_t child_hash = m_hash_func->getHashValue(child_state);
+        Hash_t child_hash;
+        if (m_incremental_hash_func) {
+            child_hash = m_incremental_hash_func->getChildHash(m_node_hashes[best_id], m_nodes.getState(best_id), action);
+        } else {
+            child_hash = m_hash_func->getHashValue(child_state);
+        }
         std::optional<NodeID> possible_child_id = getNodeID(child_hash);
 
+        bool is_hash_collision = false;
+        if (possible_child_id && !m_hash_func->isPerfectHashFunction()
+                  && !(m_nodes.getState(possible_child_id.value()) == child_state)) {
+            // A different state has the same hash value, so the child is looked for among the other states with that value
+            m_num_hash_collisions++;
+            possible_child_id = getCollidingNodeID(child_hash, child_state);
+            is_hash_collision = true;
+        }
+
         double current_action_cost = SE::getActionCost(m_nodes.getState(best_id), action);
         m_edge_costs.push_back(current_action_cost);
 
@@ -378,6 +422,10 @@ void AStarEpsilon<State_t, Action_t, Hash_t>::generateChildrenNodes() {
                 m_nodes.setLastAction(child_id, action);
                 m_nodes.setLastActionCost(child_id, current_action_cost);
 
+                if (child_id >= first_new_child_id) {
+                    // Generated earlier in this expansion, so it will be evaluated and opened with the other new children
+                    continue;
+                }
                 SE::reEvaluateNode(child_id);
 
                 if (m_open_list.isNodeInOpen(child_id)) {
@@ -399,16 +447,25 @@ void AStarEpsilon<State_t, Action_t, Hash_t>::generateChildrenNodes() {
 
         } else {
             NodeID node_id = m_nodes.addNode(child_state, best_id, child_g_cost, action, current_action_cost);
-            m_node_map[child_hash] = node_id;
+            if (is_hash_collision) {
+                m_colliding_nodes[child_hash].push_back(node_id);
+            } else {
+                m_node_map[child_hash] = node_id;
+            }
+            if (m_incremental_hash_func) {
+                m_node_hashes.push_back(child_hash);
+            }
             m_children.push_back(node_id);
-
-            SE::evaluateNode(node_id);
-
-            m_open_list.addToOpen(node_id);
-            m_not_in_focal.addToOpen(node_id);
+            m_new_children.push_back(node_id);
         }
     }
 
+    SE::evaluateNodes(m_new_children);
+    for (NodeID node_id : m_new_children) {
+        m_open_list.addToOpen(node_id);
+        m_not_in_focal.addToOpen(node_id);
+    }
+
     // TODO Parent updating is disabled for now
     //    if (m_params.m_parent_heuristic_updating) {
     //        // set the record to be maximum double value
@@ -487,7 +544,7 @@ SearchSettingsMap AStarEpsilon<State_t, Action_t, Hash_t>::getSubComponentSettin
 
 template<class State_t, class Action_t, class Hash_t>
 std::optional<NodeID> AStarEpsilon<State_t, Action_t, Hash_t>::getNodeID(Hash_t hash_value) const {
-    assert(m_nodes.size() == m_node_map.size());
+    assert(m_nodes.size() >= m_node_map.size());  // Nodes with colliding hash values are kept in m_colliding_nodes
 
     auto node_check = m_node_map.find(hash_value);
 
@@ -498,4 +555,20 @@ std::optional<NodeID> AStarEpsilon<State_t, Action_t, Hash_t>::getNodeID(Hash_t
     return node_check->second;
 }
 
+template<class State_t, class Action_t, class Hash_t>
+std::optional<NodeID> AStarEpsilon<State_t, Action_t, Hash_t>::getCollidingNodeID(Hash_t hash_value,
+          const State_t& state) const {
+    auto colliding_check = m_colliding_nodes.find(hash_value);
+    if (colliding_check == m_colliding_nodes.end()) {
+        return std::nullopt;
+    }
+
+    for (NodeID node_id : colliding_check->second) {
+        if (m_nodes.getState(node_id) == state) {
+            return node_id;
+        }
+    }
+    return std::nullopt;
+}
+
 #endif  // A_STAR_EPSILON_H_
@@ -0,0 +1,461 @@
+#ifndef ANYTIME_WEIGHTED_A_STAR_H_
+#define ANYTIME_WEIGHTED_A_STAR_H_
+
+#include "building_tools/hashing/state_hash_function.h"
+#include "engines/best_first_search/anytime_weighted_a_star_params.h"
+#include "engines/engine_components/eval_functions/weighted_f_cost_evaluator.h"
+#include "engines/engine_components/node_containers/node_list.h"
+#include "engines/engine_components/open_lists/evaluator_and_comparing_usage.h"
+#include "engines/engine_components/open_lists/heap_based_open_list.h"
+#include "engines/single_step_search_engine.h"
+#include "logging/logging_terms.h"
+#include "logging/search_component_settings.h"
+#include "search_basics/node_container.h"
+#include "search_basics/node_evaluator.h"
+#include "search_basics/search_engine.h"
+#include "utils/floating_point_utils.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * A solution found by an anytime engine.
+ */
+struct AnytimeSolution {
+    double m_cost = 0.0;  ///< The cost of the solution
+    double m_time_seconds = 0.0;  ///< The time since the search started when the solution was found
+    int64_t m_num_expansions = 0;  ///< The number of nodes expanded when the solution was found
+    double m_weight = 1.0;  ///< The weight on the heuristic when the solution was found
+};
+
+/**
+ * An anytime weighted A* engine, which quickly finds a first solution with a high weight on the heuristic, and then
+ * keeps searching for better solutions until the last one is proven optimal.
+ *
+ * Nodes in open are ordered by their weighted f-cost. Once a solution has been found, any node whose f-cost is no
+ * lower than the cost of the incumbent is pruned, since it cannot lead to a better solution. When a goal is selected
+ * for expansion, it becomes the new incumbent, and is added to the stream of improving solutions along with the time
+ * it was found. When open is empty, every node that could lead to a better solution has been pruned, so the incumbent
+ * is optimal as long as the heuristic is admissible.
+ *
+ * If the weight decrement is 0, the weight is never changed and closed nodes are reopened when a cheaper path to them
+ * is found, as in anytime weighted A* (AWA*). Otherwise, the search works as in anytime repairing A* (ARA*). Closed
+ * nodes that are reached by a cheaper path are not reopened, but are put in an inconsistent list. Each time a solution
+ * is found, the weight is lowered, the inconsistent nodes are moved back into open, all open nodes are re-keyed for the
+ * new weight, and the nodes closed so far may be expanded again. The open and closed lists are kept rather than
+ * restarting the search. The last solution of ARA* is only proven optimal if the heuristic is consistent.
+ *
+ * @tparam State_t The type of a state
+ * @tparam Action_t The type of an action
+ * @tparam Hash_t The hash type. Used to define the hash function for type lookup.
+ * @class AnytimeWeightedAStar
+ */
+template<class State_t, class Action_t, class Hash_t>
+class AnytimeWeightedAStar : public SingleStepSearchEngine<State_t, Action_t> {
+    using SE = SingleStepSearchEngine<State_t, Action_t>;  // Allows succinct access to the protected members
+    using NodeMap = std::unordered_map<Hash_t, NodeID>;  ///< Defines the type for a map.
+
+public:
+    /**
+     * Creates an anytime weighted A* engine with the given parameters.
+     *
+     * @param params The struct containing the engines parameters
+     */
+    explicit AnytimeWeightedAStar(const AnytimeWeightedAStarParams& params);
+
+    /**
+     * Default destructor
+     */
+    virtual ~AnytimeWeightedAStar() = default;
+
+    /**
+     * Sets the heuristic function used in the search.
+     *
+     * @param heuristic The heuristic function
+     */
+    void setHeuristic(NodeEvaluator<State_t, Action_t>& heuristic);
+
+    /**
+     * Sets the hash function used in the search. The hash function must be perfect, since states are
+     * only identified by their hash values.
+     *
+     * @param hash The new hash function
+     */
+    void setHashFunction(const StateHashFunction<State_t, Hash_t>& hash);
+
+    /**
+     * Set the anytime weighted A* params by input
+     *
+     * @param params The struct containing the engines parameters
+     */
+    void setEngineParams(const AnytimeWeightedAStarParams& params);
+
+    /**
+     * Gets the solutions found so far, in the order they were found. Each is cheaper than the one before it.
+     *
+     * @return The solutions found
+     */
+    const std::vector<AnytimeSolution>& getSolutionStream() const { return m_solution_stream; }
+
+    /**
+     * Gets if the search has ended with open empty, which proves that the incumbent solution is optimal.
+     *
+     * @return If the incumbent is proven optimal
+     */
+    bool isSolutionProvenOptimal() const { return m_is_proven_optimal; }
+
+    /**
+     * Gets the weight on the heuristic currently used to order open.
+     *
+     * @return The current weight
+     */
+    double getCurrentWeight() const { return m_weight; }
+
+    /**
+     * Gets the list of nodes.
+     *
+     * @return The list of nodes
+     */
+    const NodeList<State_t, Action_t>& getNodes() const { return m_nodes; }
+
+    /**
+     * Gets the number of nodes in the open list.
+     *
+     * @return The number of nodes in the open list.
+     */
+    std::size_t getOpenListSize() const { return m_open_list.getSize(); }
+
+    // Overridden public SearchEngine methods
+    StringMap getEngineSpecificStatistics() const override;
+    std::vector<NodeEvaluator<State_t, Action_t>*> getBaseEvaluators() const override { return {m_evaluator.get()}; }
+
+    // Overidden public SettingsLogger methods
+    std::string getName() const override { return m_params.m_weight_decrement > 0.0 ? "ARAStar" : "AWAStar"; }
+
+protected:
+    // Overridden SingleStepSearchEngine methods
+    void doSearchInitialization(const State_t& initial_state) override;
+    EngineStatus doSingleSearchStep() override;
+    bool doCanRunSearch() const override { return m_heuristic && m_hash_func && m_hash_func->isPerfectHashFunction(); }
+    void doReset() override;
+    StringMap getEngineParamsLog() const override { return m_params.getParameterLog(); }
+
+    // Overidden protected SettingsLogger methods
+    StringMap getComponentSettings() const override;
+    SearchSettingsMap getSubComponentSettings() const override;
+
+private:
+    /**
+     * Gets if the given node cannot lead to a solution cheaper than the incumbent.
+     *
+     * @param node_id The ID of the node
+     * @return If the node can be pruned
+     */
+    bool canPrune(NodeID node_id) const;
+
+    /**
+     * Adds the path to the given goal node as the new incumbent solution, and records it in the solution stream.
+     *
+     * @param goal_id The ID of the goal node
+     */
+    void addSolution(NodeID goal_id);
+
+    /**
+     * Starts a new ARA* iteration. Lowers the weight, moves the inconsistent nodes into open, re-keys open for the new
+     * weight, and allows all nodes to be expanded again.
+     */
+    void startNextIteration();
+
+    /**
+     * Handles a cheaper path found to a node that is not in open.
+     *
+     * @param node_id The ID of the node
+     */
+    void handleImprovedClosedNode(NodeID node_id);
+
+    AnytimeWeightedAStarParams m_params;  ///< The params to set the engine
+    NodeEvaluator<State_t, Action_t>* m_heuristic = nullptr;  ///< The heuristic function
+    std::unique_ptr<WeightedFCostEvaluator<State_t, Action_t>> m_evaluator = nullptr;  ///< The weighted f-cost used to order open
+    const StateHashFunction<State_t, Hash_t>* m_hash_func = nullptr;  ///< The hash function
+    NodeMap m_node_map;  ///< The map used to determine if a hash value is already associated with a node.
+
+    NodeList<State_t, Action_t> m_nodes;  ///< The list of nodes
+    HeapBasedOpenList<State_t, Action_t> m_open_list;  ///< The open list
+    std::vector<NodeID> m_inconsistent;  ///< The closed nodes reached by a cheaper path in the current ARA* iteration
+    std::vector<bool> m_is_inconsistent;  ///< Whether each node is in the inconsistent list
+    std::vector<int64_t> m_expanded_in_iteration;  ///< The last iteration in which each node was expanded, or -1 if it has not been
+
+    double m_weight = 1.0;  ///< The current weight on the heuristic
+    int64_t m_iteration = 0;  ///< The current ARA* iteration
+    double m_incumbent_cost = std::numeric_limits<double>::infinity();  ///< The cost of the incumbent solution
+    bool m_is_proven_optimal = false;  ///< If the incumbent has been proven optimal
+    std::vector<AnytimeSolution> m_solution_stream;  ///< The solutions found so far
+
+    std::vector<NodeID> m_new_children;  ///< The children of the current expansion that are yet to be evaluated
+    int64_t m_num_expansions = 0;  ///< The number of nodes expanded
+    int64_t m_num_reopenings = 0;  ///< The number of closed nodes put back in open
+    int64_t m_num_pruned = 0;  ///< The number of nodes pruned by the incumbent
+};
+
+template<class State_t, class Action_t, class Hash_t>
+AnytimeWeightedAStar<State_t, Action_t, Hash_t>::AnytimeWeightedAStar(const AnytimeWeightedAStarParams& params)
+          : m_params(params) {
+    assert(params.m_initial_weight >= params.m_final_weight && params.m_weight_decrement >= 0.0);
+}
+
+template<class State_t, class Action_t, class Hash_t>
+void AnytimeWeightedAStar<State_t, Action_t, Hash_t>::setHeuristic(NodeEvaluator<State_t, Action_t>& heuristic) {
+    m_heuristic = &heuristic;
+    m_evaluator = std::make_unique<WeightedFCostEvaluator<State_t, Action_t>>(heuristic, m_params.m_initial_weight);
+    m_evaluator->setNodeContainer(m_nodes);
+
+    EvalsAndUsageVec<State_t, Action_t> evals;
+    evals.emplace_back(*m_evaluator, true);
+    m_open_list.setEvaluators(evals);
+    SE::reset();
+}
+
+template<class State_t, class Action_t, class Hash_t>
+void AnytimeWeightedAStar<State_t, Action_t, Hash_t>::setHashFunction(const StateHashFunction<State_t, Hash_t>& hash) {
+    m_hash_func = &hash;
+    SE::reset();
+}
+
+template<class State_t, class Action_t, class Hash_t>
+void AnytimeWeightedAStar<State_t, Action_t, Hash_t>::setEngineParams(const AnytimeWeightedAStarParams& params) {
+    assert(params.m_initial_weight >= params.m_final_weight && params.m_weight_decrement >= 0.0);
+    m_params = params;
+    SE::reset();
+}
+
+template<class State_t, class Action_t, class Hash_t>
+StringMap AnytimeWeightedAStar<State_t, Action_t, Hash_t>::getEngineSpecificStatistics() const {
+    StringMap stats = SE::getEngineSpecificStatistics();
+    stats["num_expansions"] = std::to_string(m_num_expansions);
+    stats["num_reopenings"] = std::to_string(m_num_reopenings);
+    stats["num_pruned"] = std::to_string(m_num_pruned);
+    stats["num_solutions"] = std::to_string(m_solution_stream.size());
+    stats["num_iterations"] = std::to_string(m_iteration + 1);
+    stats["is_proven_optimal"] = boolToString(m_is_proven_optimal);
+
+    return stats;
+}
+
+template<class State_t, class Action_t, class Hash_t>
+void AnytimeWeightedAStar<State_t, Action_t, Hash_t>::doSearchInitialization(const State_t& initial_state) {
+    m_weight = m_params.m_initial_weight;
+    m_evaluator->setWeight(m_weight);
+
+    NodeID init_id = m_nodes.addNode(initial_state);
+    m_node_map[m_hash_func->getHashValue(initial_state)] = init_id;
+    m_is_inconsistent.push_back(false);
+    m_expanded_in_iteration.push_back(-1);
+
+    SE::evaluateNode(init_id);
+    if (!m_evaluator->getCachedIsDeadEnd(init_id)) {
+        m_open_list.addToOpen(init_id);
+    }
+}
+
+template<class State_t, class Action_t, class Hash_t>
+EngineStatus AnytimeWeightedAStar<State_t, Action_t, Hash_t>::doSingleSearchStep() {
+    if (m_open_list.isEmpty()) {
+        if (!m_inconsistent.empty()) {
+            startNextIteration();
+            return EngineStatus::active;
+        }
+        m_is_proven_optimal = SE::hasFoundSolution();
+        return EngineStatus::search_completed;
+    }
+
+    NodeID to_expand_id = m_open_list.getAndRemoveIDOfBestNode();
+    if (canPrune(to_expand_id)) {
+        m_num_pruned++;
+        return EngineStatus::active;
+    }
+
+    if (SE::isGoal(m_nodes.getState(to_expand_id))) {
+        addSolution(to_expand_id);
+        if (m_params.m_weight_decrement > 0.0) {
+            startNextIteration();
+        }
+        return EngineStatus::active;
+    }
+
+    m_num_expansions++;
+    m_expanded_in_iteration[to_expand_id] = m_iteration;
+    const State_t parent_state = m_nodes.getState(to_expand_id);
+    double parent_g = m_nodes.getGValue(to_expand_id);
+    m_new_children.clear();
+
+    for (const Action_t& action : SE::getApplicableActions(parent_state)) {
+        double action_cost = SE::getActionCost(parent_state, action);
+        double child_g = parent_g + action_cost;
+        State_t child_state = SE::getChildState(parent_state, action);
+        Hash_t child_hash = m_hash_func->getHashValue(child_state);
+
+        auto map_iter = m_node_map.find(child_hash);
+        if (map_iter == m_node_map.end()) {
+            if (SE::hasHitResourceLimitWithPendingEvals(static_cast<int64_t>(m_new_children.size()))) {
+                break;
+            }
+            NodeID child_id = m_nodes.addNode(child_state, to_expand_id, child_g, action, action_cost);
+            m_node_map[child_hash] = child_id;
+            m_is_inconsistent.push_back(false);
+            m_expanded_in_iteration.push_back(-1);
+            m_new_children.push_back(child_id);
+            continue;
+        }
+
+        NodeID child_id = map_iter->second;
+        if (!fpLess(child_g, m_nodes.getGValue(child_id))) {
+            continue;
+        }
+        m_nodes.setGValue(child_id, child_g);
+        m_nodes.setParentID(child_id, to_expand_id);
+        m_nodes.setLastAction(child_id, action);
+        m_nodes.setLastActionCost(child_id, action_cost);
+        if (!m_new_children.empty() && child_id >= m_new_children.front()) {
+            // Generated earlier in this expansion, so it will be evaluated and opened with the other new children
+            continue;
+        }
+        SE::reEvaluateNode(child_id);
+
+        if (m_evaluator->getCachedIsDeadEnd(child_id) || canPrune(child_id)) {
+            if (m_open_list.isNodeInOpen(child_id)) {
+                m_open_list.removeFromHeap(child_id);
+            }
+            m_num_pruned++;
+        } else if (m_open_list.isNodeInOpen(child_id)) {
+            m_open_list.evalChanged(child_id);
+        } else {
+            handleImprovedClosedNode(child_id);
+        }
+    }
+
+    SE::evaluateNodes(m_new_children);
+    for (NodeID child_id : m_new_children) {
+        if (m_evaluator->getCachedIsDeadEnd(child_id)) {
+            continue;
+        } else if (canPrune(child_id)) {
+            m_num_pruned++;
+        } else {
+            m_open_list.addToOpen(child_id);
+        }
+    }
+    return EngineStatus::active;
+}
+
+template<class State_t, class Action_t, class Hash_t>
+bool AnytimeWeightedAStar<State_t, Action_t, Hash_t>::canPrune(NodeID node_id) const {
+    return !fpLess(m_nodes.getGValue(node_id) + m_heuristic->getCachedEval(node_id), m_incumbent_cost);
+}
+
+template<class State_t, class Action_t, class Hash_t>
+void AnytimeWeightedAStar<State_t, Action_t, Hash_t>::addSolution(NodeID goal_id) {
+    SE::setIncumbentSolution(goal_id, m_nodes);
+    m_incumbent_cost = m_nodes.getGValue(goal_id);
+    m_solution_stream.push_back({m_incumbent_cost, SE::getCurrentSearchTime(), m_num_expansions, m_weight});
+}
+
+template<class State_t, class Action_t, class Hash_t>
+void AnytimeWeightedAStar<State_t, Action_t, Hash_t>::handleImprovedClosedNode(NodeID node_id) {
+    bool is_closed_in_iteration = m_expanded_in_iteration[node_id] == m_iteration;
+    if (m_params.m_weight_decrement > 0.0 && is_closed_in_iteration) {
+        if (!m_is_inconsistent[node_id]) {
+            m_is_inconsistent[node_id] = true;
+            m_inconsistent.push_back(node_id);
+        }
+        return;
+    }
+
+    // Either the node was pruned or closed in an earlier iteration, or it is reopened as in AWA*
+    if (m_is_inconsistent[node_id]) {
+        return;
+    }
+    if (m_expanded_in_iteration[node_id] >= 0) {
+        m_num_reopenings++;
+    }
+    m_open_list.addToOpen(node_id);
+}
+
+template<class State_t, class Action_t, class Hash_t>
+void AnytimeWeightedAStar<State_t, Action_t, Hash_t>::startNextIteration() {
+    m_iteration++;
+    m_weight = std::max(m_weight - m_params.m_weight_decrement, m_params.m_final_weight);
+    m_evaluator->setWeight(m_weight);
+
+    std::vector<NodeID> to_open;
+    for (std::size_t i = 0; i < m_open_list.getSize(); ++i) {
+        to_open.push_back(m_open_list.getHeapEntry(static_cast<HeapIndex>(i)));
+    }
+    for (NodeID node_id : m_inconsistent) {
+        m_is_inconsistent[node_id] = false;
+        to_open.push_back(node_id);
+    }
+    m_inconsistent.clear();
+    m_open_list.clear();
+
+    // The heuristic values are cached, so the new keys are found without evaluating the nodes again
+    for (NodeID node_id : to_open) {
+        if (canPrune(node_id)) {
+            m_num_pruned++;
+            continue;
+        }
+        m_evaluator->setCachedEval(node_id, m_nodes.getGValue(node_id) + m_weight * m_heuristic->getCachedEval(node_id));
+        m_open_list.addToOpen(node_id);
+    }
+}
+
+template<class State_t, class Action_t, class Hash_t>
+void AnytimeWeightedAStar<State_t, Action_t, Hash_t>::doReset() {
+    m_open_list.clear();
+    m_node_map.clear();
+    m_nodes.clear();
+    m_inconsistent.clear();
+    m_is_inconsistent.clear();
+    m_expanded_in_iteration.clear();
+    m_new_children.clear();
+
+    m_weight = m_params.m_initial_weight;
+    m_iteration = 0;
+    m_incumbent_cost = std::numeric_limits<double>::infinity();
+    m_is_proven_optimal = false;
+    m_solution_stream.clear();
+
+    m_num_expansions = 0;
+    m_num_reopenings = 0;
+    m_num_pruned = 0;
+}
+
+template<class State_t, class Action_t, class Hash_t>
+StringMap AnytimeWeightedAStar<State_t, Action_t, Hash_t>::getComponentSettings() const {
+    auto se_log = SE::getComponentSettings();
+    auto params_log = m_params.getParameterLog();
+
+    for (const auto& [key, value] : params_log) {
+        se_log[key] = value;
+    }
+
+    return se_log;
+}
+
+template<class State_t, class Action_t, class Hash_t>
+SearchSettingsMap AnytimeWeightedAStar<State_t, Action_t, Hash_t>::getSubComponentSettings() const {
+    SearchSettingsMap sub_components;
+
+    sub_components["heuristic"] = m_heuristic->getAllSettings();
+    sub_components["hash_function"] = m_hash_func->getAllSettings();
+
+    return sub_components;
+}
+
+#endif  //ANYTIME_WEIGHTED_A_STAR_H_
@@ -0,0 +1,10 @@
+#include "anytime_weighted_a_star_params.h"
+
+StringMap AnytimeWeightedAStarParams::getParameterLog() const {
+    StringMap params;
+
+    params["initial_weight"] = roundAndToString(m_initial_weight, 2);
+    params["weight_decrement"] = roundAndToString(m_weight_decrement, 2);
+    params["final_weight"] = roundAndToString(m_final_weight, 2);
+    return params;
+}
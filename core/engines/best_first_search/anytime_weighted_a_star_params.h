@@ -0,0 +1,23 @@
+#ifndef ANYTIME_WEIGHTED_A_STAR_PARAMS_H_
+#define ANYTIME_WEIGHTED_A_STAR_PARAMS_H_
+
+#include "logging/logging_terms.h"
+#include "utils/string_utils.h"
+
+/**
+ * The parameters for an anytime weighted A* engine
+ */
+struct AnytimeWeightedAStarParams {
+    /**
+     * Returns a map containing the log of the parameters used in anytime weighted A*
+     *
+     * @return A map to stand for the log of the params
+     */
+    StringMap getParameterLog() const;
+
+    double m_initial_weight = 5.0;  ///< The weight on the heuristic used to find the first solution
+    double m_weight_decrement = 0.0;  ///< How much the weight is lowered after each solution. If 0, the weight is never lowered and closed nodes are reopened
+    double m_final_weight = 1.0;  ///< The weight is never lowered below this value
+};
+
+#endif  //ANYTIME_WEIGHTED_A_STAR_PARAMS_H_
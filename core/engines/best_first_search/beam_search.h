@@ -0,0 +1,472 @@
+#ifndef BEAM_SEARCH_H_
+#define BEAM_SEARCH_H_
+
+#include "building_tools/hashing/state_hash_function.h"
+#include "engines/best_first_search/beam_search_params.h"
+#include "engines/engine_components/node_containers/node_list.h"
+#include "engines/engine_components/open_lists/evaluator_and_comparing_usage.h"
+#include "engines/single_step_search_engine.h"
+#include "logging/logging_terms.h"
+#include "logging/search_component_settings.h"
+#include "search_basics/node_container.h"
+#include "search_basics/node_evaluator.h"
+#include "search_basics/search_engine.h"
+#include "utils/floating_point_utils.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+/**
+ * A beam search engine, which searches breadth-first but only keeps the best nodes of each layer.
+ *
+ * The nodes of the current layer are expanded one per search step. Their children are the candidates for the next
+ * layer. A candidate whose state has already been generated for the next layer replaces the earlier copy only if it
+ * has a lower g-cost. If the closed list is used, a candidate whose state was kept in an earlier layer is skipped. Once
+ * the layer has been expanded, all candidates are evaluated as a batch, and the best beam width of them, as ordered by
+ * the evaluators, are selected with a partial selection rather than by sorting all candidates. The search stops when
+ * a goal is selected for expansion.
+ *
+ * Candidates are stored in their own node list, which the evaluators are given and which is cleared for each layer, so
+ * memory use is bounded by the beam width times the number of layers. The list starts with a copy of each node of the
+ * current layer, so that the parent ID of every candidate refers to a node in the same list. Only the nodes kept in the
+ * beam are stored until the end of the search, to extract the plan.
+ *
+ * If a layer has no candidates and no solution has been found, the search fails, unless widening on failure is enabled.
+ * In that case, the search restarts from the initial state with the beam width multiplied by the given factor. The
+ * width is capped at the maximum beam width, and the search fails once an attempt with that width has failed. Without
+ * the closed list, the beam may cycle rather than run out of candidates.
+ *
+ * @tparam State_t The type of a state
+ * @tparam Action_t The type of an action
+ * @tparam Hash_t The hash type. Used to define the hash function for type lookup.
+ * @class BeamSearch
+ */
+template<class State_t, class Action_t, class Hash_t>
+class BeamSearch : public SingleStepSearchEngine<State_t, Action_t> {
+    using SE = SingleStepSearchEngine<State_t, Action_t>;  // Allows succinct access to the protected members
+
+public:
+    /**
+     * Creates a beam search engine with the given parameters.
+     *
+     * @param params The struct containing the engines parameters
+     */
+    explicit BeamSearch(const BeamSearchParams& params)
+              : m_params(params) {}
+
+    /**
+     * Default destructor
+     */
+    virtual ~BeamSearch() = default;
+
+    /**
+     * Sets the evaluation function used to order candidates.
+     *
+     * @param evaluator The evaluator to use
+     */
+    void setEvaluator(NodeEvaluator<State_t, Action_t>& evaluator);
+
+    /**
+     * Sets the evaluators used to order candidates. Ties on the first evaluator are broken by the next, and so on.
+     *
+     * @param evaluators The evaluators to use
+     */
+    void setEvaluators(const EvalsAndUsageVec<State_t, Action_t>& evaluators);
+
+    /**
+     * Sets the hash function used in the search. The hash function must be perfect, since states are
+     * only identified by their hash values.
+     *
+     * @param hash The new hash function
+     */
+    void setHashFunction(const StateHashFunction<State_t, Hash_t>& hash);
+
+    /**
+     * Set the beam search params by input
+     *
+     * @param params The struct containing the engines parameters
+     */
+    void setEngineParams(const BeamSearchParams& params);
+
+    /**
+     * Gets the nodes kept in the beam in any layer of the current attempt.
+     *
+     * @return The list of kept nodes
+     */
+    const NodeList<State_t, Action_t>& getNodes() const { return m_kept_nodes; }
+
+    /**
+     * Gets the IDs of the nodes in the current layer.
+     *
+     * @return The current layer
+     */
+    const std::vector<NodeID>& getCurrentLayer() const { return m_current_layer; }
+
+    /**
+     * Gets the beam width used in the current attempt.
+     *
+     * @return The current beam width
+     */
+    std::size_t getCurrentBeamWidth() const { return m_beam_width; }
+
+    /**
+     * Gets the number of times the search restarted with a wider beam.
+     *
+     * @return The number of restarts
+     */
+    int64_t getNumRestarts() const { return m_num_restarts; }
+
+    // Overridden public SearchEngine methods
+    StringMap getEngineSpecificStatistics() const override;
+    std::vector<NodeEvaluator<State_t, Action_t>*> getBaseEvaluators() const override;
+
+    // Overidden public SettingsLogger methods
+    std::string getName() const override { return "BeamSearch"; }
+
+protected:
+    // Overridden SingleStepSearchEngine methods
+    void doSearchInitialization(const State_t& initial_state) override;
+    EngineStatus doSingleSearchStep() override;
+    bool doCanRunSearch() const override {
+        return !m_evaluators.empty() && m_hash_func && m_hash_func->isPerfectHashFunction() && m_params.m_beam_width > 0;
+    }
+    void doReset() override;
+    StringMap getEngineParamsLog() const override { return m_params.getParameterLog(); }
+
+    // Overidden protected SettingsLogger methods
+    StringMap getComponentSettings() const override;
+    SearchSettingsMap getSubComponentSettings() const override;
+
+private:
+    /**
+     * Clears the search and starts a new attempt from the initial state.
+     */
+    void startAttempt();
+
+    /**
+     * Adds a copy of each node of the current layer to the candidates, in the order of the layer, so that the node at
+     * each index of the layer has that index as its ID among the candidates.
+     */
+    void addLayerToCandidates();
+
+    /**
+     * Generates the children of the node at the given index of the current layer as candidates for the next layer.
+     *
+     * @param layer_index The index in the current layer of the node to expand
+     */
+    void generateCandidates(std::size_t layer_index);
+
+    /**
+     * Evaluates the candidates, keeps the best of them as the next layer, and clears the candidates.
+     */
+    void selectNextLayer();
+
+    /**
+     * Returns if the first candidate is better than the second, according to the evaluators.
+     *
+     * @param candidate1_id The ID of the first candidate
+     * @param candidate2_id The ID of the second candidate
+     * @return If the first candidate is strictly better
+     */
+    bool isBetterCandidate(NodeID candidate1_id, NodeID candidate2_id) const;
+
+    /**
+     * Adds the given state to the kept nodes. Must be called before the current layer is replaced, since the parent of
+     * the candidate is found through it.
+     *
+     * @param state The state of the node
+     * @param hash The hash value of the state
+     * @param candidate_id The ID of the candidate the node was selected from, or std::nullopt for the initial state
+     * @return The ID of the kept node
+     */
+    NodeID addKeptNode(const State_t& state, const Hash_t& hash, std::optional<NodeID> candidate_id);
+
+    BeamSearchParams m_params;  ///< The params to set the engine
+    EvalsAndUsageVec<State_t, Action_t> m_evaluators;  ///< The evaluators used to order candidates
+    const StateHashFunction<State_t, Hash_t>* m_hash_func = nullptr;  ///< The hash function
+
+    std::optional<State_t> m_initial_state = std::nullopt;  ///< The initial state of the search
+    std::size_t m_beam_width = 0;  ///< The beam width of the current attempt
+
+    NodeList<State_t, Action_t> m_kept_nodes;  ///< The nodes kept in any layer of the current attempt
+    std::vector<Hash_t> m_kept_hashes;  ///< The hash value of each kept node
+    std::vector<NodeID> m_current_layer;  ///< The kept nodes of the layer being expanded
+    std::size_t m_next_to_expand = 0;  ///< The index in the current layer of the next node to expand
+    std::unordered_set<Hash_t> m_closed_hashes;  ///< The hash values of the states kept in any layer, if the closed list is used
+
+    NodeList<State_t, Action_t> m_candidates;  ///< Copies of the nodes of the current layer, followed by the candidates for the next layer
+    std::vector<Hash_t> m_candidate_hashes;  ///< The hash value of each candidate
+    std::unordered_map<Hash_t, NodeID> m_candidate_map;  ///< Maps the hash value of a candidate's state to its ID
+    std::vector<NodeID> m_selection;  ///< The IDs of the candidates being selected from
+
+    int64_t m_num_layers = 0;  ///< The number of layers expanded, over all attempts
+    int64_t m_num_restarts = 0;  ///< The number of restarts with a wider beam
+    int64_t m_num_candidates = 0;  ///< The number of candidates evaluated
+    int64_t m_num_discarded = 0;  ///< The number of evaluated candidates not kept in the beam
+};
+
+template<class State_t, class Action_t, class Hash_t>
+std::vector<NodeEvaluator<State_t, Action_t>*> BeamSearch<State_t, Action_t, Hash_t>::getBaseEvaluators() const {
+    std::vector<NodeEvaluator<State_t, Action_t>*> evaluators;
+    for (const auto& eval_and_usage : m_evaluators) {
+        evaluators.push_back(eval_and_usage.m_evaluator);
+    }
+    return evaluators;
+}
+
+template<class State_t, class Action_t, class Hash_t>
+void BeamSearch<State_t, Action_t, Hash_t>::setEvaluator(NodeEvaluator<State_t, Action_t>& evaluator) {
+    EvalsAndUsageVec<State_t, Action_t> evals;
+    evals.emplace_back(evaluator, true);
+    setEvaluators(evals);
+}
+
+template<class State_t, class Action_t, class Hash_t>
+void BeamSearch<State_t, Action_t, Hash_t>::setEvaluators(const EvalsAndUsageVec<State_t, Action_t>& evaluators) {
+    m_evaluators = evaluators;
+
+    for (auto& eval_and_usage : m_evaluators) {
+        eval_and_usage.m_evaluator->setNodeContainer(m_candidates);
+    }
+    SE::reset();
+}
+
+template<class State_t, class Action_t, class Hash_t>
+void BeamSearch<State_t, Action_t, Hash_t>::setHashFunction(const StateHashFunction<State_t, Hash_t>& hash) {
+    m_hash_func = &hash;
+    SE::reset();
+}
+
+template<class State_t, class Action_t, class Hash_t>
+void BeamSearch<State_t, Action_t, Hash_t>::setEngineParams(const BeamSearchParams& params) {
+    m_params = params;
+    SE::reset();
+}
+
+template<class State_t, class Action_t, class Hash_t>
+StringMap BeamSearch<State_t, Action_t, Hash_t>::getEngineSpecificStatistics() const {
+    StringMap stats = SE::getEngineSpecificStatistics();
+    stats["num_layers"] = std::to_string(m_num_layers);
+    stats["num_restarts"] = std::to_string(m_num_restarts);
+    stats["num_candidates"] = std::to_string(m_num_candidates);
+    stats["num_discarded"] = std::to_string(m_num_discarded);
+    stats["final_beam_width"] = std::to_string(m_beam_width);
+
+    return stats;
+}
+
+template<class State_t, class Action_t, class Hash_t>
+void BeamSearch<State_t, Action_t, Hash_t>::doSearchInitialization(const State_t& initial_state) {
+    m_initial_state = initial_state;
+    m_beam_width = m_params.m_beam_width;
+    startAttempt();
+}
+
+template<class State_t, class Action_t, class Hash_t>
+void BeamSearch<State_t, Action_t, Hash_t>::startAttempt() {
+    m_kept_nodes.clear();
+    m_kept_hashes.clear();
+    m_current_layer.clear();
+    m_next_to_expand = 0;
+    m_closed_hashes.clear();
+    m_candidates.clear();
+    m_candidate_hashes.clear();
+    m_candidate_map.clear();
+
+    const State_t& initial_state = m_initial_state.value();
+    m_current_layer.push_back(addKeptNode(initial_state, m_hash_func->getHashValue(initial_state), std::nullopt));
+    addLayerToCandidates();
+}
+
+template<class State_t, class Action_t, class Hash_t>
+EngineStatus BeamSearch<State_t, Action_t, Hash_t>::doSingleSearchStep() {
+    if (m_next_to_expand < m_current_layer.size()) {
+        NodeID kept_id = m_current_layer[m_next_to_expand];
+        if (SE::isGoal(m_kept_nodes.getState(kept_id))) {
+            SE::setIncumbentSolution(kept_id, m_kept_nodes);
+            return EngineStatus::search_completed;
+        }
+        generateCandidates(m_next_to_expand++);
+        return EngineStatus::active;
+    }
+
+    m_num_layers++;
+    selectNextLayer();
+    if (!m_current_layer.empty()) {
+        return EngineStatus::active;
+    }
+
+    // Every candidate was a duplicate or a dead end, so the beam has failed
+    auto wider_width = static_cast<std::size_t>(std::ceil(static_cast<double>(m_beam_width) * m_params.m_width_multiplier));
+    wider_width = std::min(wider_width, m_params.m_max_beam_width);
+    if (!m_params.m_widen_on_failure || wider_width <= m_beam_width) {
+        return EngineStatus::search_completed;
+    }
+    m_beam_width = wider_width;
+    m_num_restarts++;
+    startAttempt();
+    return EngineStatus::active;
+}
+
+template<class State_t, class Action_t, class Hash_t>
+void BeamSearch<State_t, Action_t, Hash_t>::addLayerToCandidates() {
+    assert(m_candidates.size() == 0);
+    for (NodeID kept_id : m_current_layer) {
+        NodeID layer_node_id = m_candidates.addNode(m_kept_nodes.getState(kept_id));
+        m_candidates.setGValue(layer_node_id, m_kept_nodes.getGValue(kept_id));
+        m_candidate_hashes.push_back(m_kept_hashes[kept_id]);
+    }
+}
+
+template<class State_t, class Action_t, class Hash_t>
+void BeamSearch<State_t, Action_t, Hash_t>::generateCandidates(std::size_t layer_index) {
+    auto parent_id = static_cast<NodeID>(layer_index);
+    const State_t parent_state = m_candidates.getState(parent_id);
+    double parent_g = m_candidates.getGValue(parent_id);
+
+    for (const Action_t& action : SE::getApplicableActions(parent_state)) {
+        double action_cost = SE::getActionCost(parent_state, action);
+        double child_g = parent_g + action_cost;
+        State_t child_state = SE::getChildState(parent_state, action);
+        Hash_t child_hash = m_hash_func->getHashValue(child_state);
+
+        if (m_params.m_use_closed_list && m_closed_hashes.count(child_hash) > 0) {
+            continue;
+        }
+
+        auto candidate_iter = m_candidate_map.find(child_hash);
+        if (candidate_iter == m_candidate_map.end()) {
+            NodeID candidate_id = m_candidates.addNode(child_state, parent_id, child_g, action, action_cost);
+            m_candidate_map[child_hash] = candidate_id;
+            m_candidate_hashes.push_back(child_hash);
+        } else if (fpLess(child_g, m_candidates.getGValue(candidate_iter->second))) {
+            NodeID candidate_id = candidate_iter->second;
+            m_candidates.setGValue(candidate_id, child_g);
+            m_candidates.setParentID(candidate_id, parent_id);
+            m_candidates.setLastAction(candidate_id, action);
+            m_candidates.setLastActionCost(candidate_id, action_cost);
+        }
+    }
+}
+
+template<class State_t, class Action_t, class Hash_t>
+void BeamSearch<State_t, Action_t, Hash_t>::selectNextLayer() {
+    // The candidates follow the copies of the nodes of the current layer
+    m_selection.clear();
+    for (auto candidate_id = static_cast<NodeID>(m_current_layer.size()); candidate_id < m_candidates.size(); ++candidate_id) {
+        m_selection.push_back(candidate_id);
+    }
+    SE::evaluateNodes(m_selection);
+    m_num_candidates += static_cast<int64_t>(m_selection.size());
+
+    // Dead ends are never kept
+    m_selection.erase(std::remove_if(m_selection.begin(), m_selection.end(),
+                                     [this](NodeID candidate_id) {
+                                         return m_evaluators[0].m_evaluator->getCachedIsDeadEnd(candidate_id);
+                                     }),
+              m_selection.end());
+
+    if (m_selection.size() > m_beam_width) {
+        auto is_better = [this](NodeID candidate1_id, NodeID candidate2_id) { return isBetterCandidate(candidate1_id, candidate2_id); };
+        std::nth_element(m_selection.begin(), m_selection.begin() + static_cast<std::ptrdiff_t>(m_beam_width), m_selection.end(), is_better);
+        m_num_discarded += static_cast<int64_t>(m_selection.size() - m_beam_width);
+        m_selection.resize(m_beam_width);
+    }
+
+    std::vector<NodeID> next_layer;
+    for (NodeID candidate_id : m_selection) {
+        next_layer.push_back(addKeptNode(m_candidates.getState(candidate_id), m_candidate_hashes[candidate_id], candidate_id));
+    }
+    m_current_layer = std::move(next_layer);
+    m_next_to_expand = 0;
+
+    m_candidates.clear();
+    m_candidate_hashes.clear();
+    m_candidate_map.clear();
+    addLayerToCandidates();
+}
+
+template<class State_t, class Action_t, class Hash_t>
+bool BeamSearch<State_t, Action_t, Hash_t>::isBetterCandidate(NodeID candidate1_id, NodeID candidate2_id) const {
+    for (const auto& eval_and_usage : m_evaluators) {
+        double candidate1_eval = eval_and_usage.m_evaluator->getCachedEval(candidate1_id);
+        double candidate2_eval = eval_and_usage.m_evaluator->getCachedEval(candidate2_id);
+
+        if (fpLess(candidate1_eval, candidate2_eval)) {
+            return eval_and_usage.m_lower_is_better;
+        } else if (fpGreater(candidate1_eval, candidate2_eval)) {
+            return !eval_and_usage.m_lower_is_better;
+        }
+    }
+    return false;
+}
+
+template<class State_t, class Action_t, class Hash_t>
+NodeID BeamSearch<State_t, Action_t, Hash_t>::addKeptNode(const State_t& state, const Hash_t& hash, std::optional<NodeID> candidate_id) {
+    if (m_params.m_use_closed_list) {
+        m_closed_hashes.insert(hash);
+    }
+    m_kept_hashes.push_back(hash);
+    if (!candidate_id) {
+        return m_kept_nodes.addNode(state);
+    }
+
+    NodeID id = candidate_id.value();
+    NodeID parent_kept_id = m_current_layer[m_candidates.getParentID(id)];
+    return m_kept_nodes.addNode(state, parent_kept_id, m_candidates.getGValue(id), m_candidates.getLastAction(id).value(),
+              m_candidates.getLastActionCost(id));
+}
+
+template<class State_t, class Action_t, class Hash_t>
+void BeamSearch<State_t, Action_t, Hash_t>::doReset() {
+    m_initial_state = std::nullopt;
+    m_beam_width = m_params.m_beam_width;
+
+    m_kept_nodes.clear();
+    m_kept_hashes.clear();
+    m_current_layer.clear();
+    m_next_to_expand = 0;
+    m_closed_hashes.clear();
+    m_candidates.clear();
+    m_candidate_hashes.clear();
+    m_candidate_map.clear();
+    m_selection.clear();
+
+    m_num_layers = 0;
+    m_num_restarts = 0;
+    m_num_candidates = 0;
+    m_num_discarded = 0;
+}
+
+template<class State_t, class Action_t, class Hash_t>
+StringMap BeamSearch<State_t, Action_t, Hash_t>::getComponentSettings() const {
+    auto se_log = SE::getComponentSettings();
+    auto params_log = m_params.getParameterLog();
+
+    for (const auto& [key, value] : params_log) {
+        se_log[key] = value;
+    }
+
+    return se_log;
+}
+
+template<class State_t, class Action_t, class Hash_t>
+SearchSettingsMap BeamSearch<State_t, Action_t, Hash_t>::getSubComponentSettings() const {
+    SearchSettingsMap sub_components;
+
+    sub_components["eval_function"] = m_evaluators[0].m_evaluator->getAllSettings();
+    sub_components["hash_function"] = m_hash_func->getAllSettings();
+
+    return sub_components;
+}
+
+#endif  //BEAM_SEARCH_H_
@@ -0,0 +1,14 @@
+#include "beam_search_params.h"
+
+#include <string>
+
+StringMap BeamSearchParams::getParameterLog() const {
+    StringMap params;
+
+    params["beam_width"] = std::to_string(m_beam_width);
+    params["use_closed_list"] = boolToString(m_use_closed_list);
+    params["widen_on_failure"] = boolToString(m_widen_on_failure);
+    params["width_multiplier"] = roundAndToString(m_width_multiplier, 2);
+    params["max_beam_width"] = std::to_string(m_max_beam_width);
+    return params;
+}
@@ -0,0 +1,27 @@
+#ifndef BEAM_SEARCH_PARAMS_H_
+#define BEAM_SEARCH_PARAMS_H_
+
+#include "logging/logging_terms.h"
+#include "utils/string_utils.h"
+
+#include <cstddef>
+
+/**
+ * The parameters for a beam search engine
+ */
+struct BeamSearchParams {
+    /**
+     * Returns a map containing the log of the parameters used in beam search
+     *
+     * @return A map to stand for the log of the params
+     */
+    StringMap getParameterLog() const;
+
+    std::size_t m_beam_width = 100;  ///< The maximum number of nodes kept in each layer
+    bool m_use_closed_list = true;  ///< Whether to skip states kept in an earlier layer, rather than only duplicates within a layer
+    bool m_widen_on_failure = false;  ///< Whether to restart with a wider beam when a layer is empty and no solution has been found
+    double m_width_multiplier = 2.0;  ///< The factor the beam width is multiplied by on each restart
+    std::size_t m_max_beam_width = 1000000;  ///< The widest beam the search restarts with. The search fails once an attempt with this width fails
+};
+
+#endif  //BEAM_SEARCH_PARAMS_H_
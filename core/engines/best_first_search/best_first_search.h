@@ -1,9 +1,11 @@
 #ifndef BEST_FIRST_SEARCH_H_
 #define BEST_FIRST_SEARCH_H_
 
+#include "building_tools/hashing/incremental_state_hash_function.h"
 #include "building_tools/hashing/state_hash_function.h"
 #include "engines/best_first_search/best_first_search_params.h"
 #include "engines/engine_components/node_containers/node_list.h"
+#include "engines/engine_components/node_containers/ranked_node_list.h"
 #include "engines/engine_components/open_lists/evaluator_and_comparing_usage.h"
 #include "engines/engine_components/open_lists/heap_based_open_list.h"
 #include "engines/single_step_search_engine.h"
@@ -21,6 +23,7 @@
 #include <cstdint>
 #include <optional>
 #include <string>
+#include <type_traits>
 #include <unordered_map>
 #include <vector>
 
@@ -28,9 +31,19 @@
  *
  * An template for best-first search.
 *
+ * The nodes are stored in a NodeList by default. If a RankedNodeList is used instead, each node stores the hash value
+ * of its state rather than the state, and the hash function must be perfect and invertible.
+ *
+ * With deferred evaluation, newly generated children are not evaluated by the primary evaluator. Instead, the key of
+ * each child is the cached evaluation of its parent. A child is only evaluated when it is selected for expansion, and
+ * is put back in open if its evaluation makes it worse than the best node in open. This saves the evaluations of the
+ * children that are never selected, which pays off with expensive heuristics in greedy search. For f-costs with a
+ * consistent heuristic, the key of a child is a lower bound on its evaluation. Tie-breaking evaluators are still
+ * evaluated for each child, so they should be cheap, such as the g-cost.
+ *
  * @class BestFirstSearch
  */
-template<class State_t, class Action_t, class Hash_t>
+template<class State_t, class Action_t, class Hash_t, class NodeContainer_t = NodeList<State_t, Action_t>>
 class BestFirstSearch : public SingleStepSearchEngine<State_t, Action_t> {
     using SE = SingleStepSearchEngine<State_t, Action_t>;  // Allows succinct access to the protected members
     using NodeMap = std::unordered_map<Hash_t, NodeID>;  ///< Defines the type for a map.
@@ -48,7 +61,9 @@ public:
     virtual ~BestFirstSearch() = default;
 
     /**
-     * Sets the hash function used by the search.
+     * Sets the hash function used by the search. If it is an IncrementalStateHashFunction, the hash value of each child
+     * is calculated from the hash value of its parent. If the hash function is not perfect, every generated state is
+     * compared to the stored state with the same hash value, so that states with colliding hash values are kept apart.
      *
      * @param hash The new hash function
      */
@@ -80,7 +95,7 @@ public:
      *
      * @return The list of nodes.
      */
-    const NodeList<State_t, Action_t>& getNodes() const { return m_nodes; }
+    const NodeContainer_t& getNodes() const { return m_nodes; }
 
     /**
      * Gets the number of nodes in the open list.
@@ -106,6 +121,18 @@ public:
      */
     std::optional<NodeID> getNodeID(Hash_t hash_value) const;
 
+    /**
+     * Returns the ID of the node for the given state, among the nodes whose hash value was already associated with a
+     * different state when they were generated.
+     *
+     * Returns std::nullopt if there is no such node
+     *
+     * @param hash_value The hash value of the state
+     * @param state The state searching for
+     * @return The ID of the node for the given state, or null value
+     */
+    std::optional<NodeID> getCollidingNodeID(Hash_t hash_value, const State_t& state) const;
+
     /**
      * Gets the current action list being examined by the search.
      *
@@ -152,42 +179,82 @@ protected:
     SearchSettingsMap getSubComponentSettings() const override;
 
 private:
+    /**
+     * Evaluates the newly generated children of the current expansion as a single batch and adds them to open.
+     */
+    void evaluateAndOpenNewChildren();
+
+    /**
+     * Sets the key of the given unevaluated node for the primary evaluator to the evaluation of its parent, and
+     * evaluates the node with the tie-breaking evaluators.
+     *
+     * @param node_id The ID of the node
+     */
+    void setDeferredKey(NodeID node_id);
+
+    /**
+     * Returns if the given node was opened with a deferred key and has not been evaluated.
+     *
+     * @param node_id The ID of the node
+     * @return If the evaluation of the node is deferred
+     */
+    bool isDeferred(NodeID node_id) const { return node_id < m_is_deferred.size() && m_is_deferred[node_id]; }
+
     BestFirstSearchParams m_params;  ///< The params to set BFS
     EvalsAndUsageVec<State_t, Action_t> m_evaluators;
     const StateHashFunction<State_t, Hash_t>* m_hash_func = nullptr;  ///< The hash function.
+    const IncrementalStateHashFunction<State_t, Action_t, Hash_t>* m_incremental_hash_func = nullptr;  ///< The hash function, if it can hash children incrementally
+    std::vector<Hash_t> m_node_hashes;  ///< The hash value of each node. Only stored when hashing incrementally
+    bool m_verify_hashes = false;  ///< Whether generated states are compared to the stored state with the same hash value
     NodeMap m_node_map;  ///< The map used to determine if a hash value is already associated with a node.
+    std::unordered_map<Hash_t, std::vector<NodeID>> m_colliding_nodes;  ///< The nodes whose hash value was already associated with a different state in the map
 
-    NodeList<State_t, Action_t> m_nodes;  ///< The list of nodes
+    NodeContainer_t m_nodes;  ///< The list of nodes
     HeapBasedOpenList<State_t, Action_t> m_open_list;  ///< The open list
     NodeID m_last_expanded_node_id = 0;  ///< Stores last expanded node ID
 
     int64_t m_num_reex = 0;  ///< The number of re-expansions
     int64_t m_num_reopenings = 0;  ///< The number of reopenings
+    int64_t m_num_hash_collisions = 0;  ///< The number of generated states found to share a hash value with a different stored state
+    int64_t m_num_deferred_children = 0;  ///< The number of children opened without being evaluated
+    int64_t m_num_deferred_evals = 0;  ///< The number of deferred evaluations done when selecting a node for expansion
+    int64_t m_num_deferred_reinsertions = 0;  ///< The number of nodes put back in open after their deferred evaluation
 
     std::vector<Action_t> m_app_actions;  ///< A vector to store the set of applicable actions.
 
     std::vector<NodeID> m_expansion_order;  ///< A vector to store the order of the expanded node IDs
     std::vector<NodeID> m_children;  ///< The indices corresponding to the children of the current node
+    std::vector<NodeID> m_new_children;  ///< The indices of the children of the current node that are yet to be evaluated
     std::vector<int> m_node_expansion_count;  ///< The number of times each node was expanded
+    std::vector<bool> m_is_deferred;  ///< Whether each node has been opened without being evaluated
 };
 
-template<class State_t, class Action_t, class Hash_t>
-StringMap BestFirstSearch<State_t, Action_t, Hash_t>::getEngineSpecificStatistics() const {
+template<class State_t, class Action_t, class Hash_t, class NodeContainer_t>
+StringMap BestFirstSearch<State_t, Action_t, Hash_t, NodeContainer_t>::getEngineSpecificStatistics() const {
     StringMap stats = SingleStepSearchEngine<State_t, Action_t>::getEngineSpecificStatistics();
     stats["num_reexpansions"] = std::to_string(m_num_reex);
     stats["num_reopenings"] = std::to_string(m_num_reopenings);
+    stats["num_hash_collisions"] = std::to_string(m_num_hash_collisions);
+    stats["num_deferred_children"] = std::to_string(m_num_deferred_children);
+    stats["num_deferred_evals"] = std::to_string(m_num_deferred_evals);
+    stats["num_deferred_reinsertions"] = std::to_string(m_num_deferred_reinsertions);
+    stats["num_evals_saved"] = std::to_string(m_num_deferred_children - m_num_deferred_evals);
 
     return stats;
 }
 
-template<class State_t, class Action_t, class Hash_t>
-inline void BestFirstSearch<State_t, Action_t, Hash_t>::setHashFunction(const StateHashFunction<State_t, Hash_t>& hash) {
+template<class State_t, class Action_t, class Hash_t, class NodeContainer_t>
+inline void BestFirstSearch<State_t, Action_t, Hash_t, NodeContainer_t>::setHashFunction(const StateHashFunction<State_t, Hash_t>& hash) {
     m_hash_func = &hash;
+    m_incremental_hash_func = dynamic_cast<const IncrementalStateHashFunction<State_t, Action_t, Hash_t>*>(&hash);
+    if constexpr (std::is_same_v<NodeContainer_t, RankedNodeList<State_t, Action_t, Hash_t>>) {
+        m_nodes.setHashFunction(hash);
+    }
     SE::reset();
 }
 
-template<class State_t, class Action_t, class Hash_t>
-void BestFirstSearch<State_t, Action_t, Hash_t>::setEvaluators(const EvalsAndUsageVec<State_t, Action_t>& evaluators) {
+template<class State_t, class Action_t, class Hash_t, class NodeContainer_t>
+void BestFirstSearch<State_t, Action_t, Hash_t, NodeContainer_t>::setEvaluators(const EvalsAndUsageVec<State_t, Action_t>& evaluators) {
     m_evaluators = evaluators;
 
     for (auto& eval_and_usage : evaluators) {
@@ -198,24 +265,29 @@ void BestFirstSearch<State_t, Action_t, Hash_t>::setEvaluators(const EvalsAndUsa
     SE::reset();
 }
 
-template<class State_t, class Action_t, class Hash_t>
-void BestFirstSearch<State_t, Action_t, Hash_t>::setEvaluator(NodeEvaluator<State_t, Action_t>& evaluator) {
+template<class State_t, class Action_t, class Hash_t, class NodeContainer_t>
+void BestFirstSearch<State_t, Action_t, Hash_t, NodeContainer_t>::setEvaluator(NodeEvaluator<State_t, Action_t>& evaluator) {
     EvalsAndUsageVec<State_t, Action_t> evals;
     evals.emplace_back(evaluator, true);
     setEvaluators(evals);
 }
 
-template<class State_t, class Action_t, class Hash_t>
-void BestFirstSearch<State_t, Action_t, Hash_t>::setEngineParams(const BestFirstSearchParams& params) {
+template<class State_t, class Action_t, class Hash_t, class NodeContainer_t>
+void BestFirstSearch<State_t, Action_t, Hash_t, NodeContainer_t>::setEngineParams(const BestFirstSearchParams& params) {
     m_params = params;
     SE::reset();
 }
 
-template<class State_t, class Action_t, class Hash_t>
-void BestFirstSearch<State_t, Action_t, Hash_t>::doSearchInitialization(const State_t& initial_state) {
+template<class State_t, class Action_t, class Hash_t, class NodeContainer_t>
+void BestFirstSearch<State_t, Action_t, Hash_t, NodeContainer_t>::doSearchInitialization(const State_t& initial_state) {
+    m_verify_hashes = m_params.m_verify_hash_matches || !m_hash_func->isPerfectHashFunction();
+
     Hash_t init_hash = m_hash_func->getHashValue(initial_state);
     NodeID init_id = m_nodes.addNode(initial_state);
     m_node_map[init_hash] = init_id;
+    if (m_incremental_hash_func) {
+        m_node_hashes.push_back(init_hash);
+    }
 
     SE::evaluateNode(init_id);
 
@@ -223,13 +295,26 @@ void BestFirstSearch<State_t, Action_t, Hash_t>::doSearchInitialization(const St
     m_node_expansion_count.resize(1, 0);
 }
 
-template<class State_t, class Action_t, class Hash_t>
-EngineStatus BestFirstSearch<State_t, Action_t, Hash_t>::doSingleSearchStep() {
+template<class State_t, class Action_t, class Hash_t, class NodeContainer_t>
+EngineStatus BestFirstSearch<State_t, Action_t, Hash_t, NodeContainer_t>::doSingleSearchStep() {
     if (m_open_list.isEmpty()) {
         return EngineStatus::not_ready;  // TODO: This should be search completed, but needs testing
     }
 
     NodeID to_expand_id = m_open_list.getAndRemoveIDOfBestNode();
+    if (isDeferred(to_expand_id)) {
+        m_is_deferred[to_expand_id] = false;
+        m_num_deferred_evals++;
+        SE::evaluateNode(to_expand_id);
+
+        // Only expand the node if it is still no worse than the best node once it has been evaluated
+        if (!m_open_list.isNoWorseThanBestNode(to_expand_id)) {
+            m_num_deferred_reinsertions++;
+            m_open_list.addToOpen(to_expand_id);
+            return EngineStatus::active;
+        }
+    }
+
     m_node_expansion_count[to_expand_id]++;
     if (m_node_expansion_count[to_expand_id] > 1) {
         m_num_reex++;
@@ -249,9 +334,11 @@ EngineStatus BestFirstSearch<State_t, Action_t, Hash_t>::doSingleSearchStep() {
 
     m_app_actions.clear();
     m_children.clear();
+    m_new_children.clear();
 
     m_app_actions = SE::getApplicableActions(m_nodes.getState(to_expand_id));
     // randomlyReorderVector(m_app_actions, *SE::getRandomNumGenerator().get());
+    NodeID first_new_child_id = m_nodes.size();
 
     for (unsigned i = 0; i < m_app_actions.size(); i++) {
         double current_action_cost = SE::getActionCost(m_nodes.getState(to_expand_id), m_app_actions[i]);
@@ -259,9 +346,22 @@ EngineStatus BestFirstSearch<State_t, Action_t, Hash_t>::doSingleSearchStep() {
 
         State_t child_state = SE::getChildState(m_nodes.getState(to_expand_id), m_app_actions[i]);
 
-        Hash_t child_hash = m_hash_func->getHashValue(child_state);
+        Hash_t child_hash;
+        if (m_incremental_hash_func) {
+            child_hash = m_incremental_hash_func->getChildHash(m_node_hashes[to_expand_id], m_nodes.getState(to_expand_id), m_app_actions[i]);
+        } else {
+            child_hash = m_hash_func->getHashValue(child_state);
+        }
         std::optional<NodeID> possible_child_id = getNodeID(child_hash);
 
+        bool is_hash_collision = false;
+        if (possible_child_id && m_verify_hashes && !(m_nodes.getState(possible_child_id.value()) == child_state)) {
+            // A different state has the same hash value, so the child is looked for among the other states with that value
+            m_num_hash_collisions++;
+            possible_child_id = getCollidingNodeID(child_hash, child_state);
+            is_hash_collision = true;
+        }
+
         if (possible_child_id) {  // Node is in open or closed
             NodeID child_id = possible_child_id.value();
             m_children.push_back(child_id);
@@ -272,7 +372,15 @@ EngineStatus BestFirstSearch<State_t, Action_t, Hash_t>::doSingleSearchStep() {
                 m_nodes.setLastAction(child_id, m_app_actions[i]);
                 m_nodes.setLastActionCost(child_id, current_action_cost);
 
-                SE::reEvaluateNode(child_id);
+                if (child_id >= first_new_child_id) {
+                    // Generated earlier in this expansion, so it will be evaluated and opened with the other new children
+                    continue;
+                }
+                if (isDeferred(child_id)) {
+                    setDeferredKey(child_id);
+                } else {
+                    SE::reEvaluateNode(child_id);
+                }
 
                 if (m_open_list.isNodeInOpen(child_id)) {
                     m_open_list.evalChanged(child_id);
@@ -282,19 +390,25 @@ EngineStatus BestFirstSearch<State_t, Action_t, Hash_t>::doSingleSearchStep() {
                 }
             }
         } else {
-            if (SE::hasHitResourceLimit()) {
+            if (SE::hasHitResourceLimitWithPendingEvals(static_cast<int64_t>(m_new_children.size()))) {
+                evaluateAndOpenNewChildren();
                 return EngineStatus::resource_limit_hit;
             }
 
             NodeID child_id = m_nodes.addNode(child_state, to_expand_id, child_g, m_app_actions[i], current_action_cost);
-            m_node_map[child_hash] = child_id;
+            if (is_hash_collision) {
+                m_colliding_nodes[child_hash].push_back(child_id);
+            } else {
+                m_node_map[child_hash] = child_id;
+            }
+            if (m_incremental_hash_func) {
+                m_node_hashes.push_back(child_hash);
+            }
             m_children.push_back(child_id);
-
-            SE::evaluateNode(child_id);
-
-            m_open_list.addToOpen(child_id);
+            m_new_children.push_back(child_id);
         }
     }
+    evaluateAndOpenNewChildren();
 
     if (m_nodes.size() > m_node_expansion_count.size()) {
         m_node_expansion_count.resize(m_nodes.size(), 0);
@@ -302,21 +416,60 @@ EngineStatus BestFirstSearch<State_t, Action_t, Hash_t>::doSingleSearchStep() {
     return EngineStatus::active;
 }
 
-template<class State_t, class Action_t, class Hash_t>
-void BestFirstSearch<State_t, Action_t, Hash_t>::doReset() {
+template<class State_t, class Action_t, class Hash_t, class NodeContainer_t>
+void BestFirstSearch<State_t, Action_t, Hash_t, NodeContainer_t>::evaluateAndOpenNewChildren() {
+    if (m_params.m_use_deferred_evaluation) {
+        m_is_deferred.resize(m_nodes.size(), false);
+        for (NodeID child_id : m_new_children) {
+            m_is_deferred[child_id] = true;
+            setDeferredKey(child_id);
+        }
+        m_num_deferred_children += static_cast<int64_t>(m_new_children.size());
+    } else {
+        SE::evaluateNodes(m_new_children);
+    }
+
+    for (NodeID child_id : m_new_children) {
+        m_open_list.addToOpen(child_id);
+    }
+    m_new_children.clear();
+}
+
+template<class State_t, class Action_t, class Hash_t, class NodeContainer_t>
+void BestFirstSearch<State_t, Action_t, Hash_t, NodeContainer_t>::setDeferredKey(NodeID node_id) {
+    NodeEvaluator<State_t, Action_t>* primary_evaluator = m_evaluators[0].m_evaluator;
+    primary_evaluator->setCachedEval(node_id, primary_evaluator->getCachedEval(m_nodes.getParentID(node_id)));
+
+    // The tie-breakers order nodes with the same key, so they need the values of the node itself
+    for (std::size_t i = 1; i < m_evaluators.size(); ++i) {
+        m_evaluators[i].m_evaluator->prepareToEvaluate();
+        m_evaluators[i].m_evaluator->evaluate(node_id);
+    }
+}
+
+template<class State_t, class Action_t, class Hash_t, class NodeContainer_t>
+void BestFirstSearch<State_t, Action_t, Hash_t, NodeContainer_t>::doReset() {
     m_open_list.clear();
     m_node_map.clear();
+    m_colliding_nodes.clear();
+    m_node_hashes.clear();
     m_app_actions.clear();
+    m_new_children.clear();
     m_expansion_order.clear();
     m_nodes.clear();
     m_node_expansion_count.clear();
+    m_is_deferred.clear();
 
     m_num_reex = 0;
     m_num_reopenings = 0;
+    m_num_hash_collisions = 0;
+    m_num_deferred_children = 0;
+    m_num_deferred_evals = 0;
+    m_num_deferred_reinsertions = 0;
 }
 
-template<class State_t, class Action_t, class Hash_t>
-StringMap BestFirstSearch<State_t, Action_t, Hash_t>::getComponentSettings() const {
+template<class State_t, class Action_t, class Hash_t, class NodeContainer_t>
+StringMap BestFirstSearch<State_t, Action_t, Hash_t, NodeContainer_t>::getComponentSettings() const {
     auto se_log = SE::getComponentSettings();
     auto params_log = m_params.getParameterLog();
 
@@ -327,8 +480,8 @@ StringMap BestFirstSearch<State_t, Action_t, Hash_t>::getComponentSettings() con
     return se_log;
 }
 
-template<class State_t, class Action_t, class Hash_t>
-SearchSettingsMap BestFirstSearch<State_t, Action_t, Hash_t>::getSubComponentSettings() const {
+template<class State_t, class Action_t, class Hash_t, class NodeContainer_t>
+SearchSettingsMap BestFirstSearch<State_t, Action_t, Hash_t, NodeContainer_t>::getSubComponentSettings() const {
     SearchSettingsMap sub_components;
 
     sub_components["eval_function"] = m_evaluators[0].m_evaluator->getAllSettings();
@@ -337,9 +490,9 @@ SearchSettingsMap BestFirstSearch<State_t, Action_t, Hash_t>::getSubComponentSet
     return sub_components;
 }
 
-template<class State_t, class Action_t, class Hash_t>
-std::optional<NodeID> BestFirstSearch<State_t, Action_t, Hash_t>::getNodeID(Hash_t hash_value) const {
-    assert(m_nodes.size() == m_node_map.size());
+template<class State_t, class Action_t, class Hash_t, class NodeContainer_t>
+std::optional<NodeID> BestFirstSearch<State_t, Action_t, Hash_t, NodeContainer_t>::getNodeID(Hash_t hash_value) const {
+    assert(m_node_map.size() <= m_nodes.size());  // Nodes with colliding hash values are kept in m_colliding_nodes
 
     auto node_check = m_node_map.find(hash_value);
 
@@ -349,4 +502,20 @@ std::optional<NodeID> BestFirstSearch<State_t, Action_t, Hash_t>::getNodeID(Hash
 
     return node_check->second;
 }
-#endif  //BEST_FIRST_SEARCH_H_
\ No newline at end of file
+
+template<class State_t, class Action_t, class Hash_t, class NodeContainer_t>
+std::optional<NodeID> BestFirstSearch<State_t, Action_t, Hash_t, NodeContainer_t>::getCollidingNodeID(Hash_t hash_value,
+          const State_t& state) const {
+    auto colliding_check = m_colliding_nodes.find(hash_value);
+    if (colliding_check == m_colliding_nodes.end()) {
+        return std::nullopt;
+    }
+
+    for (NodeID node_id : colliding_check->second) {
+        if (m_nodes.getState(node_id) == state) {
+            return node_id;
+        }
+    }
+    return std::nullopt;
+}
+#endif  //BEST_FIRST_SEARCH_H_
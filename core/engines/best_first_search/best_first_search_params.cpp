@@ -6,5 +6,7 @@ StringMap BestFirstSearchParams::getParameterLog() const {
 
     params["use_reopened"] = boolToString(m_use_reopened);
     params["store_expansion_order"] = boolToString(m_store_expansion_order);
+    params["verify_hash_matches"] = boolToString(m_verify_hash_matches);
+    params["use_deferred_evaluation"] = boolToString(m_use_deferred_evaluation);
     return params;
 }
\ No newline at end of file
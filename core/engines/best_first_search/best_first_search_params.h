@@ -17,5 +17,7 @@ struct BestFirstSearchParams {
 
     bool m_use_reopened = true;  ///< Whether we are reopening closed nodes
     bool m_store_expansion_order = false;  ///< Whether we want to store the order of node expansions
+    bool m_verify_hash_matches = false;  ///< Whether to check that a generated state equals the stored state with the same hash value even if the hash function is perfect. This check is always done for hash functions that are not perfect
+    bool m_use_deferred_evaluation = false;  ///< Whether children are opened with a key from their parent, and only evaluated when selected for expansion
 };
 #endif  //BEST_FIRST_SEARCH_PARAMS_H_
\ No newline at end of file
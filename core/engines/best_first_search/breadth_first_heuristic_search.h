@@ -0,0 +1,565 @@
+#ifndef BREADTH_FIRST_HEURISTIC_SEARCH_H_
+#define BREADTH_FIRST_HEURISTIC_SEARCH_H_
+
+#include "building_tools/hashing/state_hash_function.h"
+#include "engines/best_first_search/breadth_first_heuristic_search_params.h"
+#include "engines/engine_components/node_containers/node_list.h"
+#include "engines/single_step_search_engine.h"
+#include "logging/logging_terms.h"
+#include "logging/search_component_settings.h"
+#include "search_basics/node_container.h"
+#include "search_basics/node_evaluator.h"
+#include "search_basics/search_engine.h"
+#include "utils/floating_point_utils.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <map>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/**
+ * A breadth-first heuristic search engine, which finds optimal solutions while only storing a few layers of the search.
+ *
+ * Each iteration is a uniform-cost search that expands nodes in layers of equal g-cost, pruning any node whose f-cost
+ * is above the cost bound of the iteration. Nodes are kept only while they can still be regenerated: a layer is removed
+ * once every layer being expanded is more than the largest action cost seen above it. If no solution is found, the
+ * next iteration uses the smallest f-cost that was pruned as its bound. This is breadth-first iterative deepening A*.
+ *
+ * Nodes do not store parent pointers. Instead, each node whose g-cost is above half of the bound stores the relay node,
+ * which is its last ancestor at or below half of the bound, along with the action taken from the relay node. When the
+ * goal is found, the path is split at the relay node, and each half is solved by a new search with the cost of that
+ * half as its bound. This recurses until every piece is a single action. The subsearches use the heuristic value minus
+ * the cost still needed to reach the goal from the end of the piece, which remains admissible.
+ *
+ * Removing old layers only avoids re-expanding nodes if actions are reversible with the same cost, as in the sliding
+ * tile puzzle or grid pathfinding. Otherwise the solution is still optimal, but nodes may be expanded more than once.
+ * All action costs must be positive, and the heuristic must be admissible.
+ *
+ * @tparam State_t The type of a state
+ * @tparam Action_t The type of an action
+ * @tparam Hash_t The hash type. Used to define the hash function for type lookup.
+ * @class BreadthFirstHeuristicSearch
+ */
+template<class State_t, class Action_t, class Hash_t>
+class BreadthFirstHeuristicSearch : public SingleStepSearchEngine<State_t, Action_t> {
+    using SE = SingleStepSearchEngine<State_t, Action_t>;  // Allows succinct access to the protected members
+
+public:
+    /**
+     * Creates a breadth-first heuristic search engine with the given parameters.
+     *
+     * @param params The struct containing the engines parameters
+     */
+    explicit BreadthFirstHeuristicSearch(const BreadthFirstHeuristicSearchParams& params)
+              : m_params(params) {}
+
+    /**
+     * Default destructor
+     */
+    virtual ~BreadthFirstHeuristicSearch() = default;
+
+    /**
+     * Sets the heuristic function used in the search.
+     *
+     * @param heuristic The heuristic function
+     */
+    void setHeuristic(NodeEvaluator<State_t, Action_t>& heuristic);
+
+    /**
+     * Sets the hash function used in the search. The hash function must be perfect, since states are
+     * only identified by their hash values.
+     *
+     * @param hash The new hash function
+     */
+    void setHashFunction(const StateHashFunction<State_t, Hash_t>& hash);
+
+    /**
+     * Set the breadth-first heuristic search params by input
+     *
+     * @param params The struct containing the engines parameters
+     */
+    void setEngineParams(const BreadthFirstHeuristicSearchParams& params);
+
+    /**
+     * Gets the largest number of nodes stored at once, including relay nodes.
+     *
+     * @return The largest number of nodes stored
+     */
+    std::size_t getMaxNodesStored() const { return m_max_nodes_stored; }
+
+    /**
+     * Gets the number of iterations used to find the cost of the solution, not counting the subsearches used to rebuild
+     * the solution.
+     *
+     * @return The number of iterations
+     */
+    int64_t getNumIterations() const { return m_num_iterations; }
+
+    /**
+     * Gets the number of subsearches used to rebuild the solution.
+     *
+     * @return The number of subsearches
+     */
+    int64_t getNumSubsearches() const { return m_num_subsearches; }
+
+    // Overridden public SearchEngine methods
+    StringMap getEngineSpecificStatistics() const override;
+    std::vector<NodeEvaluator<State_t, Action_t>*> getBaseEvaluators() const override { return {m_heuristic}; }
+
+    // Overidden public SettingsLogger methods
+    std::string getName() const override { return "BFHS"; }
+
+protected:
+    // Overridden SingleStepSearchEngine methods
+    void doSearchInitialization(const State_t& initial_state) override;
+    EngineStatus doSingleSearchStep() override;
+    bool doCanRunSearch() const override { return m_heuristic && m_hash_func && m_hash_func->isPerfectHashFunction(); }
+    void doReset() override;
+    StringMap getEngineParamsLog() const override { return m_params.getParameterLog(); }
+
+    // Overidden protected SettingsLogger methods
+    StringMap getComponentSettings() const override;
+    SearchSettingsMap getSubComponentSettings() const override;
+
+private:
+    /**
+     * A node stored by the search.
+     */
+    struct StoredNode {
+        State_t m_state;  ///< The state of the node
+        double m_g_cost = 0.0;  ///< The g-cost of the node
+        int64_t m_relay = -1;  ///< The index of the relay node of the node, or -1 if its g-cost is at most half the bound
+        std::optional<Action_t> m_relay_action = std::nullopt;  ///< The action taken from the relay node on the path to the node
+    };
+
+    /**
+     * A node kept as the relay node of other nodes.
+     */
+    struct RelayNode {
+        State_t m_state;  ///< The state of the node
+        double m_g_cost = 0.0;  ///< The g-cost of the node
+    };
+
+    /**
+     * A piece of the solution path that must still be found.
+     */
+    struct Segment {
+        State_t m_start;  ///< The first state of the piece
+        State_t m_target;  ///< The last state of the piece
+        double m_cost = 0.0;  ///< The cost of the piece
+        double m_h_offset = 0.0;  ///< The cost of the solution from the last state of the piece to the goal
+    };
+
+    /**
+     * An item on the stack of pieces of the solution, which is either an action or a segment yet to be found.
+     */
+    struct PlanItem {
+        std::optional<Segment> m_segment = std::nullopt;  ///< The segment to find, if this item is a segment
+        std::optional<Action_t> m_action = std::nullopt;  ///< The action, if this item is an action
+    };
+
+    /**
+     * Starts a uniform-cost search from the given state, pruning nodes whose f-cost is above the given bound.
+     *
+     * @param start The state to search from
+     * @param upper_bound The cost bound. If negative, the heuristic value of the start state is used
+     * @param segment The segment to find, or std::nullopt if the search is for the goal
+     */
+    void startLayeredSearch(const State_t& start, double upper_bound, std::optional<Segment> segment);
+
+    /**
+     * Expands the next node of the current search, or moves to the next layer.
+     *
+     * @return The status of the engine after the step
+     */
+    EngineStatus doLayeredSearchStep();
+
+    /**
+     * Moves past the current layer, and removes any earlier layers whose nodes can no longer be regenerated.
+     */
+    void finishLayer();
+
+    /**
+     * Generates the children of the given node, and stores those that are new or have a lower g-cost than before and
+     * are within the bound.
+     *
+     * @param node The node to expand
+     * @param hash The hash value of the state of the node
+     */
+    void expandNode(const StoredNode& node, const Hash_t& hash);
+
+    /**
+     * Splits the path to the given node at its relay node, and adds the pieces to the stack of pieces to find.
+     *
+     * @param node The node that ends the current search
+     */
+    void splitPathToNode(const StoredNode& node);
+
+    /**
+     * Gets the index of the relay node for the given node, adding it as a relay node if it is not one yet.
+     *
+     * @param node The node to use as a relay node
+     * @param hash The hash value of the state of the node
+     * @return The index of the relay node
+     */
+    int64_t getRelayIndex(const StoredNode& node, const Hash_t& hash);
+
+    /**
+     * Frees the nodes of the current search.
+     */
+    void clearLayeredSearch();
+
+    BreadthFirstHeuristicSearchParams m_params;  ///< The params to set the engine
+    NodeEvaluator<State_t, Action_t>* m_heuristic = nullptr;  ///< The heuristic function
+    const StateHashFunction<State_t, Hash_t>* m_hash_func = nullptr;  ///< The hash function
+
+    NodeList<State_t, Action_t> m_batch_nodes;  ///< Holds a parent and its children while they are evaluated
+    std::vector<Hash_t> m_child_hashes;  ///< The hash values of the children being evaluated
+    std::vector<NodeID> m_child_ids;  ///< The IDs of the children being evaluated
+    std::vector<Action_t> m_child_actions;  ///< The actions that generated the children being evaluated
+
+    // The current uniform-cost search
+    bool m_is_layered_search_active = false;  ///< If a uniform-cost search is in progress
+    std::optional<Segment> m_current_segment = std::nullopt;  ///< The segment being found, or std::nullopt if searching for the goal
+    std::optional<Hash_t> m_target_hash = std::nullopt;  ///< The hash value of the last state of the segment being found
+    double m_upper_bound = 0.0;  ///< The cost bound of the current search
+    std::unordered_map<Hash_t, StoredNode> m_stored_nodes;  ///< The nodes of all stored layers
+    std::map<double, std::vector<Hash_t>> m_open_layers;  ///< The layers yet to be expanded, by g-cost
+    std::deque<std::pair<double, std::vector<Hash_t>>> m_closed_layers;  ///< The expanded layers that are still stored
+    std::size_t m_next_in_layer = 0;  ///< The index of the next node to expand in the current layer
+    std::vector<RelayNode> m_relays;  ///< The relay nodes of the current search
+    std::unordered_map<Hash_t, int64_t> m_relay_indices;  ///< Maps the hash value of a relay node to its index
+    double m_max_action_cost = 0.0;  ///< The largest action cost seen
+    double m_next_upper_bound = std::numeric_limits<double>::infinity();  ///< The smallest f-cost pruned in the current search
+
+    // Rebuilding the solution
+    std::optional<State_t> m_initial_state = std::nullopt;  ///< The initial state of the search
+    bool m_found_solution_cost = false;  ///< If the cost of the solution has been found
+    double m_solution_cost = 0.0;  ///< The cost of the solution
+    std::vector<PlanItem> m_plan_stack;  ///< The pieces of the solution still to be found, with the first piece on top
+    std::vector<Action_t> m_plan;  ///< The actions of the solution found so far
+
+    int64_t m_num_iterations = 0;  ///< The number of iterations used to find the solution cost
+    int64_t m_num_subsearches = 0;  ///< The number of subsearches used to rebuild the solution
+    std::size_t m_max_nodes_stored = 0;  ///< The largest number of nodes stored at once
+};
+
+template<class State_t, class Action_t, class Hash_t>
+void BreadthFirstHeuristicSearch<State_t, Action_t, Hash_t>::setHeuristic(NodeEvaluator<State_t, Action_t>& heuristic) {
+    m_heuristic = &heuristic;
+    m_heuristic->setNodeContainer(m_batch_nodes);
+    SE::reset();
+}
+
+template<class State_t, class Action_t, class Hash_t>
+void BreadthFirstHeuristicSearch<State_t, Action_t, Hash_t>::setHashFunction(const StateHashFunction<State_t, Hash_t>& hash) {
+    m_hash_func = &hash;
+    SE::reset();
+}
+
+template<class State_t, class Action_t, class Hash_t>
+void BreadthFirstHeuristicSearch<State_t, Action_t, Hash_t>::setEngineParams(const BreadthFirstHeuristicSearchParams& params) {
+    m_params = params;
+    SE::reset();
+}
+
+template<class State_t, class Action_t, class Hash_t>
+StringMap BreadthFirstHeuristicSearch<State_t, Action_t, Hash_t>::getEngineSpecificStatistics() const {
+    StringMap stats = SE::getEngineSpecificStatistics();
+    stats["num_iterations"] = std::to_string(m_num_iterations);
+    stats["num_subsearches"] = std::to_string(m_num_subsearches);
+    stats["max_nodes_stored"] = std::to_string(m_max_nodes_stored);
+
+    return stats;
+}
+
+template<class State_t, class Action_t, class Hash_t>
+void BreadthFirstHeuristicSearch<State_t, Action_t, Hash_t>::doSearchInitialization(const State_t& initial_state) {
+    m_initial_state = initial_state;
+    m_num_iterations++;
+    startLayeredSearch(initial_state, m_params.m_initial_upper_bound, std::nullopt);
+}
+
+template<class State_t, class Action_t, class Hash_t>
+EngineStatus BreadthFirstHeuristicSearch<State_t, Action_t, Hash_t>::doSingleSearchStep() {
+    if (m_is_layered_search_active) {
+        return doLayeredSearchStep();
+    }
+
+    if (!m_found_solution_cost) {
+        if (m_next_upper_bound == std::numeric_limits<double>::infinity()) {
+            return EngineStatus::search_completed;
+        }
+        m_num_iterations++;
+        startLayeredSearch(m_initial_state.value(), m_next_upper_bound, std::nullopt);
+        return EngineStatus::active;
+    }
+
+    if (m_plan_stack.empty()) {
+        SE::setIncumbentSolution(m_plan, m_solution_cost);
+        return EngineStatus::search_completed;
+    }
+
+    PlanItem item = std::move(m_plan_stack.back());
+    m_plan_stack.pop_back();
+    if (item.m_action) {
+        m_plan.push_back(item.m_action.value());
+    } else if (!fpEqual(item.m_segment->m_cost, 0.0)) {
+        m_num_subsearches++;
+        startLayeredSearch(item.m_segment->m_start, item.m_segment->m_cost, item.m_segment);
+    }
+    return EngineStatus::active;
+}
+
+template<class State_t, class Action_t, class Hash_t>
+void BreadthFirstHeuristicSearch<State_t, Action_t, Hash_t>::startLayeredSearch(const State_t& start, double upper_bound,
+          std::optional<Segment> segment) {
+    clearLayeredSearch();
+    m_is_layered_search_active = true;
+    m_next_upper_bound = std::numeric_limits<double>::infinity();
+    m_current_segment = std::move(segment);
+    if (m_current_segment) {
+        m_target_hash = m_hash_func->getHashValue(m_current_segment->m_target);
+    }
+
+    NodeID start_id = m_batch_nodes.addNode(start);
+    SE::evaluateNode(start_id);
+    if (m_heuristic->getCachedIsDeadEnd(start_id)) {
+        m_upper_bound = upper_bound;
+        return;
+    }
+
+    double h_offset = m_current_segment ? m_current_segment->m_h_offset : 0.0;
+    double start_h_cost = std::max(m_heuristic->getCachedEval(start_id) - h_offset, 0.0);
+    m_upper_bound = upper_bound < 0.0 ? start_h_cost : upper_bound;
+    if (fpGreater(start_h_cost, m_upper_bound)) {
+        m_next_upper_bound = start_h_cost;
+        return;
+    }
+
+    Hash_t start_hash = m_hash_func->getHashValue(start);
+    m_stored_nodes.emplace(start_hash, StoredNode{start, 0.0, -1, std::nullopt});
+    m_open_layers[0.0].push_back(start_hash);
+    m_max_nodes_stored = std::max(m_max_nodes_stored, std::size_t{1});
+}
+
+template<class State_t, class Action_t, class Hash_t>
+EngineStatus BreadthFirstHeuristicSearch<State_t, Action_t, Hash_t>::doLayeredSearchStep() {
+    while (!m_open_layers.empty()) {
+        auto layer_iter = m_open_layers.begin();
+        if (m_next_in_layer >= layer_iter->second.size()) {
+            finishLayer();
+            continue;
+        }
+
+        Hash_t hash = layer_iter->second[m_next_in_layer++];
+        auto node_iter = m_stored_nodes.find(hash);
+
+        // The node has since been found with a lower g-cost, and so was expanded in an earlier layer
+        if (node_iter == m_stored_nodes.end() || !fpEqual(node_iter->second.m_g_cost, layer_iter->first)) {
+            continue;
+        }
+
+        StoredNode node = node_iter->second;
+        bool is_target = m_current_segment ? hash == m_target_hash.value() : SE::isGoal(node.m_state);
+        if (is_target) {
+            if (!m_current_segment) {
+                m_found_solution_cost = true;
+                m_solution_cost = node.m_g_cost;
+            }
+            splitPathToNode(node);
+            clearLayeredSearch();
+            return EngineStatus::active;
+        }
+
+        expandNode(node, hash);
+        return EngineStatus::active;
+    }
+
+    // Each subsearch has the exact cost of its segment as its bound, so it must find its target
+    assert(!m_current_segment);
+    clearLayeredSearch();
+    return EngineStatus::active;
+}
+
+template<class State_t, class Action_t, class Hash_t>
+void BreadthFirstHeuristicSearch<State_t, Action_t, Hash_t>::finishLayer() {
+    auto layer_iter = m_open_layers.begin();
+    m_closed_layers.emplace_back(layer_iter->first, std::move(layer_iter->second));
+    m_open_layers.erase(layer_iter);
+    m_next_in_layer = 0;
+
+    if (m_open_layers.empty()) {
+        return;
+    }
+
+    // A node can only be regenerated by a node whose g-cost is at most the largest action cost more than its own
+    double min_needed_g_cost = m_open_layers.begin()->first - m_max_action_cost;
+    while (!m_closed_layers.empty() && fpLess(m_closed_layers.front().first, min_needed_g_cost)) {
+        for (const Hash_t& hash : m_closed_layers.front().second) {
+            auto node_iter = m_stored_nodes.find(hash);
+            if (node_iter != m_stored_nodes.end() && fpEqual(node_iter->second.m_g_cost, m_closed_layers.front().first)) {
+                m_stored_nodes.erase(node_iter);
+            }
+        }
+        m_closed_layers.pop_front();
+    }
+}
+
+template<class State_t, class Action_t, class Hash_t>
+void BreadthFirstHeuristicSearch<State_t, Action_t, Hash_t>::expandNode(const StoredNode& node, const Hash_t& hash) {
+    m_batch_nodes.clear();
+    m_child_hashes.clear();
+    m_child_ids.clear();
+    m_child_actions.clear();
+    NodeID parent_id = m_batch_nodes.addNode(node.m_state);
+
+    for (const Action_t& action : SE::getApplicableActions(node.m_state)) {
+        double action_cost = SE::getActionCost(node.m_state, action);
+        assert(action_cost > 0.0);
+        m_max_action_cost = std::max(m_max_action_cost, action_cost);
+
+        State_t child_state = SE::getChildState(node.m_state, action);
+        Hash_t child_hash = m_hash_func->getHashValue(child_state);
+        double child_g_cost = node.m_g_cost + action_cost;
+
+        auto stored_iter = m_stored_nodes.find(child_hash);
+        if (stored_iter != m_stored_nodes.end() && !fpLess(child_g_cost, stored_iter->second.m_g_cost)) {
+            continue;
+        }
+
+        m_child_ids.push_back(m_batch_nodes.addNode(child_state, parent_id, child_g_cost, action, action_cost));
+        m_child_hashes.push_back(child_hash);
+        m_child_actions.push_back(action);
+    }
+
+    SE::evaluateNodes(m_child_ids);
+    double h_offset = m_current_segment ? m_current_segment->m_h_offset : 0.0;
+    double relay_g_cost = m_upper_bound / 2.0;
+
+    for (std::size_t i = 0; i < m_child_ids.size(); ++i) {
+        NodeID child_id = m_child_ids[i];
+        if (m_heuristic->getCachedIsDeadEnd(child_id)) {
+            continue;
+        }
+
+        double child_g_cost = m_batch_nodes.getGValue(child_id);
+        double child_f_cost = child_g_cost + std::max(m_heuristic->getCachedEval(child_id) - h_offset, 0.0);
+        if (fpGreater(child_f_cost, m_upper_bound)) {
+            m_next_upper_bound = std::min(m_next_upper_bound, child_f_cost);
+            continue;
+        }
+
+        StoredNode child{m_batch_nodes.getState(child_id), child_g_cost, -1, std::nullopt};
+        if (fpGreater(node.m_g_cost, relay_g_cost)) {
+            child.m_relay = node.m_relay;
+            child.m_relay_action = node.m_relay_action;
+        } else if (fpGreater(child_g_cost, relay_g_cost)) {
+            child.m_relay = getRelayIndex(node, hash);
+            child.m_relay_action = m_child_actions[i];
+        }
+
+        m_stored_nodes.insert_or_assign(m_child_hashes[i], std::move(child));
+        m_open_layers[child_g_cost].push_back(m_child_hashes[i]);
+    }
+    m_max_nodes_stored = std::max(m_max_nodes_stored, m_stored_nodes.size() + m_relays.size());
+}
+
+template<class State_t, class Action_t, class Hash_t>
+int64_t BreadthFirstHeuristicSearch<State_t, Action_t, Hash_t>::getRelayIndex(const StoredNode& node, const Hash_t& hash) {
+    auto relay_iter = m_relay_indices.find(hash);
+    if (relay_iter != m_relay_indices.end()) {
+        return relay_iter->second;
+    }
+
+    m_relays.push_back({node.m_state, node.m_g_cost});
+    m_relay_indices[hash] = static_cast<int64_t>(m_relays.size()) - 1;
+    return m_relay_indices[hash];
+}
+
+template<class State_t, class Action_t, class Hash_t>
+void BreadthFirstHeuristicSearch<State_t, Action_t, Hash_t>::splitPathToNode(const StoredNode& node) {
+    const State_t& start = m_current_segment ? m_current_segment->m_start : m_initial_state.value();
+    double h_offset = m_current_segment ? m_current_segment->m_h_offset : 0.0;
+
+    if (node.m_relay < 0) {
+        // Only possible for the goal, when it is within half of the bound, so it is found again with the exact bound
+        if (!fpEqual(node.m_g_cost, 0.0)) {
+            m_plan_stack.push_back({Segment{start, node.m_state, node.m_g_cost, h_offset}, std::nullopt});
+        }
+        return;
+    }
+
+    const RelayNode& relay = m_relays[node.m_relay];
+    const Action_t& relay_action = node.m_relay_action.value();
+    State_t relay_child = SE::getTransitionSystem()->getChildState(relay.m_state, relay_action);
+    double relay_child_g_cost = relay.m_g_cost + SE::getTransitionSystem()->getActionCost(relay.m_state, relay_action);
+
+    // Pushed in reverse, so the first piece is on top of the stack
+    m_plan_stack.push_back({Segment{relay_child, node.m_state, node.m_g_cost - relay_child_g_cost, h_offset}, std::nullopt});
+    m_plan_stack.push_back({std::nullopt, relay_action});
+    m_plan_stack.push_back({Segment{start, relay.m_state, relay.m_g_cost, h_offset + node.m_g_cost - relay.m_g_cost}, std::nullopt});
+}
+
+template<class State_t, class Action_t, class Hash_t>
+void BreadthFirstHeuristicSearch<State_t, Action_t, Hash_t>::clearLayeredSearch() {
+    m_is_layered_search_active = false;
+    m_current_segment = std::nullopt;
+    m_target_hash = std::nullopt;
+    m_stored_nodes.clear();
+    m_open_layers.clear();
+    m_closed_layers.clear();
+    m_next_in_layer = 0;
+    m_relays.clear();
+    m_relay_indices.clear();
+    m_batch_nodes.clear();
+}
+
+template<class State_t, class Action_t, class Hash_t>
+void BreadthFirstHeuristicSearch<State_t, Action_t, Hash_t>::doReset() {
+    clearLayeredSearch();
+    m_max_action_cost = 0.0;
+    m_next_upper_bound = std::numeric_limits<double>::infinity();
+
+    m_initial_state = std::nullopt;
+    m_found_solution_cost = false;
+    m_solution_cost = 0.0;
+    m_plan_stack.clear();
+    m_plan.clear();
+
+    m_num_iterations = 0;
+    m_num_subsearches = 0;
+    m_max_nodes_stored = 0;
+}
+
+template<class State_t, class Action_t, class Hash_t>
+StringMap BreadthFirstHeuristicSearch<State_t, Action_t, Hash_t>::getComponentSettings() const {
+    auto se_log = SE::getComponentSettings();
+    auto params_log = m_params.getParameterLog();
+
+    for (const auto& [key, value] : params_log) {
+        se_log[key] = value;
+    }
+
+    return se_log;
+}
+
+template<class State_t, class Action_t, class Hash_t>
+SearchSettingsMap BreadthFirstHeuristicSearch<State_t, Action_t, Hash_t>::getSubComponentSettings() const {
+    SearchSettingsMap sub_components;
+
+    sub_components["heuristic"] = m_heuristic->getAllSettings();
+    sub_components["hash_function"] = m_hash_func->getAllSettings();
+
+    return sub_components;
+}
+
+#endif  // BREADTH_FIRST_HEURISTIC_SEARCH_H_
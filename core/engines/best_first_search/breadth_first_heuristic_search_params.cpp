@@ -0,0 +1,8 @@
+#include "breadth_first_heuristic_search_params.h"
+
+StringMap BreadthFirstHeuristicSearchParams::getParameterLog() const {
+    StringMap params;
+
+    params["initial_upper_bound"] = roundAndToString(m_initial_upper_bound, 2);
+    return params;
+}
@@ -0,0 +1,21 @@
+#ifndef BREADTH_FIRST_HEURISTIC_SEARCH_PARAMS_H_
+#define BREADTH_FIRST_HEURISTIC_SEARCH_PARAMS_H_
+
+#include "logging/logging_terms.h"
+#include "utils/string_utils.h"
+
+/**
+ * The parameters for a breadth-first heuristic search engine
+ */
+struct BreadthFirstHeuristicSearchParams {
+    /**
+     * Returns a map containing the log of the parameters used in breadth-first heuristic search
+     *
+     * @return A map to stand for the log of the params
+     */
+    StringMap getParameterLog() const;
+
+    double m_initial_upper_bound = -1.0;  ///< The cost bound of the first iteration. If negative, the heuristic value of the initial state is used
+};
+
+#endif  //BREADTH_FIRST_HEURISTIC_SEARCH_PARAMS_H_
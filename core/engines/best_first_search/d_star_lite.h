@@ -0,0 +1,607 @@
+#ifndef D_STAR_LITE_H_
+#define D_STAR_LITE_H_
+
+#include "building_tools/evaluators/single_goal_state_evaluator.h"
+#include "building_tools/hashing/state_hash_function.h"
+#include "building_tools/transitions/inverse_transition_system.h"
+#include "engines/best_first_search/d_star_lite_params.h"
+#include "engines/engine_components/node_containers/node_list.h"
+#include "engines/single_step_search_engine.h"
+#include "logging/logging_terms.h"
+#include "logging/search_component_settings.h"
+#include "search_basics/goal_test.h"
+#include "search_basics/node_container.h"
+#include "search_basics/node_evaluator.h"
+#include "search_basics/search_engine.h"
+#include "search_basics/transition_system.h"
+#include "utils/floating_point_utils.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/**
+ * A D* Lite engine for problems with a single goal state, which repairs its previous search when the start state moves
+ * or when the actions out of some states change, instead of searching again from scratch.
+ *
+ * D* Lite searches backward from the goal. Each state stores its g-cost, the cost of the best path from it to the goal
+ * found so far, and its rhs-value, the one-step lookahead of the g-cost computed from its successors. States whose two
+ * values differ are inconsistent, and are kept in a priority queue ordered by the key [min(g, rhs) + h + k_m; min(g,
+ * rhs)], where h estimates the cost from the start state to the state. The search ends when the start state is
+ * consistent and no key in the queue is lower than its key. The plan is then read off by greedily following the
+ * successor that minimizes the action cost plus its g-cost.
+ *
+ * Each call to searchForPlan for the same goal continues from the previous search. If the start state has moved, k_m
+ * is increased by the heuristic value between the old and new start states, so the keys already in the queue remain
+ * lower bounds. The states passed to notifyStateChanged since the last search have their rhs-values recomputed, and only
+ * the states whose g-costs are affected are expanded again. If the start state never moves, this is LPA* searching
+ * backward. The previous search is discarded if the goal changes, if a component of the engine is set, or if reuse is
+ * disabled in the parameters. The standard statistics count only the work done by the latest call.
+ *
+ * The goal state is taken from the goal test, which must be a SingleGoalStateEvaluator. The heuristic must be a
+ * SingleGoalStateEvaluator, and its goal state is set to the start state of each search. The predecessors of a state are
+ * generated with the inverse of the transition system, so every action must have an inverse. States that are not valid
+ * in the transition system have no actions into or out of them.
+ *
+ * @tparam State_t The type of a state
+ * @tparam Action_t The type of an action
+ * @tparam Hash_t The hash type. Used to define the hash function for type lookup.
+ * @class DStarLite
+ */
+template<class State_t, class Action_t, class Hash_t>
+class DStarLite : public SingleStepSearchEngine<State_t, Action_t> {
+    using SE = SingleStepSearchEngine<State_t, Action_t>;  // Allows succinct access to the protected members
+    using Key = std::pair<double, double>;  ///< The priority of a state in the queue
+
+public:
+    /**
+     * Creates a D* Lite engine with the given parameters.
+     *
+     * @param params The struct containing the engines parameters
+     */
+    explicit DStarLite(const DStarLiteParams& params)
+              : m_params(params) {}
+
+    /**
+     * Default destructor
+     */
+    virtual ~DStarLite() = default;
+
+    /**
+     * Sets the heuristic, which estimates the cost from the start state to a given state. Must be a
+     * SingleGoalStateEvaluator.
+     *
+     * @param heuristic The heuristic to use
+     */
+    void setHeuristic(NodeEvaluator<State_t, Action_t>& heuristic);
+
+    /**
+     * Sets the hash function used in the search.
+     *
+     * @param hash The new hash function
+     */
+    void setHashFunction(const StateHashFunction<State_t, Hash_t>& hash);
+
+    /**
+     * Set the D* Lite params by input
+     *
+     * @param params The struct containing the engines parameters
+     */
+    void setEngineParams(const DStarLiteParams& params);
+
+    /**
+     * Records that the actions out of the given state, or their costs, may have changed since the last search. The
+     * change is repaired in the next search. States not seen by the search so far are ignored.
+     *
+     * @param state The state whose actions may have changed
+     */
+    void notifyStateChanged(const State_t& state);
+
+    /**
+     * Discards the previous search, so the next search starts from scratch.
+     */
+    void clearSearchData();
+
+    /**
+     * Gets the nodes of all states seen by the search.
+     *
+     * @return The list of nodes
+     */
+    const NodeList<State_t, Action_t>& getNodes() const { return m_nodes; }
+
+    /**
+     * Gets the g-cost of the given state, which is infinite if the state has not been seen or has no known path to the
+     * goal.
+     *
+     * @param state The state
+     * @return The g-cost of the state
+     */
+    double getGValue(const State_t& state) const;
+
+    /**
+     * Gets the number of searches that repaired a previous search, rather than starting from scratch.
+     *
+     * @return The number of repairing searches
+     */
+    int64_t getNumRepairs() const { return m_num_repairs; }
+
+    // Overridden public SearchEngine methods
+    void setTransitionSystem(const TransitionSystem<State_t, Action_t>& trans_system) override;
+    void setGoalTest(const GoalTest<State_t>& goal_test) override;
+    StringMap getEngineSpecificStatistics() const override;
+    std::vector<NodeEvaluator<State_t, Action_t>*> getBaseEvaluators() const override { return {m_heuristic}; }
+
+    // Overidden public SettingsLogger methods
+    std::string getName() const override { return "DStarLite"; }
+
+protected:
+    // Overridden SingleStepSearchEngine methods
+    void doSearchInitialization(const State_t& initial_state) override;
+    EngineStatus doSingleSearchStep() override;
+    bool doCanRunSearch() const override;
+    void doReset() override;
+    StringMap getEngineParamsLog() const override { return m_params.getParameterLog(); }
+
+    // Overidden protected SettingsLogger methods
+    StringMap getComponentSettings() const override;
+    SearchSettingsMap getSubComponentSettings() const override;
+
+private:
+    /**
+     * Gets the ID of the node for the given state, adding a node if the state has not been seen.
+     *
+     * @param state The state
+     * @return The ID of the state's node
+     */
+    NodeID getNodeID(const State_t& state);
+
+    /**
+     * Gets the heuristic value of the given node, evaluating it if it has not been evaluated since the start state was
+     * last set. Dead ends have an infinite heuristic value.
+     *
+     * @param node_id The ID of the node
+     * @return The heuristic value
+     */
+    double getHValue(NodeID node_id);
+
+    /**
+     * Computes the key of the given node.
+     *
+     * @param node_id The ID of the node
+     * @return The key of the node
+     */
+    Key calculateKey(NodeID node_id);
+
+    /**
+     * Returns if the first key is lower than the second, given some tolerance due to floating point arithmetic.
+     *
+     * @param key1 The first key
+     * @param key2 The second key
+     * @return If the first key is lower
+     */
+    static bool isKeyLess(const Key& key1, const Key& key2);
+
+    /**
+     * Recomputes the rhs-value of the given node from its successors. The rhs-value of the goal is always zero.
+     *
+     * @param node_id The ID of the node
+     */
+    void recomputeRHSValue(NodeID node_id);
+
+    /**
+     * Adds the given node to the queue, removes it, or updates its key, according to whether it is consistent.
+     *
+     * @param node_id The ID of the node
+     */
+    void updateVertex(NodeID node_id);
+
+    /**
+     * Removes the given node from the queue, if it is in it.
+     *
+     * @param node_id The ID of the node
+     */
+    void removeFromQueue(NodeID node_id);
+
+    /**
+     * Gets the predecessors of the given node's state and the cost of the action from each to the state.
+     *
+     * @param node_id The ID of the node
+     * @return The IDs of the predecessors and the action costs
+     */
+    std::vector<std::pair<NodeID, double>> getPredecessors(NodeID node_id);
+
+    /**
+     * Extracts the plan from the start state by following the best successor of each state, and sets it as the
+     * incumbent. Does nothing if the start state has no path to the goal.
+     */
+    void extractPlan();
+
+    DStarLiteParams m_params;  ///< The params to set the engine
+    NodeEvaluator<State_t, Action_t>* m_heuristic = nullptr;  ///< The heuristic
+    const StateHashFunction<State_t, Hash_t>* m_hash_func = nullptr;  ///< The hash function
+    std::unique_ptr<InverseTransitionSystem<State_t, Action_t>> m_inverse_transitions;  ///< Generates predecessors
+
+    NodeList<State_t, Action_t> m_nodes;  ///< The nodes of all states seen. Only the states are used.
+    std::unordered_map<Hash_t, NodeID> m_node_map;  ///< Maps the hash value of a state to its node
+    std::vector<double> m_g_values;  ///< The g-cost of each node
+    std::vector<double> m_rhs_values;  ///< The rhs-value of each node
+    std::vector<Key> m_keys;  ///< The key each node is in the queue with
+    std::vector<bool> m_in_queue;  ///< If each node is in the queue
+    std::vector<uint32_t> m_h_epochs;  ///< The heuristic epoch each node was last evaluated in
+    std::set<std::pair<Key, NodeID>> m_queue;  ///< The inconsistent nodes, ordered by key
+
+    bool m_have_search_data = false;  ///< If there is a previous search to repair
+    std::optional<Hash_t> m_goal_hash = std::nullopt;  ///< The hash value of the goal of the previous search
+    NodeID m_goal_id = 0;  ///< The ID of the goal node
+    NodeID m_start_id = 0;  ///< The ID of the start node
+    double m_key_modifier = 0.0;  ///< The k_m value, which is the sum of the heuristic values between successive start states
+    uint32_t m_h_epoch = 0;  ///< Increased when the heuristic's goal is set, so that heuristic values are recomputed
+    std::vector<State_t> m_changed_states;  ///< The states whose actions have changed since the last search
+
+    int64_t m_num_expansions = 0;  ///< The number of nodes popped from the queue in the latest search
+    int64_t m_num_key_updates = 0;  ///< The number of nodes reinserted with a new key in the latest search
+    int64_t m_num_changes_repaired = 0;  ///< The number of changed states whose rhs-value was recomputed in the latest search
+    int64_t m_num_repairs = 0;  ///< The number of searches that repaired a previous search
+};
+
+template<class State_t, class Action_t, class Hash_t>
+void DStarLite<State_t, Action_t, Hash_t>::setHeuristic(NodeEvaluator<State_t, Action_t>& heuristic) {
+    m_heuristic = &heuristic;
+    m_heuristic->setNodeContainer(m_nodes);
+    clearSearchData();
+    SE::reset();
+}
+
+template<class State_t, class Action_t, class Hash_t>
+void DStarLite<State_t, Action_t, Hash_t>::setHashFunction(const StateHashFunction<State_t, Hash_t>& hash) {
+    m_hash_func = &hash;
+    clearSearchData();
+    SE::reset();
+}
+
+template<class State_t, class Action_t, class Hash_t>
+void DStarLite<State_t, Action_t, Hash_t>::setEngineParams(const DStarLiteParams& params) {
+    m_params = params;
+    clearSearchData();
+    SE::reset();
+}
+
+template<class State_t, class Action_t, class Hash_t>
+void DStarLite<State_t, Action_t, Hash_t>::setTransitionSystem(const TransitionSystem<State_t, Action_t>& trans_system) {
+    clearSearchData();
+    SE::setTransitionSystem(trans_system);
+}
+
+template<class State_t, class Action_t, class Hash_t>
+void DStarLite<State_t, Action_t, Hash_t>::setGoalTest(const GoalTest<State_t>& goal_test) {
+    clearSearchData();
+    SE::setGoalTest(goal_test);
+}
+
+template<class State_t, class Action_t, class Hash_t>
+void DStarLite<State_t, Action_t, Hash_t>::notifyStateChanged(const State_t& state) {
+    if (m_have_search_data) {
+        m_changed_states.push_back(state);
+    }
+}
+
+template<class State_t, class Action_t, class Hash_t>
+void DStarLite<State_t, Action_t, Hash_t>::clearSearchData() {
+    m_nodes.clear();
+    m_node_map.clear();
+    m_g_values.clear();
+    m_rhs_values.clear();
+    m_keys.clear();
+    m_in_queue.clear();
+    m_h_epochs.clear();
+    m_queue.clear();
+
+    m_have_search_data = false;
+    m_goal_hash = std::nullopt;
+    m_goal_id = 0;
+    m_start_id = 0;
+    m_key_modifier = 0.0;
+    m_changed_states.clear();
+    m_num_repairs = 0;
+}
+
+template<class State_t, class Action_t, class Hash_t>
+double DStarLite<State_t, Action_t, Hash_t>::getGValue(const State_t& state) const {
+    auto node_iter = m_node_map.find(m_hash_func->getHashValue(state));
+    if (node_iter == m_node_map.end()) {
+        return std::numeric_limits<double>::infinity();
+    }
+    return m_g_values[node_iter->second];
+}
+
+template<class State_t, class Action_t, class Hash_t>
+StringMap DStarLite<State_t, Action_t, Hash_t>::getEngineSpecificStatistics() const {
+    StringMap stats = SE::getEngineSpecificStatistics();
+    stats["num_expansions"] = std::to_string(m_num_expansions);
+    stats["num_key_updates"] = std::to_string(m_num_key_updates);
+    stats["num_changes_repaired"] = std::to_string(m_num_changes_repaired);
+    stats["num_repairs"] = std::to_string(m_num_repairs);
+    stats["num_stored_states"] = std::to_string(m_nodes.size());
+
+    return stats;
+}
+
+template<class State_t, class Action_t, class Hash_t>
+bool DStarLite<State_t, Action_t, Hash_t>::doCanRunSearch() const {
+    return m_heuristic && m_hash_func && dynamic_cast<SingleGoalStateEvaluator<State_t>*>(m_heuristic) != nullptr &&
+           dynamic_cast<const SingleGoalStateEvaluator<State_t>*>(SE::getGoalTest()) != nullptr;
+}
+
+template<class State_t, class Action_t, class Hash_t>
+void DStarLite<State_t, Action_t, Hash_t>::doReset() {
+    // The previous search is kept so that the next search can repair it
+    if (!m_params.m_reuse_previous_search) {
+        clearSearchData();
+    }
+    m_num_expansions = 0;
+    m_num_key_updates = 0;
+    m_num_changes_repaired = 0;
+}
+
+template<class State_t, class Action_t, class Hash_t>
+void DStarLite<State_t, Action_t, Hash_t>::doSearchInitialization(const State_t& initial_state) {
+    State_t goal_state = dynamic_cast<const SingleGoalStateEvaluator<State_t>*>(SE::getGoalTest())->getGoalState();
+    Hash_t goal_hash = m_hash_func->getHashValue(goal_state);
+    if (m_have_search_data && m_goal_hash != goal_hash) {
+        clearSearchData();
+    }
+
+    // The heuristic estimates the cost from the start state, and the evaluator caches may have been reset
+    dynamic_cast<SingleGoalStateEvaluator<State_t>*>(m_heuristic)->setGoalState(initial_state);
+    m_h_epoch++;
+
+    if (!m_have_search_data) {
+        m_inverse_transitions = std::make_unique<InverseTransitionSystem<State_t, Action_t>>(*SE::getTransitionSystem());
+        m_goal_hash = goal_hash;
+        m_goal_id = getNodeID(goal_state);
+        m_start_id = getNodeID(initial_state);
+        m_rhs_values[m_goal_id] = 0.0;
+        updateVertex(m_goal_id);
+        m_have_search_data = true;
+        return;
+    }
+
+    // The keys in the queue are lower bounds relative to the old start state, and are raised lazily when popped
+    m_num_repairs++;
+    NodeID old_start_id = m_start_id;
+    m_start_id = getNodeID(initial_state);
+    if (old_start_id != m_start_id) {
+        double h_between_starts = getHValue(old_start_id);
+        if (h_between_starts != std::numeric_limits<double>::infinity()) {
+            m_key_modifier += h_between_starts;
+        }
+    }
+
+    for (const State_t& state : m_changed_states) {
+        auto node_iter = m_node_map.find(m_hash_func->getHashValue(state));
+        if (node_iter == m_node_map.end()) {
+            continue;
+        }
+        m_num_changes_repaired++;
+        recomputeRHSValue(node_iter->second);
+        updateVertex(node_iter->second);
+    }
+    m_changed_states.clear();
+}
+
+template<class State_t, class Action_t, class Hash_t>
+EngineStatus DStarLite<State_t, Action_t, Hash_t>::doSingleSearchStep() {
+    Key start_key = calculateKey(m_start_id);
+    bool start_consistent = fpEqual(m_g_values[m_start_id], m_rhs_values[m_start_id]);
+    if (m_queue.empty() || (!isKeyLess(m_queue.begin()->first, start_key) && start_consistent)) {
+        extractPlan();
+        return EngineStatus::search_completed;
+    }
+
+    auto [old_key, node_id] = *m_queue.begin();
+    Key new_key = calculateKey(node_id);
+
+    if (isKeyLess(old_key, new_key)) {
+        m_num_key_updates++;
+        m_queue.erase(m_queue.begin());
+        m_keys[node_id] = new_key;
+        m_queue.emplace(new_key, node_id);
+        return EngineStatus::active;
+    }
+
+    m_num_expansions++;
+    removeFromQueue(node_id);
+    std::vector<std::pair<NodeID, double>> predecessors = getPredecessors(node_id);
+
+    if (fpGreater(m_g_values[node_id], m_rhs_values[node_id])) {
+        // The node's cost has decreased, so its predecessors may now have cheaper paths through it
+        m_g_values[node_id] = m_rhs_values[node_id];
+        for (const auto& [pred_id, action_cost] : predecessors) {
+            if (pred_id != m_goal_id && fpLess(action_cost + m_g_values[node_id], m_rhs_values[pred_id])) {
+                m_rhs_values[pred_id] = action_cost + m_g_values[node_id];
+                updateVertex(pred_id);
+            }
+        }
+    } else {
+        // The node's cost has increased, so the predecessors whose best path went through it are recomputed
+        double old_g = m_g_values[node_id];
+        m_g_values[node_id] = std::numeric_limits<double>::infinity();
+        for (const auto& [pred_id, action_cost] : predecessors) {
+            if (pred_id != m_goal_id && fpEqual(m_rhs_values[pred_id], action_cost + old_g)) {
+                recomputeRHSValue(pred_id);
+            }
+            updateVertex(pred_id);
+        }
+        recomputeRHSValue(node_id);
+        updateVertex(node_id);
+    }
+    return EngineStatus::active;
+}
+
+template<class State_t, class Action_t, class Hash_t>
+NodeID DStarLite<State_t, Action_t, Hash_t>::getNodeID(const State_t& state) {
+    Hash_t hash = m_hash_func->getHashValue(state);
+    auto node_iter = m_node_map.find(hash);
+    if (node_iter != m_node_map.end()) {
+        return node_iter->second;
+    }
+
+    NodeID node_id = m_nodes.addNode(state);
+    m_node_map[hash] = node_id;
+    m_g_values.push_back(std::numeric_limits<double>::infinity());
+    m_rhs_values.push_back(std::numeric_limits<double>::infinity());
+    m_keys.emplace_back(0.0, 0.0);
+    m_in_queue.push_back(false);
+    m_h_epochs.push_back(0);
+    return node_id;
+}
+
+template<class State_t, class Action_t, class Hash_t>
+double DStarLite<State_t, Action_t, Hash_t>::getHValue(NodeID node_id) {
+    if (m_h_epochs[node_id] != m_h_epoch) {
+        SE::evaluateNode(node_id);
+        m_h_epochs[node_id] = m_h_epoch;
+    }
+
+    if (m_heuristic->getCachedIsDeadEnd(node_id)) {
+        return std::numeric_limits<double>::infinity();
+    }
+    return m_heuristic->getCachedEval(node_id);
+}
+
+template<class State_t, class Action_t, class Hash_t>
+typename DStarLite<State_t, Action_t, Hash_t>::Key DStarLite<State_t, Action_t, Hash_t>::calculateKey(NodeID node_id) {
+    double min_value = std::min(m_g_values[node_id], m_rhs_values[node_id]);
+    return {min_value + getHValue(node_id) + m_key_modifier, min_value};
+}
+
+template<class State_t, class Action_t, class Hash_t>
+bool DStarLite<State_t, Action_t, Hash_t>::isKeyLess(const Key& key1, const Key& key2) {
+    return fpLess(key1.first, key2.first) || (fpEqual(key1.first, key2.first) && fpLess(key1.second, key2.second));
+}
+
+template<class State_t, class Action_t, class Hash_t>
+void DStarLite<State_t, Action_t, Hash_t>::recomputeRHSValue(NodeID node_id) {
+    if (node_id == m_goal_id) {
+        m_rhs_values[node_id] = 0.0;
+        return;
+    }
+
+    double rhs_value = std::numeric_limits<double>::infinity();
+    const State_t state = m_nodes.getState(node_id);
+    if (SE::getTransitionSystem()->isValidState(state)) {
+        for (const Action_t& action : SE::getApplicableActions(state)) {
+            double action_cost = SE::getActionCost(state, action);
+            NodeID child_id = getNodeID(SE::getChildState(state, action));
+            rhs_value = std::min(rhs_value, action_cost + m_g_values[child_id]);
+        }
+    }
+    m_rhs_values[node_id] = rhs_value;
+}
+
+template<class State_t, class Action_t, class Hash_t>
+void DStarLite<State_t, Action_t, Hash_t>::updateVertex(NodeID node_id) {
+    removeFromQueue(node_id);
+    if (!fpEqual(m_g_values[node_id], m_rhs_values[node_id])) {
+        m_keys[node_id] = calculateKey(node_id);
+        m_queue.emplace(m_keys[node_id], node_id);
+        m_in_queue[node_id] = true;
+    }
+}
+
+template<class State_t, class Action_t, class Hash_t>
+void DStarLite<State_t, Action_t, Hash_t>::removeFromQueue(NodeID node_id) {
+    if (m_in_queue[node_id]) {
+        m_queue.erase({m_keys[node_id], node_id});
+        m_in_queue[node_id] = false;
+    }
+}
+
+template<class State_t, class Action_t, class Hash_t>
+std::vector<std::pair<NodeID, double>> DStarLite<State_t, Action_t, Hash_t>::getPredecessors(NodeID node_id) {
+    std::vector<std::pair<NodeID, double>> predecessors;
+    const State_t state = m_nodes.getState(node_id);
+    if (!SE::getTransitionSystem()->isValidState(state)) {
+        return predecessors;
+    }
+
+    for (const Action_t& action : SE::getApplicableActions(*m_inverse_transitions, state)) {
+        double action_cost = m_inverse_transitions->getActionCost(state, action);
+        NodeID pred_id = getNodeID(SE::getChildState(*m_inverse_transitions, state, action));
+        predecessors.emplace_back(pred_id, action_cost);
+    }
+    return predecessors;
+}
+
+template<class State_t, class Action_t, class Hash_t>
+void DStarLite<State_t, Action_t, Hash_t>::extractPlan() {
+    if (m_g_values[m_start_id] == std::numeric_limits<double>::infinity()) {
+        return;
+    }
+
+    std::vector<Action_t> plan;
+    double plan_cost = 0.0;
+    State_t state = m_nodes.getState(m_start_id);
+    NodeID node_id = m_start_id;
+
+    // Each step strictly lowers the g-cost, so the plan has at most one action per stored state
+    while (node_id != m_goal_id && plan.size() < m_nodes.size()) {
+        std::optional<Action_t> best_action = std::nullopt;
+        double best_cost = std::numeric_limits<double>::infinity();
+        double best_action_cost = 0.0;
+        NodeID best_child_id = node_id;
+
+        for (const Action_t& action : SE::getApplicableActions(state)) {
+            double action_cost = SE::getActionCost(state, action);
+            NodeID child_id = getNodeID(SE::getChildState(state, action));
+            if (fpLess(action_cost + m_g_values[child_id], best_cost)) {
+                best_action = action;
+                best_cost = action_cost + m_g_values[child_id];
+                best_action_cost = action_cost;
+                best_child_id = child_id;
+            }
+        }
+        assert(best_action.has_value());
+
+        plan.push_back(best_action.value());
+        plan_cost += best_action_cost;
+        node_id = best_child_id;
+        state = m_nodes.getState(node_id);
+    }
+    assert(node_id == m_goal_id);
+
+    SE::setIncumbentSolution(plan, plan_cost);
+}
+
+template<class State_t, class Action_t, class Hash_t>
+StringMap DStarLite<State_t, Action_t, Hash_t>::getComponentSettings() const {
+    auto se_log = SE::getComponentSettings();
+    auto params_log = m_params.getParameterLog();
+
+    for (const auto& [key, value] : params_log) {
+        se_log[key] = value;
+    }
+
+    return se_log;
+}
+
+template<class State_t, class Action_t, class Hash_t>
+SearchSettingsMap DStarLite<State_t, Action_t, Hash_t>::getSubComponentSettings() const {
+    SearchSettingsMap sub_components;
+
+    sub_components["heuristic"] = m_heuristic->getAllSettings();
+    sub_components["hash_function"] = m_hash_func->getAllSettings();
+
+    return sub_components;
+}
+
+#endif  //D_STAR_LITE_H_
@@ -0,0 +1,8 @@
+#include "d_star_lite_params.h"
+
+StringMap DStarLiteParams::getParameterLog() const {
+    StringMap params;
+
+    params["reuse_previous_search"] = boolToString(m_reuse_previous_search);
+    return params;
+}
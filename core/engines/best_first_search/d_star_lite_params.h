@@ -0,0 +1,21 @@
+#ifndef D_STAR_LITE_PARAMS_H_
+#define D_STAR_LITE_PARAMS_H_
+
+#include "logging/logging_terms.h"
+#include "utils/string_utils.h"
+
+/**
+ * The parameters for a D* Lite engine
+ */
+struct DStarLiteParams {
+    /**
+     * Returns a map containing the log of the parameters used in D* Lite
+     *
+     * @return A map to stand for the log of the params
+     */
+    StringMap getParameterLog() const;
+
+    bool m_reuse_previous_search = true;  ///< Whether to repair the previous search for the same goal, rather than starting over
+};
+
+#endif  //D_STAR_LITE_PARAMS_H_
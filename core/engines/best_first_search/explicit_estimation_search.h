@@ -0,0 +1,630 @@
+#ifndef EXPLICIT_ESTIMATION_SEARCH_H_
+#define EXPLICIT_ESTIMATION_SEARCH_H_
+
+#include "building_tools/evaluators/cost_and_distance_to_go_evaluator.h"
+#include "building_tools/hashing/incremental_state_hash_function.h"
+#include "building_tools/hashing/state_hash_function.h"
+#include "engines/engine_components/node_containers/node_list.h"
+#include "engines/single_step_search_engine.h"
+#include "explicit_estimation_search_params.h"
+#include "logging/logging_terms.h"
+#include "logging/search_component_settings.h"
+#include "search_basics/node_container.h"
+#include "search_basics/node_evaluator.h"
+#include "search_basics/search_engine.h"
+#include "utils/floating_point_utils.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <set>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/**
+ * An Explicit Estimation Search (EES) engine (Thayer and Ruml, 2011), which finds a solution whose cost is at most the
+ * given weight times the optimal cost, using a distance-to-go estimate to reach a goal with few expansions.
+ *
+ * The heuristic must give both an admissible cost-to-go estimate h and a distance-to-go estimate d. These are corrected
+ * online with the mean one-step errors seen during search. Each expansion compares the heuristic value and distance of
+ * the expanded node to those of its best child, as the child's should be exactly one action less. The corrected
+ * distance is d^ = d / (1 - e_d) and the corrected heuristic is h^ = h + d^ * e_h, where e_d and e_h are the mean
+ * distance and heuristic errors. The corrected values of a node are computed with the errors when the node is added to
+ * open.
+ *
+ * Three orderings of the open nodes are kept in sync: by f = g + h, by f^ = g + h^, and the focal list of the nodes
+ * with f^ at most the weight times the lowest f^, ordered by d^. Each step expands the best node of the focal list if
+ * its f^ is within the weight of the lowest f, otherwise the node with the lowest f^ if it is, and otherwise the node
+ * with the lowest f. As only nodes within the weight of the lowest f are expanded, the suboptimality bound holds if
+ * the heuristic is admissible, and closed nodes are reopened or the heuristic is consistent.
+ *
+ * The open and f^ orderings must be searched by value when the focal bound changes, so all three orderings are kept in
+ * balanced binary search trees.
+ *
+ * @tparam State_t The type of a state
+ * @tparam Action_t The type of an action
+ * @tparam Hash_t The hash type. Used to define the hash function for type lookup.
+ * @class ExplicitEstimationSearch
+ */
+template<class State_t, class Action_t, class Hash_t>
+class ExplicitEstimationSearch : public SingleStepSearchEngine<State_t, Action_t> {
+    using SE = SingleStepSearchEngine<State_t, Action_t>;  // Allows succinct access to the protected members
+    using NodeMap = std::unordered_map<Hash_t, NodeID>;  ///< Defines the type for a map.
+    using ValueAndID = std::pair<double, NodeID>;  ///< An open node ordered by a single value, with ties broken by ID
+    using FocalEntry = std::tuple<double, double, NodeID>;  ///< A focal node ordered by d^, and then f^ and ID
+
+public:
+    inline static const double MAX_DISTANCE_ERROR = 0.99;  ///< The cap on the mean distance error, so d^ stays finite
+
+    /**
+     * Creates an Explicit Estimation Search engine with the given parameters.
+     *
+     * @param params The struct containing the engines parameters
+     */
+    explicit ExplicitEstimationSearch(const ExplicitEstimationSearchParams& params);
+
+    /**
+     * Default destructor
+     */
+    virtual ~ExplicitEstimationSearch() = default;
+
+    /**
+     * Sets the heuristic, which gives both the cost-to-go and the distance-to-go estimates.
+     *
+     * @param heuristic The heuristic function
+     */
+    void setHeuristic(CostAndDistanceToGoEvaluator<State_t, Action_t>& heuristic);
+
+    /**
+     * Sets the hash function used by the search. If it is an IncrementalStateHashFunction, the hash value of each child
+     * is calculated from the hash value of its parent. If the hash function is not perfect, every generated state is
+     * compared to the stored state with the same hash value, so that states with colliding hash values are kept apart.
+     *
+     * @param hash The new hash function
+     */
+    void setHashFunction(const StateHashFunction<State_t, Hash_t>& hash);
+
+    /**
+     * Set the Explicit Estimation Search params by input
+     *
+     * @param params The struct containing the engines parameters
+     */
+    void setEngineParams(const ExplicitEstimationSearchParams& params);
+
+    /**
+     * Gets the list of nodes.
+     *
+     * @return The list of nodes
+     */
+    const NodeList<State_t, Action_t>& getNodes() const { return m_nodes; }
+
+    /**
+     * Returns the ID of the node with the given hash value
+     *
+     * Returns std::nullopt if the node does not exist
+     *
+     * @param hash_value The hash value searching for
+     * @return The node ID associated with the given hash value or null value.
+     */
+    std::optional<NodeID> getNodeID(Hash_t hash_value) const;
+
+    /**
+     * Returns the ID of the node for the given state, among the nodes whose hash value was already associated with a
+     * different state when they were generated.
+     *
+     * Returns std::nullopt if there is no such node
+     *
+     * @param hash_value The hash value of the state
+     * @param state The state searching for
+     * @return The ID of the node for the given state, or null value
+     */
+    std::optional<NodeID> getCollidingNodeID(Hash_t hash_value, const State_t& state) const;
+
+    /**
+     * Returns the size of the open list.
+     *
+     * @return The size of the open list.
+     */
+    std::size_t getOpenListSize() const { return m_open_f.size(); }
+
+    /**
+     * Returns the size of the focal list.
+     *
+     * @return The size of the focal list.
+     */
+    std::size_t getFocalListSize() const { return m_focal.size(); }
+
+    /**
+     * Returns the lowest f-cost of any open node, which is a lower bound on the optimal solution cost if the heuristic is
+     * admissible.
+     *
+     * @return The lowest f-cost in open, or infinity if open is empty
+     */
+    double getLowestFCost() const;
+
+    /**
+     * Gets the mean one-step error of the heuristic, used to correct it.
+     *
+     * @return The heuristic error
+     */
+    double getHeuristicError() const;
+
+    /**
+     * Gets the mean one-step error of the distance-to-go estimate, used to correct it.
+     *
+     * @return The distance error
+     */
+    double getDistanceError() const;
+
+    /**
+     * Gets the corrected distance-to-go estimate of the given node, which is computed when the node is added to open.
+     *
+     * @param node_id The ID of the node
+     * @return The corrected distance-to-go estimate
+     */
+    double getCorrectedDistance(NodeID node_id) const { return m_d_hat_values[node_id]; }
+
+    /**
+     * Gets the corrected f-cost of the given node, which is computed when the node is added to open.
+     *
+     * @param node_id The ID of the node
+     * @return The corrected f-cost
+     */
+    double getCorrectedFCost(NodeID node_id) const { return m_f_hat_values[node_id]; }
+
+    // Overridden public SearchEngine methods
+    StringMap getEngineSpecificStatistics() const override;
+    std::vector<NodeEvaluator<State_t, Action_t>*> getBaseEvaluators() const override { return {m_heuristic}; }
+
+    // Overidden public SettingsLogger methods
+    std::string getName() const override { return "ExplicitEstimationSearch"; }
+
+protected:
+    // Overridden SingleStepSearchEngine methods
+    void doSearchInitialization(const State_t& initial_state) override;
+    EngineStatus doSingleSearchStep() override;
+    bool doCanRunSearch() const override { return m_heuristic && m_hash_func; }
+    void doReset() override;
+    StringMap getEngineParamsLog() const override { return m_params.getParameterLog(); }
+
+    // Overidden protected SettingsLogger methods
+    StringMap getComponentSettings() const override;
+    SearchSettingsMap getSubComponentSettings() const override;
+
+private:
+    /**
+     * Chooses the node to expand next. Assumes open is not empty.
+     *
+     * @return The ID of the node to expand
+     */
+    NodeID selectNode();
+
+    /**
+     * Expands the given node, adding its new and improved children to open, and updating the one-step errors with its
+     * best child.
+     *
+     * @param node_id The ID of the node to expand
+     */
+    void expandNode(NodeID node_id);
+
+    /**
+     * Computes the corrected values of the given node with the current errors, and adds it to all open orderings. Dead
+     * ends are not added.
+     *
+     * @param node_id The ID of the node to add
+     */
+    void addToOpen(NodeID node_id);
+
+    /**
+     * Removes the given node from all open orderings.
+     *
+     * @param node_id The ID of the node to remove
+     */
+    void removeFromOpen(NodeID node_id);
+
+    /**
+     * Moves nodes into or out of focal after the lowest f^ in open has changed.
+     */
+    void updateFocalBound();
+
+    ExplicitEstimationSearchParams m_params;  ///< The params to set the engine
+    NodeList<State_t, Action_t> m_nodes;  ///< The list of nodes
+    NodeMap m_node_map;  ///< The map used to determine if a hash value is already associated with a node.
+    std::unordered_map<Hash_t, std::vector<NodeID>> m_colliding_nodes;  ///< The nodes whose hash value was already associated with a different state in the map
+
+    CostAndDistanceToGoEvaluator<State_t, Action_t>* m_heuristic = nullptr;  ///< The heuristic function
+    const StateHashFunction<State_t, Hash_t>* m_hash_func = nullptr;  ///< The hash function
+    const IncrementalStateHashFunction<State_t, Action_t, Hash_t>* m_incremental_hash_func = nullptr;  ///< The hash function, if it can hash children incrementally
+    std::vector<Hash_t> m_node_hashes;  ///< The hash value of each node. Only stored when hashing incrementally
+
+    std::set<ValueAndID> m_open_f;  ///< The open nodes ordered by f-cost
+    std::set<ValueAndID> m_open_f_hat;  ///< The open nodes ordered by corrected f-cost
+    std::set<FocalEntry> m_focal;  ///< The open nodes with corrected f-cost within the focal bound, ordered by d^
+    double m_focal_bound = -std::numeric_limits<double>::infinity();  ///< The weight times the lowest f^ in open
+
+    std::vector<double> m_f_values;  ///< The f-cost of each node when it was added to open
+    std::vector<double> m_f_hat_values;  ///< The corrected f-cost of each node when it was added to open
+    std::vector<double> m_d_hat_values;  ///< The corrected distance-to-go of each node when it was added to open
+    std::vector<bool> m_is_open;  ///< If each node is in open
+    std::vector<bool> m_is_in_focal;  ///< If each node is in focal
+
+    double m_h_error_sum = 0.0;  ///< The sum of the observed one-step heuristic errors
+    double m_d_error_sum = 0.0;  ///< The sum of the observed one-step distance errors
+    int64_t m_num_error_samples = 0;  ///< The number of expansions the errors were observed on
+
+    int64_t m_num_focal_expansions = 0;  ///< The number of expansions of the best node in focal
+    int64_t m_num_f_hat_expansions = 0;  ///< The number of expansions of the node with the lowest f^
+    int64_t m_num_f_expansions = 0;  ///< The number of expansions of the node with the lowest f
+    int64_t m_num_reopenings = 0;  ///< The number of reopenings
+    int64_t m_num_hash_collisions = 0;  ///< The number of generated states found to share a hash value with a different stored state
+
+    std::vector<NodeID> m_children;  ///< The children of the current node that are added to open
+    std::vector<NodeID> m_new_children;  ///< The indices of the children of the current node that are yet to be evaluated
+};
+
+template<class State_t, class Action_t, class Hash_t>
+ExplicitEstimationSearch<State_t, Action_t, Hash_t>::ExplicitEstimationSearch(const ExplicitEstimationSearchParams& params)
+          : m_params(params) {
+    assert(params.m_weight >= 1);
+}
+
+template<class State_t, class Action_t, class Hash_t>
+void ExplicitEstimationSearch<State_t, Action_t, Hash_t>::setHeuristic(CostAndDistanceToGoEvaluator<State_t, Action_t>& heuristic) {
+    m_heuristic = &heuristic;
+    m_heuristic->setNodeContainer(m_nodes);
+    SE::reset();
+}
+
+template<class State_t, class Action_t, class Hash_t>
+void ExplicitEstimationSearch<State_t, Action_t, Hash_t>::setHashFunction(const StateHashFunction<State_t, Hash_t>& hash) {
+    m_hash_func = &hash;
+    m_incremental_hash_func = dynamic_cast<const IncrementalStateHashFunction<State_t, Action_t, Hash_t>*>(&hash);
+    SE::reset();
+}
+
+template<class State_t, class Action_t, class Hash_t>
+void ExplicitEstimationSearch<State_t, Action_t, Hash_t>::setEngineParams(const ExplicitEstimationSearchParams& params) {
+    assert(params.m_weight >= 1);
+    m_params = params;
+    SE::reset();
+}
+
+template<class State_t, class Action_t, class Hash_t>
+double ExplicitEstimationSearch<State_t, Action_t, Hash_t>::getLowestFCost() const {
+    if (m_open_f.empty()) {
+        return std::numeric_limits<double>::infinity();
+    }
+    return m_open_f.begin()->first;
+}
+
+template<class State_t, class Action_t, class Hash_t>
+double ExplicitEstimationSearch<State_t, Action_t, Hash_t>::getHeuristicError() const {
+    if (!m_params.m_use_error_correction || m_num_error_samples == 0) {
+        return 0.0;
+    }
+    return std::max(0.0, m_h_error_sum / m_num_error_samples);
+}
+
+template<class State_t, class Action_t, class Hash_t>
+double ExplicitEstimationSearch<State_t, Action_t, Hash_t>::getDistanceError() const {
+    if (!m_params.m_use_error_correction || m_num_error_samples == 0) {
+        return 0.0;
+    }
+    return std::clamp(m_d_error_sum / m_num_error_samples, 0.0, MAX_DISTANCE_ERROR);
+}
+
+template<class State_t, class Action_t, class Hash_t>
+StringMap ExplicitEstimationSearch<State_t, Action_t, Hash_t>::getEngineSpecificStatistics() const {
+    StringMap stats = SE::getEngineSpecificStatistics();
+    stats["num_focal_expansions"] = std::to_string(m_num_focal_expansions);
+    stats["num_f_hat_expansions"] = std::to_string(m_num_f_hat_expansions);
+    stats["num_f_expansions"] = std::to_string(m_num_f_expansions);
+    stats["num_reopenings"] = std::to_string(m_num_reopenings);
+    stats["num_hash_collisions"] = std::to_string(m_num_hash_collisions);
+    stats["heuristic_error"] = std::to_string(getHeuristicError());
+    stats["distance_error"] = std::to_string(getDistanceError());
+
+    return stats;
+}
+
+template<class State_t, class Action_t, class Hash_t>
+void ExplicitEstimationSearch<State_t, Action_t, Hash_t>::doReset() {
+    m_nodes.clear();
+    m_node_map.clear();
+    m_colliding_nodes.clear();
+    m_node_hashes.clear();
+    m_open_f.clear();
+    m_open_f_hat.clear();
+    m_focal.clear();
+    m_focal_bound = -std::numeric_limits<double>::infinity();
+    m_f_values.clear();
+    m_f_hat_values.clear();
+    m_d_hat_values.clear();
+    m_is_open.clear();
+    m_is_in_focal.clear();
+
+    m_h_error_sum = 0.0;
+    m_d_error_sum = 0.0;
+    m_num_error_samples = 0;
+    m_num_focal_expansions = 0;
+    m_num_f_hat_expansions = 0;
+    m_num_f_expansions = 0;
+    m_num_reopenings = 0;
+    m_num_hash_collisions = 0;
+}
+
+template<class State_t, class Action_t, class Hash_t>
+void ExplicitEstimationSearch<State_t, Action_t, Hash_t>::doSearchInitialization(const State_t& initial_state) {
+    Hash_t init_hash = m_hash_func->getHashValue(initial_state);
+    NodeID init_id = m_nodes.addNode(initial_state);
+    m_node_map[init_hash] = init_id;
+    if (m_incremental_hash_func) {
+        m_node_hashes.push_back(init_hash);
+    }
+
+    SE::evaluateNode(init_id);
+    addToOpen(init_id);
+}
+
+template<class State_t, class Action_t, class Hash_t>
+EngineStatus ExplicitEstimationSearch<State_t, Action_t, Hash_t>::doSingleSearchStep() {
+    assert(m_open_f.size() == m_open_f_hat.size());
+
+    if (m_open_f.empty()) {
+        return EngineStatus::search_completed;
+    }
+
+    NodeID node_id = selectNode();
+    if (SE::isGoal(m_nodes.getState(node_id))) {
+        SE::setIncumbentSolution(node_id, m_nodes);
+        return EngineStatus::search_completed;
+    }
+    expandNode(node_id);
+
+    return EngineStatus::active;
+}
+
+template<class State_t, class Action_t, class Hash_t>
+NodeID ExplicitEstimationSearch<State_t, Action_t, Hash_t>::selectNode() {
+    assert(!m_focal.empty());
+    double max_f_hat = m_params.m_weight * m_open_f.begin()->first;
+
+    NodeID best_d_hat_id = std::get<2>(*m_focal.begin());
+    if (!fpGreater(m_f_hat_values[best_d_hat_id], max_f_hat)) {
+        m_num_focal_expansions++;
+        return best_d_hat_id;
+    }
+    NodeID best_f_hat_id = m_open_f_hat.begin()->second;
+    if (!fpGreater(m_f_hat_values[best_f_hat_id], max_f_hat)) {
+        m_num_f_hat_expansions++;
+        return best_f_hat_id;
+    }
+    m_num_f_expansions++;
+    return m_open_f.begin()->second;
+}
+
+template<class State_t, class Action_t, class Hash_t>
+void ExplicitEstimationSearch<State_t, Action_t, Hash_t>::expandNode(NodeID node_id) {
+    removeFromOpen(node_id);
+    State_t state = m_nodes.getState(node_id);
+    double g_value = m_nodes.getGValue(node_id);
+
+    m_children.clear();
+    m_new_children.clear();
+    std::optional<NodeID> best_child_id = std::nullopt;
+    double best_child_f = std::numeric_limits<double>::infinity();
+
+    for (const Action_t& action : SE::getApplicableActions(state)) {
+        if (SE::hasHitResourceLimitWithPendingEvals(static_cast<int64_t>(m_new_children.size()))) {
+            break;
+        }
+        State_t child_state = SE::getChildState(state, action);
+        Hash_t child_hash;
+        if (m_incremental_hash_func) {
+            child_hash = m_incremental_hash_func->getChildHash(m_node_hashes[node_id], state, action);
+        } else {
+            child_hash = m_hash_func->getHashValue(child_state);
+        }
+        double action_cost = SE::getActionCost(state, action);
+        double child_g = g_value + action_cost;
+        std::optional<NodeID> possible_child_id = getNodeID(child_hash);
+
+        bool is_hash_collision = false;
+        if (possible_child_id && !m_hash_func->isPerfectHashFunction()
+                  && !(m_nodes.getState(possible_child_id.value()) == child_state)) {
+            // A different state has the same hash value, so the child is looked for among the other states with that value
+            m_num_hash_collisions++;
+            possible_child_id = getCollidingNodeID(child_hash, child_state);
+            is_hash_collision = true;
+        }
+
+        if (!possible_child_id) {
+            NodeID child_id = m_nodes.addNode(child_state, node_id, child_g, action, action_cost);
+            if (is_hash_collision) {
+                m_colliding_nodes[child_hash].push_back(child_id);
+            } else {
+                m_node_map[child_hash] = child_id;
+            }
+            if (m_incremental_hash_func) {
+                m_node_hashes.push_back(child_hash);
+            }
+            m_new_children.push_back(child_id);
+            m_children.push_back(child_id);
+            continue;
+        }
+
+        NodeID child_id = possible_child_id.value();
+        if (!m_new_children.empty() && child_id >= m_new_children.front()) {
+            // Generated earlier in this expansion, so it will be evaluated and opened with the other new children
+            if (fpLess(child_g, m_nodes.getGValue(child_id))) {
+                m_nodes.setGValue(child_id, child_g);
+                m_nodes.setLastAction(child_id, action);
+                m_nodes.setLastActionCost(child_id, action_cost);
+            }
+            continue;
+        }
+        if (!m_heuristic->getCachedIsDeadEnd(child_id) && action_cost + m_heuristic->getCachedEval(child_id) < best_child_f) {
+            best_child_f = action_cost + m_heuristic->getCachedEval(child_id);
+            best_child_id = child_id;
+        }
+        if (m_heuristic->getCachedIsDeadEnd(child_id) || !fpLess(child_g, m_nodes.getGValue(child_id))) {
+            continue;
+        }
+        if (m_is_open[child_id]) {
+            removeFromOpen(child_id);
+        } else if (m_params.m_use_reopened) {
+            m_num_reopenings++;
+        } else {
+            continue;
+        }
+        m_nodes.setGValue(child_id, child_g);
+        m_nodes.setParentID(child_id, node_id);
+        m_nodes.setLastAction(child_id, action);
+        m_nodes.setLastActionCost(child_id, action_cost);
+        m_children.push_back(child_id);
+    }
+
+    SE::evaluateNodes(m_new_children);
+    for (NodeID child_id : m_new_children) {
+        double f_from_parent = m_nodes.getLastActionCost(child_id) + m_heuristic->getCachedEval(child_id);
+        if (!m_heuristic->getCachedIsDeadEnd(child_id) && f_from_parent < best_child_f) {
+            best_child_f = f_from_parent;
+            best_child_id = child_id;
+        }
+    }
+
+    // The best child should have a heuristic value and distance exactly one action less than its parent's
+    if (best_child_id) {
+        m_h_error_sum += best_child_f - m_heuristic->getCachedEval(node_id);
+        m_d_error_sum += 1.0 + m_heuristic->getCachedDistanceToGoEval(*best_child_id) -
+                         m_heuristic->getCachedDistanceToGoEval(node_id);
+        m_num_error_samples++;
+    }
+
+    for (NodeID child_id : m_children) {
+        addToOpen(child_id);
+    }
+}
+
+template<class State_t, class Action_t, class Hash_t>
+void ExplicitEstimationSearch<State_t, Action_t, Hash_t>::addToOpen(NodeID node_id) {
+    if (node_id >= m_is_open.size()) {
+        m_f_values.resize(node_id + 1);
+        m_f_hat_values.resize(node_id + 1);
+        m_d_hat_values.resize(node_id + 1);
+        m_is_open.resize(node_id + 1, false);
+        m_is_in_focal.resize(node_id + 1, false);
+    }
+    if (m_heuristic->getCachedIsDeadEnd(node_id)) {
+        return;
+    }
+
+    double g_value = m_nodes.getGValue(node_id);
+    double h_value = m_heuristic->getCachedEval(node_id);
+    m_d_hat_values[node_id] = m_heuristic->getCachedDistanceToGoEval(node_id) / (1.0 - getDistanceError());
+    m_f_values[node_id] = g_value + h_value;
+    m_f_hat_values[node_id] = g_value + h_value + m_d_hat_values[node_id] * getHeuristicError();
+
+    m_is_open[node_id] = true;
+    m_open_f.emplace(m_f_values[node_id], node_id);
+    m_open_f_hat.emplace(m_f_hat_values[node_id], node_id);
+    if (m_f_hat_values[node_id] <= m_focal_bound) {
+        m_is_in_focal[node_id] = true;
+        m_focal.emplace(m_d_hat_values[node_id], m_f_hat_values[node_id], node_id);
+    }
+    updateFocalBound();
+}
+
+template<class State_t, class Action_t, class Hash_t>
+void ExplicitEstimationSearch<State_t, Action_t, Hash_t>::removeFromOpen(NodeID node_id) {
+    assert(m_is_open[node_id]);
+    m_is_open[node_id] = false;
+    m_open_f.erase({m_f_values[node_id], node_id});
+    m_open_f_hat.erase({m_f_hat_values[node_id], node_id});
+    if (m_is_in_focal[node_id]) {
+        m_is_in_focal[node_id] = false;
+        m_focal.erase({m_d_hat_values[node_id], m_f_hat_values[node_id], node_id});
+    }
+    updateFocalBound();
+}
+
+template<class State_t, class Action_t, class Hash_t>
+void ExplicitEstimationSearch<State_t, Action_t, Hash_t>::updateFocalBound() {
+    double new_bound = -std::numeric_limits<double>::infinity();
+    if (!m_open_f_hat.empty()) {
+        new_bound = m_params.m_weight * m_open_f_hat.begin()->first;
+    }
+    double low = std::min(m_focal_bound, new_bound);
+    double high = std::max(m_focal_bound, new_bound);
+    bool is_adding = new_bound > m_focal_bound;
+    m_focal_bound = new_bound;
+
+    // Only the nodes with f^ between the old and new bounds change membership
+    auto iter = m_open_f_hat.upper_bound({low, std::numeric_limits<NodeID>::max()});
+    for (; iter != m_open_f_hat.end() && iter->first <= high; ++iter) {
+        NodeID node_id = iter->second;
+        if (is_adding && !m_is_in_focal[node_id]) {
+            m_is_in_focal[node_id] = true;
+            m_focal.emplace(m_d_hat_values[node_id], m_f_hat_values[node_id], node_id);
+        } else if (!is_adding && m_is_in_focal[node_id]) {
+            m_is_in_focal[node_id] = false;
+            m_focal.erase({m_d_hat_values[node_id], m_f_hat_values[node_id], node_id});
+        }
+    }
+}
+
+template<class State_t, class Action_t, class Hash_t>
+std::optional<NodeID> ExplicitEstimationSearch<State_t, Action_t, Hash_t>::getNodeID(Hash_t hash_value) const {
+    auto node_check = m_node_map.find(hash_value);
+    if (node_check == m_node_map.end()) {
+        return std::nullopt;
+    }
+
+    return node_check->second;
+}
+
+template<class State_t, class Action_t, class Hash_t>
+std::optional<NodeID> ExplicitEstimationSearch<State_t, Action_t, Hash_t>::getCollidingNodeID(Hash_t hash_value,
+          const State_t& state) const {
+    auto colliding_check = m_colliding_nodes.find(hash_value);
+    if (colliding_check == m_colliding_nodes.end()) {
+        return std::nullopt;
+    }
+
+    for (NodeID node_id : colliding_check->second) {
+        if (m_nodes.getState(node_id) == state) {
+            return node_id;
+        }
+    }
+    return std::nullopt;
+}
+
+template<class State_t, class Action_t, class Hash_t>
+StringMap ExplicitEstimationSearch<State_t, Action_t, Hash_t>::getComponentSettings() const {
+    auto se_log = SE::getComponentSettings();
+    auto params_log = m_params.getParameterLog();
+
+    for (const auto& [key, value] : params_log) {
+        se_log[key] = value;
+    }
+
+    return se_log;
+}
+
+template<class State_t, class Action_t, class Hash_t>
+SearchSettingsMap ExplicitEstimationSearch<State_t, Action_t, Hash_t>::getSubComponentSettings() const {
+    SearchSettingsMap sub_components;
+
+    sub_components["heuristic"] = m_heuristic->getAllSettings();
+    sub_components["hash_function"] = m_hash_func->getAllSettings();
+
+    return sub_components;
+}
+
+#endif  //EXPLICIT_ESTIMATION_SEARCH_H_
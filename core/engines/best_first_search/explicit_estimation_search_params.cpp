@@ -0,0 +1,10 @@
+#include "explicit_estimation_search_params.h"
+
+StringMap ExplicitEstimationSearchParams::getParameterLog() const {
+    StringMap params;
+
+    params["weight"] = roundAndToString(m_weight, 2);
+    params["use_reopened"] = boolToString(m_use_reopened);
+    params["use_error_correction"] = boolToString(m_use_error_correction);
+    return params;
+}
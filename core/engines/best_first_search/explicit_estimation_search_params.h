@@ -0,0 +1,23 @@
+#ifndef EXPLICIT_ESTIMATION_SEARCH_PARAMS_H_
+#define EXPLICIT_ESTIMATION_SEARCH_PARAMS_H_
+
+#include "logging/logging_terms.h"
+#include "utils/string_utils.h"
+
+/**
+ * The parameters for an Explicit Estimation Search engine
+ */
+struct ExplicitEstimationSearchParams {
+    /**
+     * Returns a map containing the log of the parameters used in Explicit Estimation Search
+     *
+     * @return A map to stand for the log of the params
+     */
+    StringMap getParameterLog() const;
+
+    double m_weight = 2.0;  ///< The suboptimality bound. Must be at least 1
+    bool m_use_reopened = true;  ///< Whether to reopen closed nodes when a cheaper path to them is found
+    bool m_use_error_correction = true;  ///< Whether to correct the heuristic and distance-to-go with the observed one-step errors
+};
+
+#endif  //EXPLICIT_ESTIMATION_SEARCH_PARAMS_H_
@@ -0,0 +1,549 @@
+#ifndef EXTERNAL_A_STAR_H_
+#define EXTERNAL_A_STAR_H_
+
+#include "building_tools/hashing/state_hash_function.h"
+#include "engines/best_first_search/external_a_star_params.h"
+#include "engines/engine_components/external_storage/external_node_file.h"
+#include "engines/engine_components/node_containers/node_list.h"
+#include "engines/single_step_search_engine.h"
+#include "logging/logging_terms.h"
+#include "logging/search_component_settings.h"
+#include "search_basics/node_container.h"
+#include "search_basics/node_evaluator.h"
+#include "search_basics/search_engine.h"
+#include "utils/floating_point_utils.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <map>
+#include <memory>
+#include <optional>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * An external-memory A* engine, for problems whose search does not fit in memory.
+ *
+ * Nodes are not kept in memory. Instead, they are split into buckets by their g-cost and heuristic value, and each
+ * bucket is stored in its own file on disk as a list of records holding the rank of the state of the node and of its
+ * parent, as given by a perfect, invertible hash function. Newly generated nodes are buffered in memory and appended to
+ * the file of their bucket when the memory budget is used up.
+ *
+ * Buckets are expanded in order of f-cost, with ties broken by lower g-cost. When a bucket is selected, its file is
+ * sorted with an external merge sort that removes duplicates, and any state that is in a previously expanded bucket with
+ * the same heuristic value and no larger g-cost is removed by merging the two sorted files. The nodes of the bucket are
+ * then streamed from disk and expanded one per search step. Since duplicates are only removed when a bucket is
+ * selected, this is delayed duplicate detection.
+ *
+ * When a goal is expanded, the solution is rebuilt by following the parent ranks back to the initial state, finding
+ * each parent by binary search in the sorted file of the bucket it was expanded in.
+ *
+ * The hash function must recover the whole state with unrank, since states are only stored as ranks. All action costs
+ * must be positive. The solution found is optimal if the heuristic is consistent.
+ *
+ * @tparam State_t The type of a state
+ * @tparam Action_t The type of an action
+ * @class ExternalAStar
+ */
+template<class State_t, class Action_t>
+class ExternalAStar : public SingleStepSearchEngine<State_t, Action_t> {
+    using SE = SingleStepSearchEngine<State_t, Action_t>;  // Allows succinct access to the protected members
+
+public:
+    /**
+     * Creates an external-memory A* engine with the given parameters.
+     *
+     * @param params The struct containing the engines parameters
+     */
+    explicit ExternalAStar(const ExternalAStarParams& params)
+              : m_params(params) {}
+
+    /**
+     * Removes any files left on disk by the last search.
+     */
+    virtual ~ExternalAStar() { removeFiles(); }
+
+    /**
+     * Sets the heuristic function used in the search.
+     *
+     * @param heuristic The heuristic function
+     */
+    void setHeuristic(NodeEvaluator<State_t, Action_t>& heuristic);
+
+    /**
+     * Sets the hash function used to store states on disk. It must be perfect and invertible.
+     *
+     * @param hash The new hash function
+     */
+    void setHashFunction(const StateHashFunction<State_t, uint64_t>& hash);
+
+    /**
+     * Set the external-memory A* params by input
+     *
+     * @param params The struct containing the engines parameters
+     */
+    void setEngineParams(const ExternalAStarParams& params);
+
+    /**
+     * Gets the disk accesses made by the search.
+     *
+     * @return The I/O statistics
+     */
+    const ExternalIOStatistics& getIOStatistics() const { return m_io_stats; }
+
+    /**
+     * Gets the directory the bucket files of the current search are written in.
+     *
+     * @return The directory of the current search, or an empty path if no search has been started
+     */
+    const std::filesystem::path& getSearchDirectory() const { return m_search_directory; }
+
+    // Overridden public SearchEngine methods
+    StringMap getEngineSpecificStatistics() const override;
+    std::vector<NodeEvaluator<State_t, Action_t>*> getBaseEvaluators() const override { return {m_heuristic}; }
+
+    // Overidden public SettingsLogger methods
+    std::string getName() const override { return "ExternalAStar"; }
+
+protected:
+    // Overridden SingleStepSearchEngine methods
+    void doSearchInitialization(const State_t& initial_state) override;
+    EngineStatus doSingleSearchStep() override;
+    bool doCanRunSearch() const override;
+    void doReset() override;
+    StringMap getEngineParamsLog() const override { return m_params.getParameterLog(); }
+
+    // Overidden protected SettingsLogger methods
+    StringMap getComponentSettings() const override;
+    SearchSettingsMap getSubComponentSettings() const override;
+
+private:
+    /**
+     * Identifies a bucket by the g-cost and heuristic value of its nodes. Keys are only created with makeKey, so that
+     * they can be compared exactly.
+     */
+    struct BucketKey {
+        double m_g_cost = 0.0;  ///< The g-cost of the nodes in the bucket
+        double m_h_cost = 0.0;  ///< The heuristic value of the nodes in the bucket
+
+        /**
+         * Creates the key of the bucket for nodes with the given g-cost and heuristic value. Both are rounded to a
+         * multiple of TOLERANCE, so that costs that only differ by floating point error are in the same bucket.
+         *
+         * @param g_cost The g-cost of the nodes
+         * @param h_cost The heuristic value of the nodes
+         * @return The key of the bucket
+         */
+        static BucketKey makeKey(double g_cost, double h_cost);
+
+        /**
+         * Orders buckets by f-cost, then by g-cost.
+         *
+         * @param other The bucket to compare to
+         * @return If this bucket comes before the other
+         */
+        bool operator<(const BucketKey& other) const;
+    };
+
+    /**
+     * A bucket that has not been expanded yet.
+     */
+    struct OpenBucket {
+        std::string m_path;  ///< The file storing the nodes of the bucket
+        std::vector<ExternalNodeRecord> m_buffer;  ///< The nodes generated for the bucket but not yet written to disk
+    };
+
+    /**
+     * A bucket that has been expanded, whose file is sorted by rank.
+     */
+    struct ClosedBucket {
+        BucketKey m_key;  ///< The key of the bucket
+        std::string m_path;  ///< The file storing the nodes of the bucket
+    };
+
+    /**
+     * Gets the maximum number of records that fit in the memory budget.
+     *
+     * @return The number of records
+     */
+    std::size_t getMaxRecordsInMemory() const;
+
+    /**
+     * Adds the given record to the buffer of the bucket with the given key, writing all buffers to disk if the memory
+     * budget has been used up.
+     *
+     * @param key The key of the bucket
+     * @param record The record to add
+     */
+    void addToBucket(const BucketKey& key, const ExternalNodeRecord& record);
+
+    /**
+     * Writes the buffers of all open buckets to disk.
+     */
+    void flushAllBuffers();
+
+    /**
+     * Removes the first open bucket, removes its duplicates, and starts streaming its nodes if any are left.
+     */
+    void selectNextBucket();
+
+    /**
+     * Generates and evaluates the children of the node with the given record, which is in the current bucket, and adds
+     * them to their buckets.
+     *
+     * @param state The state of the node
+     * @param record The record of the node
+     */
+    void expandNode(const State_t& state, const ExternalNodeRecord& record);
+
+    /**
+     * Sets the incumbent solution to the path to the node with the given record, found by following parent ranks
+     * through the closed buckets.
+     *
+     * @param record The record of the goal node
+     * @param key The key of the bucket of the goal node
+     */
+    void setSolutionFromRecord(ExternalNodeRecord record, BucketKey key);
+
+    /**
+     * Removes the directory of the last search and all of its files.
+     */
+    void removeFiles();
+
+    ExternalAStarParams m_params;  ///< The params to set the engine
+    NodeEvaluator<State_t, Action_t>* m_heuristic = nullptr;  ///< The heuristic function
+    const StateHashFunction<State_t, uint64_t>* m_hash_func = nullptr;  ///< The perfect, invertible hash function
+
+    std::map<BucketKey, OpenBucket> m_open_buckets;  ///< The buckets yet to be expanded, in order of expansion
+    std::vector<ClosedBucket> m_closed_buckets;  ///< The buckets that have been expanded
+    std::unique_ptr<ExternalNodeReader> m_current_reader;  ///< Streams the nodes of the bucket being expanded
+    BucketKey m_current_key;  ///< The key of the bucket being expanded
+
+    NodeList<State_t, Action_t> m_batch_nodes;  ///< Holds a parent and its children while they are evaluated
+    std::vector<uint64_t> m_child_ranks;  ///< The ranks of the children being evaluated
+    std::vector<NodeID> m_child_ids;  ///< The IDs of the children being evaluated
+    std::optional<State_t> m_scratch_state;  ///< The state that ranks are recovered into
+
+    std::filesystem::path m_search_directory;  ///< The directory holding the files of the current search
+    uint64_t m_init_rank = 0;  ///< The rank of the initial state
+    std::size_t m_num_buffered_records = 0;  ///< The number of records in the buffers of all open buckets
+    std::size_t m_num_bucket_files = 0;  ///< The number of bucket files created
+
+    ExternalIOStatistics m_io_stats;  ///< The disk accesses made by the search
+    int64_t m_num_expansions = 0;  ///< The number of nodes expanded
+    int64_t m_num_buckets_expanded = 0;  ///< The number of non-empty buckets expanded
+    int64_t m_num_duplicates_removed = 0;  ///< The number of nodes removed by duplicate detection
+    std::size_t m_max_bucket_size = 0;  ///< The largest number of nodes in a bucket after duplicate detection
+};
+
+template<class State_t, class Action_t>
+typename ExternalAStar<State_t, Action_t>::BucketKey ExternalAStar<State_t, Action_t>::BucketKey::makeKey(double g_cost,
+          double h_cost) {
+    return {std::round(g_cost / TOLERANCE) * TOLERANCE, std::round(h_cost / TOLERANCE) * TOLERANCE};
+}
+
+template<class State_t, class Action_t>
+bool ExternalAStar<State_t, Action_t>::BucketKey::operator<(const BucketKey& other) const {
+    double f_cost = m_g_cost + m_h_cost;
+    double other_f_cost = other.m_g_cost + other.m_h_cost;
+
+    if (f_cost != other_f_cost) {
+        return f_cost < other_f_cost;
+    }
+    return m_g_cost < other.m_g_cost;
+}
+
+template<class State_t, class Action_t>
+void ExternalAStar<State_t, Action_t>::setHeuristic(NodeEvaluator<State_t, Action_t>& heuristic) {
+    m_heuristic = &heuristic;
+    m_heuristic->setNodeContainer(m_batch_nodes);
+    SE::reset();
+}
+
+template<class State_t, class Action_t>
+void ExternalAStar<State_t, Action_t>::setHashFunction(const StateHashFunction<State_t, uint64_t>& hash) {
+    m_hash_func = &hash;
+    SE::reset();
+}
+
+template<class State_t, class Action_t>
+void ExternalAStar<State_t, Action_t>::setEngineParams(const ExternalAStarParams& params) {
+    m_params = params;
+    SE::reset();
+}
+
+template<class State_t, class Action_t>
+StringMap ExternalAStar<State_t, Action_t>::getEngineSpecificStatistics() const {
+    StringMap stats = SE::getEngineSpecificStatistics();
+    stats["num_expansions"] = std::to_string(m_num_expansions);
+    stats["num_buckets_expanded"] = std::to_string(m_num_buckets_expanded);
+    stats["num_duplicates_removed"] = std::to_string(m_num_duplicates_removed);
+    stats["max_bucket_size"] = std::to_string(m_max_bucket_size);
+    stats["bytes_read"] = std::to_string(m_io_stats.m_bytes_read);
+    stats["bytes_written"] = std::to_string(m_io_stats.m_bytes_written);
+    stats["num_sort_passes"] = std::to_string(m_io_stats.m_num_sort_passes);
+
+    return stats;
+}
+
+template<class State_t, class Action_t>
+bool ExternalAStar<State_t, Action_t>::doCanRunSearch() const {
+    return m_heuristic && m_hash_func && m_hash_func->isPerfectHashFunction() && m_hash_func->isInvertible();
+}
+
+template<class State_t, class Action_t>
+void ExternalAStar<State_t, Action_t>::doSearchInitialization(const State_t& initial_state) {
+    std::filesystem::path base_directory = m_params.m_directory.empty() ? std::filesystem::temp_directory_path()
+                                                                        : std::filesystem::path(m_params.m_directory);
+    m_search_directory = base_directory / ("external_a_star_" + std::to_string(std::random_device{}()));
+    std::filesystem::create_directories(m_search_directory);
+
+    m_scratch_state = initial_state;
+    m_init_rank = m_hash_func->getHashValue(initial_state);
+
+    NodeID init_id = m_batch_nodes.addNode(initial_state);
+    SE::evaluateNode(init_id);
+    if (!m_heuristic->getCachedIsDeadEnd(init_id)) {
+        addToBucket(BucketKey::makeKey(0.0, m_heuristic->getCachedEval(init_id)), {m_init_rank, m_init_rank});
+    }
+}
+
+template<class State_t, class Action_t>
+EngineStatus ExternalAStar<State_t, Action_t>::doSingleSearchStep() {
+    if (!m_current_reader) {
+        if (m_open_buckets.empty()) {
+            return EngineStatus::search_completed;
+        }
+        selectNextBucket();
+        return EngineStatus::active;
+    }
+
+    ExternalNodeRecord record;
+    if (!m_current_reader->readNext(record)) {
+        m_current_reader = nullptr;
+        return EngineStatus::active;
+    }
+
+    m_hash_func->unrank(record.m_rank, m_scratch_state.value());
+    State_t state = m_scratch_state.value();
+
+    if (SE::isGoal(state)) {
+        setSolutionFromRecord(record, m_current_key);
+        return EngineStatus::search_completed;
+    }
+
+    expandNode(state, record);
+    return EngineStatus::active;
+}
+
+template<class State_t, class Action_t>
+std::size_t ExternalAStar<State_t, Action_t>::getMaxRecordsInMemory() const {
+    return std::max<std::size_t>(m_params.m_memory_budget_bytes / sizeof(ExternalNodeRecord), 1);
+}
+
+template<class State_t, class Action_t>
+void ExternalAStar<State_t, Action_t>::addToBucket(const BucketKey& key, const ExternalNodeRecord& record) {
+    auto bucket_iter = m_open_buckets.find(key);
+    if (bucket_iter == m_open_buckets.end()) {
+        OpenBucket bucket;
+        bucket.m_path = (m_search_directory / ("bucket_" + std::to_string(m_num_bucket_files++) + ".bin")).string();
+        bucket_iter = m_open_buckets.emplace(key, std::move(bucket)).first;
+    }
+
+    bucket_iter->second.m_buffer.push_back(record);
+    m_num_buffered_records++;
+
+    if (m_num_buffered_records >= getMaxRecordsInMemory()) {
+        flushAllBuffers();
+    }
+}
+
+template<class State_t, class Action_t>
+void ExternalAStar<State_t, Action_t>::flushAllBuffers() {
+    for (auto& [key, bucket] : m_open_buckets) {
+        if (!bucket.m_buffer.empty()) {
+            appendNodeRecords(bucket.m_path, bucket.m_buffer, m_io_stats);
+            bucket.m_buffer.clear();
+            bucket.m_buffer.shrink_to_fit();
+        }
+    }
+    m_num_buffered_records = 0;
+}
+
+template<class State_t, class Action_t>
+void ExternalAStar<State_t, Action_t>::selectNextBucket() {
+    BucketKey key = m_open_buckets.begin()->first;
+    OpenBucket bucket = std::move(m_open_buckets.begin()->second);
+    m_open_buckets.erase(m_open_buckets.begin());
+
+    appendNodeRecords(bucket.m_path, bucket.m_buffer, m_io_stats);
+    m_num_buffered_records -= bucket.m_buffer.size();
+
+    std::size_t num_generated = getNumNodeRecords(bucket.m_path);
+    std::size_t num_records = sortAndRemoveDuplicateNodeRecords(bucket.m_path, getMaxRecordsInMemory(),
+              m_params.m_max_merge_fan_in, m_io_stats);
+
+    // A state always has the same heuristic value, so any earlier copy is in a bucket with the same heuristic value
+    std::size_t block_size = getMaxRecordsInMemory() / 3;
+    for (const ClosedBucket& closed : m_closed_buckets) {
+        if (num_records == 0) {
+            break;
+        }
+        if (closed.m_key.m_h_cost == key.m_h_cost && closed.m_key.m_g_cost <= key.m_g_cost) {
+            num_records = subtractNodeRecords(bucket.m_path, closed.m_path, block_size, m_io_stats);
+        }
+    }
+    m_num_duplicates_removed += static_cast<int64_t>(num_generated - num_records);
+
+    if (num_records == 0) {
+        std::filesystem::remove(bucket.m_path);
+        return;
+    }
+
+    m_num_buckets_expanded++;
+    m_max_bucket_size = std::max(m_max_bucket_size, num_records);
+    m_closed_buckets.push_back({key, bucket.m_path});
+    m_current_key = key;
+    m_current_reader = std::make_unique<ExternalNodeReader>(bucket.m_path, block_size, m_io_stats);
+}
+
+template<class State_t, class Action_t>
+void ExternalAStar<State_t, Action_t>::expandNode(const State_t& state, const ExternalNodeRecord& record) {
+    m_num_expansions++;
+    m_batch_nodes.clear();
+    m_child_ranks.clear();
+    m_child_ids.clear();
+    NodeID parent_id = m_batch_nodes.addNode(state);
+
+    for (const Action_t& action : SE::getApplicableActions(state)) {
+        State_t child_state = SE::getChildState(state, action);
+        uint64_t child_rank = m_hash_func->getHashValue(child_state);
+
+        // The parent has already been expanded with a lower g-cost
+        if (child_rank == record.m_parent_rank) {
+            continue;
+        }
+
+        double action_cost = SE::getActionCost(state, action);
+        assert(action_cost > 0.0);
+        m_child_ids.push_back(m_batch_nodes.addNode(child_state, parent_id, m_current_key.m_g_cost + action_cost, action, action_cost));
+        m_child_ranks.push_back(child_rank);
+    }
+
+    SE::evaluateNodes(m_child_ids);
+    for (std::size_t i = 0; i < m_child_ids.size(); ++i) {
+        NodeID child_id = m_child_ids[i];
+        if (!m_heuristic->getCachedIsDeadEnd(child_id)) {
+            BucketKey child_key = BucketKey::makeKey(m_batch_nodes.getGValue(child_id), m_heuristic->getCachedEval(child_id));
+            addToBucket(child_key, {m_child_ranks[i], record.m_rank});
+        }
+    }
+}
+
+template<class State_t, class Action_t>
+void ExternalAStar<State_t, Action_t>::setSolutionFromRecord(ExternalNodeRecord record, BucketKey key) {
+    std::vector<Action_t> plan;
+    double plan_cost = 0.0;
+    State_t parent_state = m_scratch_state.value();
+
+    while (record.m_rank != m_init_rank) {
+        m_hash_func->unrank(record.m_parent_rank, parent_state);
+        m_batch_nodes.clear();
+        NodeID parent_id = m_batch_nodes.addNode(parent_state);
+        SE::evaluateNode(parent_id);
+        double parent_h_cost = m_heuristic->getCachedEval(parent_id);
+
+        // Finds the action that generated the node, and the bucket the parent was expanded in
+        bool found_parent = false;
+        for (const Action_t& action : SE::getTransitionSystem()->getActions(parent_state)) {
+            State_t child_state = SE::getTransitionSystem()->getChildState(parent_state, action);
+            if (m_hash_func->getHashValue(child_state) != record.m_rank) {
+                continue;
+            }
+
+            double action_cost = SE::getTransitionSystem()->getActionCost(parent_state, action);
+            BucketKey parent_key = BucketKey::makeKey(key.m_g_cost - action_cost, parent_h_cost);
+            for (const ClosedBucket& closed : m_closed_buckets) {
+                if (closed.m_key.m_g_cost != parent_key.m_g_cost || closed.m_key.m_h_cost != parent_key.m_h_cost) {
+                    continue;
+                }
+
+                std::optional<ExternalNodeRecord> parent_record = findNodeRecord(closed.m_path, record.m_parent_rank, m_io_stats);
+                if (parent_record) {
+                    plan.push_back(action);
+                    plan_cost += action_cost;
+                    record = parent_record.value();
+                    key = closed.m_key;
+                    found_parent = true;
+                    break;
+                }
+            }
+            if (found_parent) {
+                break;
+            }
+        }
+        assert(found_parent);
+    }
+
+    std::reverse(plan.begin(), plan.end());
+    SE::setIncumbentSolution(plan, plan_cost);
+}
+
+template<class State_t, class Action_t>
+void ExternalAStar<State_t, Action_t>::removeFiles() {
+    m_current_reader = nullptr;
+    if (!m_search_directory.empty()) {
+        std::error_code error;
+        std::filesystem::remove_all(m_search_directory, error);
+        m_search_directory.clear();
+    }
+}
+
+template<class State_t, class Action_t>
+void ExternalAStar<State_t, Action_t>::doReset() {
+    removeFiles();
+    m_open_buckets.clear();
+    m_closed_buckets.clear();
+    m_batch_nodes.clear();
+    m_child_ranks.clear();
+    m_child_ids.clear();
+    m_scratch_state = std::nullopt;
+
+    m_num_buffered_records = 0;
+    m_num_bucket_files = 0;
+    m_io_stats.reset();
+    m_num_expansions = 0;
+    m_num_buckets_expanded = 0;
+    m_num_duplicates_removed = 0;
+    m_max_bucket_size = 0;
+}
+
+template<class State_t, class Action_t>
+StringMap ExternalAStar<State_t, Action_t>::getComponentSettings() const {
+    auto se_log = SE::getComponentSettings();
+    auto params_log = m_params.getParameterLog();
+
+    for (const auto& [key, value] : params_log) {
+        se_log[key] = value;
+    }
+
+    return se_log;
+}
+
+template<class State_t, class Action_t>
+SearchSettingsMap ExternalAStar<State_t, Action_t>::getSubComponentSettings() const {
+    SearchSettingsMap sub_components;
+
+    sub_components["heuristic"] = m_heuristic->getAllSettings();
+    sub_components["hash_function"] = m_hash_func->getAllSettings();
+
+    return sub_components;
+}
+
+#endif  // EXTERNAL_A_STAR_H_
@@ -0,0 +1,10 @@
+#include "external_a_star_params.h"
+
+StringMap ExternalAStarParams::getParameterLog() const {
+    StringMap params;
+
+    params["directory"] = m_directory;
+    params["memory_budget_bytes"] = std::to_string(m_memory_budget_bytes);
+    params["max_merge_fan_in"] = std::to_string(m_max_merge_fan_in);
+    return params;
+}
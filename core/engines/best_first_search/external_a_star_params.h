@@ -0,0 +1,26 @@
+#ifndef EXTERNAL_A_STAR_PARAMS_H_
+#define EXTERNAL_A_STAR_PARAMS_H_
+
+#include "logging/logging_terms.h"
+#include "utils/string_utils.h"
+
+#include <cstddef>
+#include <string>
+
+/**
+ * The parameters for an external-memory A* engine
+ */
+struct ExternalAStarParams {
+    /**
+     * Returns a map containing the log of the parameters used in external-memory A*
+     *
+     * @return A map to stand for the log of the params
+     */
+    StringMap getParameterLog() const;
+
+    std::string m_directory;  ///< The directory the bucket files are written in. If empty, the system's temporary directory is used
+    std::size_t m_memory_budget_bytes = 64 * 1024 * 1024;  ///< The memory used for buffering generated nodes and for sorting bucket files
+    std::size_t m_max_merge_fan_in = 64;  ///< The maximum number of sorted runs merged at once when sorting a bucket file
+};
+
+#endif  //EXTERNAL_A_STAR_PARAMS_H_
@@ -0,0 +1,574 @@
+#ifndef MM_SEARCH_H_
+#define MM_SEARCH_H_
+
+#include "building_tools/evaluators/single_goal_state_evaluator.h"
+#include "building_tools/hashing/state_hash_function.h"
+#include "building_tools/transitions/inverse_transition_system.h"
+#include "engines/best_first_search/mm_search_params.h"
+#include "engines/engine_components/eval_functions/f_cost_evaluator.h"
+#include "engines/engine_components/eval_functions/g_cost_evaluator.h"
+#include "engines/engine_components/eval_functions/mm_priority_evaluator.h"
+#include "engines/engine_components/node_containers/node_list.h"
+#include "engines/engine_components/open_lists/evaluator_and_comparing_usage.h"
+#include "engines/engine_components/open_lists/heap_based_open_list.h"
+#include "engines/single_step_search_engine.h"
+#include "logging/logging_terms.h"
+#include "logging/search_component_settings.h"
+#include "search_basics/node_container.h"
+#include "search_basics/node_evaluator.h"
+#include "search_basics/search_engine.h"
+#include "search_basics/transition_system.h"
+#include "utils/floating_point_utils.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * A bidirectional MM search engine for problems with a single goal state, which searches forward from the initial
+ * state and backward from the goal state until the two searches meet in the middle.
+ *
+ * Each direction has its own node list, node map, and open list. Nodes in open are ordered by the MM priority, which
+ * is the maximum of their f-cost and twice their g-cost, and the direction with the lowest priority node is expanded
+ * next. The cost of the best path found through a state seen by both searches is kept as the incumbent, and the search
+ * stops once no cheaper path can exist. If the heuristics of both directions are admissible, the solution found is
+ * optimal.
+ *
+ * The goal state is taken from the goal test, which must be a SingleGoalStateEvaluator. When the search starts, the
+ * goal state of the backward heuristic is set to the initial state, and the goal state of the forward heuristic is set
+ * to the goal state, if they are SingleGoalStateEvaluators. The two heuristics must therefore be different objects.
+ *
+ * The backward transition system generates the predecessors of a state, where the inverse of an action applied in a
+ * state is the forward action that leads from the predecessor back to that state. If none is set, it is derived from
+ * the forward transition system using the inverse of each action.
+ *
+ * @tparam State_t The type of a state
+ * @tparam Action_t The type of an action
+ * @tparam Hash_t The hash type. Used to define the hash function for type lookup.
+ * @class MMSearch
+ */
+template<class State_t, class Action_t, class Hash_t>
+class MMSearch : public SingleStepSearchEngine<State_t, Action_t> {
+    using SE = SingleStepSearchEngine<State_t, Action_t>;  // Allows succinct access to the protected members
+    using NodeMap = std::unordered_map<Hash_t, NodeID>;  ///< Defines the type for a map.
+
+public:
+    /**
+     * Creates a bidirectional MM engine with the given parameters.
+     *
+     * @param params The struct containing the engines parameters
+     */
+    explicit MMSearch(const MMSearchParams& params);
+
+    /**
+     * Default destructor
+     */
+    virtual ~MMSearch() = default;
+
+    /**
+     * Sets the heuristic function used by the forward search, which estimates the cost to the goal state.
+     *
+     * @param heuristic The forward heuristic function
+     */
+    void setForwardHeuristic(NodeEvaluator<State_t, Action_t>& heuristic) { setHeuristic(m_forward, heuristic); }
+
+    /**
+     * Sets the heuristic function used by the backward search, which estimates the cost from the initial state.
+     *
+     * @param heuristic The backward heuristic function
+     */
+    void setBackwardHeuristic(NodeEvaluator<State_t, Action_t>& heuristic) { setHeuristic(m_backward, heuristic); }
+
+    /**
+     * Sets the transition system used by the backward search. If none is set, the inverse of the forward transition
+     * system is used.
+     *
+     * @param backward_transitions The backward transition system
+     */
+    void setBackwardTransitionSystem(const TransitionSystem<State_t, Action_t>& backward_transitions);
+
+    /**
+     * Sets the hash function used in the search. The hash function must be perfect, since states are
+     * only identified by their hash values.
+     *
+     * @param hash The new hash function
+     */
+    void setHashFunction(const StateHashFunction<State_t, Hash_t>& hash);
+
+    /**
+     * Set the MM params by input
+     *
+     * @param params The struct containing the engines parameters
+     */
+    void setEngineParams(const MMSearchParams& params);
+
+    /**
+     * Gets the list of nodes generated by the forward search.
+     *
+     * @return The list of forward nodes
+     */
+    const NodeList<State_t, Action_t>& getForwardNodes() const { return m_forward.m_nodes; }
+
+    /**
+     * Gets the list of nodes generated by the backward search. The g-cost of a node is the cost of the path from the
+     * node to the goal state.
+     *
+     * @return The list of backward nodes
+     */
+    const NodeList<State_t, Action_t>& getBackwardNodes() const { return m_backward.m_nodes; }
+
+    /**
+     * Gets the number of nodes expanded by the forward search.
+     *
+     * @return The number of forward expansions
+     */
+    int64_t getNumForwardExpansions() const { return m_forward.m_num_expansions; }
+
+    /**
+     * Gets the number of nodes expanded by the backward search.
+     *
+     * @return The number of backward expansions
+     */
+    int64_t getNumBackwardExpansions() const { return m_backward.m_num_expansions; }
+
+    /**
+     * Gets a lower bound on the cost of any solution not yet found, given the nodes currently in open.
+     *
+     * @return The lower bound
+     */
+    double getLowerBound() const;
+
+    // Overridden public SearchEngine methods
+    StringMap getEngineSpecificStatistics() const override;
+    std::vector<NodeEvaluator<State_t, Action_t>*> getBaseEvaluators() const override;
+
+    // Overidden public SettingsLogger methods
+    std::string getName() const override { return "MM"; }
+
+protected:
+    // Overridden SingleStepSearchEngine methods
+    void doSearchInitialization(const State_t& initial_state) override;
+    EngineStatus doSingleSearchStep() override;
+    bool doCanRunSearch() const override;
+    void doReset() override;
+    StringMap getEngineParamsLog() const override { return m_params.getParameterLog(); }
+
+    // Overidden protected SettingsLogger methods
+    StringMap getComponentSettings() const override;
+    SearchSettingsMap getSubComponentSettings() const override;
+
+private:
+    /**
+     * The nodes and evaluators of one direction of the search.
+     */
+    struct SearchDirection {
+        NodeList<State_t, Action_t> m_nodes;  ///< The list of nodes
+        NodeMap m_node_map;  ///< The map used to determine if a hash value is already associated with a node.
+        HeapBasedOpenList<State_t, Action_t> m_open_list;  ///< The open list, ordered by MM priority and then g-cost
+        HeapBasedOpenList<State_t, Action_t> m_f_cost_list;  ///< The nodes in open ordered by f-cost
+        HeapBasedOpenList<State_t, Action_t> m_g_cost_list;  ///< The nodes in open ordered by g-cost
+
+        NodeEvaluator<State_t, Action_t>* m_heuristic = nullptr;  ///< The heuristic function
+        std::unique_ptr<FCostEvaluator<State_t, Action_t>> m_f_cost_evaluator;  ///< Caches the f-cost of each node
+        std::unique_ptr<MMPriorityEvaluator<State_t, Action_t>> m_priority_evaluator;  ///< Caches the MM priority of each node
+        GCostEvaluator<State_t, Action_t> m_g_cost_evaluator;  ///< Gets the g-cost of each node
+        const TransitionSystem<State_t, Action_t>* m_transitions = nullptr;  ///< The transitions used to generate children
+
+        int64_t m_num_expansions = 0;  ///< The number of nodes expanded in this direction
+    };
+
+    /**
+     * Sets the heuristic of the given direction and builds the evaluators and open lists that use it.
+     *
+     * @param direction The direction of the search
+     * @param heuristic The heuristic function
+     */
+    void setHeuristic(SearchDirection& direction, NodeEvaluator<State_t, Action_t>& heuristic);
+
+    /**
+     * Adds the given node to all of the open lists of the given direction.
+     *
+     * @param direction The direction of the search
+     * @param node_id The ID of the node
+     */
+    void addToOpen(SearchDirection& direction, NodeID node_id);
+
+    /**
+     * Expands the best node in the open list of the given direction, and updates the incumbent if any of its children
+     * has been seen by the other direction.
+     *
+     * @param direction The direction to expand a node in
+     */
+    void expandBestNode(SearchDirection& direction);
+
+    /**
+     * Checks if the given node has been seen by the other direction, and if so, updates the incumbent if the path
+     * through the node is cheaper.
+     *
+     * @param direction The direction of the node
+     * @param node_id The ID of the node
+     * @param hash_value The hash value of the node's state
+     */
+    void checkForMeeting(const SearchDirection& direction, NodeID node_id, Hash_t hash_value);
+
+    /**
+     * Sets the incumbent solution to the path through the best meeting point found.
+     */
+    void setSolutionFromMeeting();
+
+    /**
+     * Returns the ID of the node with the given hash value in the given direction.
+     *
+     * Returns std::nullopt if the node does not exist
+     *
+     * @param direction The direction of the search
+     * @param hash_value The hash value searching for
+     * @return The node ID associated with the given hash value or null value.
+     */
+    std::optional<NodeID> getNodeID(const SearchDirection& direction, Hash_t hash_value) const;
+
+    MMSearchParams m_params;  ///< The params to set the engine
+    SearchDirection m_forward;  ///< The search from the initial state
+    SearchDirection m_backward;  ///< The search from the goal state
+
+    const StateHashFunction<State_t, Hash_t>* m_hash_func = nullptr;  ///< The hash function
+    const TransitionSystem<State_t, Action_t>* m_backward_transitions = nullptr;  ///< The backward transition system, if one is set
+    std::unique_ptr<InverseTransitionSystem<State_t, Action_t>> m_inverse_transitions;  ///< The inverse of the forward transitions, if no backward transition system is set
+
+    double m_best_meeting_cost = std::numeric_limits<double>::infinity();  ///< The cost of the best path found
+    NodeID m_best_forward_meeting_id = 0;  ///< The ID of the forward node of the best meeting point
+    NodeID m_best_backward_meeting_id = 0;  ///< The ID of the backward node of the best meeting point
+
+    int64_t m_num_reopenings = 0;  ///< The number of reopenings in either direction
+    int64_t m_num_meeting_improvements = 0;  ///< The number of times a cheaper path through a meeting point was found
+    std::vector<NodeID> m_new_children;  ///< The IDs of the children of the current node that are yet to be evaluated
+};
+
+template<class State_t, class Action_t, class Hash_t>
+MMSearch<State_t, Action_t, Hash_t>::MMSearch(const MMSearchParams& params)
+          : m_params(params) {
+    m_forward.m_g_cost_evaluator.setNodeContainer(m_forward.m_nodes);
+    m_backward.m_g_cost_evaluator.setNodeContainer(m_backward.m_nodes);
+}
+
+template<class State_t, class Action_t, class Hash_t>
+void MMSearch<State_t, Action_t, Hash_t>::setHeuristic(SearchDirection& direction, NodeEvaluator<State_t, Action_t>& heuristic) {
+    direction.m_heuristic = &heuristic;
+    direction.m_f_cost_evaluator = std::make_unique<FCostEvaluator<State_t, Action_t>>(heuristic);
+    direction.m_f_cost_evaluator->setNodeContainer(direction.m_nodes);
+    direction.m_priority_evaluator = std::make_unique<MMPriorityEvaluator<State_t, Action_t>>(heuristic);
+    direction.m_priority_evaluator->setNodeContainer(direction.m_nodes);
+
+    EvalsAndUsageVec<State_t, Action_t> open_evals;
+    open_evals.emplace_back(direction.m_priority_evaluator.get(), true);
+    open_evals.emplace_back(direction.m_g_cost_evaluator, true);
+    direction.m_open_list.setEvaluators(open_evals);
+
+    EvalsAndUsageVec<State_t, Action_t> f_cost_evals;
+    f_cost_evals.emplace_back(direction.m_f_cost_evaluator.get(), true);
+    direction.m_f_cost_list.setEvaluators(f_cost_evals);
+
+    EvalsAndUsageVec<State_t, Action_t> g_cost_evals;
+    g_cost_evals.emplace_back(direction.m_g_cost_evaluator, true);
+    direction.m_g_cost_list.setEvaluators(g_cost_evals);
+    SE::reset();
+}
+
+template<class State_t, class Action_t, class Hash_t>
+void MMSearch<State_t, Action_t, Hash_t>::setBackwardTransitionSystem(const TransitionSystem<State_t, Action_t>& backward_transitions) {
+    m_backward_transitions = &backward_transitions;
+    SE::reset();
+}
+
+template<class State_t, class Action_t, class Hash_t>
+void MMSearch<State_t, Action_t, Hash_t>::setHashFunction(const StateHashFunction<State_t, Hash_t>& hash) {
+    m_hash_func = &hash;
+    SE::reset();
+}
+
+template<class State_t, class Action_t, class Hash_t>
+void MMSearch<State_t, Action_t, Hash_t>::setEngineParams(const MMSearchParams& params) {
+    m_params = params;
+    SE::reset();
+}
+
+template<class State_t, class Action_t, class Hash_t>
+double MMSearch<State_t, Action_t, Hash_t>::getLowerBound() const {
+    if (m_forward.m_open_list.isEmpty() || m_backward.m_open_list.isEmpty()) {
+        return std::numeric_limits<double>::infinity();
+    }
+
+    double min_priority = std::min(m_forward.m_priority_evaluator->getCachedEval(m_forward.m_open_list.getIDOfBestNode()),
+              m_backward.m_priority_evaluator->getCachedEval(m_backward.m_open_list.getIDOfBestNode()));
+    double forward_min_f_cost = m_forward.m_f_cost_evaluator->getCachedEval(m_forward.m_f_cost_list.getIDOfBestNode());
+    double backward_min_f_cost = m_backward.m_f_cost_evaluator->getCachedEval(m_backward.m_f_cost_list.getIDOfBestNode());
+    double min_g_cost_sum = m_forward.m_nodes.getGValue(m_forward.m_g_cost_list.getIDOfBestNode()) +
+                            m_backward.m_nodes.getGValue(m_backward.m_g_cost_list.getIDOfBestNode()) + m_params.m_min_action_cost;
+
+    return std::max({min_priority, forward_min_f_cost, backward_min_f_cost, min_g_cost_sum});
+}
+
+template<class State_t, class Action_t, class Hash_t>
+StringMap MMSearch<State_t, Action_t, Hash_t>::getEngineSpecificStatistics() const {
+    StringMap stats = SE::getEngineSpecificStatistics();
+    stats["num_forward_expansions"] = std::to_string(m_forward.m_num_expansions);
+    stats["num_backward_expansions"] = std::to_string(m_backward.m_num_expansions);
+    stats["num_reopenings"] = std::to_string(m_num_reopenings);
+    stats["num_meeting_improvements"] = std::to_string(m_num_meeting_improvements);
+
+    return stats;
+}
+
+template<class State_t, class Action_t, class Hash_t>
+std::vector<NodeEvaluator<State_t, Action_t>*> MMSearch<State_t, Action_t, Hash_t>::getBaseEvaluators() const {
+    return {m_forward.m_f_cost_evaluator.get(), m_forward.m_priority_evaluator.get(), m_backward.m_f_cost_evaluator.get(),
+              m_backward.m_priority_evaluator.get()};
+}
+
+template<class State_t, class Action_t, class Hash_t>
+bool MMSearch<State_t, Action_t, Hash_t>::doCanRunSearch() const {
+    return m_forward.m_heuristic && m_backward.m_heuristic && m_hash_func && m_hash_func->isPerfectHashFunction() &&
+           dynamic_cast<const SingleGoalStateEvaluator<State_t>*>(SE::getGoalTest()) != nullptr;
+}
+
+template<class State_t, class Action_t, class Hash_t>
+void MMSearch<State_t, Action_t, Hash_t>::doSearchInitialization(const State_t& initial_state) {
+    State_t goal_state = dynamic_cast<const SingleGoalStateEvaluator<State_t>*>(SE::getGoalTest())->getGoalState();
+
+    // Each heuristic estimates the distance to the start of the other direction
+    auto* forward_goal_evaluator = dynamic_cast<SingleGoalStateEvaluator<State_t>*>(m_forward.m_heuristic);
+    if (forward_goal_evaluator) {
+        forward_goal_evaluator->setGoalState(goal_state);
+    }
+    auto* backward_goal_evaluator = dynamic_cast<SingleGoalStateEvaluator<State_t>*>(m_backward.m_heuristic);
+    if (backward_goal_evaluator) {
+        backward_goal_evaluator->setGoalState(initial_state);
+    }
+
+    m_forward.m_transitions = SE::getTransitionSystem();
+    if (m_backward_transitions) {
+        m_backward.m_transitions = m_backward_transitions;
+    } else {
+        m_inverse_transitions = std::make_unique<InverseTransitionSystem<State_t, Action_t>>(*SE::getTransitionSystem());
+        m_backward.m_transitions = m_inverse_transitions.get();
+    }
+
+    NodeID init_id = m_forward.m_nodes.addNode(initial_state);
+    Hash_t init_hash = m_hash_func->getHashValue(initial_state);
+    m_forward.m_node_map[init_hash] = init_id;
+    SE::evaluateNode({m_forward.m_f_cost_evaluator.get(), m_forward.m_priority_evaluator.get()}, init_id);
+    addToOpen(m_forward, init_id);
+
+    NodeID goal_id = m_backward.m_nodes.addNode(goal_state);
+    Hash_t goal_hash = m_hash_func->getHashValue(goal_state);
+    m_backward.m_node_map[goal_hash] = goal_id;
+    SE::evaluateNode({m_backward.m_f_cost_evaluator.get(), m_backward.m_priority_evaluator.get()}, goal_id);
+    addToOpen(m_backward, goal_id);
+
+    checkForMeeting(m_backward, goal_id, goal_hash);
+}
+
+template<class State_t, class Action_t, class Hash_t>
+EngineStatus MMSearch<State_t, Action_t, Hash_t>::doSingleSearchStep() {
+    // Either search being exhausted also means no cheaper path exists
+    if (!fpLess(getLowerBound(), m_best_meeting_cost)) {
+        if (m_best_meeting_cost != std::numeric_limits<double>::infinity()) {
+            setSolutionFromMeeting();
+        }
+        return EngineStatus::search_completed;
+    }
+
+    NodeID forward_best_id = m_forward.m_open_list.getIDOfBestNode();
+    NodeID backward_best_id = m_backward.m_open_list.getIDOfBestNode();
+    if (!fpGreater(m_forward.m_priority_evaluator->getCachedEval(forward_best_id),
+                  m_backward.m_priority_evaluator->getCachedEval(backward_best_id))) {
+        expandBestNode(m_forward);
+    } else {
+        expandBestNode(m_backward);
+    }
+
+    return EngineStatus::active;
+}
+
+template<class State_t, class Action_t, class Hash_t>
+void MMSearch<State_t, Action_t, Hash_t>::addToOpen(SearchDirection& direction, NodeID node_id) {
+    direction.m_open_list.addToOpen(node_id);
+    direction.m_f_cost_list.addToOpen(node_id);
+    direction.m_g_cost_list.addToOpen(node_id);
+}
+
+template<class State_t, class Action_t, class Hash_t>
+void MMSearch<State_t, Action_t, Hash_t>::expandBestNode(SearchDirection& direction) {
+    NodeID to_expand_id = direction.m_open_list.getAndRemoveIDOfBestNode();
+    direction.m_f_cost_list.removeFromHeap(to_expand_id);
+    direction.m_g_cost_list.removeFromHeap(to_expand_id);
+    direction.m_num_expansions++;
+
+    std::vector<NodeEvaluator<State_t, Action_t>*> evaluators = {direction.m_f_cost_evaluator.get(),
+              direction.m_priority_evaluator.get()};
+    State_t parent_state = direction.m_nodes.getState(to_expand_id);
+    double parent_g = direction.m_nodes.getGValue(to_expand_id);
+    m_new_children.clear();
+
+    for (const Action_t& action : SE::getApplicableActions(*direction.m_transitions, parent_state)) {
+        double action_cost = direction.m_transitions->getActionCost(parent_state, action);
+        double child_g = parent_g + action_cost;
+        State_t child_state = SE::getChildState(*direction.m_transitions, parent_state, action);
+        Hash_t child_hash = m_hash_func->getHashValue(child_state);
+        std::optional<NodeID> possible_child_id = getNodeID(direction, child_hash);
+
+        if (!possible_child_id) {
+            NodeID child_id = direction.m_nodes.addNode(child_state, to_expand_id, child_g, action, action_cost);
+            direction.m_node_map[child_hash] = child_id;
+            m_new_children.push_back(child_id);
+            checkForMeeting(direction, child_id, child_hash);
+            continue;
+        }
+
+        NodeID child_id = possible_child_id.value();
+        if (!fpLess(child_g, direction.m_nodes.getGValue(child_id))) {
+            continue;
+        }
+
+        direction.m_nodes.setGValue(child_id, child_g);
+        direction.m_nodes.setParentID(child_id, to_expand_id);
+        direction.m_nodes.setLastAction(child_id, action);
+        direction.m_nodes.setLastActionCost(child_id, action_cost);
+        if (!m_new_children.empty() && child_id >= m_new_children.front()) {
+            // Generated earlier in this expansion, so it will be evaluated and opened with the other new children
+            checkForMeeting(direction, child_id, child_hash);
+            continue;
+        }
+        SE::reEvaluateNode(evaluators, child_id);
+        checkForMeeting(direction, child_id, child_hash);
+
+        if (direction.m_open_list.isNodeInOpen(child_id)) {
+            direction.m_open_list.evalChanged(child_id);
+            direction.m_f_cost_list.evalChanged(child_id);
+            direction.m_g_cost_list.evalChanged(child_id);
+        } else if (!direction.m_priority_evaluator->getCachedIsDeadEnd(child_id)) {
+            m_num_reopenings++;
+            addToOpen(direction, child_id);
+        }
+    }
+
+    SE::evaluateNodes(evaluators, m_new_children);
+    for (NodeID child_id : m_new_children) {
+        if (!direction.m_priority_evaluator->getCachedIsDeadEnd(child_id)) {
+            addToOpen(direction, child_id);
+        }
+    }
+}
+
+template<class State_t, class Action_t, class Hash_t>
+void MMSearch<State_t, Action_t, Hash_t>::checkForMeeting(const SearchDirection& direction, NodeID node_id, Hash_t hash_value) {
+    const SearchDirection& other_direction = (&direction == &m_forward) ? m_backward : m_forward;
+    std::optional<NodeID> other_id = getNodeID(other_direction, hash_value);
+
+    if (!other_id) {
+        return;
+    }
+
+    double path_cost = direction.m_nodes.getGValue(node_id) + other_direction.m_nodes.getGValue(other_id.value());
+    if (fpLess(path_cost, m_best_meeting_cost)) {
+        m_best_meeting_cost = path_cost;
+        m_best_forward_meeting_id = (&direction == &m_forward) ? node_id : other_id.value();
+        m_best_backward_meeting_id = (&direction == &m_forward) ? other_id.value() : node_id;
+        m_num_meeting_improvements++;
+    }
+}
+
+template<class State_t, class Action_t, class Hash_t>
+void MMSearch<State_t, Action_t, Hash_t>::setSolutionFromMeeting() {
+    std::vector<Action_t> plan;
+    double plan_cost = 0.0;
+
+    NodeID current_id = m_best_forward_meeting_id;
+    while (m_forward.m_nodes.getLastAction(current_id).has_value()) {
+        plan.emplace_back(m_forward.m_nodes.getLastAction(current_id).value());
+        plan_cost += m_forward.m_nodes.getLastActionCost(current_id);
+        current_id = m_forward.m_nodes.getParentID(current_id);
+    }
+    std::reverse(plan.begin(), plan.end());
+
+    // The inverse of each backward action is the forward action leading back towards the goal
+    current_id = m_best_backward_meeting_id;
+    while (m_backward.m_nodes.getLastAction(current_id).has_value()) {
+        NodeID parent_id = m_backward.m_nodes.getParentID(current_id);
+        std::optional<Action_t> forward_action = m_backward.m_transitions->getInverse(m_backward.m_nodes.getState(parent_id),
+                  m_backward.m_nodes.getLastAction(current_id).value());
+        assert(forward_action.has_value());
+
+        plan.emplace_back(forward_action.value());
+        plan_cost += m_backward.m_nodes.getLastActionCost(current_id);
+        current_id = parent_id;
+    }
+
+    assert(!fpGreater(plan_cost, m_best_meeting_cost));
+    SE::setIncumbentSolution(plan, plan_cost);
+}
+
+template<class State_t, class Action_t, class Hash_t>
+void MMSearch<State_t, Action_t, Hash_t>::doReset() {
+    for (SearchDirection* direction : {&m_forward, &m_backward}) {
+        direction->m_open_list.clear();
+        direction->m_f_cost_list.clear();
+        direction->m_g_cost_list.clear();
+        direction->m_node_map.clear();
+        direction->m_nodes.clear();
+        direction->m_num_expansions = 0;
+    }
+    m_inverse_transitions = nullptr;
+    m_new_children.clear();
+
+    m_best_meeting_cost = std::numeric_limits<double>::infinity();
+    m_best_forward_meeting_id = 0;
+    m_best_backward_meeting_id = 0;
+    m_num_reopenings = 0;
+    m_num_meeting_improvements = 0;
+}
+
+template<class State_t, class Action_t, class Hash_t>
+StringMap MMSearch<State_t, Action_t, Hash_t>::getComponentSettings() const {
+    auto se_log = SE::getComponentSettings();
+    auto params_log = m_params.getParameterLog();
+
+    for (const auto& [key, value] : params_log) {
+        se_log[key] = value;
+    }
+
+    return se_log;
+}
+
+template<class State_t, class Action_t, class Hash_t>
+SearchSettingsMap MMSearch<State_t, Action_t, Hash_t>::getSubComponentSettings() const {
+    SearchSettingsMap sub_components;
+
+    sub_components["forward_heuristic"] = m_forward.m_heuristic->getAllSettings();
+    sub_components["backward_heuristic"] = m_backward.m_heuristic->getAllSettings();
+    sub_components["hash_function"] = m_hash_func->getAllSettings();
+    if (m_backward_transitions) {
+        sub_components["backward_transitions"] = m_backward_transitions->getAllSettings();
+    }
+
+    return sub_components;
+}
+
+template<class State_t, class Action_t, class Hash_t>
+std::optional<NodeID> MMSearch<State_t, Action_t, Hash_t>::getNodeID(const SearchDirection& direction, Hash_t hash_value) const {
+    auto node_check = direction.m_node_map.find(hash_value);
+
+    if (node_check == direction.m_node_map.end()) {
+        return std::nullopt;
+    }
+
+    return node_check->second;
+}
+
+#endif  // MM_SEARCH_H_
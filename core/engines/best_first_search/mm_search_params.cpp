@@ -0,0 +1,8 @@
+#include "mm_search_params.h"
+
+StringMap MMSearchParams::getParameterLog() const {
+    StringMap params;
+
+    params["min_action_cost"] = roundAndToString(m_min_action_cost, 2);
+    return params;
+}
@@ -0,0 +1,21 @@
+#ifndef MM_SEARCH_PARAMS_H_
+#define MM_SEARCH_PARAMS_H_
+
+#include "logging/logging_terms.h"
+#include "utils/string_utils.h"
+
+/**
+ * The parameters for a bidirectional MM search engine
+ */
+struct MMSearchParams {
+    /**
+     * Returns a map containing the log of the parameters used in MM
+     *
+     * @return A map to stand for the log of the params
+     */
+    StringMap getParameterLog() const;
+
+    double m_min_action_cost = 0.0;  ///< A lower bound on the cost of any action, used to strengthen the termination condition
+};
+
+#endif  //MM_SEARCH_PARAMS_H_
@@ -0,0 +1,430 @@
+#ifndef PARTIAL_EXPANSION_A_STAR_H_
+#define PARTIAL_EXPANSION_A_STAR_H_
+
+#include "building_tools/hashing/state_hash_function.h"
+#include "engines/best_first_search/partial_expansion_a_star_params.h"
+#include "engines/engine_components/eval_functions/f_cost_evaluator.h"
+#include "engines/engine_components/node_containers/node_list.h"
+#include "engines/engine_components/open_lists/evaluator_and_comparing_usage.h"
+#include "engines/engine_components/open_lists/heap_based_open_list.h"
+#include "engines/single_step_search_engine.h"
+#include "logging/logging_terms.h"
+#include "logging/search_component_settings.h"
+#include "search_basics/node_container.h"
+#include "search_basics/node_evaluator.h"
+#include "search_basics/operator_selection_function.h"
+#include "search_basics/search_engine.h"
+#include "utils/floating_point_utils.h"
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * A partial expansion A* engine, which avoids storing surplus nodes (those with an f-cost larger than the optimal
+ * solution cost) in domains with a large branching factor.
+ *
+ * Each node in open has a stored f-cost, which is initially its f-cost. When a node is selected for expansion, only
+ * the children whose f-cost equals the stored f-cost of the node are generated. The node is then put back in open
+ * with the next larger f-cost of its children as its stored f-cost, or closed if all of its children have been
+ * generated. Nodes with the same stored f-cost are ordered by their heuristic value.
+ *
+ * If an operator selection function is set, it is used to find the actions that generate the children with the needed
+ * f-cost without generating the other children (EPEA*). Otherwise, all children are generated and evaluated, and those
+ * with a different f-cost are discarded (PEA*). Either way, the heuristic is assumed to be consistent.
+ *
+ * @tparam State_t The type of a state
+ * @tparam Action_t The type of an action
+ * @tparam Hash_t The hash type. Used to define the hash function for type lookup.
+ * @class PartialExpansionAStar
+ */
+template<class State_t, class Action_t, class Hash_t>
+class PartialExpansionAStar : public SingleStepSearchEngine<State_t, Action_t> {
+    using SE = SingleStepSearchEngine<State_t, Action_t>;  // Allows succinct access to the protected members
+    using NodeMap = std::unordered_map<Hash_t, NodeID>;  ///< Defines the type for a map.
+
+public:
+    /**
+     * Creates a partial expansion A* engine with the given parameters.
+     *
+     * @param params The struct containing the engines parameters
+     */
+    explicit PartialExpansionAStar(const PartialExpansionAStarParams& params)
+              : m_params(params) {}
+
+    /**
+     * Default destructor
+     */
+    virtual ~PartialExpansionAStar() = default;
+
+    /**
+     * Sets the heuristic function used in the search.
+     *
+     * @param heuristic The heuristic function
+     */
+    void setHeuristic(NodeEvaluator<State_t, Action_t>& heuristic);
+
+    /**
+     * Sets the operator selection function used to generate only the children with the needed f-cost. It must match
+     * the heuristic of the search.
+     *
+     * @param op_selection The operator selection function
+     */
+    void setOperatorSelectionFunction(const OperatorSelectionFunction<State_t, Action_t>& op_selection);
+
+    /**
+     * Sets the hash function used in the search. The hash function must be perfect, since states are
+     * only identified by their hash values.
+     *
+     * @param hash The new hash function
+     */
+    void setHashFunction(const StateHashFunction<State_t, Hash_t>& hash);
+
+    /**
+     * Set the partial expansion A* params by input
+     *
+     * @param params The struct containing the engines parameters
+     */
+    void setEngineParams(const PartialExpansionAStarParams& params);
+
+    /**
+     * Gets the current open list being examined by the search.
+     *
+     * @return The current open list.
+     */
+    const HeapBasedOpenList<State_t, Action_t>& getOpenList() const { return m_open_list; }
+
+    /**
+     * Gets the list of nodes.
+     *
+     * @return The list of nodes
+     */
+    const NodeList<State_t, Action_t>& getNodes() const { return m_nodes; }
+
+    /**
+     * Returns the ID of the node with the given hash value
+     *
+     * Returns std::nullopt if the node does not exist
+     *
+     * @param hash_value The hash value searching for
+     * @return The node ID associated with the given hash value or null value.
+     */
+    std::optional<NodeID> getNodeID(Hash_t hash_value) const;
+
+    /**
+     * Gets the stored f-cost of the node with the given ID. This is the f-cost of the next children of the node to be
+     * generated.
+     *
+     * @param node_id The ID of the node
+     * @return The stored f-cost of the node
+     */
+    double getStoredFCost(NodeID node_id) const { return m_f_cost_evaluator->getCachedEval(node_id); }
+
+    /**
+     * Gets the list of node IDs in the order they were selected for expansion. A node appears once for each time it
+     * was partially expanded.
+     *
+     * @return The order of node expansions
+     */
+    const std::vector<NodeID>& getExpansionOrder() const { return m_expansion_order; }
+
+    /**
+     * Gets the ID of the last node expanded.
+     *
+     * @return The ID of the last node expanded
+     */
+    NodeID getLastExpandedNodeID() const { return m_last_expanded_node_id; }
+
+    // Overridden public SearchEngine methods
+    StringMap getEngineSpecificStatistics() const override;
+    std::vector<NodeEvaluator<State_t, Action_t>*> getBaseEvaluators() const override { return {m_f_cost_evaluator.get()}; }
+
+    // Overidden public SettingsLogger methods
+    std::string getName() const override { return "PartialExpansionAStar"; }
+
+protected:
+    // Overridden SingleStepSearchEngine methods
+    void doSearchInitialization(const State_t& initial_state) override;
+    EngineStatus doSingleSearchStep() override;
+    bool doCanRunSearch() const override { return m_heuristic && m_hash_func && m_hash_func->isPerfectHashFunction(); }
+    void doReset() override;
+    StringMap getEngineParamsLog() const override { return m_params.getParameterLog(); }
+
+    // Overidden protected SettingsLogger methods
+    StringMap getComponentSettings() const override;
+    SearchSettingsMap getSubComponentSettings() const override;
+
+private:
+    /**
+     * Gets the applicable actions in the state of the given node whose change in f-cost equals the given change, by
+     * generating and evaluating every child. Children that are not needed are discarded.
+     *
+     * @param node_id The ID of the node being expanded
+     * @param f_cost_change The change in f-cost of the actions to get
+     * @return The next larger change in f-cost, or infinity if there is none
+     */
+    double getActionsByGeneratingAllChildren(NodeID node_id, double f_cost_change);
+
+    /**
+     * Generates the child of the given node for the given action, and adds it to the list of new children if it has
+     * not been seen before. Otherwise, updates the existing node if a cheaper path to it has been found.
+     *
+     * @param parent_id The ID of the node being expanded
+     * @param action The action to apply
+     */
+    void generateChild(NodeID parent_id, const Action_t& action);
+
+    PartialExpansionAStarParams m_params;  ///< The params to set the engine
+    NodeList<State_t, Action_t> m_nodes;  ///< The list of nodes
+    NodeMap m_node_map;  ///< The map used to determine if a hash value is already associated with a node.
+    HeapBasedOpenList<State_t, Action_t> m_open_list;  ///< The open list, ordered by stored f-cost and then heuristic value
+
+    NodeEvaluator<State_t, Action_t>* m_heuristic = nullptr;  ///< The heuristic function
+    std::unique_ptr<FCostEvaluator<State_t, Action_t>> m_f_cost_evaluator;  ///< Caches the stored f-cost of each node
+    const OperatorSelectionFunction<State_t, Action_t>* m_op_selection = nullptr;  ///< The operator selection function, if one is used
+    const StateHashFunction<State_t, Hash_t>* m_hash_func = nullptr;  ///< The hash function
+
+    int64_t m_num_reopenings = 0;  ///< The number of reopenings
+    int64_t m_num_partial_expansions = 0;  ///< The number of expansions after which the node was put back in open
+    int64_t m_num_discarded_children = 0;  ///< The number of children that were generated and discarded, when not using an operator selection function
+
+    NodeID m_last_expanded_node_id = 0;  ///< Stores last expanded node ID
+    std::vector<NodeID> m_expansion_order;  ///< A vector to store the order of the expanded node IDs
+    std::vector<Action_t> m_app_actions;  ///< The actions used to generate the children of the current node
+    std::vector<NodeID> m_new_children;  ///< The IDs of the children of the current node that are yet to be evaluated
+};
+
+template<class State_t, class Action_t, class Hash_t>
+void PartialExpansionAStar<State_t, Action_t, Hash_t>::setHeuristic(NodeEvaluator<State_t, Action_t>& heuristic) {
+    m_heuristic = &heuristic;
+    m_f_cost_evaluator = std::make_unique<FCostEvaluator<State_t, Action_t>>(heuristic);
+    m_f_cost_evaluator->setNodeContainer(m_nodes);
+
+    EvalsAndUsageVec<State_t, Action_t> open_evals;
+    open_evals.emplace_back(m_f_cost_evaluator.get(), true);
+    open_evals.emplace_back(heuristic, true);
+    m_open_list.setEvaluators(open_evals);
+    SE::reset();
+}
+
+template<class State_t, class Action_t, class Hash_t>
+void PartialExpansionAStar<State_t, Action_t, Hash_t>::setOperatorSelectionFunction(
+          const OperatorSelectionFunction<State_t, Action_t>& op_selection) {
+    m_op_selection = &op_selection;
+    SE::reset();
+}
+
+template<class State_t, class Action_t, class Hash_t>
+void PartialExpansionAStar<State_t, Action_t, Hash_t>::setHashFunction(const StateHashFunction<State_t, Hash_t>& hash) {
+    m_hash_func = &hash;
+    SE::reset();
+}
+
+template<class State_t, class Action_t, class Hash_t>
+void PartialExpansionAStar<State_t, Action_t, Hash_t>::setEngineParams(const PartialExpansionAStarParams& params) {
+    m_params = params;
+    SE::reset();
+}
+
+template<class State_t, class Action_t, class Hash_t>
+StringMap PartialExpansionAStar<State_t, Action_t, Hash_t>::getEngineSpecificStatistics() const {
+    StringMap stats = SE::getEngineSpecificStatistics();
+    stats["num_reopenings"] = std::to_string(m_num_reopenings);
+    stats["num_partial_expansions"] = std::to_string(m_num_partial_expansions);
+    stats["num_discarded_children"] = std::to_string(m_num_discarded_children);
+
+    return stats;
+}
+
+template<class State_t, class Action_t, class Hash_t>
+void PartialExpansionAStar<State_t, Action_t, Hash_t>::doSearchInitialization(const State_t& initial_state) {
+    NodeID init_id = m_nodes.addNode(initial_state);
+    m_node_map[m_hash_func->getHashValue(initial_state)] = init_id;
+
+    SE::evaluateNode(init_id);
+    m_open_list.addToOpen(init_id);
+}
+
+template<class State_t, class Action_t, class Hash_t>
+EngineStatus PartialExpansionAStar<State_t, Action_t, Hash_t>::doSingleSearchStep() {
+    if (m_open_list.isEmpty()) {
+        return EngineStatus::search_completed;
+    }
+
+    NodeID to_expand_id = m_open_list.getAndRemoveIDOfBestNode();
+    double f_cost = m_nodes.getGValue(to_expand_id) + m_heuristic->getCachedEval(to_expand_id);
+    double f_cost_change = m_f_cost_evaluator->getCachedEval(to_expand_id) - f_cost;
+    if (fpEqual(f_cost_change, 0.0)) {
+        f_cost_change = 0.0;
+    }
+
+    if (m_params.m_store_expansion_order) {
+        m_expansion_order.push_back(to_expand_id);
+    }
+    m_last_expanded_node_id = to_expand_id;
+
+    // The goal test is only needed the first time the node is selected
+    if (f_cost_change == 0.0 && SE::isGoal(m_nodes.getState(to_expand_id))) {
+        SE::setIncumbentSolution(to_expand_id, m_nodes);
+        return EngineStatus::search_completed;
+    }
+
+    m_app_actions.clear();
+    m_new_children.clear();
+
+    double next_f_cost_change = std::numeric_limits<double>::infinity();
+    if (m_op_selection) {
+        next_f_cost_change = m_op_selection->getActionsWithFCostChange(m_nodes.getState(to_expand_id), f_cost_change, m_app_actions);
+    } else {
+        next_f_cost_change = getActionsByGeneratingAllChildren(to_expand_id, f_cost_change);
+    }
+
+    for (const Action_t& action : m_app_actions) {
+        generateChild(to_expand_id, action);
+    }
+    SE::evaluateNodes(m_new_children);
+    for (NodeID child_id : m_new_children) {
+        m_open_list.addToOpen(child_id);
+    }
+
+    // The node stays in open until all of its children have been generated
+    if (next_f_cost_change != std::numeric_limits<double>::infinity()) {
+        m_num_partial_expansions++;
+        m_f_cost_evaluator->setCachedEval(to_expand_id, f_cost + next_f_cost_change);
+        m_open_list.addToOpen(to_expand_id);
+    }
+
+    return EngineStatus::active;
+}
+
+template<class State_t, class Action_t, class Hash_t>
+double PartialExpansionAStar<State_t, Action_t, Hash_t>::getActionsByGeneratingAllChildren(NodeID node_id, double f_cost_change) {
+    double next_f_cost_change = std::numeric_limits<double>::infinity();
+    double parent_h = m_heuristic->getCachedEval(node_id);
+
+    for (const Action_t& action : SE::getApplicableActions(m_nodes.getState(node_id))) {
+        double action_cost = SE::getActionCost(m_nodes.getState(node_id), action);
+        State_t child_state = SE::getChildState(m_nodes.getState(node_id), action);
+        std::optional<NodeID> possible_child_id = getNodeID(m_hash_func->getHashValue(child_state));
+
+        double child_h = 0.0;
+        if (possible_child_id) {
+            child_h = m_heuristic->getCachedEval(possible_child_id.value());
+        } else {
+            // The child is only evaluated to get its f-cost, and is removed again
+            NodeID child_id = m_nodes.addNode(child_state, node_id, m_nodes.getGValue(node_id) + action_cost, action, action_cost);
+            SE::evaluateNode(child_id);
+            child_h = m_heuristic->getCachedEval(child_id);
+            m_nodes.popBack();
+        }
+
+        double action_f_cost_change = action_cost + child_h - parent_h;
+        if (fpEqual(action_f_cost_change, f_cost_change)) {
+            m_app_actions.push_back(action);
+        } else {
+            if (!possible_child_id) {
+                m_num_discarded_children++;
+            }
+            if (fpGreater(action_f_cost_change, f_cost_change) && fpLess(action_f_cost_change, next_f_cost_change)) {
+                next_f_cost_change = action_f_cost_change;
+            }
+        }
+    }
+    return next_f_cost_change;
+}
+
+template<class State_t, class Action_t, class Hash_t>
+void PartialExpansionAStar<State_t, Action_t, Hash_t>::generateChild(NodeID parent_id, const Action_t& action) {
+    double action_cost = SE::getActionCost(m_nodes.getState(parent_id), action);
+    double child_g = m_nodes.getGValue(parent_id) + action_cost;
+    State_t child_state = SE::getChildState(m_nodes.getState(parent_id), action);
+    Hash_t child_hash = m_hash_func->getHashValue(child_state);
+    std::optional<NodeID> possible_child_id = getNodeID(child_hash);
+
+    if (!possible_child_id) {
+        NodeID child_id = m_nodes.addNode(child_state, parent_id, child_g, action, action_cost);
+        m_node_map[child_hash] = child_id;
+        m_new_children.push_back(child_id);
+        return;
+    }
+
+    NodeID child_id = possible_child_id.value();
+    if (fpLess(child_g, m_nodes.getGValue(child_id))) {
+        m_nodes.setGValue(child_id, child_g);
+        m_nodes.setParentID(child_id, parent_id);
+        m_nodes.setLastAction(child_id, action);
+        m_nodes.setLastActionCost(child_id, action_cost);
+
+        if (!m_new_children.empty() && child_id >= m_new_children.front()) {
+            // Generated earlier in this expansion, so it will be evaluated and opened with the other new children
+            return;
+        }
+        // Re-evaluating resets the stored f-cost, so all of the children of the node are generated again
+        SE::reEvaluateNode(child_id);
+
+        if (m_open_list.isNodeInOpen(child_id)) {
+            m_open_list.evalChanged(child_id);
+        } else if (m_params.m_use_reopened) {
+            m_num_reopenings++;
+            m_open_list.addToOpen(child_id);
+        }
+    }
+}
+
+template<class State_t, class Action_t, class Hash_t>
+void PartialExpansionAStar<State_t, Action_t, Hash_t>::doReset() {
+    m_open_list.clear();
+    m_node_map.clear();
+    m_nodes.clear();
+    m_expansion_order.clear();
+    m_app_actions.clear();
+    m_new_children.clear();
+
+    m_num_reopenings = 0;
+    m_num_partial_expansions = 0;
+    m_num_discarded_children = 0;
+}
+
+template<class State_t, class Action_t, class Hash_t>
+StringMap PartialExpansionAStar<State_t, Action_t, Hash_t>::getComponentSettings() const {
+    auto se_log = SE::getComponentSettings();
+    auto params_log = m_params.getParameterLog();
+
+    for (const auto& [key, value] : params_log) {
+        se_log[key] = value;
+    }
+
+    return se_log;
+}
+
+template<class State_t, class Action_t, class Hash_t>
+SearchSettingsMap PartialExpansionAStar<State_t, Action_t, Hash_t>::getSubComponentSettings() const {
+    SearchSettingsMap sub_components;
+
+    sub_components["heuristic"] = m_heuristic->getAllSettings();
+    sub_components["hash_function"] = m_hash_func->getAllSettings();
+    if (m_op_selection) {
+        sub_components["operator_selection_function"] = m_op_selection->getAllSettings();
+    }
+
+    return sub_components;
+}
+
+template<class State_t, class Action_t, class Hash_t>
+std::optional<NodeID> PartialExpansionAStar<State_t, Action_t, Hash_t>::getNodeID(Hash_t hash_value) const {
+    auto node_check = m_node_map.find(hash_value);
+
+    if (node_check == m_node_map.end()) {
+        return std::nullopt;
+    }
+
+    return node_check->second;
+}
+
+#endif  // PARTIAL_EXPANSION_A_STAR_H_
@@ -0,0 +1,9 @@
+#include "partial_expansion_a_star_params.h"
+
+StringMap PartialExpansionAStarParams::getParameterLog() const {
+    StringMap params;
+
+    params["use_reopened"] = boolToString(m_use_reopened);
+    params["store_expansion_order"] = boolToString(m_store_expansion_order);
+    return params;
+}
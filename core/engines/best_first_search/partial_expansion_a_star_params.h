@@ -0,0 +1,22 @@
+#ifndef PARTIAL_EXPANSION_A_STAR_PARAMS_H_
+#define PARTIAL_EXPANSION_A_STAR_PARAMS_H_
+
+#include "logging/logging_terms.h"
+#include "utils/string_utils.h"
+
+/**
+ * The parameters for a partial expansion A* engine
+ */
+struct PartialExpansionAStarParams {
+    /**
+     * Returns a map containing the log of the parameters used in partial expansion A*
+     *
+     * @return A map to stand for the log of the params
+     */
+    StringMap getParameterLog() const;
+
+    bool m_use_reopened = true;  ///< Whether we are reopening closed nodes
+    bool m_store_expansion_order = false;  ///< Whether we want to store the order of node expansions
+};
+
+#endif  //PARTIAL_EXPANSION_A_STAR_PARAMS_H_
@@ -31,6 +31,9 @@ public:
     const NodeContainer<State_t, Action_t>* getNodeContainer() const override { return m_nodes; }
     void prepareToEvaluate() override { m_last_node_id = std::nullopt; }
     void evaluate(NodeID to_evaluate) override;
+    void evaluateBatch(const std::vector<NodeID>& to_evaluate) override;
+    void scheduledEvaluate(NodeID to_evaluate) override { m_last_node_id = to_evaluate; }
+    void scheduledEvaluateBatch(const std::vector<NodeID>& to_evaluate) override;
     void reEvaluate(NodeID to_evaluate) override;
     void reset() override { m_last_node_id = std::nullopt; }
     NodeID getIDofLastEvaluatedNode() const override { return m_last_node_id.value(); }
@@ -60,6 +63,20 @@ void GCostEvaluator<State_t, Action_t>::evaluate(NodeID to_evaluate) {
     m_last_node_id = to_evaluate;
 }
 
+template<class State_t, class Action_t>
+void GCostEvaluator<State_t, Action_t>::evaluateBatch(const std::vector<NodeID>& to_evaluate) {
+    if (!to_evaluate.empty()) {
+        evaluate(to_evaluate.back());
+    }
+}
+
+template<class State_t, class Action_t>
+void GCostEvaluator<State_t, Action_t>::scheduledEvaluateBatch(const std::vector<NodeID>& to_evaluate) {
+    if (!to_evaluate.empty()) {
+        m_last_node_id = to_evaluate.back();
+    }
+}
+
 template<class State_t, class Action_t>
 void GCostEvaluator<State_t, Action_t>::reEvaluate(NodeID to_evaluate) {
     assert(!m_last_node_id.has_value() || m_last_node_id.value() == to_evaluate);
@@ -0,0 +1,117 @@
+#ifndef MM_PRIORITY_EVALUATOR_H_
+#define MM_PRIORITY_EVALUATOR_H_
+
+#include "building_tools/evaluators/node_evaluator_with_cache.h"
+#include "engines/engine_components/eval_functions/eval_function_terms.h"
+#include "logging/logging_terms.h"
+#include "logging/search_component_settings.h"
+#include "search_basics/node_container.h"
+#include "search_basics/node_evaluator.h"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+/**
+ * An evaluator that calculates the priority of a node in the bidirectional MM search, which is the maximum of the
+ * f-cost of the node and twice its g-cost.
+ *
+ * @tparam State_t The type of state
+ * @tparam Action_t The type of action
+ * @class MMPriorityEvaluator
+ */
+template<class State_t, class Action_t>
+class MMPriorityEvaluator : public NodeEvaluatorWithCache<State_t, Action_t> {
+    using NE = NodeEvaluatorWithCache<State_t, Action_t>;
+
+public:
+    inline static const std::string CLASS_NAME = "MMPriority";  ///< The class name. Used to define the component's name.
+
+    /**
+     * Creates a MMPriorityEvaluator.
+     *
+     * @param heuristic The heuristic used as part of the f-cost
+     */
+    explicit MMPriorityEvaluator(NodeEvaluator<State_t, Action_t>& heuristic)
+              : m_heuristic(&heuristic) {}
+
+    // Overriden public NodeEvaluator functions
+    void setNodeContainer(const NodeContainer<State_t, Action_t>& nodes) override;
+    std::vector<NodeEvaluator<State_t, Action_t>*> getSubEvaluators() const override { return {m_heuristic}; }
+
+    // Overriden public SettingsLogger methods
+    std::string getName() const override { return CLASS_NAME; }
+
+protected:
+    // Overriden protected NodeEvaluatorWithStorage functions
+    void doPrepare() override { m_heuristic->prepareToEvaluate(); }
+    void doEvaluateAndCache(NodeID to_evaluate) override;
+    void doEvaluateBatchAndCache(const std::vector<NodeID>& to_evaluate) override;
+    void doScheduledEvaluateAndCache(NodeID to_evaluate) override;
+    void doReEvaluateAndCache(NodeID to_evaluate) override;
+    void doReset() override { m_heuristic->reset(); };
+
+    // Overriden protected SettingsLogger methods
+    StringMap getComponentSettings() const override { return {}; }
+    SearchSettingsMap getSubComponentSettings() const override;
+
+private:
+    /**
+     * Calculates the priority of a node from its heuristic value.
+     *
+     * @param node_id The ID of the node
+     * @param h_cost The heuristic value of the node
+     * @return The priority of the node
+     */
+    double getPriority(NodeID node_id, double h_cost) const;
+
+    NodeEvaluator<State_t, Action_t>* m_heuristic;  ///< The base heuristic used as part of the f-cost
+};
+
+template<class State_t, class Action_t>
+void MMPriorityEvaluator<State_t, Action_t>::setNodeContainer(const NodeContainer<State_t, Action_t>& nodes) {
+    m_heuristic->setNodeContainer(nodes);
+    NodeEvaluatorWithCache<State_t, Action_t>::setNodeContainer(nodes);
+}
+
+template<class State_t, class Action_t>
+void MMPriorityEvaluator<State_t, Action_t>::doEvaluateAndCache(NodeID to_evaluate) {
+    m_heuristic->evaluate(to_evaluate);
+    NE::setCachedValues(to_evaluate, getPriority(to_evaluate, m_heuristic->getLastNodeEval()), m_heuristic->isLastNodeADeadEnd());
+}
+
+template<class State_t, class Action_t>
+void MMPriorityEvaluator<State_t, Action_t>::doEvaluateBatchAndCache(const std::vector<NodeID>& to_evaluate) {
+    m_heuristic->evaluateBatch(to_evaluate);
+
+    for (NodeID node_id : to_evaluate) {
+        doScheduledEvaluateAndCache(node_id);
+    }
+}
+
+template<class State_t, class Action_t>
+void MMPriorityEvaluator<State_t, Action_t>::doScheduledEvaluateAndCache(NodeID to_evaluate) {
+    double eval = getPriority(to_evaluate, m_heuristic->getCachedEval(to_evaluate));
+    NE::setCachedValues(to_evaluate, eval, m_heuristic->getCachedIsDeadEnd(to_evaluate));
+}
+
+template<class State_t, class Action_t>
+void MMPriorityEvaluator<State_t, Action_t>::doReEvaluateAndCache(NodeID to_evaluate) {
+    m_heuristic->reEvaluate(to_evaluate);
+    NE::setCachedValues(to_evaluate, getPriority(to_evaluate, m_heuristic->getLastNodeEval()), m_heuristic->isLastNodeADeadEnd());
+}
+
+template<class State_t, class Action_t>
+double MMPriorityEvaluator<State_t, Action_t>::getPriority(NodeID node_id, double h_cost) const {
+    double g_cost = NE::getNodeContainer()->getGValue(node_id);
+    return std::max(g_cost + h_cost, 2.0 * g_cost);
+}
+
+template<class State_t, class Action_t>
+SearchSettingsMap MMPriorityEvaluator<State_t, Action_t>::getSubComponentSettings() const {
+    SearchSettingsMap sub_components;
+    sub_components[evalFunctionTerms::SETTING_HEURISTIC] = m_heuristic->getAllSettings();
+    return sub_components;
+}
+
+#endif  //MM_PRIORITY_EVALUATOR_H_
@@ -51,6 +51,8 @@ protected:
     // Overriden protected NodeEvaluatorWithStorage functions
     void doPrepare() override { m_heuristic->prepareToEvaluate(); }
     void doEvaluateAndCache(NodeID to_evaluate) override;
+    void doEvaluateBatchAndCache(const std::vector<NodeID>& to_evaluate) override;
+    void doScheduledEvaluateAndCache(NodeID to_evaluate) override;
     void doReEvaluateAndCache(NodeID to_evaluate) override;
     void doReset() override { m_heuristic->reset(); };
 
@@ -81,6 +83,21 @@ void WeightedFCostEvaluator<State_t, Action_t>::doEvaluateAndCache(NodeID to_eva
     NE::setCachedValues(to_evaluate, eval, m_heuristic->isLastNodeADeadEnd());
 }
 
+template<class State_t, class Action_t>
+void WeightedFCostEvaluator<State_t, Action_t>::doEvaluateBatchAndCache(const std::vector<NodeID>& to_evaluate) {
+    m_heuristic->evaluateBatch(to_evaluate);
+
+    for (NodeID node_id : to_evaluate) {
+        doScheduledEvaluateAndCache(node_id);
+    }
+}
+
+template<class State_t, class Action_t>
+void WeightedFCostEvaluator<State_t, Action_t>::doScheduledEvaluateAndCache(NodeID to_evaluate) {
+    double eval = NE::getNodeContainer()->getGValue(to_evaluate) + m_weight * m_heuristic->getCachedEval(to_evaluate);
+    NE::setCachedValues(to_evaluate, eval, m_heuristic->getCachedIsDeadEnd(to_evaluate));
+}
+
 template<class State_t, class Action_t>
 void WeightedFCostEvaluator<State_t, Action_t>::doReEvaluateAndCache(NodeID to_evaluate) {
     m_heuristic->reEvaluate(to_evaluate);
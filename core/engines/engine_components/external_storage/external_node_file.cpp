@@ -0,0 +1,275 @@
+#include "external_node_file.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <queue>
+#include <utility>
+
+namespace {
+    constexpr std::size_t RECORD_SIZE = sizeof(ExternalNodeRecord);  ///< The number of bytes in a record on disk
+
+    /**
+     * Reads up to the given number of records from the current position of the given file into the given vector.
+     */
+    void readNodeRecords(std::ifstream& file, std::size_t max_records, std::vector<ExternalNodeRecord>& records,
+              ExternalIOStatistics& stats) {
+        records.resize(max_records);
+        file.read(reinterpret_cast<char*>(records.data()), static_cast<std::streamsize>(max_records * RECORD_SIZE));
+        std::size_t num_read = static_cast<std::size_t>(file.gcount()) / RECORD_SIZE;
+        records.resize(num_read);
+        stats.m_bytes_read += num_read * RECORD_SIZE;
+    }
+
+    /**
+     * Writes the given records to the current position of the given file.
+     */
+    void writeNodeRecords(std::ofstream& file, const std::vector<ExternalNodeRecord>& records, ExternalIOStatistics& stats) {
+        file.write(reinterpret_cast<const char*>(records.data()), static_cast<std::streamsize>(records.size() * RECORD_SIZE));
+        stats.m_bytes_written += records.size() * RECORD_SIZE;
+    }
+
+    /**
+     * Writes records to a file in blocks, skipping any record with the same rank as the record written before it.
+     */
+    class UniqueNodeWriter {
+    public:
+        UniqueNodeWriter(const std::string& path, std::size_t block_size, ExternalIOStatistics& stats)
+                  : m_file(path, std::ios::binary | std::ios::trunc), m_block_size(std::max<std::size_t>(block_size, 1)), m_stats(&stats) {
+            m_block.reserve(m_block_size);
+        }
+
+        void write(const ExternalNodeRecord& record) {
+            if (m_last_rank && m_last_rank.value() == record.m_rank) {
+                return;
+            }
+            m_last_rank = record.m_rank;
+            m_block.push_back(record);
+            m_num_written++;
+
+            if (m_block.size() == m_block_size) {
+                flush();
+            }
+        }
+
+        std::size_t finish() {
+            flush();
+            m_file.close();
+            return m_num_written;
+        }
+
+    private:
+        void flush() {
+            writeNodeRecords(m_file, m_block, *m_stats);
+            m_block.clear();
+        }
+
+        std::ofstream m_file;
+        std::vector<ExternalNodeRecord> m_block;
+        std::size_t m_block_size;
+        ExternalIOStatistics* m_stats;
+        std::optional<uint64_t> m_last_rank = std::nullopt;
+        std::size_t m_num_written = 0;
+    };
+
+    /**
+     * Merges the given sorted runs into the given file, skipping records with the same rank as an earlier record, and
+     * removes the runs. The memory is split evenly between the runs and the output.
+     */
+    std::size_t mergeNodeRecordRuns(const std::vector<std::string>& run_paths, const std::string& path,
+              std::size_t max_records_in_memory, ExternalIOStatistics& stats) {
+        std::size_t block_size = max_records_in_memory / (run_paths.size() + 1);
+        std::vector<std::unique_ptr<ExternalNodeReader>> readers;
+        using HeapEntry = std::pair<uint64_t, std::size_t>;
+        std::priority_queue<HeapEntry, std::vector<HeapEntry>, std::greater<>> heap;
+
+        for (const auto& run_path : run_paths) {
+            readers.push_back(std::make_unique<ExternalNodeReader>(run_path, block_size, stats));
+            auto first = readers.back()->peekNext();
+            assert(first.has_value());
+            heap.emplace(first->m_rank, readers.size() - 1);
+        }
+
+        UniqueNodeWriter writer(path, block_size, stats);
+        ExternalNodeRecord record;
+        while (!heap.empty()) {
+            std::size_t run = heap.top().second;
+            heap.pop();
+
+            readers[run]->readNext(record);
+            writer.write(record);
+
+            auto next = readers[run]->peekNext();
+            if (next) {
+                heap.emplace(next->m_rank, run);
+            }
+        }
+        std::size_t num_records = writer.finish();
+
+        readers.clear();
+        for (const auto& run_path : run_paths) {
+            std::filesystem::remove(run_path);
+        }
+        return num_records;
+    }
+}  // namespace
+
+ExternalNodeReader::ExternalNodeReader(const std::string& path, std::size_t block_size, ExternalIOStatistics& stats)
+          : m_file(path, std::ios::binary), m_block_size(std::max<std::size_t>(block_size, 1)), m_stats(&stats) {
+}
+
+bool ExternalNodeReader::fillBlock() {
+    if (m_next_in_block < m_block.size()) {
+        return true;
+    }
+    if (!m_file.is_open() || !m_file.good()) {
+        return false;
+    }
+
+    readNodeRecords(m_file, m_block_size, m_block, *m_stats);
+    m_next_in_block = 0;
+    return !m_block.empty();
+}
+
+bool ExternalNodeReader::readNext(ExternalNodeRecord& record) {
+    if (!fillBlock()) {
+        return false;
+    }
+    record = m_block[m_next_in_block++];
+    return true;
+}
+
+std::optional<ExternalNodeRecord> ExternalNodeReader::peekNext() {
+    if (!fillBlock()) {
+        return std::nullopt;
+    }
+    return m_block[m_next_in_block];
+}
+
+void appendNodeRecords(const std::string& path, const std::vector<ExternalNodeRecord>& records, ExternalIOStatistics& stats) {
+    std::ofstream file(path, std::ios::binary | std::ios::app);
+    writeNodeRecords(file, records, stats);
+}
+
+std::size_t getNumNodeRecords(const std::string& path) {
+    std::error_code error;
+    auto file_size = std::filesystem::file_size(path, error);
+    return error ? 0 : static_cast<std::size_t>(file_size / RECORD_SIZE);
+}
+
+std::size_t sortAndRemoveDuplicateNodeRecords(const std::string& path, std::size_t max_records_in_memory,
+          std::size_t max_fan_in, ExternalIOStatistics& stats) {
+    max_records_in_memory = std::max<std::size_t>(max_records_in_memory, 1);
+    std::vector<std::string> run_paths;
+    std::vector<ExternalNodeRecord> records;
+    std::size_t first_run_size = 0;
+
+    // Forms sorted runs that each fit in memory
+    {
+        std::ifstream file(path, std::ios::binary);
+        while (file.good()) {
+            readNodeRecords(file, max_records_in_memory, records, stats);
+            if (records.empty()) {
+                break;
+            }
+            std::sort(records.begin(), records.end());
+            records.erase(std::unique(records.begin(), records.end(),
+                                    [](const auto& rec1, const auto& rec2) { return rec1.m_rank == rec2.m_rank; }),
+                      records.end());
+
+            if (run_paths.empty()) {
+                first_run_size = records.size();
+            }
+            run_paths.push_back(path + ".run" + std::to_string(run_paths.size()));
+            std::ofstream run_file(run_paths.back(), std::ios::binary | std::ios::trunc);
+            writeNodeRecords(run_file, records, stats);
+        }
+    }
+    stats.m_num_sort_passes++;
+
+    if (run_paths.empty()) {
+        std::ofstream(path, std::ios::binary | std::ios::trunc);
+        return 0;
+    } else if (run_paths.size() == 1) {
+        std::filesystem::rename(run_paths[0], path);
+        return first_run_size;
+    }
+
+    // Merges the runs in passes, until few enough are left to merge them back into the file
+    std::size_t fan_in = std::max<std::size_t>(std::min(max_fan_in, max_records_in_memory - 1), 2);
+    std::size_t num_runs_created = run_paths.size();
+    while (run_paths.size() > fan_in) {
+        std::vector<std::string> merged_paths;
+        for (std::size_t first = 0; first < run_paths.size(); first += fan_in) {
+            std::vector<std::string> group(run_paths.begin() + static_cast<std::ptrdiff_t>(first),
+                      run_paths.begin() + static_cast<std::ptrdiff_t>(std::min(first + fan_in, run_paths.size())));
+            if (group.size() == 1) {
+                merged_paths.push_back(group[0]);
+                continue;
+            }
+            merged_paths.push_back(path + ".run" + std::to_string(num_runs_created++));
+            mergeNodeRecordRuns(group, merged_paths.back(), max_records_in_memory, stats);
+        }
+        run_paths = std::move(merged_paths);
+        stats.m_num_sort_passes++;
+    }
+
+    std::size_t num_records = mergeNodeRecordRuns(run_paths, path, max_records_in_memory, stats);
+    stats.m_num_sort_passes++;
+    return num_records;
+}
+
+std::size_t subtractNodeRecords(const std::string& path, const std::string& to_subtract, std::size_t block_size,
+          ExternalIOStatistics& stats) {
+    std::string result_path = path + ".subtracted";
+    std::size_t num_records = 0;
+    {
+        ExternalNodeReader reader(path, block_size, stats);
+        ExternalNodeReader subtract_reader(to_subtract, block_size, stats);
+        UniqueNodeWriter writer(result_path, block_size, stats);
+
+        ExternalNodeRecord record;
+        while (reader.readNext(record)) {
+            auto to_remove = subtract_reader.peekNext();
+            while (to_remove && to_remove->m_rank < record.m_rank) {
+                subtract_reader.readNext(to_remove.value());
+                to_remove = subtract_reader.peekNext();
+            }
+
+            if (!to_remove || to_remove->m_rank != record.m_rank) {
+                writer.write(record);
+            }
+        }
+        num_records = writer.finish();
+    }
+
+    std::filesystem::rename(result_path, path);
+    return num_records;
+}
+
+std::optional<ExternalNodeRecord> findNodeRecord(const std::string& path, uint64_t rank, ExternalIOStatistics& stats) {
+    std::ifstream file(path, std::ios::binary);
+    std::size_t low = 0;
+    std::size_t high = getNumNodeRecords(path);
+    ExternalNodeRecord record;
+
+    while (low < high) {
+        std::size_t mid = low + (high - low) / 2;
+        file.seekg(static_cast<std::streamoff>(mid * RECORD_SIZE));
+        file.read(reinterpret_cast<char*>(&record), static_cast<std::streamsize>(RECORD_SIZE));
+        stats.m_bytes_read += RECORD_SIZE;
+
+        if (record.m_rank == rank) {
+            return record;
+        } else if (record.m_rank < rank) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return std::nullopt;
+}
@@ -0,0 +1,150 @@
+#ifndef EXTERNAL_NODE_FILE_H_
+#define EXTERNAL_NODE_FILE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <optional>
+#include <string>
+#include <vector>
+
+/**
+ * Tools for storing search nodes in binary files on disk, for searches whose nodes do not fit in memory.
+ *
+ * Each node is stored as a fixed-size record holding the perfect hash value (rank) of its state and of the state of
+ * its parent. Files are sorted by rank, so that duplicates can be removed and files can be compared by streaming over
+ * them rather than with a hash map.
+ */
+
+/**
+ * A node stored on disk.
+ */
+struct ExternalNodeRecord {
+    uint64_t m_rank = 0;  ///< The rank of the state of the node
+    uint64_t m_parent_rank = 0;  ///< The rank of the state of the parent of the node
+
+    /**
+     * Orders records by the rank of their state.
+     *
+     * @param other The record to compare to
+     * @return If this record has a smaller rank than the other
+     */
+    bool operator<(const ExternalNodeRecord& other) const { return m_rank < other.m_rank; }
+};
+
+/**
+ * Counts the disk accesses made by the external storage tools.
+ */
+struct ExternalIOStatistics {
+    /**
+     * Sets all of the statistics back to 0.
+     */
+    void reset() { *this = ExternalIOStatistics(); }
+
+    uint64_t m_bytes_read = 0;  ///< The number of bytes read from disk
+    uint64_t m_bytes_written = 0;  ///< The number of bytes written to disk
+    uint64_t m_num_sort_passes = 0;  ///< The number of passes over data made while sorting files
+};
+
+/**
+ * Streams the records of a file, reading them from disk in blocks.
+ *
+ * @class ExternalNodeReader
+ */
+class ExternalNodeReader {
+public:
+    /**
+     * Opens the given file for reading.
+     *
+     * @param path The path to the file
+     * @param block_size The maximum number of records read from disk at a time
+     * @param stats The statistics to add the bytes read to
+     */
+    ExternalNodeReader(const std::string& path, std::size_t block_size, ExternalIOStatistics& stats);
+
+    /**
+     * Reads the next record of the file.
+     *
+     * @param record The record to write the next record into
+     * @return If there was a record left to read
+     */
+    bool readNext(ExternalNodeRecord& record);
+
+    /**
+     * Gets the next record of the file without moving past it.
+     *
+     * @return The next record, or std::nullopt if there are none left
+     */
+    std::optional<ExternalNodeRecord> peekNext();
+
+private:
+    /**
+     * Reads the next block of records from disk if the current block has been used up.
+     *
+     * @return If there is a record left to read
+     */
+    bool fillBlock();
+
+    std::ifstream m_file;  ///< The file being read
+    std::vector<ExternalNodeRecord> m_block;  ///< The current block of records
+    std::size_t m_next_in_block = 0;  ///< The index of the next record in the current block
+    std::size_t m_block_size;  ///< The maximum number of records in a block
+    ExternalIOStatistics* m_stats;  ///< The statistics to add the bytes read to
+};
+
+/**
+ * Appends the given records to the end of the given file, creating it if it does not exist.
+ *
+ * @param path The path to the file
+ * @param records The records to append
+ * @param stats The statistics to add the bytes written to
+ */
+void appendNodeRecords(const std::string& path, const std::vector<ExternalNodeRecord>& records, ExternalIOStatistics& stats);
+
+/**
+ * Gets the number of records in the given file.
+ *
+ * @param path The path to the file
+ * @return The number of records, or 0 if the file does not exist
+ */
+std::size_t getNumNodeRecords(const std::string& path);
+
+/**
+ * Sorts the given file by rank and removes records with the same rank as an earlier record, using an external merge
+ * sort. Sorted runs of at most the given number of records are written to temporary files next to the given file. The
+ * runs are then merged at most the given number at a time, in as many passes as are needed to merge them back into the
+ * given file. The number of runs merged at once is also limited so that each run and the output get at least one record
+ * of memory.
+ *
+ * @param path The path to the file
+ * @param max_records_in_memory The maximum number of records held in memory at once
+ * @param max_fan_in The maximum number of runs merged at once, which is at least 2
+ * @param stats The statistics to add the disk accesses and sort passes to
+ * @return The number of records left in the file
+ */
+std::size_t sortAndRemoveDuplicateNodeRecords(const std::string& path, std::size_t max_records_in_memory,
+          std::size_t max_fan_in, ExternalIOStatistics& stats);
+
+/**
+ * Removes all records from the first file whose rank appears in the second file. Both files must be sorted by rank.
+ *
+ * @param path The path to the file to remove records from
+ * @param to_subtract The path to the file with the records to remove
+ * @param block_size The maximum number of records read from disk at a time from each file
+ * @param stats The statistics to add the disk accesses to
+ * @return The number of records left in the first file
+ */
+std::size_t subtractNodeRecords(const std::string& path, const std::string& to_subtract, std::size_t block_size,
+          ExternalIOStatistics& stats);
+
+/**
+ * Finds the record with the given rank in a file sorted by rank, using binary search.
+ *
+ * @param path The path to the file
+ * @param rank The rank to look for
+ * @param stats The statistics to add the bytes read to
+ * @return The record with the given rank, or std::nullopt if there is none
+ */
+std::optional<ExternalNodeRecord> findNodeRecord(const std::string& path, uint64_t rank, ExternalIOStatistics& stats);
+
+#endif  //EXTERNAL_NODE_FILE_H_
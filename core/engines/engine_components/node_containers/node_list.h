@@ -82,6 +82,7 @@ void NodeList<State_t, Action_t>::clear() {
     m_last_action_costs.clear();
     m_parent_ids.clear();
     m_g_values.clear();
+    NodeContainer<State_t, Action_t>::m_num_clears++;
 }
 
 template<class State_t, class Action_t>
@@ -0,0 +1,283 @@
+#ifndef RANKED_NODE_LIST_H_
+#define RANKED_NODE_LIST_H_
+
+#include "building_tools/hashing/state_hash_function.h"
+#include "search_basics/node_container.h"
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <vector>
+
+/**
+ * A list of search nodes that stores the hash value of each state, rather than the state itself, and recovers states
+ * on demand with the unrank method of an invertible hash function. For puzzles such as the sliding tile puzzle this
+ * avoids a heap-allocated permutation per node.
+ *
+ * Recovered states are kept in a small set of scratch states that are reused in round-robin order, so the reference
+ * returned by getState remains valid until NUM_SCRATCH_STATES further states have been recovered. Recently added and
+ * recently recovered nodes are found in the scratch states without unranking.
+ *
+ * @tparam State_t The type for the states in the node
+ * @tparam Action_t The type for the actions in the node
+ * @tparam Hash_t The type of the hash values stored for each state
+ */
+template<class State_t, class Action_t, class Hash_t = uint64_t>
+class RankedNodeList : public NodeContainer<State_t, Action_t> {
+public:
+    static constexpr std::size_t NUM_SCRATCH_STATES = 4;  ///< The number of recovered states that are kept
+
+    /**
+     * Creates a ranked node list without a hash function. One must be set before nodes are added.
+     */
+    RankedNodeList() = default;
+
+    /**
+     * Creates a ranked node list that uses the given hash function.
+     *
+     * @param hash_func The invertible, perfect hash function used to store states
+     */
+    explicit RankedNodeList(const StateHashFunction<State_t, Hash_t>& hash_func) { setHashFunction(hash_func); }
+
+    /**
+     * Destructor for the ranked node list. Does nothing.
+     */
+    virtual ~RankedNodeList() = default;
+
+    /**
+     * Sets the hash function used to store states, and clears the list.
+     *
+     * @param hash_func The invertible, perfect hash function used to store states
+     */
+    void setHashFunction(const StateHashFunction<State_t, Hash_t>& hash_func);
+
+    // Overridden public NodeContainer methods
+    NodeID addNode(const State_t& state) override;
+    NodeID addNode(const State_t& state, NodeID parent_id, double g_cost, const Action_t& last_action, double last_action_cost) override;
+    const State_t& getState(NodeID node_id) const override;
+    const std::optional<Action_t>& getLastAction(NodeID node_id) const override;
+    void setLastAction(NodeID node_id, const std::optional<Action_t>& action) override;
+    double getLastActionCost(NodeID node_id) const override;
+    void setLastActionCost(NodeID node_id, double last_action_cost) override;
+    NodeID getParentID(NodeID node_id) const override;
+    void setParentID(NodeID node_id, NodeID parent_id) override;
+    double getGValue(NodeID node_id) const override;
+    void setGValue(NodeID node_id, double g_value) override;
+    void clear() override;
+    std::size_t size() const override { return m_ranks.size(); };
+
+    /**
+     * Gets the hash value stored for the node with the given ID.
+     *
+     * @param node_id The ID of the node of interest
+     * @return The hash value of the state of the node
+     */
+    const Hash_t& getRank(NodeID node_id) const;
+
+    /**
+     * Gets the number of times a state has been recovered from its hash value.
+     *
+     * @return The number of unrank calls
+     */
+    uint64_t getNumUnranks() const { return m_num_unranks; }
+
+    /**
+     * Pops off the last element of the node list.
+     */
+    void popBack();
+
+private:
+    static constexpr NodeID NO_NODE = std::numeric_limits<NodeID>::max();  ///< Marks a scratch state as unused
+
+    /**
+     * Stores the given state as the scratch state of the given node, replacing the oldest scratch state.
+     *
+     * @param node_id The ID of the node
+     * @param state The state of the node
+     */
+    void storeScratchState(NodeID node_id, const State_t& state);
+
+    /**
+     * Adds the hash value of the given state, and stores it as a scratch state for the new node.
+     *
+     * @param state The state of the new node
+     * @return The ID of the new node
+     */
+    NodeID addRank(const State_t& state);
+
+    const StateHashFunction<State_t, Hash_t>* m_hash_func = nullptr;  ///< The hash function used to store states
+
+    std::vector<Hash_t> m_ranks;  ///< The hash value of the state of each node
+    std::vector<std::optional<Action_t>> m_last_actions;  ///< The list of last actions being stored
+    std::vector<double> m_last_action_costs;  ///< The list of last action costs
+    std::vector<NodeID> m_parent_ids;  ///< The list of parent IDs
+    std::vector<double> m_g_values;  ///< The list of g-values
+
+    mutable std::array<State_t, NUM_SCRATCH_STATES> m_scratch_states;  ///< Recently added or recovered states
+    mutable std::array<NodeID, NUM_SCRATCH_STATES> m_scratch_ids{};  ///< The ID of the node of each scratch state
+    mutable std::size_t m_next_scratch = 0;  ///< The index of the scratch state to replace next
+    mutable uint64_t m_num_unranks = 0;  ///< The number of times a state has been recovered
+    bool m_has_scratch_shape = false;  ///< Whether the scratch states have the shape of the stored states
+};
+
+template<class State_t, class Action_t, class Hash_t>
+void RankedNodeList<State_t, Action_t, Hash_t>::setHashFunction(const StateHashFunction<State_t, Hash_t>& hash_func) {
+    assert(hash_func.isPerfectHashFunction() && hash_func.isInvertible());
+    m_hash_func = &hash_func;
+    clear();
+}
+
+template<class State_t, class Action_t, class Hash_t>
+NodeID RankedNodeList<State_t, Action_t, Hash_t>::addRank(const State_t& state) {
+    assert(m_hash_func);
+    if (!m_has_scratch_shape) {
+        // Copies of the first state give the scratch states the right shape for unrank
+        m_scratch_states.fill(state);
+        m_has_scratch_shape = true;
+    }
+
+    NodeID new_node_id = m_ranks.size();
+    m_ranks.emplace_back(m_hash_func->getHashValue(state));
+    storeScratchState(new_node_id, state);
+    return new_node_id;
+}
+
+template<class State_t, class Action_t, class Hash_t>
+NodeID RankedNodeList<State_t, Action_t, Hash_t>::addNode(const State_t& state, NodeID parent_id, double g_cost,
+          const Action_t& last_action, double last_action_cost) {
+    NodeID new_node_id = addRank(state);
+    m_last_actions.emplace_back(last_action);
+    m_last_action_costs.emplace_back(last_action_cost);
+    m_parent_ids.emplace_back(parent_id);
+    m_g_values.emplace_back(g_cost);
+    return new_node_id;
+}
+
+template<class State_t, class Action_t, class Hash_t>
+NodeID RankedNodeList<State_t, Action_t, Hash_t>::addNode(const State_t& state) {
+    NodeID new_node_id = addRank(state);
+    m_last_actions.emplace_back(std::nullopt);
+    m_last_action_costs.emplace_back(0);
+    m_parent_ids.emplace_back(0);
+    m_g_values.emplace_back(0);
+    return new_node_id;
+}
+
+template<class State_t, class Action_t, class Hash_t>
+void RankedNodeList<State_t, Action_t, Hash_t>::clear() {
+    m_ranks.clear();
+    m_last_actions.clear();
+    m_last_action_costs.clear();
+    m_parent_ids.clear();
+    m_g_values.clear();
+
+    m_scratch_ids.fill(NO_NODE);
+    m_next_scratch = 0;
+    m_num_unranks = 0;
+    m_has_scratch_shape = false;
+    NodeContainer<State_t, Action_t>::m_num_clears++;
+}
+
+template<class State_t, class Action_t, class Hash_t>
+void RankedNodeList<State_t, Action_t, Hash_t>::storeScratchState(NodeID node_id, const State_t& state) {
+    m_scratch_states[m_next_scratch] = state;
+    m_scratch_ids[m_next_scratch] = node_id;
+    m_next_scratch = (m_next_scratch + 1) % NUM_SCRATCH_STATES;
+}
+
+template<class State_t, class Action_t, class Hash_t>
+const State_t& RankedNodeList<State_t, Action_t, Hash_t>::getState(NodeID node_id) const {
+    assert(node_id < m_ranks.size());
+    for (std::size_t i = 0; i < NUM_SCRATCH_STATES; ++i) {
+        if (m_scratch_ids[i] == node_id) {
+            return m_scratch_states[i];
+        }
+    }
+
+    std::size_t scratch_index = m_next_scratch;
+    m_hash_func->unrank(m_ranks[node_id], m_scratch_states[scratch_index]);
+    m_scratch_ids[scratch_index] = node_id;
+    m_next_scratch = (m_next_scratch + 1) % NUM_SCRATCH_STATES;
+    m_num_unranks++;
+    return m_scratch_states[scratch_index];
+}
+
+template<class State_t, class Action_t, class Hash_t>
+const Hash_t& RankedNodeList<State_t, Action_t, Hash_t>::getRank(NodeID node_id) const {
+    assert(node_id < m_ranks.size());
+    return m_ranks[node_id];
+}
+
+template<class State_t, class Action_t, class Hash_t>
+const std::optional<Action_t>& RankedNodeList<State_t, Action_t, Hash_t>::getLastAction(NodeID node_id) const {
+    assert(node_id < m_last_actions.size());
+    return m_last_actions[node_id];
+}
+
+template<class State_t, class Action_t, class Hash_t>
+void RankedNodeList<State_t, Action_t, Hash_t>::setLastAction(NodeID node_id, const std::optional<Action_t>& action) {
+    assert(node_id < m_last_actions.size());
+    m_last_actions[node_id] = action;
+}
+
+template<class State_t, class Action_t, class Hash_t>
+double RankedNodeList<State_t, Action_t, Hash_t>::getLastActionCost(NodeID node_id) const {
+    assert(node_id < m_last_action_costs.size());
+    return m_last_action_costs[node_id];
+}
+
+template<class State_t, class Action_t, class Hash_t>
+void RankedNodeList<State_t, Action_t, Hash_t>::setLastActionCost(NodeID node_id, double last_action_cost) {
+    assert(node_id < m_last_action_costs.size());
+    m_last_action_costs[node_id] = last_action_cost;
+}
+
+template<class State_t, class Action_t, class Hash_t>
+NodeID RankedNodeList<State_t, Action_t, Hash_t>::getParentID(NodeID node_id) const {
+    assert(node_id < m_parent_ids.size());
+    return m_parent_ids[node_id];
+}
+
+template<class State_t, class Action_t, class Hash_t>
+void RankedNodeList<State_t, Action_t, Hash_t>::setParentID(NodeID node_id, NodeID parent_id) {
+    assert(node_id < m_parent_ids.size());
+    m_parent_ids[node_id] = parent_id;
+}
+
+template<class State_t, class Action_t, class Hash_t>
+double RankedNodeList<State_t, Action_t, Hash_t>::getGValue(NodeID node_id) const {
+    assert(node_id < m_g_values.size());
+    return m_g_values[node_id];
+}
+
+template<class State_t, class Action_t, class Hash_t>
+void RankedNodeList<State_t, Action_t, Hash_t>::setGValue(NodeID node_id, double g_value) {
+    assert(node_id < m_g_values.size());
+    m_g_values[node_id] = g_value;
+}
+
+template<class State_t, class Action_t, class Hash_t>
+void RankedNodeList<State_t, Action_t, Hash_t>::popBack() {
+    assert(m_ranks.size() > 0);
+    assert(m_ranks.size() == m_last_actions.size());
+    assert(m_last_actions.size() == m_last_action_costs.size());
+    assert(m_last_action_costs.size() == m_parent_ids.size());
+    assert(m_parent_ids.size() == m_g_values.size());
+
+    NodeID last_id = m_ranks.size() - 1;
+    for (NodeID& scratch_id : m_scratch_ids) {
+        if (scratch_id == last_id) {
+            scratch_id = NO_NODE;
+        }
+    }
+
+    m_ranks.pop_back();
+    m_last_actions.pop_back();
+    m_last_action_costs.pop_back();
+    m_parent_ids.pop_back();
+    m_g_values.pop_back();
+}
+#endif /* RANKED_NODE_LIST_H_ */
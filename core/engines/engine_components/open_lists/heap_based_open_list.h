@@ -56,6 +56,15 @@ public:
      */
     NodeID getAndRemoveIDOfBestNode();
 
+    /**
+     * Returns if the node with the given ID, which does not need to be in the open list, is no worse than the best node
+     * in the open list according to the evaluators. Returns true if the open list is empty.
+     *
+     * @param node_id The ID of the node to compare
+     * @return If the node is no worse than the best node in open
+     */
+    bool isNoWorseThanBestNode(NodeID node_id) const;
+
     /**
      * Removes the node with the given ID from the open list.
      *
@@ -125,7 +134,16 @@ private:
      * @param heap_index_2 The location in the open list of the second node being compared.
      * @return If the evaluation of the first node is less than or equal to the second.
      */
-    bool nodeNoWorse(HeapIndex heap_index_1, HeapIndex heap_index_2) const;
+    bool nodeNoWorse(HeapIndex heap_index_1, HeapIndex heap_index_2) const { return nodeIDNoWorse(m_heap[heap_index_1], m_heap[heap_index_2]); }
+
+    /**
+     * Returns true if the evaluation of the first node is less than or equal to the second.
+     *
+     * @param node1_id The ID of the first node being compared
+     * @param node2_id The ID of the second node being compared
+     * @return If the evaluation of the first node is less than or equal to the second.
+     */
+    bool nodeIDNoWorse(NodeID node1_id, NodeID node2_id) const;
 
     /**
      * Heapify's up the node at the given open list location if it needs to be moved up.
@@ -242,10 +260,12 @@ void HeapBasedOpenList<State_t, Action_t>::addToOpen(NodeID node_id) {
 }
 
 template<class State_t, class Action_t>
-bool HeapBasedOpenList<State_t, Action_t>::nodeNoWorse(HeapIndex heap_index_1, HeapIndex heap_index_2) const {
-    NodeID node1_id = m_heap[heap_index_1];
-    NodeID node2_id = m_heap[heap_index_2];
+bool HeapBasedOpenList<State_t, Action_t>::isNoWorseThanBestNode(NodeID node_id) const {
+    return m_heap.empty() || nodeIDNoWorse(node_id, m_heap[0]);
+}
 
+template<class State_t, class Action_t>
+bool HeapBasedOpenList<State_t, Action_t>::nodeIDNoWorse(NodeID node1_id, NodeID node2_id) const {
     for (auto& eval_and_usage : m_evaluators) {
         double node1_eval = eval_and_usage.m_evaluator->getCachedEval(node1_id);
         double node2_eval = eval_and_usage.m_evaluator->getCachedEval(node2_id);
@@ -0,0 +1,447 @@
+#ifndef FRINGE_SEARCH_H_
+#define FRINGE_SEARCH_H_
+
+#include "building_tools/hashing/state_hash_function.h"
+#include "engines/engine_components/node_containers/node_list.h"
+#include "engines/single_step_search_engine.h"
+#include "fringe_search_params.h"
+#include "logging/logging_terms.h"
+#include "logging/search_component_settings.h"
+#include "search_basics/node_container.h"
+#include "search_basics/node_evaluator.h"
+#include "search_basics/search_engine.h"
+#include "utils/floating_point_utils.h"
+#include "utils/string_utils.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+/**
+ * Defines a fringe search engine.
+ *
+ * Fringe search uses IDA*-style f-cost thresholds, but keeps the fringe of the search between iterations in a doubly
+ * linked list instead of regenerating it. Each iteration passes over the list once. A node whose f-cost is above the
+ * threshold stays in the list for the next iteration. Otherwise, it is goal tested and expanded, and its children are
+ * inserted into the list right after it so that they are visited later in the same iteration. A child whose state is
+ * already stored is only inserted if its g-cost is lower than the stored one, in which case it is moved from wherever
+ * it was in the list. The search is optimal if the heuristic is admissible, and no priority queue is used.
+ *
+ * The g-cost and list links of each state are kept in a dense array of cells indexed by the state's hash value, so the
+ * hash function must be perfect, and the hash values should be small integers. The grid location hash function, for
+ * example, gives one cell per grid location once the map width is set. The array is grown on demand to the largest hash
+ * value seen, and is not cleared between searches. Instead, each cell records the search it was last written in.
+ *
+ * @tparam State_t The type of a state
+ * @tparam Action_t The type of an action
+ * @tparam Hash_t The hash type. Must be an unsigned integer type.
+ * @class FringeSearch
+ */
+template<class State_t, class Action_t, class Hash_t>
+class FringeSearch : public SingleStepSearchEngine<State_t, Action_t> {
+    using SE = SingleStepSearchEngine<State_t, Action_t>;  // Allows succinct access to the protected members
+    static_assert(std::is_integral_v<Hash_t> && std::is_unsigned_v<Hash_t>, "Fringe search indexes cells by the hash value");
+
+public:
+    /**
+     * Creates a fringe search engine with the given parameters.
+     *
+     * @param params The parameters to use for the search
+     */
+    explicit FringeSearch(const FringeSearchParams& params)
+              : m_params(params) {}
+
+    /**
+     * Updates the engine parameters. Resets the engine as well.
+     *
+     * @param params The new parameters
+     */
+    void setEngineParams(const FringeSearchParams& params);
+
+    /**
+     * Sets the heuristic to use. The f-cost of a node is its g-cost plus its heuristic value.
+     *
+     * @param heuristic The heuristic to use
+     */
+    void setHeuristic(NodeEvaluator<State_t, Action_t>& heuristic);
+
+    /**
+     * Sets the hash function used to index the cells. The hash function must be perfect.
+     *
+     * @param hash The new hash function
+     */
+    void setHashFunction(const StateHashFunction<State_t, Hash_t>& hash);
+
+    /**
+     * Gets the list of nodes generated in the current search. There is one node per state.
+     *
+     * @return The list of nodes
+     */
+    const NodeList<State_t, Action_t>& getNodes() const { return m_nodes; }
+
+    /**
+     * Gets the thresholds used for each of the iterations thus far.
+     *
+     * @return The thresholds thus far
+     */
+    const std::vector<double>& getThresholds() const { return m_thresholds; }
+
+    /**
+     * Gets the number of nodes currently in the fringe.
+     *
+     * @return The size of the fringe
+     */
+    std::size_t getFringeSize() const { return m_fringe_size; }
+
+    /**
+     * Gets the number of cells currently allocated.
+     *
+     * @return The number of cells
+     */
+    std::size_t getNumCells() const { return m_cells.size(); }
+
+    // Overridden public SearchEngine methods
+    StringMap getEngineSpecificStatistics() const override;
+    std::vector<NodeEvaluator<State_t, Action_t>*> getBaseEvaluators() const override { return {m_heuristic}; }
+
+    // Overidden public SettingsLogger methods
+    std::string getName() const override { return "FringeSearch"; }
+
+protected:
+    // Overridden SingleStepSearchEngine methods
+    void doSearchInitialization(const State_t& initial_state) override;
+    EngineStatus doSingleSearchStep() override;
+    bool doCanRunSearch() const override;
+    void doReset() override;
+    StringMap getEngineParamsLog() const override { return m_params.getParameterLog(); }
+
+    // Overidden protected SettingsLogger methods
+    StringMap getComponentSettings() const override;
+    SearchSettingsMap getSubComponentSettings() const override;
+
+private:
+    inline static const Hash_t NO_CELL = std::numeric_limits<Hash_t>::max();  ///< Marks the end of the fringe list
+
+    /**
+     * The data stored for a state, indexed by its hash value.
+     */
+    struct FringeCell {
+        double m_g_value = 0.0;  ///< The lowest g-cost found for the state
+        NodeID m_node_id = 0;  ///< The ID of the state's node in the node list
+        Hash_t m_prev = NO_CELL;  ///< The previous cell in the fringe list
+        Hash_t m_next = NO_CELL;  ///< The next cell in the fringe list
+        uint32_t m_search_id = 0;  ///< The search in which the cell was last written. The cell is unused if not the current search.
+        bool m_in_fringe = false;  ///< If the state is in the fringe list
+    };
+
+    /**
+     * Gets the cell for the given hash value, growing the cell array if needed.
+     *
+     * @param hash The hash value of the state
+     * @return The cell of the state
+     */
+    FringeCell& getCell(Hash_t hash);
+
+    /**
+     * Returns if the given cell has been written in the current search.
+     *
+     * @param cell The cell to check
+     * @return If the cell is in use
+     */
+    bool isCellInUse(const FringeCell& cell) const { return cell.m_search_id == m_search_id; }
+
+    /**
+     * Inserts the given cell into the fringe list after the given cell, or at the front if the given cell is NO_CELL.
+     *
+     * @param hash The hash value of the cell to insert
+     * @param after_hash The hash value of the cell to insert after
+     */
+    void insertAfter(Hash_t hash, Hash_t after_hash);
+
+    /**
+     * Removes the given cell from the fringe list.
+     *
+     * @param hash The hash value of the cell to remove
+     */
+    void removeFromFringe(Hash_t hash);
+
+    /**
+     * Expands the node of the given cell, and inserts its new or improved children after it in the fringe list.
+     *
+     * @param hash The hash value of the cell to expand
+     */
+    void expandCell(Hash_t hash);
+
+    FringeSearchParams m_params;  ///< The parameters of the engine
+    NodeEvaluator<State_t, Action_t>* m_heuristic = nullptr;  ///< The heuristic
+    const StateHashFunction<State_t, Hash_t>* m_hash_func = nullptr;  ///< The hash function
+
+    NodeList<State_t, Action_t> m_nodes;  ///< The nodes of the current search
+    std::vector<FringeCell> m_cells;  ///< The cells, indexed by hash value
+    uint32_t m_search_id = 0;  ///< The ID of the current search, used to tell which cells are in use
+
+    Hash_t m_fringe_head = NO_CELL;  ///< The first cell in the fringe list
+    Hash_t m_current = NO_CELL;  ///< The cell to visit next in the current iteration
+    std::size_t m_fringe_size = 0;  ///< The number of cells in the fringe list
+    double m_threshold = 0.0;  ///< The f-cost threshold of the current iteration
+    double m_next_threshold = std::numeric_limits<double>::infinity();  ///< The lowest f-cost above the threshold seen
+
+    std::vector<double> m_thresholds;  ///< The thresholds of the iterations thus far
+    int64_t m_num_expansions = 0;  ///< The number of nodes expanded
+    int64_t m_num_deferred = 0;  ///< The number of visits to nodes above the threshold
+    int64_t m_num_reinsertions = 0;  ///< The number of times a stored state was reached with a lower g-cost
+    std::size_t m_max_fringe_size = 0;  ///< The largest size of the fringe list
+};
+
+template<class State_t, class Action_t, class Hash_t>
+void FringeSearch<State_t, Action_t, Hash_t>::setEngineParams(const FringeSearchParams& params) {
+    m_params = params;
+    SE::reset();
+}
+
+template<class State_t, class Action_t, class Hash_t>
+void FringeSearch<State_t, Action_t, Hash_t>::setHeuristic(NodeEvaluator<State_t, Action_t>& heuristic) {
+    m_heuristic = &heuristic;
+    m_heuristic->setNodeContainer(m_nodes);
+    SE::reset();
+}
+
+template<class State_t, class Action_t, class Hash_t>
+void FringeSearch<State_t, Action_t, Hash_t>::setHashFunction(const StateHashFunction<State_t, Hash_t>& hash) {
+    m_hash_func = &hash;
+    SE::reset();
+}
+
+template<class State_t, class Action_t, class Hash_t>
+bool FringeSearch<State_t, Action_t, Hash_t>::doCanRunSearch() const {
+    return m_heuristic != nullptr && m_hash_func != nullptr && m_hash_func->isPerfectHashFunction();
+}
+
+template<class State_t, class Action_t, class Hash_t>
+StringMap FringeSearch<State_t, Action_t, Hash_t>::getEngineSpecificStatistics() const {
+    StringMap stats = SE::getEngineSpecificStatistics();
+    stats["num_iterations"] = std::to_string(m_thresholds.size());
+    stats["num_expansions"] = std::to_string(m_num_expansions);
+    stats["num_deferred"] = std::to_string(m_num_deferred);
+    stats["num_reinsertions"] = std::to_string(m_num_reinsertions);
+    stats["max_fringe_size"] = std::to_string(m_max_fringe_size);
+    stats["num_stored_states"] = std::to_string(m_nodes.size());
+    stats["num_cells"] = std::to_string(m_cells.size());
+    stats["final_threshold"] = m_thresholds.empty() ? "none" : roundAndToString(m_thresholds.back(), 2);
+
+    return stats;
+}
+
+template<class State_t, class Action_t, class Hash_t>
+typename FringeSearch<State_t, Action_t, Hash_t>::FringeCell& FringeSearch<State_t, Action_t, Hash_t>::getCell(Hash_t hash) {
+    assert(hash != NO_CELL);
+    auto index = static_cast<std::size_t>(hash);
+    if (index >= m_cells.size()) {
+        m_cells.resize(std::max(index + 1, 2 * m_cells.size()));
+    }
+    return m_cells[index];
+}
+
+template<class State_t, class Action_t, class Hash_t>
+void FringeSearch<State_t, Action_t, Hash_t>::insertAfter(Hash_t hash, Hash_t after_hash) {
+    FringeCell& cell = m_cells[hash];
+    assert(!cell.m_in_fringe);
+
+    cell.m_prev = after_hash;
+    if (after_hash == NO_CELL) {
+        cell.m_next = m_fringe_head;
+        m_fringe_head = hash;
+    } else {
+        cell.m_next = m_cells[after_hash].m_next;
+        m_cells[after_hash].m_next = hash;
+    }
+    if (cell.m_next != NO_CELL) {
+        m_cells[cell.m_next].m_prev = hash;
+    }
+    cell.m_in_fringe = true;
+
+    m_fringe_size++;
+    m_max_fringe_size = std::max(m_max_fringe_size, m_fringe_size);
+}
+
+template<class State_t, class Action_t, class Hash_t>
+void FringeSearch<State_t, Action_t, Hash_t>::removeFromFringe(Hash_t hash) {
+    FringeCell& cell = m_cells[hash];
+    assert(cell.m_in_fringe);
+
+    if (cell.m_prev == NO_CELL) {
+        m_fringe_head = cell.m_next;
+    } else {
+        m_cells[cell.m_prev].m_next = cell.m_next;
+    }
+    if (cell.m_next != NO_CELL) {
+        m_cells[cell.m_next].m_prev = cell.m_prev;
+    }
+    cell.m_prev = NO_CELL;
+    cell.m_next = NO_CELL;
+    cell.m_in_fringe = false;
+
+    m_fringe_size--;
+}
+
+template<class State_t, class Action_t, class Hash_t>
+void FringeSearch<State_t, Action_t, Hash_t>::doSearchInitialization(const State_t& initial_state) {
+    if (m_cells.size() < m_params.m_num_cells) {
+        m_cells.resize(m_params.m_num_cells);
+    }
+
+    // Cells written in earlier searches become unused by moving to a new search ID
+    m_search_id++;
+    if (m_search_id == 0) {
+        std::fill(m_cells.begin(), m_cells.end(), FringeCell());
+        m_search_id = 1;
+    }
+
+    Hash_t init_hash = m_hash_func->getHashValue(initial_state);
+    FringeCell& init_cell = getCell(init_hash);
+    init_cell = FringeCell();
+    init_cell.m_search_id = m_search_id;
+    init_cell.m_node_id = m_nodes.addNode(initial_state);
+    SE::evaluateNode(init_cell.m_node_id);
+
+    m_threshold = m_heuristic->getCachedEval(init_cell.m_node_id);
+    m_next_threshold = std::numeric_limits<double>::infinity();
+    m_thresholds.push_back(m_threshold);
+
+    if (!m_heuristic->getCachedIsDeadEnd(init_cell.m_node_id)) {
+        insertAfter(init_hash, NO_CELL);
+    }
+    m_current = m_fringe_head;
+}
+
+template<class State_t, class Action_t, class Hash_t>
+EngineStatus FringeSearch<State_t, Action_t, Hash_t>::doSingleSearchStep() {
+    if (m_current == NO_CELL) {
+        // Every node left in the fringe is above the threshold, so the next iteration starts with the lowest of them
+        if (m_fringe_head == NO_CELL) {
+            return EngineStatus::search_completed;
+        }
+        assert(m_next_threshold < std::numeric_limits<double>::infinity());
+        m_threshold = m_next_threshold;
+        m_next_threshold = std::numeric_limits<double>::infinity();
+        m_thresholds.push_back(m_threshold);
+        m_current = m_fringe_head;
+        return EngineStatus::active;
+    }
+
+    Hash_t hash = m_current;
+    const FringeCell& cell = m_cells[hash];
+    double f_value = cell.m_g_value + m_heuristic->getCachedEval(cell.m_node_id);
+
+    if (fpGreater(f_value, m_threshold)) {
+        m_next_threshold = std::min(m_next_threshold, f_value);
+        m_num_deferred++;
+        m_current = cell.m_next;
+        return EngineStatus::active;
+    }
+
+    if (SE::isGoal(m_nodes.getState(cell.m_node_id))) {
+        SE::setIncumbentSolution(cell.m_node_id, m_nodes);
+        return EngineStatus::search_completed;
+    }
+
+    expandCell(hash);
+    return EngineStatus::active;
+}
+
+template<class State_t, class Action_t, class Hash_t>
+void FringeSearch<State_t, Action_t, Hash_t>::expandCell(Hash_t hash) {
+    m_num_expansions++;
+    NodeID parent_id = m_cells[hash].m_node_id;
+    const State_t parent_state = m_nodes.getState(parent_id);
+    double parent_g = m_cells[hash].m_g_value;
+
+    Hash_t insert_after = hash;
+    for (const Action_t& action : SE::getApplicableActions(parent_state)) {
+        double action_cost = SE::getActionCost(parent_state, action);
+        double child_g = parent_g + action_cost;
+        State_t child_state = SE::getChildState(parent_state, action);
+        Hash_t child_hash = m_hash_func->getHashValue(child_state);
+
+        // Growing the cells may move them, so no cell references are held across this call
+        FringeCell& child_cell = getCell(child_hash);
+
+        if (!isCellInUse(child_cell)) {
+            child_cell = FringeCell();
+            child_cell.m_search_id = m_search_id;
+            child_cell.m_g_value = child_g;
+            child_cell.m_node_id = m_nodes.addNode(child_state, parent_id, child_g, action, action_cost);
+            SE::evaluateNode(child_cell.m_node_id);
+        } else if (fpLess(child_g, child_cell.m_g_value)) {
+            m_num_reinsertions++;
+            child_cell.m_g_value = child_g;
+            m_nodes.setGValue(child_cell.m_node_id, child_g);
+            m_nodes.setParentID(child_cell.m_node_id, parent_id);
+            m_nodes.setLastAction(child_cell.m_node_id, action);
+            m_nodes.setLastActionCost(child_cell.m_node_id, action_cost);
+
+            if (child_cell.m_in_fringe) {
+                if (child_hash == insert_after) {
+                    insert_after = child_cell.m_prev;
+                }
+                removeFromFringe(child_hash);
+            }
+        } else {
+            continue;
+        }
+
+        if (!m_heuristic->getCachedIsDeadEnd(m_cells[child_hash].m_node_id)) {
+            insertAfter(child_hash, insert_after);
+            insert_after = child_hash;
+        }
+    }
+
+    // The children are now right after the expanded node, so they are visited next
+    m_current = m_cells[hash].m_next;
+    removeFromFringe(hash);
+}
+
+template<class State_t, class Action_t, class Hash_t>
+void FringeSearch<State_t, Action_t, Hash_t>::doReset() {
+    m_nodes.clear();
+    m_fringe_head = NO_CELL;
+    m_current = NO_CELL;
+    m_fringe_size = 0;
+    m_threshold = 0.0;
+    m_next_threshold = std::numeric_limits<double>::infinity();
+
+    m_thresholds.clear();
+    m_num_expansions = 0;
+    m_num_deferred = 0;
+    m_num_reinsertions = 0;
+    m_max_fringe_size = 0;
+}
+
+template<class State_t, class Action_t, class Hash_t>
+StringMap FringeSearch<State_t, Action_t, Hash_t>::getComponentSettings() const {
+    auto se_log = SE::getComponentSettings();
+    auto params_log = m_params.getParameterLog();
+
+    for (const auto& [key, value] : params_log) {
+        se_log[key] = value;
+    }
+
+    return se_log;
+}
+
+template<class State_t, class Action_t, class Hash_t>
+SearchSettingsMap FringeSearch<State_t, Action_t, Hash_t>::getSubComponentSettings() const {
+    SearchSettingsMap sub_components;
+
+    sub_components["heuristic"] = m_heuristic->getAllSettings();
+    sub_components["hash_function"] = m_hash_func->getAllSettings();
+
+    return sub_components;
+}
+
+#endif  //FRINGE_SEARCH_H_
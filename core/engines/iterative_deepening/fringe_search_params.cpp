@@ -0,0 +1,10 @@
+#include "fringe_search_params.h"
+
+#include <string>
+
+StringMap FringeSearchParams::getParameterLog() const {
+    StringMap params;
+
+    params["num_cells"] = std::to_string(m_num_cells);
+    return params;
+}
@@ -0,0 +1,19 @@
+#ifndef FRINGE_SEARCH_PARAMS_H_
+#define FRINGE_SEARCH_PARAMS_H_
+
+#include "logging/logging_terms.h"
+
+#include <cstddef>
+
+/**
+ * The parameters for a fringe search engine
+ */
+struct FringeSearchParams {
+    /**
+     * Returns a map containing the values of all the parameters
+     */
+    StringMap getParameterLog() const;
+
+    std::size_t m_num_cells = 0;  ///< The number of per-state cells to allocate before the first search. The cells grow on demand past this.
+};
+#endif  //FRINGE_SEARCH_PARAMS_H_
@@ -0,0 +1,528 @@
+#ifndef LSS_LRTA_STAR_H_
+#define LSS_LRTA_STAR_H_
+
+#include "building_tools/evaluators/single_goal_state_evaluator.h"
+#include "building_tools/hashing/state_hash_function.h"
+#include "engines/engine_components/node_containers/node_list.h"
+#include "engines/single_step_search_engine.h"
+#include "logging/logging_terms.h"
+#include "logging/search_component_settings.h"
+#include "lss_lrta_star_params.h"
+#include "search_basics/goal_test.h"
+#include "search_basics/node_container.h"
+#include "search_basics/node_evaluator.h"
+#include "search_basics/search_engine.h"
+#include "search_basics/transition_system.h"
+#include "utils/floating_point_utils.h"
+#include "utils/string_utils.h"
+#include "utils/timer.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <optional>
+#include <queue>
+#include <set>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/**
+ * A real-time search engine using LSS-LRTA* (Koenig and Sun, 2009), which commits to one action at a time after a
+ * bounded amount of search, and learns a heuristic that improves over repeated trials.
+ *
+ * To choose each move, an A* lookahead search is run from the agent's current state until it has expanded the given
+ * number of nodes, has run for the given time, or a goal is at the front of its open list. The heuristic values of the
+ * states it expanded are then raised with a Dijkstra search backward from the open list, so that each becomes the
+ * lowest cost of reaching a frontier state plus the frontier state's heuristic value. The agent takes the first action
+ * on the path to the frontier state with the lowest f-cost. With a lookahead of one expansion, this is LRTA*.
+ *
+ * The learned heuristic values are kept in a table keyed by state hash value, and are used instead of the heuristic for
+ * the states in it. The table is kept between calls to searchForPlan, so each call runs one more trial from the given
+ * start state. It is cleared when the goal changes, or when a component of the engine is set. The goal changes if the
+ * goal test is a SingleGoalStateEvaluator with a different goal state, or otherwise if it is a different object. If the
+ * heuristic is admissible and the goal can be reached from every state, repeated trials converge to an optimal path, at
+ * which point no heuristic value changes during a trial.
+ *
+ * The plan of a trial is the sequence of actions the agent took, so it can visit states more than once. Actions can
+ * also be taken one at a time with selectAction, by a caller that moves the agent itself.
+ *
+ * @tparam State_t The type of a state
+ * @tparam Action_t The type of an action
+ * @tparam Hash_t The hash type. Used to key the learned heuristic values.
+ * @class LssLrtaStar
+ */
+template<class State_t, class Action_t, class Hash_t>
+class LssLrtaStar : public SingleStepSearchEngine<State_t, Action_t> {
+    using SE = SingleStepSearchEngine<State_t, Action_t>;  // Allows succinct access to the protected members
+    using OpenEntry = std::tuple<double, double, NodeID>;  ///< The f-cost, heuristic value, and ID of an open node
+
+public:
+    /**
+     * Creates an LSS-LRTA* engine with the given parameters.
+     *
+     * @param params The struct containing the engines parameters
+     */
+    explicit LssLrtaStar(const LssLrtaStarParams& params)
+              : m_params(params) {}
+
+    /**
+     * Default destructor
+     */
+    virtual ~LssLrtaStar() = default;
+
+    /**
+     * Sets the heuristic, which is used for states without a learned heuristic value.
+     *
+     * @param heuristic The heuristic to use
+     */
+    void setHeuristic(NodeEvaluator<State_t, Action_t>& heuristic);
+
+    /**
+     * Sets the hash function used to key the learned heuristic values. The hash function must be perfect, since
+     * states are only identified by their hash values.
+     *
+     * @param hash The new hash function
+     */
+    void setHashFunction(const StateHashFunction<State_t, Hash_t>& hash);
+
+    /**
+     * Set the LSS-LRTA* params by input
+     *
+     * @param params The struct containing the engines parameters
+     */
+    void setEngineParams(const LssLrtaStarParams& params);
+
+    /**
+     * Runs a bounded lookahead search from the given state, learns from it, and returns the action to take. Assumes the
+     * transition system, goal test, heuristic, and hash function are set, and that the goal has not changed since the
+     * last trial. The time taken is recorded as a move latency.
+     *
+     * @param state The agent's current state
+     * @return The action to take, or std::nullopt if the state is a goal or no goal can be reached from it
+     */
+    std::optional<Action_t> selectAction(const State_t& state);
+
+    /**
+     * Discards all learned heuristic values and trial statistics.
+     */
+    void clearLearnedHeuristic();
+
+    /**
+     * Gets the learned heuristic value of the given state, if it has one.
+     *
+     * @param state The state
+     * @return The learned heuristic value, or std::nullopt if the state has none
+     */
+    std::optional<double> getLearnedHValue(const State_t& state) const;
+
+    /**
+     * Gets the number of states with a learned heuristic value.
+     *
+     * @return The size of the learned heuristic table
+     */
+    std::size_t getNumLearnedValues() const { return m_learned_h_values.size(); }
+
+    /**
+     * Gets the number of trials run since the learned heuristic values were last cleared.
+     *
+     * @return The number of trials
+     */
+    int64_t getNumTrials() const { return m_num_trials; }
+
+    /**
+     * Checks if the latest trial reached a goal without changing any heuristic value.
+     *
+     * @return If the learned heuristic has converged
+     */
+    bool hasConverged() const { return m_has_converged; }
+
+    /**
+     * Gets the time taken to choose each move since the latest trial started, in seconds.
+     *
+     * @return The move latencies
+     */
+    const std::vector<double>& getMoveLatencies() const { return m_move_latencies; }
+
+    // Overridden public SearchEngine methods
+    void setTransitionSystem(const TransitionSystem<State_t, Action_t>& trans_system) override;
+    StringMap getEngineSpecificStatistics() const override;
+    std::vector<NodeEvaluator<State_t, Action_t>*> getBaseEvaluators() const override { return {m_heuristic}; }
+
+    // Overidden public SettingsLogger methods
+    std::string getName() const override { return "LssLrtaStar"; }
+
+protected:
+    // Overridden SingleStepSearchEngine methods
+    void doSearchInitialization(const State_t& initial_state) override;
+    EngineStatus doSingleSearchStep() override;
+    bool doCanRunSearch() const override { return m_heuristic && m_hash_func && m_hash_func->isPerfectHashFunction(); }
+    void doReset() override;
+    StringMap getEngineParamsLog() const override { return m_params.getParameterLog(); }
+
+    // Overidden protected SettingsLogger methods
+    StringMap getComponentSettings() const override;
+    SearchSettingsMap getSubComponentSettings() const override;
+
+private:
+    /**
+     * Gets the ID of the lookahead node for the given state, adding and evaluating a node if the state has not been
+     * seen in the current lookahead. Dead ends have an infinite heuristic value.
+     *
+     * @param state The state
+     * @return The ID of the state's node
+     */
+    NodeID getLookaheadNodeID(const State_t& state);
+
+    /**
+     * Expands nodes in A* order from the root until the lookahead is used up, the open list is empty, or a goal is at
+     * the front of the open list.
+     *
+     * @param timer The timer started when the move began
+     */
+    void runLookahead(const Timer& timer);
+
+    /**
+     * Raises the heuristic values of the expanded nodes from the open nodes, and stores them in the learned table.
+     */
+    void learnHValues();
+
+    /**
+     * Gets the value at the given percentile of the move latencies, in microseconds.
+     *
+     * @param percentile The percentile, between 0 and 100
+     * @return The latency
+     */
+    double getLatencyPercentile(double percentile) const;
+
+    LssLrtaStarParams m_params;  ///< The params to set the engine
+    NodeEvaluator<State_t, Action_t>* m_heuristic = nullptr;  ///< The heuristic
+    const StateHashFunction<State_t, Hash_t>* m_hash_func = nullptr;  ///< The hash function
+
+    std::unordered_map<Hash_t, double> m_learned_h_values;  ///< The learned heuristic value of each state with one
+    std::optional<Hash_t> m_goal_hash = std::nullopt;  ///< The hash value of the goal state the values were learned for
+    const GoalTest<State_t>* m_learned_goal_test = nullptr;  ///< The goal test the values were learned for
+
+    NodeList<State_t, Action_t> m_nodes;  ///< The nodes of the current lookahead
+    std::unordered_map<Hash_t, NodeID> m_node_map;  ///< Maps the hash value of a state to its lookahead node
+    std::vector<double> m_h_values;  ///< The heuristic value of each lookahead node
+    std::vector<bool> m_is_closed;  ///< If each lookahead node has been expanded
+    std::vector<std::vector<std::pair<NodeID, double>>> m_predecessors;  ///< The parents of each node, and the action costs
+    std::set<OpenEntry> m_open;  ///< The open lookahead nodes, ordered by f-cost and then by heuristic value
+    std::optional<NodeID> m_goal_id = std::nullopt;  ///< The goal node at the front of the open list, if one was found
+
+    State_t m_current_state{};  ///< The agent's current state in the trial
+    std::vector<Action_t> m_trajectory;  ///< The actions taken in the trial
+    double m_trajectory_cost = 0.0;  ///< The cost of the actions taken in the trial
+
+    int64_t m_num_trials = 0;  ///< The number of trials since the learned values were cleared
+    bool m_has_converged = false;  ///< If the latest trial reached a goal without changing any heuristic value
+    int64_t m_num_h_updates = 0;  ///< The number of heuristic values raised in the latest trial
+    int64_t m_num_lookahead_expansions = 0;  ///< The number of nodes expanded by lookaheads in the latest trial
+    std::vector<double> m_move_latencies;  ///< The time taken to choose each move in the latest trial, in seconds
+};
+
+template<class State_t, class Action_t, class Hash_t>
+void LssLrtaStar<State_t, Action_t, Hash_t>::setHeuristic(NodeEvaluator<State_t, Action_t>& heuristic) {
+    m_heuristic = &heuristic;
+    m_heuristic->setNodeContainer(m_nodes);
+    clearLearnedHeuristic();
+    SE::reset();
+}
+
+template<class State_t, class Action_t, class Hash_t>
+void LssLrtaStar<State_t, Action_t, Hash_t>::setHashFunction(const StateHashFunction<State_t, Hash_t>& hash) {
+    m_hash_func = &hash;
+    clearLearnedHeuristic();
+    SE::reset();
+}
+
+template<class State_t, class Action_t, class Hash_t>
+void LssLrtaStar<State_t, Action_t, Hash_t>::setEngineParams(const LssLrtaStarParams& params) {
+    m_params = params;
+    SE::reset();
+}
+
+template<class State_t, class Action_t, class Hash_t>
+void LssLrtaStar<State_t, Action_t, Hash_t>::setTransitionSystem(const TransitionSystem<State_t, Action_t>& trans_system) {
+    clearLearnedHeuristic();
+    SE::setTransitionSystem(trans_system);
+}
+
+template<class State_t, class Action_t, class Hash_t>
+void LssLrtaStar<State_t, Action_t, Hash_t>::clearLearnedHeuristic() {
+    m_learned_h_values.clear();
+    m_goal_hash = std::nullopt;
+    m_learned_goal_test = nullptr;
+    m_num_trials = 0;
+    m_has_converged = false;
+}
+
+template<class State_t, class Action_t, class Hash_t>
+std::optional<double> LssLrtaStar<State_t, Action_t, Hash_t>::getLearnedHValue(const State_t& state) const {
+    auto value_iter = m_learned_h_values.find(m_hash_func->getHashValue(state));
+    if (value_iter == m_learned_h_values.end()) {
+        return std::nullopt;
+    }
+    return value_iter->second;
+}
+
+template<class State_t, class Action_t, class Hash_t>
+StringMap LssLrtaStar<State_t, Action_t, Hash_t>::getEngineSpecificStatistics() const {
+    StringMap stats = SE::getEngineSpecificStatistics();
+    stats["num_trials"] = std::to_string(m_num_trials);
+    stats["has_converged"] = boolToString(m_has_converged);
+    stats["num_moves"] = std::to_string(m_move_latencies.size());
+    stats["num_h_updates"] = std::to_string(m_num_h_updates);
+    stats["num_lookahead_expansions"] = std::to_string(m_num_lookahead_expansions);
+    stats["num_learned_values"] = std::to_string(m_learned_h_values.size());
+    stats["move_latency_microseconds_p50"] = std::to_string(getLatencyPercentile(50.0));
+    stats["move_latency_microseconds_p90"] = std::to_string(getLatencyPercentile(90.0));
+    stats["move_latency_microseconds_p99"] = std::to_string(getLatencyPercentile(99.0));
+    stats["move_latency_microseconds_max"] = std::to_string(getLatencyPercentile(100.0));
+
+    return stats;
+}
+
+template<class State_t, class Action_t, class Hash_t>
+void LssLrtaStar<State_t, Action_t, Hash_t>::doReset() {
+    // The learned heuristic values are kept so that the next trial can improve on them
+    m_trajectory.clear();
+    m_trajectory_cost = 0.0;
+    m_num_h_updates = 0;
+    m_num_lookahead_expansions = 0;
+    m_move_latencies.clear();
+}
+
+template<class State_t, class Action_t, class Hash_t>
+void LssLrtaStar<State_t, Action_t, Hash_t>::doSearchInitialization(const State_t& initial_state) {
+    const auto* single_goal = dynamic_cast<const SingleGoalStateEvaluator<State_t>*>(SE::getGoalTest());
+    std::optional<Hash_t> goal_hash = std::nullopt;
+    if (single_goal) {
+        goal_hash = m_hash_func->getHashValue(single_goal->getGoalState());
+    }
+    bool is_same_goal = single_goal ? goal_hash == m_goal_hash : SE::getGoalTest() == m_learned_goal_test;
+    if (m_num_trials > 0 && !is_same_goal) {
+        clearLearnedHeuristic();
+    }
+    m_goal_hash = goal_hash;
+    m_learned_goal_test = SE::getGoalTest();
+
+    m_num_trials++;
+    m_current_state = initial_state;
+}
+
+template<class State_t, class Action_t, class Hash_t>
+EngineStatus LssLrtaStar<State_t, Action_t, Hash_t>::doSingleSearchStep() {
+    if (SE::isGoal(m_current_state)) {
+        m_has_converged = m_num_h_updates == 0;
+        SE::setIncumbentSolution(m_trajectory, m_trajectory_cost);
+        return EngineStatus::search_completed;
+    }
+    if (static_cast<int64_t>(m_trajectory.size()) >= m_params.m_max_moves_per_trial) {
+        m_has_converged = false;
+        return EngineStatus::resource_limit_hit;
+    }
+
+    std::optional<Action_t> action = selectAction(m_current_state);
+    if (!action) {
+        m_has_converged = false;
+        return EngineStatus::search_completed;
+    }
+    m_trajectory.push_back(*action);
+    m_trajectory_cost += SE::getActionCost(m_current_state, *action);
+    SE::getTransitionSystem()->applyAction(m_current_state, *action);
+    return EngineStatus::active;
+}
+
+template<class State_t, class Action_t, class Hash_t>
+std::optional<Action_t> LssLrtaStar<State_t, Action_t, Hash_t>::selectAction(const State_t& state) {
+    assert(m_params.m_lookahead_expansions > 0);
+    Timer timer;
+    timer.startTimer();
+
+    m_nodes.clear();
+    m_node_map.clear();
+    m_h_values.clear();
+    m_is_closed.clear();
+    m_predecessors.clear();
+    m_open.clear();
+    m_goal_id = std::nullopt;
+
+    NodeID root_id = getLookaheadNodeID(state);
+    if (m_h_values[root_id] != std::numeric_limits<double>::infinity()) {
+        m_open.emplace(m_h_values[root_id], m_h_values[root_id], root_id);
+    }
+    runLookahead(timer);
+    learnHValues();
+
+    std::optional<Action_t> action = std::nullopt;
+    if (!m_open.empty() && m_goal_id != root_id) {
+        // Only the first action on the path to the best frontier node is taken
+        NodeID node_id = std::get<2>(*m_open.begin());
+        while (m_nodes.getParentID(node_id) != root_id) {
+            node_id = m_nodes.getParentID(node_id);
+        }
+        action = m_nodes.getLastAction(node_id);
+    }
+
+    timer.endTimer();
+    m_move_latencies.push_back(timer.getLastTimePeriodDuration());
+    return action;
+}
+
+template<class State_t, class Action_t, class Hash_t>
+NodeID LssLrtaStar<State_t, Action_t, Hash_t>::getLookaheadNodeID(const State_t& state) {
+    Hash_t hash = m_hash_func->getHashValue(state);
+    auto node_iter = m_node_map.find(hash);
+    if (node_iter != m_node_map.end()) {
+        return node_iter->second;
+    }
+
+    NodeID node_id = m_nodes.addNode(state);
+    m_node_map[hash] = node_id;
+    m_is_closed.push_back(false);
+    m_predecessors.emplace_back();
+
+    auto learned_iter = m_learned_h_values.find(hash);
+    if (learned_iter != m_learned_h_values.end()) {
+        m_h_values.push_back(learned_iter->second);
+    } else {
+        SE::evaluateNode({m_heuristic}, node_id);
+        m_h_values.push_back(m_heuristic->getCachedIsDeadEnd(node_id) ? std::numeric_limits<double>::infinity() :
+                                                                         m_heuristic->getCachedEval(node_id));
+    }
+    return node_id;
+}
+
+template<class State_t, class Action_t, class Hash_t>
+void LssLrtaStar<State_t, Action_t, Hash_t>::runLookahead(const Timer& timer) {
+    int64_t num_expansions = 0;
+    while (!m_open.empty()) {
+        NodeID node_id = std::get<2>(*m_open.begin());
+        if (SE::isGoal(m_nodes.getState(node_id))) {
+            m_goal_id = node_id;
+            return;
+        }
+        if (num_expansions >= m_params.m_lookahead_expansions ||
+                  (num_expansions > 0 && timer.getCurrentTimePeriodDuration() * 1e6 >= m_params.m_lookahead_microseconds)) {
+            return;
+        }
+
+        m_open.erase(m_open.begin());
+        m_is_closed[node_id] = true;
+        num_expansions++;
+        m_num_lookahead_expansions++;
+
+        const State_t state = m_nodes.getState(node_id);
+        double g_value = m_nodes.getGValue(node_id);
+        for (const Action_t& action : SE::getApplicableActions(state)) {
+            double action_cost = SE::getActionCost(state, action);
+            std::size_t num_nodes = m_nodes.size();
+            NodeID child_id = getLookaheadNodeID(SE::getChildState(state, action));
+            bool is_new = child_id == num_nodes;
+            if (m_h_values[child_id] == std::numeric_limits<double>::infinity()) {
+                continue;
+            }
+            m_predecessors[child_id].emplace_back(node_id, action_cost);
+
+            double child_g = g_value + action_cost;
+            if (child_id == 0 || (!is_new && child_g >= m_nodes.getGValue(child_id))) {
+                continue;
+            }
+            if (!is_new && !m_is_closed[child_id]) {
+                m_open.erase({m_nodes.getGValue(child_id) + m_h_values[child_id], m_h_values[child_id], child_id});
+            }
+            m_is_closed[child_id] = false;
+            m_nodes.setGValue(child_id, child_g);
+            m_nodes.setParentID(child_id, node_id);
+            m_nodes.setLastAction(child_id, action);
+            m_nodes.setLastActionCost(child_id, action_cost);
+            m_open.emplace(child_g + m_h_values[child_id], m_h_values[child_id], child_id);
+        }
+    }
+}
+
+template<class State_t, class Action_t, class Hash_t>
+void LssLrtaStar<State_t, Action_t, Hash_t>::learnHValues() {
+    using QueueEntry = std::pair<double, NodeID>;
+    std::priority_queue<QueueEntry, std::vector<QueueEntry>, std::greater<>> queue;
+    std::vector<double> old_h_values(m_h_values);
+
+    for (NodeID node_id = 0; node_id < m_nodes.size(); ++node_id) {
+        if (m_is_closed[node_id]) {
+            m_h_values[node_id] = std::numeric_limits<double>::infinity();
+        }
+    }
+    for (const auto& [f_value, h_value, node_id] : m_open) {
+        queue.emplace(h_value, node_id);
+    }
+
+    while (!queue.empty()) {
+        auto [h_value, node_id] = queue.top();
+        queue.pop();
+        if (h_value > m_h_values[node_id]) {
+            continue;
+        }
+        for (const auto& [pred_id, action_cost] : m_predecessors[node_id]) {
+            if (m_is_closed[pred_id] && action_cost + h_value < m_h_values[pred_id]) {
+                m_h_values[pred_id] = action_cost + h_value;
+                queue.emplace(m_h_values[pred_id], pred_id);
+            }
+        }
+    }
+
+    // Expanded states that cannot reach the frontier are dead ends, and keep an infinite value
+    for (NodeID node_id = 0; node_id < m_nodes.size(); ++node_id) {
+        if (m_is_closed[node_id]) {
+            // Values within floating point tolerance of the old value are not counted as changes
+            if (fpGreater(m_h_values[node_id], old_h_values[node_id])) {
+                m_num_h_updates++;
+            } else {
+                m_h_values[node_id] = old_h_values[node_id];
+            }
+            m_learned_h_values[m_hash_func->getHashValue(m_nodes.getState(node_id))] = m_h_values[node_id];
+        }
+    }
+}
+
+template<class State_t, class Action_t, class Hash_t>
+double LssLrtaStar<State_t, Action_t, Hash_t>::getLatencyPercentile(double percentile) const {
+    if (m_move_latencies.empty()) {
+        return 0.0;
+    }
+    std::vector<double> latencies(m_move_latencies);
+    std::sort(latencies.begin(), latencies.end());
+    auto rank = static_cast<std::size_t>(std::ceil(percentile / 100.0 * latencies.size()));
+    return latencies[std::clamp<std::size_t>(rank, 1, latencies.size()) - 1] * 1e6;
+}
+
+template<class State_t, class Action_t, class Hash_t>
+StringMap LssLrtaStar<State_t, Action_t, Hash_t>::getComponentSettings() const {
+    auto se_log = SE::getComponentSettings();
+    auto params_log = m_params.getParameterLog();
+
+    for (const auto& [key, value] : params_log) {
+        se_log[key] = value;
+    }
+
+    return se_log;
+}
+
+template<class State_t, class Action_t, class Hash_t>
+SearchSettingsMap LssLrtaStar<State_t, Action_t, Hash_t>::getSubComponentSettings() const {
+    SearchSettingsMap sub_components;
+
+    sub_components["heuristic"] = m_heuristic->getAllSettings();
+    sub_components["hash_function"] = m_hash_func->getAllSettings();
+
+    return sub_components;
+}
+
+#endif  //LSS_LRTA_STAR_H_
@@ -0,0 +1,12 @@
+#include "lss_lrta_star_params.h"
+
+#include <string>
+
+StringMap LssLrtaStarParams::getParameterLog() const {
+    StringMap params;
+
+    params["lookahead_expansions"] = std::to_string(m_lookahead_expansions);
+    params["lookahead_microseconds"] = std::to_string(m_lookahead_microseconds);
+    params["max_moves_per_trial"] = std::to_string(m_max_moves_per_trial);
+    return params;
+}
@@ -0,0 +1,25 @@
+#ifndef LSS_LRTA_STAR_PARAMS_H_
+#define LSS_LRTA_STAR_PARAMS_H_
+
+#include "logging/logging_terms.h"
+
+#include <cstdint>
+#include <limits>
+
+/**
+ * The parameters for an LSS-LRTA* engine
+ */
+struct LssLrtaStarParams {
+    /**
+     * Returns a map containing the values of all the parameters
+     *
+     * @return A map to stand for the log of the params
+     */
+    StringMap getParameterLog() const;
+
+    int64_t m_lookahead_expansions = 100;  ///< The most nodes expanded by the lookahead search for each move. Must be positive.
+    double m_lookahead_microseconds = std::numeric_limits<double>::infinity();  ///< The time after which the lookahead search stops expanding, checked after each expansion
+    int64_t m_max_moves_per_trial = std::numeric_limits<int64_t>::max();  ///< The most moves in a trial before it is abandoned
+};
+
+#endif  //LSS_LRTA_STAR_PARAMS_H_
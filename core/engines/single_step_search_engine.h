@@ -1,6 +1,7 @@
 #ifndef SINGLE_STEP_SEARCH_ENGINE_H_
 #define SINGLE_STEP_SEARCH_ENGINE_H_
 
+#include "building_tools/evaluators/evaluation_schedule.h"
 #include "experiment_running/search_resource_limits.h"
 #include "logging/logging_terms.h"
 #include "logging/standard_search_statistics.h"
@@ -143,6 +144,28 @@ protected:
      */
     State_t getChildState(const State_t& state, const Action_t& action);
 
+    /**
+     * Generates and returns the applicable actions in a state using the given transition system instead of the one set
+     * for the engine, such as when searching backward from the goal. Also updates the count of getAction calls and
+     * number of actions generated.
+     *
+     * @param transitions The transition system to use
+     * @param state The state to generate actions in
+     * @return The list of actions applicable in the current state.
+     */
+    std::vector<Action_t> getApplicableActions(const TransitionSystem<State_t, Action_t>& transitions, const State_t& state);
+
+    /**
+     * Gets the child state of a given state and action pair using the given transition system instead of the one set
+     * for the engine, and updates the number of states generated.
+     *
+     * @param transitions The transition system to use
+     * @param state The parent state
+     * @param action The action to apply
+     * @return The child state
+     */
+    State_t getChildState(const TransitionSystem<State_t, Action_t>& transitions, const State_t& state, const Action_t& action);
+
     /**
      * Checks if the next action is the inverse of last action in the given state.
      *
@@ -164,6 +187,13 @@ protected:
      */
     double getActionCost(const State_t& state, const Action_t& action) const { return m_transition_system->getActionCost(state, action); }
 
+    /**
+     * Gets the time since the current search was initialized.
+     *
+     * @return The time elapsed in the current search, in seconds
+     */
+    double getCurrentSearchTime() const { return m_timer.getCurrentTimePeriodDuration(); }
+
     /**
      * Sets the incumbent solution to the given plan and cost. Assumes cost is correct for the given plan.
      *
@@ -192,24 +222,57 @@ protected:
     virtual bool hasHitResourceLimit() const;
 
     /**
-     * Extracts the full list of evaluators from the base evaluators and assigns IDs to all of them.
+     * Checks if the resource limit has been hit, counting evaluations that have been queued for a later batch as if they
+     * had already been performed.
+     *
+     * @param num_pending_evals The number of node evaluations queued but not yet performed
+     * @return If the resource limit has been hit.
+     */
+    bool hasHitResourceLimitWithPendingEvals(int64_t num_pending_evals) const;
+
+    /**
+     * Extracts the full list of evaluators from the base evaluators and compiles them into the evaluation schedule.
      */
     void initializeAllEvaluators();
 
+    /**
+     * Gets the compiled schedule of all evaluators used by the engine.
+     *
+     * @return The evaluation schedule
+     */
+    const EvaluationSchedule<State_t, Action_t>& getEvaluationSchedule() const { return m_evaluation_schedule; }
+
     /**
       * Evaluates the node corresponding to the given ID using all of the provided evaluators.
       *
       * @param evaluators The set of evaluators to use
       * @param to_evaluate The ID of the node to evaluate
       */
-    void evaluateNode(std::vector<NodeEvaluator<State_t, Action_t>*> evaluators, NodeID to_evaluate);
+    void evaluateNode(const std::vector<NodeEvaluator<State_t, Action_t>*>& evaluators, NodeID to_evaluate);
 
     /**
-      * Evaluates the node corresponding to the given ID using all of the provided evaluators.
+      * Evaluates the node corresponding to the given ID using the evaluation schedule of all evaluators.
       *
       * @param to_evaluate The ID of the node to evaluate
       */
-    void evaluateNode(NodeID to_evaluate) { evaluateNode(m_evaluators, to_evaluate); }
+    void evaluateNode(NodeID to_evaluate);
+
+    /**
+     * Evaluates all of the nodes corresponding to the given IDs using all of the provided evaluators. The evaluators
+     * are prepared once and then each processes the whole batch, so that the children of an expansion can be
+     * evaluated together. Counts as one evaluation per node.
+     *
+     * @param evaluators The set of evaluators to use, ordered such that sub-evaluators appear before their users
+     * @param to_evaluate The IDs of the nodes to evaluate
+     */
+    void evaluateNodes(const std::vector<NodeEvaluator<State_t, Action_t>*>& evaluators, const std::vector<NodeID>& to_evaluate);
+
+    /**
+     * Evaluates all of the nodes corresponding to the given IDs using the evaluation schedule of all evaluators.
+     *
+     * @param to_evaluate The IDs of the nodes to evaluate
+     */
+    void evaluateNodes(const std::vector<NodeID>& to_evaluate);
 
     /**
      * Re-evaluates the node corresponding to the given ID using all of the provided evaluators. Thus, previous computations may be reused as
@@ -218,14 +281,14 @@ protected:
      * @param evaluators The set of evaluators to use
      * @param to_evaluate The ID of the node to evaluate
      */
-    void reEvaluateNode(std::vector<NodeEvaluator<State_t, Action_t>*> evaluators, NodeID to_evaluate);
+    void reEvaluateNode(const std::vector<NodeEvaluator<State_t, Action_t>*>& evaluators, NodeID to_evaluate);
 
     /**
      * Re-evaluates the node corresponding to the given ID using all evaluators. Thus, previous computations may be reused as applicable.
      *
      * @param to_evaluate The ID of the node to evaluate
      */
-    void reEvaluateNode(NodeID to_evaluate) { reEvaluateNode(m_evaluators, to_evaluate); }
+    void reEvaluateNode(NodeID to_evaluate) { reEvaluateNode(m_evaluation_schedule.getEvaluators(), to_evaluate); }
 
     // Overidden SettingsLogger methods
     StringMap getComponentSettings() const override;
@@ -238,7 +301,7 @@ private:
 
     EngineStatus m_status = EngineStatus::not_ready;  ///< The current search status
 
-    std::vector<NodeEvaluator<State_t, Action_t>*> m_evaluators;  ///< The list of all evaluators
+    EvaluationSchedule<State_t, Action_t> m_evaluation_schedule;  ///< The compiled schedule of all evaluators
     const TransitionSystem<State_t, Action_t>* m_transition_system = nullptr;  ///< The transition system
     const GoalTest<State_t>* m_goal_test = nullptr;  ///< The goal test function
 
@@ -266,7 +329,7 @@ void SingleStepSearchEngine<State_t, Action_t>::reset() {
     m_num_search_steps = 0;
     m_search_stats.reset();
 
-    for (auto eval : m_evaluators) {
+    for (auto eval : m_evaluation_schedule.getEvaluators()) {
         eval->reset();
     }
 
@@ -385,17 +448,29 @@ bool SingleStepSearchEngine<State_t, Action_t>::isGoal(const State_t& state) {
 
 template<class State_t, class Action_t>
 std::vector<Action_t> SingleStepSearchEngine<State_t, Action_t>::getApplicableActions(const State_t& state) {
+    return getApplicableActions(*m_transition_system, state);
+}
+
+template<class State_t, class Action_t>
+State_t SingleStepSearchEngine<State_t, Action_t>::getChildState(const State_t& state, const Action_t& action) {
+    return getChildState(*m_transition_system, state, action);
+}
+
+template<class State_t, class Action_t>
+std::vector<Action_t> SingleStepSearchEngine<State_t, Action_t>::getApplicableActions(
+          const TransitionSystem<State_t, Action_t>& transitions, const State_t& state) {
     m_search_stats.m_num_get_actions_calls += 1;
 
-    std::vector<Action_t> actions = m_transition_system->getActions(state);
+    std::vector<Action_t> actions = transitions.getActions(state);
     m_search_stats.m_num_actions_generated += actions.size();
     return actions;
 }
 
 template<class State_t, class Action_t>
-State_t SingleStepSearchEngine<State_t, Action_t>::getChildState(const State_t& state, const Action_t& action) {
+State_t SingleStepSearchEngine<State_t, Action_t>::getChildState(const TransitionSystem<State_t, Action_t>& transitions,
+          const State_t& state, const Action_t& action) {
     m_search_stats.m_num_states_generated++;
-    return m_transition_system->getChildState(state, action);
+    return transitions.getChildState(state, action);
 }
 
 template<class State_t, class Action_t>
@@ -408,6 +483,17 @@ bool SingleStepSearchEngine<State_t, Action_t>::hasHitResourceLimit() const {
            m_resource_limits.hasHitTimeLimit(m_timer);
 }
 
+template<class State_t, class Action_t>
+bool SingleStepSearchEngine<State_t, Action_t>::hasHitResourceLimitWithPendingEvals(int64_t num_pending_evals) const {
+    if (num_pending_evals == 0) {
+        return hasHitResourceLimit();
+    }
+
+    StandardSearchStatistics stats_with_pending = m_search_stats;
+    stats_with_pending.m_num_evals += num_pending_evals;
+    return hasHitResourceLimit() || m_resource_limits.hasHitNumEvalLimit(stats_with_pending);
+}
+
 template<class State_t, class Action_t>
 StringMap SingleStepSearchEngine<State_t, Action_t>::getComponentSettings() const {
     StringMap log = getEngineParamsLog();
@@ -419,15 +505,27 @@ StringMap SingleStepSearchEngine<State_t, Action_t>::getComponentSettings() cons
 template<class State_t, class Action_t>
 void SingleStepSearchEngine<State_t, Action_t>::initializeAllEvaluators() {
     auto base_evals = getBaseEvaluators();
-    m_evaluators = getAllEvaluators(base_evals);
-
-    for (int i = 0; i < static_cast<int>(m_evaluators.size()); i++) {
-        m_evaluators[i]->reset();
+    for (auto* eval : getAllEvaluators(base_evals)) {
+        eval->reset();
     }
+
+    m_evaluation_schedule.compile(base_evals);
 }
 
 template<class State_t, class Action_t>
-void SingleStepSearchEngine<State_t, Action_t>::evaluateNode(std::vector<NodeEvaluator<State_t, Action_t>*> evaluators, NodeID to_evaluate) {
+void SingleStepSearchEngine<State_t, Action_t>::evaluateNode(NodeID to_evaluate) {
+    m_search_stats.m_num_evals++;
+    m_evaluation_schedule.evaluate(to_evaluate);
+}
+
+template<class State_t, class Action_t>
+void SingleStepSearchEngine<State_t, Action_t>::evaluateNodes(const std::vector<NodeID>& to_evaluate) {
+    m_search_stats.m_num_evals += static_cast<int64_t>(to_evaluate.size());
+    m_evaluation_schedule.evaluateBatch(to_evaluate);
+}
+
+template<class State_t, class Action_t>
+void SingleStepSearchEngine<State_t, Action_t>::evaluateNode(const std::vector<NodeEvaluator<State_t, Action_t>*>& evaluators, NodeID to_evaluate) {
     m_search_stats.m_num_evals++;
     for (auto eval : evaluators) {
         eval->prepareToEvaluate();
@@ -439,7 +537,23 @@ void SingleStepSearchEngine<State_t, Action_t>::evaluateNode(std::vector<NodeEva
 }
 
 template<class State_t, class Action_t>
-void SingleStepSearchEngine<State_t, Action_t>::reEvaluateNode(std::vector<NodeEvaluator<State_t, Action_t>*> evaluators, NodeID to_evaluate) {
+void SingleStepSearchEngine<State_t, Action_t>::evaluateNodes(const std::vector<NodeEvaluator<State_t, Action_t>*>& evaluators, const std::vector<NodeID>& to_evaluate) {
+    if (to_evaluate.empty()) {
+        return;
+    }
+
+    m_search_stats.m_num_evals += static_cast<int64_t>(to_evaluate.size());
+    for (auto eval : evaluators) {
+        eval->prepareToEvaluate();
+    }
+
+    for (auto eval : evaluators) {
+        eval->evaluateBatch(to_evaluate);
+    }
+}
+
+template<class State_t, class Action_t>
+void SingleStepSearchEngine<State_t, Action_t>::reEvaluateNode(const std::vector<NodeEvaluator<State_t, Action_t>*>& evaluators, NodeID to_evaluate) {
     m_search_stats.m_num_evals++;
     for (auto eval : evaluators) {
         eval->prepareToEvaluate();
@@ -10,12 +10,19 @@
 #include <algorithm>
 #include <cassert>
 #include <cstdlib>
+#include <memory>
+#include <optional>
+#include <vector>
 
 BurntGapHeuristic::BurntGapHeuristic(PancakePuzzleCostType cost_type)
           : m_cost_type(cost_type) {
 }
 
 void BurntGapHeuristic::doEvaluateAndCache(NodeID to_evaluate) {
+    if (m_use_incremental_evaluation && evaluateIncrementally(to_evaluate)) {
+        return;
+    }
+
     const BurntPancakeState& state = getNodeContainer()->getState(to_evaluate);
     double num_gaps = 0.0;
     double total_cost = 0.0;
@@ -45,22 +52,60 @@ void BurntGapHeuristic::doEvaluateAndCache(NodeID to_evaluate) {
     }
 }
 
+bool BurntGapHeuristic::evaluateIncrementally(NodeID to_evaluate) {
+    const auto* nodes = getNodeContainer();
+    const std::optional<NumToFlip>& last_action = nodes->getLastAction(to_evaluate);
+    NodeID parent_id = nodes->getParentID(to_evaluate);
+
+    if (!last_action.has_value() || parent_id == to_evaluate || !hasCachedValue(parent_id)) {
+        return false;
+    }
+
+    const std::vector<int>& perm = nodes->getState(to_evaluate).m_permutation;
+    auto num_pancakes = static_cast<int>(perm.size());
+    int flip = *last_action;
+    assert(flip >= 1 && flip <= num_pancakes);
+
+    // Flipping reverses and negates the top pancakes, which keeps the gaps between them. Only the pair at the bottom
+    // of the flip changes, where the parent's top pancake was before it was negated
+    int old_above = -perm[0];
+    int new_above = perm[flip - 1];
+    int below = (flip < num_pancakes) ? perm[flip] : num_pancakes + 1;
+
+    double gap_change = 0.0;
+    double cost_change = 0.0;
+    if (abs(old_above - below) > 1) {
+        gap_change -= 1.0;
+        cost_change -= std::min(abs(old_above), abs(below));
+    }
+    if (abs(new_above - below) > 1) {
+        gap_change += 1.0;
+        cost_change += std::min(abs(new_above), abs(below));
+    }
+
+    double h_change = (m_cost_type == PancakePuzzleCostType::heavy) ? cost_change : gap_change;
+    setCachedDistanceToGoEval(to_evaluate, getCachedDistanceToGoEval(parent_id) + gap_change);
+    setCachedValues(to_evaluate, getCachedEval(parent_id) + h_change, false);
+    return true;
+}
+
+void BurntGapHeuristic::bindEvaluationStore(const std::shared_ptr<EvaluationStore>& store) {
+    NodeEvaluatorWithCache<BurntPancakeState, NumToFlip>::bindEvaluationStore(store);
+    m_distance_to_go_evals.bindToStore(store, getEvaluationStorageType());
+}
+
 double BurntGapHeuristic::getCachedDistanceToGoEval(NodeID node_id) const {
-    assert(node_id < m_distance_to_go_evals.size());
-    return m_distance_to_go_evals[node_id];
+    return m_distance_to_go_evals.getEvaluation(node_id);
 }
 
 void BurntGapHeuristic::setCachedDistanceToGoEval(NodeID node_id, double eval) {
-    if (node_id >= m_distance_to_go_evals.size()) {
-        m_distance_to_go_evals.resize(node_id + 1, 0.0);
-    }
-    m_distance_to_go_evals[node_id] = eval;
+    m_distance_to_go_evals.setEvaluation(node_id, eval);
 }
 
 double BurntGapHeuristic::getLastDistanceToGoEval() const {
     assert(isEvalComputed());
 
-    return m_distance_to_go_evals[getIDofLastEvaluatedNode()];
+    return m_distance_to_go_evals.getEvaluation(getIDofLastEvaluatedNode());
 }
 
 StringMap BurntGapHeuristic::getComponentSettings() const {
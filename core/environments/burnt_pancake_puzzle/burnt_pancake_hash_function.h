@@ -1,9 +1,20 @@
 #ifndef BURNT_PANCAKE_HASH_FUNCTION_H_
 #define BURNT_PANCAKE_HASH_FUNCTION_H_
 
-#include "building_tools/hashing/permutation_hash_function.h"
+#include "building_tools/hashing/large_permutation_hash_function.h"
+#include "building_tools/hashing/signed_permutation_hash_function.h"
 #include "burnt_pancake_state.h"
 
-using BurntPancakeHashFunction = PermutationHashFunction<BurntPancakeState>;
+/**
+ * The perfect hash function for burnt pancake puzzles of up to 16 pancakes. The rank of a burnt pancake state has
+ * 2^n * n! values, which no longer fits in 64 bits for 17 pancakes.
+ */
+using BurntPancakeHashFunction = SignedPermutationHashFunction<BurntPancakeState>;
+
+/**
+ * The perfect hash function for burnt pancake puzzles of up to 28 pancakes, which ranks states into 128 bits. Gives the
+ * same ranks as BurntPancakeHashFunction for up to 16 pancakes.
+ */
+using LargeBurntPancakeHashFunction = LargeSignedPermutationHashFunction<BurntPancakeState>;
 
 #endif  //BURNT_PANCAKE_HASH_FUNCTION_H_
@@ -19,4 +19,8 @@ bool operator==(const BurntPancakeState& state1, const BurntPancakeState& state2
 
 bool operator!=(const BurntPancakeState& state1, const BurntPancakeState& state2) {
     return !(state1 == state2);
-}
\ No newline at end of file
+}
+
+void serialize(ByteSink& sink, const BurntPancakeState& state) {
+    sink.writeVector(state.m_permutation);
+}
@@ -4,6 +4,8 @@
 #include <iostream>
 #include <vector>
 
+#include "utils/byte_sink.h"
+
 using BurntPancake = int;
 
 /**
@@ -29,6 +31,8 @@ public:
     explicit BurntPancakeState(const std::vector<BurntPancake>& permutation);
 
     std::vector<BurntPancake> m_permutation;  ///< The permutation representation of the state.
+
+    static constexpr bool IS_PERMUTATION_ONLY = true;  ///< The state is fully described by its permutation, so permutation hash functions can recover it
 };
 
 /**
@@ -59,4 +63,12 @@ bool operator==(const BurntPancakeState& state1, const BurntPancakeState& state2
  */
 bool operator!=(const BurntPancakeState& state1, const BurntPancakeState& state2);
 
+/**
+ * Writes the burnt pancake puzzle state to the given byte sink.
+ *
+ * @param sink The byte sink to write to.
+ * @param state The state to write.
+ */
+void serialize(ByteSink& sink, const BurntPancakeState& state);
+
 #endif /* BURNT_PANCAKE_STATE_H_ */
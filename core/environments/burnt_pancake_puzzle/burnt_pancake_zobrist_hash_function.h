@@ -0,0 +1,55 @@
+#ifndef BURNT_PANCAKE_ZOBRIST_HASH_FUNCTION_H_
+#define BURNT_PANCAKE_ZOBRIST_HASH_FUNCTION_H_
+
+#include "building_tools/hashing/zobrist_hash_function.h"
+#include "burnt_pancake_state.h"
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/**
+ * A Zobrist hash function for the burnt pancake puzzle. A flip only changes the positions and burnt sides of the
+ * flipped pancakes, so the hash value of a child is found from that of its parent in time proportional to the number of
+ * pancakes flipped.
+ *
+ * @tparam Hash_t The hash value type, which is either an unsigned integer type or Hash128
+ * @class BurntPancakeZobristHashFunction
+ */
+template<class Hash_t = uint64_t>
+class BurntPancakeZobristHashFunction : public ZobristHashFunction<BurntPancakeState, int, Hash_t> {
+public:
+    inline static const std::string CLASS_NAME = "BurntPancakeZobristHashFunction";  ///< The name of the class. Defines this component's name
+
+    /**
+     * Creates a Zobrist hash function for stacks of the given number of burnt pancakes.
+     *
+     * @param num_pancakes The number of pancakes in the stack
+     * @param seed The seed used to generate the random keys
+     */
+    explicit BurntPancakeZobristHashFunction(int num_pancakes, uint64_t seed = 0)
+              : ZobristHashFunction<BurntPancakeState, int, Hash_t>(static_cast<std::size_t>(num_pancakes), -num_pancakes,
+                          num_pancakes, seed) {}
+
+    Hash_t getChildHash(Hash_t parent_hash, const BurntPancakeState& parent_state, const int& action) const override;
+
+    // Overriden public SettingsLogger methods
+    std::string getName() const override { return CLASS_NAME; }
+};
+
+template<class Hash_t>
+Hash_t BurntPancakeZobristHashFunction<Hash_t>::getChildHash(Hash_t parent_hash, const BurntPancakeState& parent_state,
+          const int& action) const {
+    assert(action >= 0 && static_cast<std::size_t>(action) <= parent_state.m_permutation.size());
+    auto num_to_flip = static_cast<std::size_t>(action);
+
+    for (std::size_t pos = 0; pos < num_to_flip; ++pos) {
+        BurntPancake pancake = parent_state.m_permutation[pos];
+        parent_hash ^= this->getKey(pos, pancake);
+        parent_hash ^= this->getKey(num_to_flip - 1 - pos, -pancake);
+    }
+    return parent_hash;
+}
+
+#endif  //BURNT_PANCAKE_ZOBRIST_HASH_FUNCTION_H_
@@ -0,0 +1,412 @@
+#include "contraction_hierarchy.h"
+#include "graph.h"
+#include "utils/io_utils.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <queue>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace {
+    constexpr uint64_t FILE_MARKER = 0x31484352544E4F43;  ///< Written at the start of saved hierarchies ("CONTRCH1")
+
+    using ArcID = ContractionHierarchy::ArcID;
+    using Arc = ContractionHierarchy::Arc;
+
+    /**
+     * A neighbour of a vertex in the remaining graph, and the arc that joins them.
+     */
+    struct Neighbour {
+        VertexID m_vertex_id;  ///< The neighbouring vertex
+        ArcID m_arc_id;  ///< The arc between the vertices
+    };
+
+    /**
+     * A shortcut that contracting a vertex would add.
+     */
+    struct Shortcut {
+        VertexID m_from_vertex_id;  ///< The in-neighbour of the contracted vertex
+        VertexID m_to_vertex_id;  ///< The out-neighbour of the contracted vertex
+        double m_cost;  ///< The cost of the path through the contracted vertex
+        ArcID m_first_arc;  ///< The arc into the contracted vertex
+        ArcID m_second_arc;  ///< The arc out of the contracted vertex
+    };
+
+    /**
+     * The vertices that have not been contracted yet, and the arcs between them.
+     */
+    struct RemainingGraph {
+        explicit RemainingGraph(std::size_t num_vertices)
+                  : m_out(num_vertices), m_in(num_vertices), m_contracted_neighbours(num_vertices, 0) {}
+
+        std::vector<std::vector<Neighbour>> m_out;  ///< The out-neighbours of each vertex
+        std::vector<std::vector<Neighbour>> m_in;  ///< The in-neighbours of each vertex
+        std::vector<int64_t> m_contracted_neighbours;  ///< The number of neighbours of each vertex already contracted
+    };
+
+    /**
+     * Adds the given arc between two remaining vertices, unless there is already an arc between them that is no more
+     * costly. A more costly arc is replaced.
+     */
+    void addArc(RemainingGraph& graph, std::vector<Arc>& arcs, const Arc& arc) {
+        for (Neighbour& neighbour : graph.m_out[arc.m_from_vertex_id]) {
+            if (neighbour.m_vertex_id != arc.m_to_vertex_id) {
+                continue;
+            }
+            if (arcs[neighbour.m_arc_id].m_cost <= arc.m_cost) {
+                return;
+            }
+            ArcID old_arc_id = neighbour.m_arc_id;
+            neighbour.m_arc_id = static_cast<ArcID>(arcs.size());
+            for (Neighbour& in_neighbour : graph.m_in[arc.m_to_vertex_id]) {
+                if (in_neighbour.m_arc_id == old_arc_id) {
+                    in_neighbour.m_arc_id = neighbour.m_arc_id;
+                }
+            }
+            arcs.push_back(arc);
+            return;
+        }
+
+        assert(arcs.size() < ContractionHierarchy::NO_ARC);
+        graph.m_out[arc.m_from_vertex_id].push_back({arc.m_to_vertex_id, static_cast<ArcID>(arcs.size())});
+        graph.m_in[arc.m_to_vertex_id].push_back({arc.m_from_vertex_id, static_cast<ArcID>(arcs.size())});
+        arcs.push_back(arc);
+    }
+
+    /**
+     * Finds the shortcuts needed to contract a vertex. Each thread needs its own, since the search data is kept between
+     * searches so it only has to be cleared where it was used.
+     */
+    class WitnessSearch {
+    public:
+        explicit WitnessSearch(std::size_t num_vertices)
+                  : m_distances(num_vertices, std::numeric_limits<double>::infinity()), m_is_target(num_vertices, false) {}
+
+        /**
+         * Finds the shortcuts that contracting the given vertex would add to the remaining graph.
+         */
+        void findShortcuts(const RemainingGraph& graph, const std::vector<Arc>& arcs, VertexID vertex_id,
+                  int64_t max_settled, std::vector<Shortcut>& shortcuts) {
+            shortcuts.clear();
+            for (const Neighbour& in_neighbour : graph.m_in[vertex_id]) {
+                double in_cost = arcs[in_neighbour.m_arc_id].m_cost;
+                double max_distance = -1.0;
+                for (const Neighbour& out_neighbour : graph.m_out[vertex_id]) {
+                    if (out_neighbour.m_vertex_id != in_neighbour.m_vertex_id) {
+                        max_distance = std::max(max_distance, in_cost + arcs[out_neighbour.m_arc_id].m_cost);
+                    }
+                }
+                if (max_distance < 0.0) {
+                    continue;
+                }
+
+                int64_t num_targets = 0;
+                for (const Neighbour& out_neighbour : graph.m_out[vertex_id]) {
+                    if (out_neighbour.m_vertex_id != in_neighbour.m_vertex_id && !m_is_target[out_neighbour.m_vertex_id]) {
+                        m_is_target[out_neighbour.m_vertex_id] = true;
+                        num_targets++;
+                    }
+                }
+                search(graph, arcs, in_neighbour.m_vertex_id, vertex_id, max_distance, max_settled, num_targets);
+                for (const Neighbour& out_neighbour : graph.m_out[vertex_id]) {
+                    double via_cost = in_cost + arcs[out_neighbour.m_arc_id].m_cost;
+                    if (out_neighbour.m_vertex_id != in_neighbour.m_vertex_id &&
+                              m_distances[out_neighbour.m_vertex_id] > via_cost) {
+                        shortcuts.push_back({in_neighbour.m_vertex_id, out_neighbour.m_vertex_id, via_cost,
+                                  in_neighbour.m_arc_id, out_neighbour.m_arc_id});
+                    }
+                    m_is_target[out_neighbour.m_vertex_id] = false;
+                }
+                clearDistances();
+            }
+        }
+
+    private:
+        using QueueEntry = std::pair<double, VertexID>;  ///< A distance and the vertex it was found for
+
+        /**
+         * Runs Dijkstra's algorithm from the source without passing through the excluded vertex, until the given
+         * distance is passed, the given number of vertices are settled, or all of the targets are settled.
+         */
+        void search(const RemainingGraph& graph, const std::vector<Arc>& arcs, VertexID source, VertexID excluded,
+                  double max_distance, int64_t max_settled, int64_t num_targets) {
+            m_distances[source] = 0.0;
+            m_reached.push_back(source);
+            m_queue.emplace(0.0, source);
+
+            int64_t num_settled = 0;
+            while (!m_queue.empty()) {
+                auto [distance, vertex_id] = m_queue.top();
+                m_queue.pop();
+                if (distance > m_distances[vertex_id]) {
+                    continue;
+                }
+                if (distance > max_distance || num_settled++ >= max_settled) {
+                    break;
+                }
+                if (m_is_target[vertex_id] && --num_targets == 0) {
+                    break;
+                }
+
+                for (const Neighbour& neighbour : graph.m_out[vertex_id]) {
+                    double new_distance = distance + arcs[neighbour.m_arc_id].m_cost;
+                    if (neighbour.m_vertex_id != excluded && new_distance < m_distances[neighbour.m_vertex_id]) {
+                        if (m_distances[neighbour.m_vertex_id] == std::numeric_limits<double>::infinity()) {
+                            m_reached.push_back(neighbour.m_vertex_id);
+                        }
+                        m_distances[neighbour.m_vertex_id] = new_distance;
+                        m_queue.emplace(new_distance, neighbour.m_vertex_id);
+                    }
+                }
+            }
+        }
+
+        /**
+         * Resets the distances of the vertices reached by the last search.
+         */
+        void clearDistances() {
+            for (VertexID vertex_id : m_reached) {
+                m_distances[vertex_id] = std::numeric_limits<double>::infinity();
+            }
+            m_reached.clear();
+            m_queue = {};
+        }
+
+        std::vector<double> m_distances;  ///< The distance to each vertex, or infinity if not reached
+        std::vector<bool> m_is_target;  ///< Whether each vertex is an out-neighbour the current search needs a distance to
+        std::vector<VertexID> m_reached;  ///< The vertices reached by the current search
+        std::priority_queue<QueueEntry, std::vector<QueueEntry>, std::greater<>> m_queue;  ///< The open vertices
+    };
+
+    /**
+     * Gets the priority of contracting the given vertex, and the shortcuts it would add.
+     */
+    int64_t computePriority(const RemainingGraph& graph, const std::vector<Arc>& arcs, VertexID vertex_id,
+              int64_t max_witness_settled, WitnessSearch& witness_search, std::vector<Shortcut>& shortcuts) {
+        witness_search.findShortcuts(graph, arcs, vertex_id, max_witness_settled, shortcuts);
+        auto num_removed = static_cast<int64_t>(graph.m_out[vertex_id].size() + graph.m_in[vertex_id].size());
+        return static_cast<int64_t>(shortcuts.size()) - num_removed + graph.m_contracted_neighbours[vertex_id];
+    }
+
+    /**
+     * Removes the given vertex from the given neighbour list.
+     */
+    void removeNeighbour(std::vector<Neighbour>& neighbours, VertexID vertex_id) {
+        neighbours.erase(std::remove_if(neighbours.begin(), neighbours.end(),
+                                   [vertex_id](const Neighbour& neighbour) { return neighbour.m_vertex_id == vertex_id; }),
+                  neighbours.end());
+    }
+
+    /**
+     * Lays out the given per-vertex arc lists as offsets into a single list.
+     */
+    void flattenArcLists(const std::vector<std::vector<ArcID>>& arc_lists, std::vector<uint64_t>& offsets,
+              std::vector<ArcID>& arcs) {
+        offsets.assign(1, 0);
+        for (const auto& arc_list : arc_lists) {
+            arcs.insert(arcs.end(), arc_list.begin(), arc_list.end());
+            offsets.push_back(arcs.size());
+        }
+    }
+}  // namespace
+
+ContractionHierarchy::ContractionHierarchy(const Graph& graph)
+          : m_graph(&graph) {}
+
+void ContractionHierarchy::build(unsigned num_threads, int64_t max_witness_settled) {
+    assert(num_threads > 0 && max_witness_settled > 0);
+    clear();
+
+    std::size_t num_vertices = m_graph->getNumVertices();
+    RemainingGraph remaining(num_vertices);
+    for (EdgeID edge_id = 0; edge_id < m_graph->getNumEdges(); ++edge_id) {
+        const Edge& edge = m_graph->getEdgeByID(edge_id);
+        if (edge.m_from_vertex_id != edge.m_to_vertex_id) {
+            addArc(remaining, m_arcs, {edge.m_from_vertex_id, edge.m_to_vertex_id, edge.m_cost, edge_id, NO_ARC, NO_ARC});
+        }
+    }
+
+    // The initial priorities only read the remaining graph, so the vertices can be split between threads
+    std::vector<int64_t> priorities(num_vertices);
+    std::atomic<std::size_t> next_vertex(0);
+    auto compute_initial_priorities = [&]() {
+        WitnessSearch witness_search(num_vertices);
+        std::vector<Shortcut> shortcuts;
+        for (std::size_t vertex_id = next_vertex++; vertex_id < num_vertices; vertex_id = next_vertex++) {
+            priorities[vertex_id] = computePriority(remaining, m_arcs, vertex_id, max_witness_settled, witness_search,
+                      shortcuts);
+        }
+    };
+    std::vector<std::thread> workers;
+    for (unsigned thread = 1; thread < num_threads; ++thread) {
+        workers.emplace_back(compute_initial_priorities);
+    }
+    compute_initial_priorities();
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+
+    using QueueEntry = std::pair<int64_t, VertexID>;
+    std::priority_queue<QueueEntry, std::vector<QueueEntry>, std::greater<>> queue;
+    for (VertexID vertex_id = 0; vertex_id < num_vertices; ++vertex_id) {
+        queue.emplace(priorities[vertex_id], vertex_id);
+    }
+
+    WitnessSearch witness_search(num_vertices);
+    std::vector<Shortcut> shortcuts;
+    std::vector<Shortcut> neighbour_shortcuts;
+    std::vector<bool> contracted(num_vertices, false);
+    std::vector<std::vector<ArcID>> up_arcs(num_vertices);
+    std::vector<std::vector<ArcID>> down_arcs(num_vertices);
+    std::vector<VertexID> neighbours;
+    m_ranks.assign(num_vertices, 0);
+    uint64_t next_rank = 0;
+
+    while (!queue.empty()) {
+        auto [priority, vertex_id] = queue.top();
+        queue.pop();
+        if (contracted[vertex_id] || priority != priorities[vertex_id]) {
+            continue;
+        }
+
+        // Lazy update: the priority may have risen since it was last computed
+        priorities[vertex_id] = computePriority(remaining, m_arcs, vertex_id, max_witness_settled, witness_search,
+                  shortcuts);
+        if (!queue.empty() && priorities[vertex_id] > queue.top().first) {
+            queue.emplace(priorities[vertex_id], vertex_id);
+            continue;
+        }
+
+        neighbours.clear();
+        for (const Neighbour& neighbour : remaining.m_out[vertex_id]) {
+            up_arcs[vertex_id].push_back(neighbour.m_arc_id);
+            removeNeighbour(remaining.m_in[neighbour.m_vertex_id], vertex_id);
+            neighbours.push_back(neighbour.m_vertex_id);
+        }
+        for (const Neighbour& neighbour : remaining.m_in[vertex_id]) {
+            down_arcs[vertex_id].push_back(neighbour.m_arc_id);
+            removeNeighbour(remaining.m_out[neighbour.m_vertex_id], vertex_id);
+            neighbours.push_back(neighbour.m_vertex_id);
+        }
+        remaining.m_out[vertex_id] = std::vector<Neighbour>();
+        remaining.m_in[vertex_id] = std::vector<Neighbour>();
+        contracted[vertex_id] = true;
+        m_ranks[vertex_id] = next_rank++;
+
+        for (const Shortcut& shortcut : shortcuts) {
+            addArc(remaining, m_arcs, {shortcut.m_from_vertex_id, shortcut.m_to_vertex_id, shortcut.m_cost, NO_EDGE,
+                                              shortcut.m_first_arc, shortcut.m_second_arc});
+        }
+
+        std::sort(neighbours.begin(), neighbours.end());
+        neighbours.erase(std::unique(neighbours.begin(), neighbours.end()), neighbours.end());
+        for (VertexID neighbour : neighbours) {
+            remaining.m_contracted_neighbours[neighbour]++;
+            priorities[neighbour] = computePriority(remaining, m_arcs, neighbour, max_witness_settled, witness_search,
+                      neighbour_shortcuts);
+            queue.emplace(priorities[neighbour], neighbour);
+        }
+    }
+
+    flattenArcLists(up_arcs, m_up_offsets, m_up_arcs);
+    flattenArcLists(down_arcs, m_down_offsets, m_down_arcs);
+    for (const auto& arc_list : {std::cref(m_up_arcs), std::cref(m_down_arcs)}) {
+        m_num_shortcuts += std::count_if(arc_list.get().begin(), arc_list.get().end(),
+                  [this](ArcID arc_id) { return m_arcs[arc_id].m_edge_id == NO_EDGE; });
+    }
+}
+
+void ContractionHierarchy::unpackArc(ArcID arc_id, std::vector<EdgeID>& edges) const {
+    std::vector<ArcID> to_unpack = {arc_id};
+    while (!to_unpack.empty()) {
+        const Arc& arc = m_arcs[to_unpack.back()];
+        to_unpack.pop_back();
+        if (arc.m_edge_id != NO_EDGE) {
+            edges.push_back(arc.m_edge_id);
+        } else {
+            to_unpack.push_back(arc.m_second_arc);
+            to_unpack.push_back(arc.m_first_arc);
+        }
+    }
+}
+
+void ContractionHierarchy::clear() {
+    m_arcs.clear();
+    m_ranks.clear();
+    m_up_offsets.clear();
+    m_up_arcs.clear();
+    m_down_offsets.clear();
+    m_down_arcs.clear();
+    m_num_shortcuts = 0;
+}
+
+bool ContractionHierarchy::save(std::ostream& out) const {
+    writeBinaryValue(out, FILE_MARKER);
+    writeBinaryValue(out, static_cast<uint64_t>(m_graph->getNumVertices()));
+    writeBinaryValue(out, static_cast<uint64_t>(m_graph->getNumEdges()));
+    writeBinaryValue(out, static_cast<uint64_t>(m_num_shortcuts));
+    writeBinaryVector(out, m_arcs);
+    writeBinaryVector(out, m_ranks);
+    writeBinaryVector(out, m_up_offsets);
+    writeBinaryVector(out, m_up_arcs);
+    writeBinaryVector(out, m_down_offsets);
+    writeBinaryVector(out, m_down_arcs);
+    return static_cast<bool>(out);
+}
+
+bool ContractionHierarchy::load(std::istream& in) {
+    clear();
+
+    uint64_t marker = 0;
+    uint64_t num_vertices = 0;
+    uint64_t num_edges = 0;
+    uint64_t num_shortcuts = 0;
+    if (!readBinaryValue(in, marker) || marker != FILE_MARKER || !readBinaryValue(in, num_vertices) ||
+              !readBinaryValue(in, num_edges) || !readBinaryValue(in, num_shortcuts) || !readBinaryVector(in, m_arcs) ||
+              !readBinaryVector(in, m_ranks) || !readBinaryVector(in, m_up_offsets) || !readBinaryVector(in, m_up_arcs) ||
+              !readBinaryVector(in, m_down_offsets) || !readBinaryVector(in, m_down_arcs)) {
+        std::cerr << "Contraction hierarchy could not be read.\n";
+        clear();
+        return false;
+    }
+
+    if (num_vertices != m_graph->getNumVertices() || num_edges != m_graph->getNumEdges()) {
+        std::cerr << "Contraction hierarchy was built for a different graph.\n";
+        clear();
+        return false;
+    }
+
+    auto is_valid_arc = [this](ArcID arc_id) { return arc_id < m_arcs.size(); };
+    auto are_valid_offsets = [num_vertices](const std::vector<uint64_t>& offsets, const std::vector<ArcID>& arcs) {
+        return offsets.size() == num_vertices + 1 && offsets.front() == 0 && offsets.back() == arcs.size() &&
+               std::is_sorted(offsets.begin(), offsets.end());
+    };
+    bool is_valid = num_vertices == 0 ||
+                    (m_ranks.size() == num_vertices && are_valid_offsets(m_up_offsets, m_up_arcs) &&
+                              are_valid_offsets(m_down_offsets, m_down_arcs) &&
+                              std::all_of(m_up_arcs.begin(), m_up_arcs.end(), is_valid_arc) &&
+                              std::all_of(m_down_arcs.begin(), m_down_arcs.end(), is_valid_arc));
+    // Shortcuts are always added after the arcs they replace, which also rules out cycles when unpacking
+    for (std::size_t arc_id = 0; is_valid && arc_id < m_arcs.size(); ++arc_id) {
+        const Arc& arc = m_arcs[arc_id];
+        is_valid = arc.m_from_vertex_id < num_vertices && arc.m_to_vertex_id < num_vertices &&
+                   (arc.m_edge_id < num_edges ||
+                             (arc.m_edge_id == NO_EDGE && arc.m_first_arc < arc_id && arc.m_second_arc < arc_id));
+    }
+    if (!is_valid) {
+        std::cerr << "Contraction hierarchy has inconsistent arrays.\n";
+        clear();
+        return false;
+    }
+
+    m_num_shortcuts = num_shortcuts;
+    return true;
+}
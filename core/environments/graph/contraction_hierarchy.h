@@ -0,0 +1,190 @@
+#ifndef CONTRACTION_HIERARCHY_H_
+#define CONTRACTION_HIERARCHY_H_
+
+#include "graph.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <utility>
+#include <vector>
+
+/**
+ * A contraction hierarchy of a Graph (Geisberger, Sanders, Schultes, and Delling, 2008), which answers many shortest
+ * path queries on the same static graph much faster than searching the graph itself.
+ *
+ * The vertices are contracted one at a time, from least to most important. Contracting a vertex removes it from the
+ * remaining graph, and adds a shortcut between each pair of its remaining neighbours whose shortest path went through
+ * it. Whether a shortcut is needed is decided with a witness search, which is a Dijkstra search from the in-neighbour
+ * that skips the contracted vertex. The witness search is limited in how many vertices it settles, so some unneeded
+ * shortcuts may be added, but no needed shortcut is left out. The next vertex to contract is the one with the lowest
+ * priority, which is its edge difference (the number of shortcuts contracting it would add minus the number of arcs
+ * that would be removed) plus the number of its neighbours already contracted. Priorities are updated lazily, and the
+ * neighbours of each contracted vertex are updated eagerly. The initial priorities need a witness search per edge, and
+ * are computed in parallel.
+ *
+ * Each arc of the hierarchy, whether an edge of the graph or a shortcut, is stored with its lower ranked end. The
+ * upward arcs of a vertex lead to higher ranked vertices, and the downward arcs of a vertex come from higher ranked
+ * vertices. A query searches forward from the start over upward arcs and backward from the goal over downward arcs,
+ * and meets at the highest ranked vertex of the shortest path. Shortcuts are unpacked into the edges of the graph
+ * through the two arcs they replace.
+ *
+ * The hierarchy is built for the graph given when build is called, and must be rebuilt if the graph changes. It can be
+ * saved in a binary format and loaded back for the same graph.
+ *
+ * @class ContractionHierarchy
+ */
+class ContractionHierarchy {
+public:
+    using ArcID = uint32_t;  ///< The ID of an arc of the hierarchy
+    inline static const ArcID NO_ARC = std::numeric_limits<ArcID>::max();  ///< Used when an arc does not exist
+    inline static const EdgeID NO_EDGE = std::numeric_limits<EdgeID>::max();  ///< Used when an arc is a shortcut
+
+    /**
+     * An arc of the hierarchy.
+     */
+    struct Arc {
+        uint64_t m_from_vertex_id;  ///< The vertex the arc leaves
+        uint64_t m_to_vertex_id;  ///< The vertex the arc enters
+        double m_cost;  ///< The cost of the arc
+        uint64_t m_edge_id;  ///< The edge of the graph if the arc is not a shortcut, or NO_EDGE
+        ArcID m_first_arc;  ///< The first arc replaced by the shortcut, or NO_ARC
+        ArcID m_second_arc;  ///< The second arc replaced by the shortcut, or NO_ARC
+    };
+
+    /**
+     * Creates an empty hierarchy for the given graph.
+     *
+     * @param graph The graph
+     */
+    explicit ContractionHierarchy(const Graph& graph);
+
+    /**
+     * Contracts all vertices of the graph.
+     *
+     * @param num_threads The number of threads used to compute the initial priorities. Must be positive.
+     * @param max_witness_settled The most vertices a witness search settles before giving up. Must be positive.
+     */
+    void build(unsigned num_threads = 1, int64_t max_witness_settled = 500);
+
+    /**
+     * Writes the hierarchy to the given binary stream.
+     *
+     * @param out The stream to write to
+     * @return If the write succeeded
+     */
+    bool save(std::ostream& out) const;
+
+    /**
+     * Reads a hierarchy written by save. Fails if it does not match the number of vertices and edges of the graph.
+     *
+     * @param in The binary stream to read from
+     * @return If the read succeeded. If not, the hierarchy is left empty.
+     */
+    bool load(std::istream& in);
+
+    /**
+     * Checks if the hierarchy has been built or loaded.
+     *
+     * @return If the hierarchy is ready for queries
+     */
+    bool isBuilt() const { return !m_ranks.empty() || m_graph->getNumVertices() == 0; }
+
+    /**
+     * Gets the graph the hierarchy is for.
+     *
+     * @return The graph
+     */
+    const Graph& getGraph() const { return *m_graph; }
+
+    /**
+     * Gets the position of the given vertex in the contraction order. Assumes the hierarchy is built.
+     *
+     * @param vertex_id The ID of the vertex
+     * @return The rank of the vertex
+     */
+    std::size_t getRank(VertexID vertex_id) const { return m_ranks[vertex_id]; }
+
+    /**
+     * Gets the arc with the given ID.
+     *
+     * @param arc_id The ID of the arc
+     * @return The arc
+     */
+    const Arc& getArc(ArcID arc_id) const { return m_arcs[arc_id]; }
+
+    /**
+     * Gets the IDs of the arcs from the given vertex to higher ranked vertices. Assumes the hierarchy is built.
+     *
+     * @param vertex_id The ID of the vertex
+     * @return The first and one past the last arc ID in getUpwardArcList
+     */
+    std::pair<std::size_t, std::size_t> getUpwardArcs(VertexID vertex_id) const {
+        return {m_up_offsets[vertex_id], m_up_offsets[vertex_id + 1]};
+    }
+
+    /**
+     * Gets the IDs of the arcs to the given vertex from higher ranked vertices. Assumes the hierarchy is built.
+     *
+     * @param vertex_id The ID of the vertex
+     * @return The first and one past the last arc ID in getDownwardArcList
+     */
+    std::pair<std::size_t, std::size_t> getDownwardArcs(VertexID vertex_id) const {
+        return {m_down_offsets[vertex_id], m_down_offsets[vertex_id + 1]};
+    }
+
+    /**
+     * Gets the arc IDs indexed by getUpwardArcs.
+     *
+     * @return The upward arc IDs of all vertices
+     */
+    const std::vector<ArcID>& getUpwardArcList() const { return m_up_arcs; }
+
+    /**
+     * Gets the arc IDs indexed by getDownwardArcs.
+     *
+     * @return The downward arc IDs of all vertices
+     */
+    const std::vector<ArcID>& getDownwardArcList() const { return m_down_arcs; }
+
+    /**
+     * Appends the edges of the graph that the given arc stands for, in order, to the given list.
+     *
+     * @param arc_id The ID of the arc
+     * @param edges The list to append the edges to
+     */
+    void unpackArc(ArcID arc_id, std::vector<EdgeID>& edges) const;
+
+    /**
+     * Gets the number of arcs in the hierarchy, including shortcuts.
+     *
+     * @return The number of arcs
+     */
+    std::size_t getNumArcs() const { return m_arcs.size(); }
+
+    /**
+     * Gets the number of shortcuts in the hierarchy.
+     *
+     * @return The number of shortcuts
+     */
+    std::size_t getNumShortcuts() const { return m_num_shortcuts; }
+
+private:
+    /**
+     * Removes all arcs and ranks.
+     */
+    void clear();
+
+    const Graph* m_graph;  ///< The graph
+
+    std::vector<Arc> m_arcs;  ///< All arcs, including shortcuts
+    std::vector<uint64_t> m_ranks;  ///< The position of each vertex in the contraction order
+    std::vector<uint64_t> m_up_offsets;  ///< The upward arcs of v are from m_up_offsets[v] up to m_up_offsets[v + 1]
+    std::vector<ArcID> m_up_arcs;  ///< The upward arcs of each vertex
+    std::vector<uint64_t> m_down_offsets;  ///< The downward arcs of v are from m_down_offsets[v] up to m_down_offsets[v + 1]
+    std::vector<ArcID> m_down_arcs;  ///< The downward arcs of each vertex
+    std::size_t m_num_shortcuts = 0;  ///< The number of shortcut arcs
+};
+
+#endif  //CONTRACTION_HIERARCHY_H_
@@ -0,0 +1,149 @@
+#include "contraction_hierarchy_search.h"
+#include "building_tools/evaluators/single_goal_state_evaluator.h"
+#include "contraction_hierarchy.h"
+#include "graph.h"
+#include "graph_action.h"
+#include "graph_state.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <limits>
+#include <string>
+#include <vector>
+
+void ContractionHierarchySearch::setHierarchy(const ContractionHierarchy& hierarchy) {
+    assert(hierarchy.isBuilt());
+    m_hierarchy = &hierarchy;
+    for (SearchDirection* direction : {&m_forward, &m_backward}) {
+        direction->m_distances.assign(hierarchy.getGraph().getNumVertices(), std::numeric_limits<double>::infinity());
+        direction->m_parent_arcs.assign(hierarchy.getGraph().getNumVertices(), ContractionHierarchy::NO_ARC);
+        direction->m_reached.clear();
+        direction->m_queue = {};
+    }
+    SE::reset();
+}
+
+StringMap ContractionHierarchySearch::getEngineSpecificStatistics() const {
+    StringMap stats = SE::getEngineSpecificStatistics();
+    stats["num_forward_settled"] = std::to_string(m_forward.m_num_settled);
+    stats["num_backward_settled"] = std::to_string(m_backward.m_num_settled);
+    stats["num_arcs_relaxed"] = std::to_string(m_num_arcs_relaxed);
+
+    return stats;
+}
+
+bool ContractionHierarchySearch::doCanRunSearch() const {
+    return m_hierarchy && dynamic_cast<const SingleGoalStateEvaluator<GraphState>*>(SE::getGoalTest()) != nullptr;
+}
+
+void ContractionHierarchySearch::doReset() {
+    m_forward.m_num_settled = 0;
+    m_backward.m_num_settled = 0;
+    m_num_arcs_relaxed = 0;
+}
+
+void ContractionHierarchySearch::doSearchInitialization(const GraphState& initial_state) {
+    GraphState goal_state = dynamic_cast<const SingleGoalStateEvaluator<GraphState>*>(SE::getGoalTest())->getGoalState();
+    assert(initial_state.m_graph == &m_hierarchy->getGraph() && goal_state.m_graph == &m_hierarchy->getGraph());
+
+    clearDirection(m_forward);
+    clearDirection(m_backward);
+    m_best_cost = std::numeric_limits<double>::infinity();
+    m_meeting_vertex = initial_state.m_vertex_id;
+
+    reachVertex(m_forward, initial_state.m_vertex_id, 0.0, ContractionHierarchy::NO_ARC);
+    reachVertex(m_backward, goal_state.m_vertex_id, 0.0, ContractionHierarchy::NO_ARC);
+}
+
+EngineStatus ContractionHierarchySearch::doSingleSearchStep() {
+    double forward_min = m_forward.m_queue.empty() ? std::numeric_limits<double>::infinity() : m_forward.m_queue.top().first;
+    double backward_min = m_backward.m_queue.empty() ? std::numeric_limits<double>::infinity() :
+                                                       m_backward.m_queue.top().first;
+    if (std::min(forward_min, backward_min) >= m_best_cost) {
+        extractPlan();
+        return EngineStatus::search_completed;
+    }
+
+    settleNextVertex(forward_min <= backward_min);
+    return EngineStatus::active;
+}
+
+void ContractionHierarchySearch::reachVertex(SearchDirection& direction, VertexID vertex_id, double distance,
+          ContractionHierarchy::ArcID parent_arc) {
+    if (direction.m_distances[vertex_id] == std::numeric_limits<double>::infinity()) {
+        direction.m_reached.push_back(vertex_id);
+    }
+    direction.m_distances[vertex_id] = distance;
+    direction.m_parent_arcs[vertex_id] = parent_arc;
+    direction.m_queue.emplace(distance, vertex_id);
+}
+
+void ContractionHierarchySearch::settleNextVertex(bool is_forward) {
+    SearchDirection& direction = is_forward ? m_forward : m_backward;
+    const SearchDirection& other_direction = is_forward ? m_backward : m_forward;
+    auto [distance, vertex_id] = direction.m_queue.top();
+    direction.m_queue.pop();
+    if (distance > direction.m_distances[vertex_id]) {
+        return;
+    }
+    direction.m_num_settled++;
+
+    if (distance + other_direction.m_distances[vertex_id] < m_best_cost) {
+        m_best_cost = distance + other_direction.m_distances[vertex_id];
+        m_meeting_vertex = vertex_id;
+    }
+
+    auto [first, last] = is_forward ? m_hierarchy->getUpwardArcs(vertex_id) : m_hierarchy->getDownwardArcs(vertex_id);
+    const auto& arc_list = is_forward ? m_hierarchy->getUpwardArcList() : m_hierarchy->getDownwardArcList();
+    for (std::size_t i = first; i < last; ++i) {
+        m_num_arcs_relaxed++;
+        const ContractionHierarchy::Arc& arc = m_hierarchy->getArc(arc_list[i]);
+        VertexID neighbour = is_forward ? arc.m_to_vertex_id : arc.m_from_vertex_id;
+        if (distance + arc.m_cost < direction.m_distances[neighbour]) {
+            reachVertex(direction, neighbour, distance + arc.m_cost, arc_list[i]);
+        }
+    }
+}
+
+void ContractionHierarchySearch::clearDirection(SearchDirection& direction) {
+    for (VertexID vertex_id : direction.m_reached) {
+        direction.m_distances[vertex_id] = std::numeric_limits<double>::infinity();
+        direction.m_parent_arcs[vertex_id] = ContractionHierarchy::NO_ARC;
+    }
+    direction.m_reached.clear();
+    direction.m_queue = {};
+}
+
+void ContractionHierarchySearch::extractPlan() {
+    if (m_best_cost == std::numeric_limits<double>::infinity()) {
+        return;
+    }
+
+    // The forward arcs are found from the meeting vertex back to the start, and the backward arcs in path order
+    std::vector<ContractionHierarchy::ArcID> path_arcs;
+    for (VertexID vertex_id = m_meeting_vertex; m_forward.m_parent_arcs[vertex_id] != ContractionHierarchy::NO_ARC;) {
+        path_arcs.push_back(m_forward.m_parent_arcs[vertex_id]);
+        vertex_id = m_hierarchy->getArc(path_arcs.back()).m_from_vertex_id;
+    }
+    std::reverse(path_arcs.begin(), path_arcs.end());
+    for (VertexID vertex_id = m_meeting_vertex; m_backward.m_parent_arcs[vertex_id] != ContractionHierarchy::NO_ARC;) {
+        path_arcs.push_back(m_backward.m_parent_arcs[vertex_id]);
+        vertex_id = m_hierarchy->getArc(path_arcs.back()).m_to_vertex_id;
+    }
+
+    std::vector<EdgeID> edges;
+    for (ContractionHierarchy::ArcID arc_id : path_arcs) {
+        m_hierarchy->unpackArc(arc_id, edges);
+    }
+
+    const Graph* graph = &m_hierarchy->getGraph();
+    std::vector<GraphAction> plan;
+    plan.reserve(edges.size());
+    double plan_cost = 0.0;
+    for (EdgeID edge_id : edges) {
+        plan.emplace_back(edge_id, graph);
+        plan_cost += graph->getEdgeByID(edge_id).m_cost;
+    }
+    SE::setIncumbentSolution(plan, plan_cost);
+}
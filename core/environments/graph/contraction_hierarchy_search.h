@@ -0,0 +1,128 @@
+#ifndef CONTRACTION_HIERARCHY_SEARCH_H_
+#define CONTRACTION_HIERARCHY_SEARCH_H_
+
+#include "contraction_hierarchy.h"
+#include "engines/single_step_search_engine.h"
+#include "graph.h"
+#include "graph_action.h"
+#include "graph_state.h"
+#include "logging/logging_terms.h"
+#include "logging/search_component_settings.h"
+#include "search_basics/node_evaluator.h"
+#include "search_basics/search_engine.h"
+
+#include <cstdint>
+#include <functional>
+#include <queue>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * A search engine that answers queries on a graph with a prebuilt ContractionHierarchy, using a bidirectional Dijkstra
+ * search that only moves upward in the hierarchy.
+ *
+ * Each search step settles one vertex, from whichever direction has the lower distance at the front of its queue. The
+ * forward search from the start follows upward arcs, and the backward search from the goal follows downward arcs in
+ * reverse. Whenever a vertex settled in one direction has been reached in the other, the path through it is a
+ * candidate. The search ends once neither queue holds a distance lower than the best candidate, and the arcs of that
+ * path are unpacked into the edges of the graph. The plan is optimal.
+ *
+ * The goal state is taken from the goal test, which must be a SingleGoalStateEvaluator. The transition system is only
+ * needed to meet the SearchEngine interface, and should be the GraphTransitions for the graph of the hierarchy. The
+ * standard statistics do not count any work, since the hierarchy is searched directly.
+ *
+ * @class ContractionHierarchySearch
+ */
+class ContractionHierarchySearch : public SingleStepSearchEngine<GraphState, GraphAction> {
+    using SE = SingleStepSearchEngine<GraphState, GraphAction>;  // Allows succinct access to the protected members
+
+public:
+    /**
+     * Creates an engine without a hierarchy.
+     */
+    ContractionHierarchySearch() = default;
+
+    /**
+     * Default destructor
+     */
+    ~ContractionHierarchySearch() override = default;
+
+    /**
+     * Sets the hierarchy to search. Assumes it has been built or loaded.
+     *
+     * @param hierarchy The hierarchy
+     */
+    void setHierarchy(const ContractionHierarchy& hierarchy);
+
+    // Overridden public SearchEngine methods
+    StringMap getEngineSpecificStatistics() const override;
+    std::vector<NodeEvaluator<GraphState, GraphAction>*> getBaseEvaluators() const override { return {}; }
+
+    // Overidden public SettingsLogger methods
+    std::string getName() const override { return "ContractionHierarchySearch"; }
+
+protected:
+    // Overridden SingleStepSearchEngine methods
+    void doSearchInitialization(const GraphState& initial_state) override;
+    EngineStatus doSingleSearchStep() override;
+    bool doCanRunSearch() const override;
+    void doReset() override;
+    StringMap getEngineParamsLog() const override { return {}; }
+
+    // Overidden protected SettingsLogger methods
+    SearchSettingsMap getSubComponentSettings() const override { return {}; }
+
+private:
+    using QueueEntry = std::pair<double, VertexID>;  ///< A distance and the vertex it was found for
+
+    /**
+     * The data for one direction of the search.
+     */
+    struct SearchDirection {
+        std::vector<double> m_distances;  ///< The distance to each vertex, or infinity if not reached
+        std::vector<ContractionHierarchy::ArcID> m_parent_arcs;  ///< The arc each vertex was reached by
+        std::vector<VertexID> m_reached;  ///< The vertices reached in the current search
+        std::priority_queue<QueueEntry, std::vector<QueueEntry>, std::greater<>> m_queue;  ///< The open vertices
+        int64_t m_num_settled = 0;  ///< The number of vertices settled in the latest search
+    };
+
+    /**
+     * Adds the given vertex at the given distance to one direction of the search.
+     *
+     * @param direction The direction of the search
+     * @param vertex_id The vertex reached
+     * @param distance The distance to the vertex
+     * @param parent_arc The arc the vertex was reached by
+     */
+    void reachVertex(SearchDirection& direction, VertexID vertex_id, double distance,
+              ContractionHierarchy::ArcID parent_arc);
+
+    /**
+     * Settles the vertex at the front of the queue of the given direction.
+     *
+     * @param is_forward Whether to settle a vertex of the forward search
+     */
+    void settleNextVertex(bool is_forward);
+
+    /**
+     * Clears the data of the given direction that was set by the previous search.
+     *
+     * @param direction The direction of the search
+     */
+    void clearDirection(SearchDirection& direction);
+
+    /**
+     * Unpacks the best path into edges and sets it as the incumbent. Does nothing if no path was found.
+     */
+    void extractPlan();
+
+    const ContractionHierarchy* m_hierarchy = nullptr;  ///< The hierarchy to search
+    SearchDirection m_forward;  ///< The search from the start
+    SearchDirection m_backward;  ///< The search from the goal
+    double m_best_cost = 0.0;  ///< The cost of the best path found so far
+    VertexID m_meeting_vertex = 0;  ///< The vertex the best path goes through
+    int64_t m_num_arcs_relaxed = 0;  ///< The number of arcs relaxed in the latest search
+};
+
+#endif  //CONTRACTION_HIERARCHY_SEARCH_H_
@@ -0,0 +1,181 @@
+#include "csr_graph.h"
+#include "graph.h"
+#include "utils/io_utils.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <numeric>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace {
+    constexpr uint64_t FILE_MARKER = 0x3148505247534353;  ///< Written at the start of saved graphs ("SCSGRPH1")
+}  // namespace
+
+CsrGraph::CsrGraph(const Graph& graph, bool keep_labels) {
+    std::vector<CsrGraphEdge> edges;
+    edges.reserve(graph.getNumEdges());
+    for (EdgeID edge_id = 0; edge_id < graph.getNumEdges(); ++edge_id) {
+        const Edge& edge = graph.getEdgeByID(edge_id);
+        edges.push_back({static_cast<CsrVertexID>(edge.m_from_vertex_id), static_cast<CsrVertexID>(edge.m_to_vertex_id),
+                  edge.m_cost});
+    }
+    std::vector<std::size_t> original_edges = buildEdges(graph.getNumVertices(), edges);
+
+    if (keep_labels) {
+        m_has_labels = true;
+        m_vertex_labels.reserve(graph.getNumVertices());
+        for (VertexID vertex_id = 0; vertex_id < graph.getNumVertices(); ++vertex_id) {
+            m_vertex_labels.push_back(graph.getVertexLabel(vertex_id));
+            m_vertex_ids[m_vertex_labels.back()] = static_cast<CsrVertexID>(vertex_id);
+        }
+        m_edge_labels.reserve(original_edges.size());
+        for (std::size_t original_edge : original_edges) {
+            m_edge_labels.push_back(graph.getEdgeByID(original_edge).m_label);
+        }
+    }
+}
+
+CsrGraph::CsrGraph(std::size_t num_vertices, const std::vector<CsrGraphEdge>& edges) {
+    buildEdges(num_vertices, edges);
+}
+
+std::vector<std::size_t> CsrGraph::buildEdges(std::size_t num_vertices, const std::vector<CsrGraphEdge>& edges) {
+    assert(num_vertices < std::numeric_limits<CsrVertexID>::max());
+    assert(edges.size() < std::numeric_limits<CsrEdgeID>::max());
+
+    // Counting sort by from vertex, so the edges out of each vertex are contiguous
+    m_edge_offsets.assign(num_vertices + 1, 0);
+    for (const CsrGraphEdge& edge : edges) {
+        assert(edge.m_from_vertex_id < num_vertices && edge.m_to_vertex_id < num_vertices);
+        m_edge_offsets[edge.m_from_vertex_id + 1]++;
+    }
+    std::partial_sum(m_edge_offsets.begin(), m_edge_offsets.end(), m_edge_offsets.begin());
+
+    std::vector<std::size_t> original_edges(edges.size());
+    std::vector<CsrEdgeID> next_slot(m_edge_offsets.begin(), m_edge_offsets.end() - 1);
+    for (std::size_t i = 0; i < edges.size(); ++i) {
+        original_edges[next_slot[edges[i].m_from_vertex_id]++] = i;
+    }
+
+    // Sorting by to vertex allows edges to be found with a binary search. Ties keep their original order
+    for (std::size_t vertex = 0; vertex < num_vertices; ++vertex) {
+        std::stable_sort(original_edges.begin() + m_edge_offsets[vertex], original_edges.begin() + m_edge_offsets[vertex + 1],
+                  [&edges](std::size_t edge1, std::size_t edge2) {
+                      return edges[edge1].m_to_vertex_id < edges[edge2].m_to_vertex_id;
+                  });
+    }
+
+    m_edge_targets.resize(edges.size());
+    m_edge_costs.resize(edges.size());
+    for (std::size_t edge_id = 0; edge_id < edges.size(); ++edge_id) {
+        m_edge_targets[edge_id] = edges[original_edges[edge_id]].m_to_vertex_id;
+        m_edge_costs[edge_id] = edges[original_edges[edge_id]].m_cost;
+    }
+
+    computeInverseEdges();
+    return original_edges;
+}
+
+void CsrGraph::computeInverseEdges() {
+    m_inverse_edges.resize(m_edge_targets.size());
+    for (std::size_t vertex = 0; vertex < getNumVertices(); ++vertex) {
+        for (CsrEdgeID edge_id : getOutEdges(static_cast<CsrVertexID>(vertex))) {
+            std::optional<CsrEdgeID> inverse = findEdge(m_edge_targets[edge_id], static_cast<CsrVertexID>(vertex));
+            m_inverse_edges[edge_id] = inverse.value_or(edge_id);
+        }
+    }
+}
+
+std::optional<CsrEdgeID> CsrGraph::getInverseEdge(CsrEdgeID edge_id) const {
+    assert(edge_id < m_inverse_edges.size());
+    if (m_inverse_edges[edge_id] == edge_id) {
+        return std::nullopt;
+    }
+    return m_inverse_edges[edge_id];
+}
+
+std::optional<CsrEdgeID> CsrGraph::findEdge(CsrVertexID from_vertex_id, CsrVertexID to_vertex_id) const {
+    assert(from_vertex_id < getNumVertices());
+    auto first = m_edge_targets.begin() + m_edge_offsets[from_vertex_id];
+    auto last = m_edge_targets.begin() + m_edge_offsets[from_vertex_id + 1];
+    auto found = std::lower_bound(first, last, to_vertex_id);
+    if (found == last || *found != to_vertex_id) {
+        return std::nullopt;
+    }
+    return static_cast<CsrEdgeID>(found - m_edge_targets.begin());
+}
+
+const std::string& CsrGraph::getVertexLabel(CsrVertexID vertex_id) const {
+    assert(m_has_labels && vertex_id < m_vertex_labels.size());
+    return m_vertex_labels[vertex_id];
+}
+
+const std::string& CsrGraph::getEdgeLabel(CsrEdgeID edge_id) const {
+    assert(m_has_labels && edge_id < m_edge_labels.size());
+    return m_edge_labels[edge_id];
+}
+
+std::optional<CsrVertexID> CsrGraph::findVertex(const std::string& vertex_label) const {
+    auto found = m_vertex_ids.find(vertex_label);
+    if (found == m_vertex_ids.end()) {
+        return std::nullopt;
+    }
+    return found->second;
+}
+
+void CsrGraph::clear() {
+    m_edge_offsets.clear();
+    m_edge_targets.clear();
+    m_edge_costs.clear();
+    m_inverse_edges.clear();
+    m_has_labels = false;
+    m_vertex_labels.clear();
+    m_edge_labels.clear();
+    m_vertex_ids.clear();
+}
+
+bool CsrGraph::save(std::ostream& out) const {
+    writeBinaryValue(out, FILE_MARKER);
+    writeBinaryVector(out, m_edge_offsets);
+    writeBinaryVector(out, m_edge_targets);
+    writeBinaryVector(out, m_edge_costs);
+    return static_cast<bool>(out);
+}
+
+bool CsrGraph::load(std::istream& in) {
+    clear();
+
+    uint64_t marker = 0;
+    if (!readBinaryValue(in, marker) || marker != FILE_MARKER || !readBinaryVector(in, m_edge_offsets) ||
+              !readBinaryVector(in, m_edge_targets) || !readBinaryVector(in, m_edge_costs)) {
+        std::cerr << "CSR graph could not be read.\n";
+        clear();
+        return false;
+    }
+
+    std::size_t num_vertices = getNumVertices();
+    bool is_empty = m_edge_offsets.empty() && m_edge_targets.empty() && m_edge_costs.empty();
+    bool is_valid = is_empty || (!m_edge_offsets.empty() && m_edge_offsets.front() == 0 &&
+                    m_edge_offsets.back() == m_edge_targets.size() && m_edge_costs.size() == m_edge_targets.size() &&
+                    std::is_sorted(m_edge_offsets.begin(), m_edge_offsets.end()) &&
+                    std::all_of(m_edge_targets.begin(), m_edge_targets.end(),
+                              [num_vertices](CsrVertexID target) { return target < num_vertices; }));
+    for (std::size_t vertex = 0; is_valid && vertex < num_vertices; ++vertex) {
+        is_valid = std::is_sorted(m_edge_targets.begin() + m_edge_offsets[vertex],
+                  m_edge_targets.begin() + m_edge_offsets[vertex + 1]);
+    }
+    if (!is_valid) {
+        std::cerr << "CSR graph has inconsistent edge arrays.\n";
+        clear();
+        return false;
+    }
+
+    computeInverseEdges();
+    return true;
+}
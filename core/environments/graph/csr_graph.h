@@ -0,0 +1,281 @@
+#ifndef CSR_GRAPH_H_
+#define CSR_GRAPH_H_
+
+#include "graph.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using CsrVertexID = uint32_t;  ///< ID of a vertex in a CsrGraph
+using CsrEdgeID = uint32_t;  ///< ID of an edge in a CsrGraph
+
+/**
+ * An edge given when building a CsrGraph.
+ *
+ * @struct CsrGraphEdge
+ */
+struct CsrGraphEdge {
+    CsrVertexID m_from_vertex_id;  ///< ID of the from vertex
+    CsrVertexID m_to_vertex_id;  ///< ID of the to vertex
+    double m_cost;  ///< Edge cost
+};
+
+/**
+ * The range of IDs of the edges out of a vertex in a CsrGraph. Iterating over it does not allocate.
+ *
+ * @class CsrEdgeRange
+ */
+class CsrEdgeRange {
+public:
+    /**
+     * Iterates over the edge IDs in the range.
+     */
+    class Iterator {
+    public:
+        explicit Iterator(CsrEdgeID edge_id) : m_edge_id(edge_id) {}
+
+        CsrEdgeID operator*() const { return m_edge_id; }
+
+        Iterator& operator++() {
+            ++m_edge_id;
+            return *this;
+        }
+
+        bool operator==(const Iterator& other) const { return m_edge_id == other.m_edge_id; }
+
+        bool operator!=(const Iterator& other) const { return m_edge_id != other.m_edge_id; }
+
+    private:
+        CsrEdgeID m_edge_id;  ///< The current edge ID
+    };
+
+    /**
+     * Creates the range of edge IDs from begin up to, but not including, end.
+     *
+     * @param begin The first edge ID in the range
+     * @param end One past the last edge ID in the range
+     */
+    CsrEdgeRange(CsrEdgeID begin, CsrEdgeID end) : m_begin(begin), m_end(end) {}
+
+    Iterator begin() const { return Iterator(m_begin); }
+
+    Iterator end() const { return Iterator(m_end); }
+
+    /**
+     * Gets the number of edges in the range.
+     *
+     * @return The number of edges
+     */
+    std::size_t size() const { return m_end - m_begin; }
+
+    /**
+     * Checks if the given edge ID is in the range.
+     *
+     * @param edge_id The edge ID to check
+     * @return If the edge is in the range
+     */
+    bool contains(CsrEdgeID edge_id) const { return edge_id >= m_begin && edge_id < m_end; }
+
+private:
+    CsrEdgeID m_begin;  ///< The first edge ID in the range
+    CsrEdgeID m_end;  ///< One past the last edge ID in the range
+};
+
+/**
+ * An immutable graph stored in compressed sparse row form, for graphs too large for Graph.
+ *
+ * The edges out of each vertex are stored contiguously, sorted by the ID of the to vertex, so the edges out of vertex v
+ * have the IDs from offset v up to offset v + 1. Targets and costs are stored in separate arrays indexed by edge ID.
+ * Vertex and edge labels are optional and kept in a side table, so graphs without labels only pay for the offsets,
+ * targets, costs, and inverse edges.
+ *
+ * Edge IDs in a CsrGraph built from a Graph do not in general match the edge IDs in the Graph.
+ *
+ * @class CsrGraph
+ */
+class CsrGraph {
+public:
+    /**
+     * Creates an empty graph.
+     */
+    CsrGraph() = default;
+
+    /**
+     * Creates a graph with the same vertices and edges as the given graph. Vertex IDs are kept.
+     *
+     * @param graph The graph to copy
+     * @param keep_labels Whether to keep the vertex and edge labels
+     */
+    explicit CsrGraph(const Graph& graph, bool keep_labels = true);
+
+    /**
+     * Creates a graph with the given number of vertices and the given edges, without labels.
+     *
+     * @param num_vertices The number of vertices
+     * @param edges The edges. Each end must be less than the number of vertices.
+     */
+    CsrGraph(std::size_t num_vertices, const std::vector<CsrGraphEdge>& edges);
+
+    /**
+     * Gets the number of vertices in the graph.
+     *
+     * @return The number of vertices in the graph
+     */
+    std::size_t getNumVertices() const { return m_edge_offsets.empty() ? 0 : m_edge_offsets.size() - 1; }
+
+    /**
+     * Gets the number of edges in the graph.
+     *
+     * @return The number of edges in the graph
+     */
+    std::size_t getNumEdges() const { return m_edge_targets.size(); }
+
+    /**
+     * Gets the IDs of the edges out of the given vertex. Assumes the vertex is in the graph.
+     *
+     * @param vertex_id The ID of the vertex
+     * @return The range of edge IDs
+     */
+    CsrEdgeRange getOutEdges(CsrVertexID vertex_id) const {
+        return {m_edge_offsets[vertex_id], m_edge_offsets[vertex_id + 1]};
+    }
+
+    /**
+     * Gets the vertex at the end of the given edge. Assumes the edge is in the graph.
+     *
+     * @param edge_id The ID of the edge
+     * @return The ID of the to vertex
+     */
+    CsrVertexID getEdgeTarget(CsrEdgeID edge_id) const { return m_edge_targets[edge_id]; }
+
+    /**
+     * Gets the cost of the given edge. Assumes the edge is in the graph.
+     *
+     * @param edge_id The ID of the edge
+     * @return The cost of the edge
+     */
+    double getEdgeCost(CsrEdgeID edge_id) const { return m_edge_costs[edge_id]; }
+
+    /**
+     * Gets the edge in the opposite direction to the given edge, if there is one. If there are several, gives the one
+     * with the lowest ID.
+     *
+     * @param edge_id The ID of the edge
+     * @return The ID of the inverse edge, or std::nullopt if there is none
+     */
+    std::optional<CsrEdgeID> getInverseEdge(CsrEdgeID edge_id) const;
+
+    /**
+     * Finds an edge between the given vertices. If there are several, gives the one with the lowest ID.
+     *
+     * @param from_vertex_id The ID of the from vertex
+     * @param to_vertex_id The ID of the to vertex
+     * @return The ID of the edge, or std::nullopt if there is none
+     */
+    std::optional<CsrEdgeID> findEdge(CsrVertexID from_vertex_id, CsrVertexID to_vertex_id) const;
+
+    /**
+     * Checks if the graph has vertex and edge labels.
+     *
+     * @return If the graph has labels
+     */
+    bool hasLabels() const { return m_has_labels; }
+
+    /**
+     * Gets the label of the given vertex. Assumes the graph has labels.
+     *
+     * @param vertex_id The ID of the vertex
+     * @return The label of the vertex
+     */
+    const std::string& getVertexLabel(CsrVertexID vertex_id) const;
+
+    /**
+     * Gets the label of the given edge. Assumes the graph has labels.
+     *
+     * @param edge_id The ID of the edge
+     * @return The label of the edge
+     */
+    const std::string& getEdgeLabel(CsrEdgeID edge_id) const;
+
+    /**
+     * Finds the vertex with the given label.
+     *
+     * @param vertex_label The vertex label
+     * @return The ID of the vertex, or std::nullopt if there is no such vertex or the graph has no labels
+     */
+    std::optional<CsrVertexID> findVertex(const std::string& vertex_label) const;
+
+    /**
+     * Gets the offsets of the edges out of each vertex. Has one more entry than the number of vertices.
+     *
+     * @return The edge offsets
+     */
+    const std::vector<CsrEdgeID>& getEdgeOffsets() const { return m_edge_offsets; }
+
+    /**
+     * Gets the to vertex of each edge.
+     *
+     * @return The edge targets
+     */
+    const std::vector<CsrVertexID>& getEdgeTargets() const { return m_edge_targets; }
+
+    /**
+     * Gets the cost of each edge.
+     *
+     * @return The edge costs
+     */
+    const std::vector<double>& getEdgeCosts() const { return m_edge_costs; }
+
+    /**
+     * Writes the vertices and edges of the graph to the given binary stream. Labels are not written.
+     *
+     * @param out The stream to write to
+     * @return If the write succeeded
+     */
+    bool save(std::ostream& out) const;
+
+    /**
+     * Replaces this graph with one written by save. The loaded graph has no labels.
+     *
+     * @param in The binary stream to read from
+     * @return If the read succeeded. If not, the graph is left empty.
+     */
+    bool load(std::istream& in);
+
+private:
+    /**
+     * Removes all vertices, edges, and labels.
+     */
+    void clear();
+
+    /**
+     * Sets the inverse of each edge from the offsets and targets.
+     */
+    void computeInverseEdges();
+
+    /**
+     * Fills in the edge arrays from the given edges, and returns the original index of the edge at each edge ID.
+     *
+     * @param num_vertices The number of vertices
+     * @param edges The edges
+     * @return The index in edges of the edge given each edge ID
+     */
+    std::vector<std::size_t> buildEdges(std::size_t num_vertices, const std::vector<CsrGraphEdge>& edges);
+
+    std::vector<CsrEdgeID> m_edge_offsets;  ///< The edges out of vertex v have IDs from m_edge_offsets[v] up to m_edge_offsets[v + 1]
+    std::vector<CsrVertexID> m_edge_targets;  ///< The to vertex of each edge
+    std::vector<double> m_edge_costs;  ///< The cost of each edge
+    std::vector<CsrEdgeID> m_inverse_edges;  ///< The inverse of each edge. Equal to itself if there is no inverse
+
+    bool m_has_labels = false;  ///< Whether the graph has vertex and edge labels
+    std::vector<std::string> m_vertex_labels;  ///< The label of each vertex, or empty if there are no labels
+    std::vector<std::string> m_edge_labels;  ///< The label of each edge, or empty if there are no labels
+    std::unordered_map<std::string, CsrVertexID> m_vertex_ids;  ///< Map of vertex label to vertex ID
+};
+
+#endif  //CSR_GRAPH_H_
@@ -0,0 +1,16 @@
+#include "csr_graph_action.h"
+
+#include <ostream>
+
+std::ostream& operator<<(std::ostream& out, const CsrGraphAction& action) {
+    out << action.m_edge_id;
+    return out;
+}
+
+bool operator==(const CsrGraphAction& action1, const CsrGraphAction& action2) {
+    return action1.m_edge_id == action2.m_edge_id;
+}
+
+bool operator!=(const CsrGraphAction& action1, const CsrGraphAction& action2) {
+    return !(action1 == action2);
+}
@@ -0,0 +1,44 @@
+#ifndef CSR_GRAPH_ACTION_H_
+#define CSR_GRAPH_ACTION_H_
+
+#include "csr_graph.h"
+
+#include <ostream>
+
+/**
+ * An edge of a CsrGraph, as an action for CsrGraphTransitions.
+ *
+ * @struct CsrGraphAction
+ */
+struct CsrGraphAction {
+    CsrEdgeID m_edge_id = 0;  ///< The ID of the edge in the graph
+};
+
+/**
+ * Outputs a string representation of the edge action to the given output stream as the ID of the edge.
+ *
+ * @param out The output stream.
+ * @param action The edge action to output.
+ * @return The output stream.
+ */
+std::ostream& operator<<(std::ostream& out, const CsrGraphAction& action);
+
+/**
+ * Defines equality of two edge actions.
+ *
+ * @param action1 The first action to test.
+ * @param action2 The second action to test.
+ * @return If the actions are equal or not.
+ */
+bool operator==(const CsrGraphAction& action1, const CsrGraphAction& action2);
+
+/**
+ * Defines inequality for edge actions.
+ *
+ * @param action1 The first action to compare.
+ * @param action2 The second action to compare.
+ * @return If the actions are not equal.
+ */
+bool operator!=(const CsrGraphAction& action1, const CsrGraphAction& action2);
+
+#endif  //CSR_GRAPH_ACTION_H_
@@ -0,0 +1,476 @@
+#include "csr_graph_loading.h"
+#include "csr_graph.h"
+#include "utils/io_utils.h"
+
+#include <algorithm>
+#include <cassert>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace {
+    constexpr uint64_t CACHE_MARKER = 0x3148434143525343;  ///< Written at the start of cache files ("CSRCACH1")
+
+    /**
+     * Reads whitespace-separated fields from a single line.
+     */
+    class LineFields {
+    public:
+        explicit LineFields(std::string_view line) : m_line(line) {}
+
+        /**
+         * Reads the next field as a word.
+         */
+        bool readWord(std::string_view& word) {
+            skipSpaces();
+            std::size_t end = m_position;
+            while (end < m_line.size() && !isSpace(m_line[end])) {
+                end++;
+            }
+            word = m_line.substr(m_position, end - m_position);
+            m_position = end;
+            return !word.empty();
+        }
+
+        /**
+         * Reads the next field as a number.
+         */
+        template<class Value_t>
+        bool readNumber(Value_t& value) {
+            skipSpaces();
+            const char* first = m_line.data() + m_position;
+            const char* last = m_line.data() + m_line.size();
+            auto [end, error] = std::from_chars(first, last, value);
+            if (error != std::errc() || (end != last && !isSpace(*end))) {
+                return false;
+            }
+            m_position += static_cast<std::size_t>(end - first);
+            return true;
+        }
+
+        /**
+         * Checks if all fields have been read.
+         */
+        bool isAtEnd() {
+            skipSpaces();
+            return m_position == m_line.size();
+        }
+
+    private:
+        static bool isSpace(char character) { return character == ' ' || character == '\t' || character == '\r'; }
+
+        void skipSpaces() {
+            while (m_position < m_line.size() && isSpace(m_line[m_position])) {
+                m_position++;
+            }
+        }
+
+        std::string_view m_line;  ///< The line being read
+        std::size_t m_position = 0;  ///< The position of the next unread character
+    };
+
+    /**
+     * Information shared by the chunks of a DIMACS file.
+     */
+    struct DimacsChunk {
+        std::optional<uint64_t> m_num_vertices;  ///< The number of vertices on the problem line, if it is in the chunk
+        uint64_t m_num_items = 0;  ///< The number of arcs or coordinates on the problem line
+        uint64_t m_max_vertex = 0;  ///< The largest vertex number in the chunk, numbered from 1
+    };
+
+    /**
+     * The arcs of a chunk of a DIMACS graph file.
+     */
+    struct DimacsGraphChunk : DimacsChunk {
+        std::vector<CsrGraphEdge> m_edges;  ///< The arcs in the chunk, with vertices numbered from 0
+    };
+
+    /**
+     * The vertex coordinates of a chunk of a DIMACS coordinate file.
+     */
+    struct DimacsCoordinatesChunk : DimacsChunk {
+        std::vector<std::pair<CsrVertexID, DimacsCoordinates>> m_coordinates;  ///< Vertex numbered from 0 and coordinates
+    };
+
+    /**
+     * Reads the given file in blocks of the given size, and passes the complete lines in each block to the given block
+     * parser in file order. The partial line at the end of a block is carried over to the start of the next, so a line
+     * longer than the block size is passed once it has been read completely. Returns whether the file could be read
+     * and the block parser succeeded on every block.
+     */
+    template<class BlockParser_t>
+    bool readInLineBlocks(const std::string& file_name, std::size_t block_size, const BlockParser_t& parse_block) {
+        assert(block_size > 0);
+        std::ifstream file(file_name, std::ios::binary);
+        if (file.fail()) {
+            std::cerr << "Could not open file: " << file_name << "\n";
+            return false;
+        }
+
+        std::string block;
+        std::size_t carried_size = 0;
+        while (true) {
+            block.resize(carried_size + block_size);
+            file.read(block.data() + carried_size, static_cast<std::streamsize>(block_size));
+            if (file.bad()) {
+                std::cerr << "Could not read file: " << file_name << "\n";
+                return false;
+            }
+            std::size_t block_end = carried_size + static_cast<std::size_t>(file.gcount());
+            bool is_last_block = file.eof();
+
+            // npos + 1 wraps to 0, so a block without a line break is carried over whole
+            std::size_t lines_end = is_last_block ? block_end : block.rfind('\n', block_end - 1) + 1;
+            if (lines_end > 0 && !parse_block(std::string_view(block.data(), lines_end))) {
+                return false;
+            }
+            if (is_last_block) {
+                return true;
+            }
+            std::copy(block.begin() + lines_end, block.begin() + block_end, block.begin());
+            carried_size = block_end - lines_end;
+        }
+    }
+
+    /**
+     * Splits the given text into the given number of chunks of about equal size that end at line boundaries, parses
+     * the lines of each chunk on a separate thread, and returns the chunks. If any line cannot be parsed, prints the
+     * first such line in the text and returns std::nullopt.
+     *
+     * The line parser is given each line and the chunk it is in, and returns whether the line could be parsed.
+     */
+    template<class Chunk_t, class LineParser_t>
+    std::optional<std::vector<Chunk_t>> parseInChunks(std::string_view text, unsigned num_threads,
+              const LineParser_t& parse_line) {
+        assert(num_threads > 0);
+        std::vector<std::size_t> boundaries = {0};
+        for (unsigned chunk = 1; chunk < num_threads; ++chunk) {
+            std::size_t boundary = std::max(boundaries.back(), text.size() * chunk / num_threads);
+            boundary = text.find('\n', boundary);
+            boundaries.push_back(boundary == std::string_view::npos ? text.size() : boundary + 1);
+        }
+        boundaries.push_back(text.size());
+
+        std::vector<Chunk_t> chunks(num_threads);
+        std::vector<std::optional<std::string_view>> bad_lines(num_threads);
+        auto parse_chunk = [&](unsigned chunk) {
+            std::string_view chunk_text = text.substr(boundaries[chunk], boundaries[chunk + 1] - boundaries[chunk]);
+            while (!chunk_text.empty()) {
+                std::size_t line_end = std::min(chunk_text.find('\n'), chunk_text.size());
+                std::string_view line = chunk_text.substr(0, line_end);
+                if (!parse_line(line, chunks[chunk])) {
+                    bad_lines[chunk] = line;
+                    return;
+                }
+                chunk_text.remove_prefix(std::min(line_end + 1, chunk_text.size()));
+            }
+        };
+
+        std::vector<std::thread> workers;
+        for (unsigned chunk = 1; chunk < num_threads; ++chunk) {
+            workers.emplace_back(parse_chunk, chunk);
+        }
+        parse_chunk(0);
+        for (std::thread& worker : workers) {
+            worker.join();
+        }
+
+        for (const auto& bad_line : bad_lines) {
+            if (bad_line) {
+                std::cerr << "Could not parse line: " << *bad_line << "\n";
+                return std::nullopt;
+            }
+        }
+        return chunks;
+    }
+
+    /**
+     * Parses the start of a DIMACS line that is shared between file types. Returns whether the line is done with, and
+     * sets is_valid to whether it could be parsed.
+     */
+    bool parseDimacsCommonLine(LineFields& fields, std::string_view type, std::string_view expected_problem,
+              DimacsChunk& chunk, bool& is_valid) {
+        if (type.empty() || type == "c") {
+            is_valid = true;
+            return true;
+        }
+        if (type == "p") {
+            std::string_view problem;
+            std::string_view second_problem;
+            uint64_t num_vertices = 0;
+            is_valid = !chunk.m_num_vertices && fields.readWord(problem);
+            if (is_valid && expected_problem == "aux") {
+                is_valid = problem == "aux" && fields.readWord(problem) && problem == "sp" &&
+                           fields.readWord(second_problem) && second_problem == "co";
+            } else {
+                is_valid = is_valid && problem == expected_problem;
+            }
+            is_valid = is_valid && fields.readNumber(num_vertices);
+            if (is_valid && expected_problem == "sp") {
+                is_valid = fields.readNumber(chunk.m_num_items);
+            } else {
+                chunk.m_num_items = num_vertices;
+            }
+            is_valid = is_valid && fields.isAtEnd();
+            chunk.m_num_vertices = num_vertices;
+            return true;
+        }
+        return false;
+    }
+
+    /**
+     * Adds the problem line and largest vertex of the given chunk to the given summary of the chunks before it. Returns
+     * false if both have a problem line.
+     */
+    bool addDimacsChunk(DimacsChunk& summary, const DimacsChunk& chunk) {
+        if (chunk.m_num_vertices) {
+            if (summary.m_num_vertices) {
+                std::cerr << "DIMACS file has more than one problem line.\n";
+                return false;
+            }
+            summary.m_num_vertices = chunk.m_num_vertices;
+            summary.m_num_items = chunk.m_num_items;
+        }
+        summary.m_max_vertex = std::max(summary.m_max_vertex, chunk.m_max_vertex);
+        return true;
+    }
+
+    /**
+     * Checks that the summary of all chunks has a problem line, that it has the number of items found, and that every
+     * vertex is in range. Returns the number of vertices if so.
+     */
+    std::optional<uint64_t> checkDimacsSummary(const DimacsChunk& summary, uint64_t num_items) {
+        if (!summary.m_num_vertices) {
+            std::cerr << "DIMACS file has no problem line.\n";
+            return std::nullopt;
+        }
+        if (*summary.m_num_vertices >= std::numeric_limits<CsrVertexID>::max() ||
+                  summary.m_max_vertex > *summary.m_num_vertices) {
+            std::cerr << "DIMACS file has a vertex outside of the range given on the problem line.\n";
+            return std::nullopt;
+        }
+        if (num_items != summary.m_num_items) {
+            std::cerr << "DIMACS file has " << num_items << " lines, but the problem line gives " << summary.m_num_items
+                      << ".\n";
+            return std::nullopt;
+        }
+        return summary.m_num_vertices;
+    }
+
+    /**
+     * Gets the modification time of the given file as a count of ticks.
+     */
+    int64_t getModificationTime(const std::string& file_name, std::error_code& error) {
+        return static_cast<int64_t>(std::filesystem::last_write_time(file_name, error).time_since_epoch().count());
+    }
+}  // namespace
+
+std::optional<CsrGraph> loadDimacsGraph(const std::string& file_name, unsigned num_threads, std::size_t block_size) {
+    auto parse_line = [](std::string_view line, DimacsGraphChunk& chunk) {
+        LineFields fields(line);
+        std::string_view type;
+        fields.readWord(type);
+        bool is_valid = false;
+        if (parseDimacsCommonLine(fields, type, "sp", chunk, is_valid)) {
+            return is_valid;
+        }
+
+        uint64_t from_vertex = 0;
+        uint64_t to_vertex = 0;
+        double cost = 0.0;
+        if (type != "a" || !fields.readNumber(from_vertex) || !fields.readNumber(to_vertex) || !fields.readNumber(cost) ||
+                  !fields.isAtEnd() || from_vertex == 0 || to_vertex == 0) {
+            return false;
+        }
+        chunk.m_max_vertex = std::max({chunk.m_max_vertex, from_vertex, to_vertex});
+        if (chunk.m_max_vertex >= std::numeric_limits<CsrVertexID>::max()) {
+            return false;
+        }
+        chunk.m_edges.push_back({static_cast<CsrVertexID>(from_vertex - 1), static_cast<CsrVertexID>(to_vertex - 1), cost});
+        return true;
+    };
+
+    // Each arc line has at least 8 characters, which bounds the space reserved for a malformed problem line
+    std::error_code error;
+    auto max_edges = static_cast<uint64_t>(std::filesystem::file_size(file_name, error) / 8);
+    DimacsChunk summary;
+    std::vector<CsrGraphEdge> edges;
+    auto parse_block = [&](std::string_view block) {
+        auto chunks = parseInChunks<DimacsGraphChunk>(block, num_threads, parse_line);
+        if (!chunks) {
+            return false;
+        }
+        for (const DimacsGraphChunk& chunk : *chunks) {
+            if (!addDimacsChunk(summary, chunk)) {
+                return false;
+            }
+            if (chunk.m_num_vertices && !error) {
+                edges.reserve(std::min(chunk.m_num_items, max_edges));
+            }
+            edges.insert(edges.end(), chunk.m_edges.begin(), chunk.m_edges.end());
+        }
+        return true;
+    };
+    if (!readInLineBlocks(file_name, block_size, parse_block)) {
+        return std::nullopt;
+    }
+
+    std::optional<uint64_t> num_vertices = checkDimacsSummary(summary, edges.size());
+    if (!num_vertices) {
+        return std::nullopt;
+    }
+    return CsrGraph(*num_vertices, edges);
+}
+
+std::optional<std::vector<DimacsCoordinates>> loadDimacsCoordinates(const std::string& file_name, unsigned num_threads,
+          std::size_t block_size) {
+    auto parse_line = [](std::string_view line, DimacsCoordinatesChunk& chunk) {
+        LineFields fields(line);
+        std::string_view type;
+        fields.readWord(type);
+        bool is_valid = false;
+        if (parseDimacsCommonLine(fields, type, "aux", chunk, is_valid)) {
+            return is_valid;
+        }
+
+        uint64_t vertex = 0;
+        DimacsCoordinates coordinates;
+        if (type != "v" || !fields.readNumber(vertex) || !fields.readNumber(coordinates.m_x) ||
+                  !fields.readNumber(coordinates.m_y) || !fields.isAtEnd() || vertex == 0 ||
+                  vertex >= std::numeric_limits<CsrVertexID>::max()) {
+            return false;
+        }
+        chunk.m_max_vertex = std::max(chunk.m_max_vertex, vertex);
+        chunk.m_coordinates.emplace_back(static_cast<CsrVertexID>(vertex - 1), coordinates);
+        return true;
+    };
+
+    DimacsChunk summary;
+    uint64_t num_coordinates = 0;
+    std::vector<DimacsCoordinates> all_coordinates;
+    auto parse_block = [&](std::string_view block) {
+        auto chunks = parseInChunks<DimacsCoordinatesChunk>(block, num_threads, parse_line);
+        if (!chunks) {
+            return false;
+        }
+        for (const DimacsCoordinatesChunk& chunk : *chunks) {
+            if (!addDimacsChunk(summary, chunk)) {
+                return false;
+            }
+            if (summary.m_num_vertices && summary.m_max_vertex > *summary.m_num_vertices) {
+                std::cerr << "DIMACS file has a vertex outside of the range given on the problem line.\n";
+                return false;
+            }
+            all_coordinates.resize(std::max(all_coordinates.size(), static_cast<std::size_t>(summary.m_max_vertex)));
+            for (const auto& [vertex, coordinates] : chunk.m_coordinates) {
+                all_coordinates[vertex] = coordinates;
+            }
+            num_coordinates += chunk.m_coordinates.size();
+        }
+        return true;
+    };
+    if (!readInLineBlocks(file_name, block_size, parse_block)) {
+        return std::nullopt;
+    }
+
+    std::optional<uint64_t> num_vertices = checkDimacsSummary(summary, num_coordinates);
+    if (!num_vertices) {
+        return std::nullopt;
+    }
+    all_coordinates.resize(*num_vertices);
+    return all_coordinates;
+}
+
+std::optional<CsrGraph> loadBinaryEdgeList(const std::string& file_name, std::size_t num_vertices) {
+    static_assert(sizeof(CsrGraphEdge) == 16, "Binary edge lists use 16 byte records");
+
+    std::ifstream file(file_name, std::ios::binary | std::ios::ate);
+    if (file.fail()) {
+        std::cerr << "Could not open file: " << file_name << "\n";
+        return std::nullopt;
+    }
+    auto file_size = static_cast<std::size_t>(file.tellg());
+    if (file_size % sizeof(CsrGraphEdge) != 0) {
+        std::cerr << "Binary edge list " << file_name << " does not hold a whole number of edges.\n";
+        return std::nullopt;
+    }
+
+    std::vector<CsrGraphEdge> edges(file_size / sizeof(CsrGraphEdge));
+    file.seekg(0);
+    file.read(reinterpret_cast<char*>(edges.data()), static_cast<std::streamsize>(file_size));
+    if (!file) {
+        std::cerr << "Could not read binary edge list " << file_name << "\n";
+        return std::nullopt;
+    }
+
+    CsrVertexID max_vertex = 0;
+    for (const CsrGraphEdge& edge : edges) {
+        max_vertex = std::max({max_vertex, edge.m_from_vertex_id, edge.m_to_vertex_id});
+    }
+    if (num_vertices == 0 && !edges.empty()) {
+        num_vertices = static_cast<std::size_t>(max_vertex) + 1;
+    } else if (!edges.empty() && max_vertex >= num_vertices) {
+        std::cerr << "Binary edge list " << file_name << " has a vertex outside of the given range.\n";
+        return std::nullopt;
+    }
+    return CsrGraph(num_vertices, edges);
+}
+
+bool writeBinaryEdgeList(const std::vector<CsrGraphEdge>& edges, const std::string& file_name) {
+    std::ofstream file(file_name, std::ios::binary | std::ios::trunc);
+    file.write(reinterpret_cast<const char*>(edges.data()), static_cast<std::streamsize>(edges.size() * sizeof(CsrGraphEdge)));
+    if (!file) {
+        std::cerr << "Could not write binary edge list " << file_name << "\n";
+        return false;
+    }
+    return true;
+}
+
+std::optional<CsrGraph> loadCsrGraphWithCache(const std::string& file_name, const std::string& cache_file_name,
+          const std::function<std::optional<CsrGraph>(const std::string&)>& loader) {
+    std::error_code error;
+    auto file_size = static_cast<uint64_t>(std::filesystem::file_size(file_name, error));
+    int64_t modification_time = error ? 0 : getModificationTime(file_name, error);
+    if (error) {
+        std::cerr << "Could not find file: " << file_name << "\n";
+        return std::nullopt;
+    }
+
+    std::ifstream cache_in(cache_file_name, std::ios::binary);
+    if (cache_in) {
+        uint64_t marker = 0;
+        uint64_t cached_size = 0;
+        int64_t cached_time = 0;
+        CsrGraph graph;
+        if (readBinaryValue(cache_in, marker) && marker == CACHE_MARKER && readBinaryValue(cache_in, cached_size) &&
+                  cached_size == file_size && readBinaryValue(cache_in, cached_time) &&
+                  cached_time == modification_time && graph.load(cache_in)) {
+            return graph;
+        }
+    }
+    cache_in.close();
+
+    std::optional<CsrGraph> graph = loader(file_name);
+    if (graph) {
+        std::ofstream cache_out(cache_file_name, std::ios::binary | std::ios::trunc);
+        writeBinaryValue(cache_out, CACHE_MARKER);
+        writeBinaryValue(cache_out, file_size);
+        writeBinaryValue(cache_out, modification_time);
+        if (!graph->save(cache_out)) {
+            std::cerr << "Could not write graph cache file: " << cache_file_name << "\n";
+        }
+    }
+    return graph;
+}
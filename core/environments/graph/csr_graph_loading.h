@@ -0,0 +1,92 @@
+#ifndef CSR_GRAPH_LOADING_H_
+#define CSR_GRAPH_LOADING_H_
+
+#include "csr_graph.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <string>
+#include <vector>
+
+/**
+ * Loaders for large graphs that build a CsrGraph directly with integer vertex IDs, without labels.
+ *
+ * Text files are streamed in fixed-size blocks, with the partial line at the end of each block carried over to the
+ * next. Each block is split into chunks at line boundaries, which are parsed on separate threads. The results of the
+ * chunks are appended in file order, so the graph does not depend on the number of threads or the block size.
+ *
+ * @file csr_graph_loading.h
+ */
+
+constexpr std::size_t DIMACS_BLOCK_SIZE = std::size_t{1} << 24;  ///< The default number of bytes read at a time
+
+/**
+ * The coordinates of a vertex, as given in a DIMACS coordinate file.
+ */
+struct DimacsCoordinates {
+    int64_t m_x = 0;  ///< The x coordinate, which is the longitude in the DIMACS road networks
+    int64_t m_y = 0;  ///< The y coordinate, which is the latitude in the DIMACS road networks
+};
+
+/**
+ * Loads a graph in the DIMACS shortest path format (.gr). The file has a problem line "p sp <vertices> <arcs>", and one
+ * "a <from> <to> <cost>" line per arc, with vertices numbered from 1. Lines starting with "c" are comments. Vertex v in
+ * the file is vertex v - 1 in the graph.
+ *
+ * @param file_name The name of the file to load
+ * @param num_threads The number of threads to parse with. Must be positive.
+ * @param block_size The number of bytes to read from the file at a time. Must be positive.
+ * @return The graph, or std::nullopt if the file could not be read or is malformed
+ */
+std::optional<CsrGraph> loadDimacsGraph(const std::string& file_name, unsigned num_threads = 1,
+          std::size_t block_size = DIMACS_BLOCK_SIZE);
+
+/**
+ * Loads the vertex coordinates in the DIMACS coordinate format (.co). The file has a problem line
+ * "p aux sp co <vertices>", and one "v <vertex> <x> <y>" line per vertex, with vertices numbered from 1. Lines starting
+ * with "c" are comments.
+ *
+ * @param file_name The name of the file to load
+ * @param num_threads The number of threads to parse with. Must be positive.
+ * @param block_size The number of bytes to read from the file at a time. Must be positive.
+ * @return The coordinates of each vertex, indexed by vertex ID in the graph, or std::nullopt if the file could not be
+ *         read or is malformed
+ */
+std::optional<std::vector<DimacsCoordinates>> loadDimacsCoordinates(const std::string& file_name, unsigned num_threads = 1,
+          std::size_t block_size = DIMACS_BLOCK_SIZE);
+
+/**
+ * Loads a graph from a binary edge list, which is a sequence of CsrGraphEdge records with no header: the from vertex
+ * and to vertex as 4-byte unsigned integers, and the cost as an 8-byte double, in the byte order of the machine.
+ *
+ * @param file_name The name of the file to load
+ * @param num_vertices The number of vertices. If 0, it is one more than the largest vertex ID in the file.
+ * @return The graph, or std::nullopt if the file could not be read or is malformed
+ */
+std::optional<CsrGraph> loadBinaryEdgeList(const std::string& file_name, std::size_t num_vertices = 0);
+
+/**
+ * Writes the given edges as a binary edge list that can be read by loadBinaryEdgeList.
+ *
+ * @param edges The edges to write
+ * @param file_name The name of the file to write. Overwritten if it exists.
+ * @return If the write succeeded
+ */
+bool writeBinaryEdgeList(const std::vector<CsrGraphEdge>& edges, const std::string& file_name);
+
+/**
+ * Loads a graph through a binary cache file. If the cache file was written for the current size and modification time
+ * of the source file, the graph is read from the cache. Otherwise, the graph is loaded with the given loader and the
+ * cache file is rewritten.
+ *
+ * @param file_name The name of the source file
+ * @param cache_file_name The name of the cache file
+ * @param loader Loads the graph from the source file
+ * @return The graph, or std::nullopt if neither the cache nor the loader gave one
+ */
+std::optional<CsrGraph> loadCsrGraphWithCache(const std::string& file_name, const std::string& cache_file_name,
+          const std::function<std::optional<CsrGraph>(const std::string&)>& loader);
+
+#endif  //CSR_GRAPH_LOADING_H_
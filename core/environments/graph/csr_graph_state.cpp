@@ -0,0 +1,21 @@
+#include "csr_graph_state.h"
+#include "utils/byte_sink.h"
+
+#include <ostream>
+
+std::ostream& operator<<(std::ostream& out, const CsrGraphState& state) {
+    out << state.m_vertex_id;
+    return out;
+}
+
+bool operator==(const CsrGraphState& state1, const CsrGraphState& state2) {
+    return state1.m_vertex_id == state2.m_vertex_id;
+}
+
+bool operator!=(const CsrGraphState& state1, const CsrGraphState& state2) {
+    return !(state1 == state2);
+}
+
+void serialize(ByteSink& sink, const CsrGraphState& state) {
+    sink.write(state.m_vertex_id);
+}
@@ -0,0 +1,56 @@
+#ifndef CSR_GRAPH_STATE_H_
+#define CSR_GRAPH_STATE_H_
+
+#include "csr_graph.h"
+#include "utils/byte_sink.h"
+
+#include <ostream>
+
+/**
+ * A vertex of a CsrGraph, as a state for CsrGraphTransitions. Unlike GraphState, it does not store a pointer to the
+ * graph, so it only takes four bytes.
+ *
+ * @struct CsrGraphState
+ */
+struct CsrGraphState {
+    CsrVertexID m_vertex_id = 0;  ///< The ID of the vertex in the graph
+};
+
+static_assert(sizeof(CsrGraphState) == sizeof(CsrVertexID), "CsrGraphState should only store the vertex ID");
+
+/**
+ * Outputs a string representation of the state to the given output stream as the ID of the vertex.
+ *
+ * @param out The output stream.
+ * @param state The vertex state to output.
+ * @return The output stream.
+ */
+std::ostream& operator<<(std::ostream& out, const CsrGraphState& state);
+
+/**
+ * Defines equality of two vertex states.
+ *
+ * @param state1 The first state to test.
+ * @param state2 The second state to test.
+ * @return If the states are equal or not.
+ */
+bool operator==(const CsrGraphState& state1, const CsrGraphState& state2);
+
+/**
+ * Defines inequality for vertex states.
+ *
+ * @param state1 The first state to compare.
+ * @param state2 The second state to compare.
+ * @return If the states are not equal.
+ */
+bool operator!=(const CsrGraphState& state1, const CsrGraphState& state2);
+
+/**
+ * Writes the vertex state to the given byte sink.
+ *
+ * @param sink The byte sink to write to.
+ * @param state The vertex state to write.
+ */
+void serialize(ByteSink& sink, const CsrGraphState& state);
+
+#endif  //CSR_GRAPH_STATE_H_
@@ -0,0 +1,53 @@
+#include "csr_graph_transitions.h"
+#include "csr_graph.h"
+#include "csr_graph_action.h"
+#include "csr_graph_state.h"
+
+#include <cassert>
+#include <optional>
+#include <vector>
+
+CsrGraphTransitions::CsrGraphTransitions(const CsrGraph& graph)
+          : m_graph(&graph) {
+}
+
+bool CsrGraphTransitions::isApplicable(const CsrGraphState& state, const CsrGraphAction& action) const {
+    assert(state.m_vertex_id < m_graph->getNumVertices());
+    return m_graph->getOutEdges(state.m_vertex_id).contains(action.m_edge_id);
+}
+
+double CsrGraphTransitions::getActionCost(const CsrGraphState& state, const CsrGraphAction& action) const {
+    assert(isApplicable(state, action));
+    return m_graph->getEdgeCost(action.m_edge_id);
+}
+
+void CsrGraphTransitions::applyAction(CsrGraphState& state, const CsrGraphAction& action) const {
+    assert(isApplicable(state, action));
+    state.m_vertex_id = m_graph->getEdgeTarget(action.m_edge_id);
+}
+
+std::vector<CsrGraphAction> CsrGraphTransitions::getActions(const CsrGraphState& state) const {
+    assert(state.m_vertex_id < m_graph->getNumVertices());
+
+    CsrEdgeRange out_edges = m_graph->getOutEdges(state.m_vertex_id);
+    std::vector<CsrGraphAction> actions;
+    actions.reserve(out_edges.size());
+    for (CsrEdgeID edge_id : out_edges) {
+        actions.push_back({edge_id});
+    }
+    return actions;
+}
+
+std::optional<CsrGraphAction> CsrGraphTransitions::getInverse(const CsrGraphState& state,
+          const CsrGraphAction& action) const {
+    assert(isApplicable(state, action));
+    std::optional<CsrEdgeID> inverse = m_graph->getInverseEdge(action.m_edge_id);
+    if (inverse) {
+        return CsrGraphAction{*inverse};
+    }
+    return std::nullopt;
+}
+
+bool CsrGraphTransitions::isValidState(const CsrGraphState& state) const {
+    return state.m_vertex_id < m_graph->getNumVertices();
+}
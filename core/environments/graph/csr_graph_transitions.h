@@ -0,0 +1,74 @@
+#ifndef CSR_GRAPH_TRANSITIONS_H_
+#define CSR_GRAPH_TRANSITIONS_H_
+
+#include "csr_graph.h"
+#include "csr_graph_action.h"
+#include "csr_graph_state.h"
+#include "logging/logging_terms.h"
+#include "logging/search_component_settings.h"
+#include "search_basics/transition_system.h"
+
+#include <optional>
+#include <string>
+#include <vector>
+
+/**
+ * Defines the transitions for a CsrGraph environment.
+ *
+ * Besides the usual TransitionSystem methods, getOutEdges gives the edges out of a state without allocating, for code
+ * that loops over successors directly.
+ *
+ * @class CsrGraphTransitions
+ */
+class CsrGraphTransitions : public TransitionSystem<CsrGraphState, CsrGraphAction> {
+public:
+    inline static const std::string CLASS_NAME = "CsrGraphTransitions";  ///< The name of this class
+
+    /**
+     * Creates transitions for the given graph.
+     *
+     * @param graph The graph this transitions system will be based on
+     */
+    explicit CsrGraphTransitions(const CsrGraph& graph);
+
+    /**
+     * Default destructor.
+     */
+    ~CsrGraphTransitions() override = default;
+
+    /**
+     * Gets the graph the transitions are for.
+     *
+     * @return The graph
+     */
+    const CsrGraph& getGraph() const { return *m_graph; }
+
+    /**
+     * Gets the IDs of the edges out of the given state, which are the IDs of its applicable actions. Does not allocate.
+     *
+     * @param state The state to get the edges for
+     * @return The range of edge IDs
+     */
+    CsrEdgeRange getOutEdges(const CsrGraphState& state) const { return m_graph->getOutEdges(state.m_vertex_id); }
+
+    // Overriden public TransitionSystem methods
+    bool isApplicable(const CsrGraphState& state, const CsrGraphAction& action) const override;
+    double getActionCost(const CsrGraphState& state, const CsrGraphAction& action) const override;
+    void applyAction(CsrGraphState& state, const CsrGraphAction& action) const override;
+    std::vector<CsrGraphAction> getActions(const CsrGraphState& state) const override;
+    std::optional<CsrGraphAction> getInverse(const CsrGraphState& state, const CsrGraphAction& action) const override;
+    bool isValidState(const CsrGraphState& state) const override;
+
+    // Overriden public SettingsLogger methods
+    std::string getName() const override { return CLASS_NAME; }
+
+protected:
+    // Overriden protected SettingsLogger methods
+    StringMap getComponentSettings() const override { return {}; }
+    SearchSettingsMap getSubComponentSettings() const override { return {}; }
+
+private:
+    const CsrGraph* m_graph;  ///< The graph that the transitions correspond to
+};
+
+#endif /* CSR_GRAPH_TRANSITIONS_H_ */
@@ -0,0 +1,39 @@
+#ifndef CSR_VERTEX_HASH_FUNCTION_H_
+#define CSR_VERTEX_HASH_FUNCTION_H_
+
+#include "building_tools/hashing/state_hash_function.h"
+#include "csr_graph_state.h"
+#include "logging/logging_terms.h"
+#include "logging/search_component_settings.h"
+
+#include <cstdint>
+#include <string>
+
+/**
+ * A perfect hash function for CsrGraph vertex states, which uses the vertex ID.
+ *
+ * @class CsrVertexHashFunction
+ */
+class CsrVertexHashFunction : public StateHashFunction<CsrGraphState, uint32_t> {
+
+public:
+    inline static const std::string CLASS_NAME = "CsrVertexHashFunction";  ///< The name of the class. Defines this component's name
+
+    /**
+     * Default destructor.
+     */
+    ~CsrVertexHashFunction() override = default;
+
+    uint32_t getHashValue(const CsrGraphState& state) const override { return state.m_vertex_id; }
+    bool isPerfectHashFunction() const override { return true; }
+
+    // Overriden public SettingsLogger methods
+    std::string getName() const override { return CLASS_NAME; }
+
+protected:
+    // Overriden protected SettingsLogger methods
+    StringMap getComponentSettings() const override { return {}; }
+    SearchSettingsMap getSubComponentSettings() const override { return {}; }
+};
+
+#endif /* CSR_VERTEX_HASH_FUNCTION_H_ */
@@ -0,0 +1,475 @@
+#include "grid_cluster_abstraction.h"
+#include "grid_location.h"
+#include "grid_pathfinding_action.h"
+#include "grid_pathfinding_transitions.h"
+#include "utils/floating_point_utils.h"
+#include "utils/io_utils.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <optional>
+#include <queue>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace {
+    constexpr uint64_t FILE_MARKER = 0x31415048464553;  ///< Written at the start of saved abstractions ("SEFHPA1")
+    constexpr int MAX_SINGLE_TRANSITION_LENGTH = 6;  ///< Entrances shorter than this get a single transition
+}  // namespace
+
+GridClusterAbstraction::GridClusterAbstraction(const GridPathfindingTransitions& transitions, int cluster_size)
+          : m_transitions(&transitions), m_cluster_size(cluster_size) {
+    assert(cluster_size > 0);
+    assert(transitions.getCostType() == GridPathfindingCostType::standard);
+}
+
+void GridClusterAbstraction::clear() {
+    m_map_width = 0;
+    m_map_height = 0;
+    m_clusters_per_row = 0;
+    m_vertex_locations.clear();
+    m_cluster_vertices.clear();
+    m_edge_offsets.clear();
+    m_edge_targets.clear();
+    m_edge_costs.clear();
+}
+
+void GridClusterAbstraction::build(unsigned num_threads) {
+    assert(num_threads > 0);
+    clear();
+    m_map_width = m_transitions->getMapWidth();
+    m_map_height = m_transitions->getMapHeight();
+    m_clusters_per_row = (m_map_width + m_cluster_size - 1) / m_cluster_size;
+    int clusters_per_column = (m_map_height + m_cluster_size - 1) / m_cluster_size;
+    m_cluster_vertices.resize(static_cast<std::size_t>(m_clusters_per_row) * clusters_per_column);
+
+    std::vector<int64_t> vertex_at_location(static_cast<std::size_t>(m_map_width) * m_map_height, -1);
+    std::vector<std::vector<std::pair<VertexID, double>>> out_edges;
+    addBorderEntrances(GridDirection::east, vertex_at_location, out_edges);
+    addBorderEntrances(GridDirection::south, vertex_at_location, out_edges);
+    out_edges.resize(m_vertex_locations.size());
+
+    // Each cluster only adds edges out of its own vertices, so clusters can be handled by different threads
+    std::atomic<std::size_t> next_cluster(0);
+    auto add_cluster_edges = [&]() {
+        for (std::size_t cluster = next_cluster++; cluster < m_cluster_vertices.size(); cluster = next_cluster++) {
+            addIntraClusterEdges(cluster, out_edges);
+        }
+    };
+    std::vector<std::thread> workers;
+    for (unsigned thread = 1; thread < num_threads; ++thread) {
+        workers.emplace_back(add_cluster_edges);
+    }
+    add_cluster_edges();
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+
+    m_edge_offsets.reserve(out_edges.size() + 1);
+    m_edge_offsets.push_back(0);
+    for (const auto& vertex_edges : out_edges) {
+        for (const auto& [target, cost] : vertex_edges) {
+            m_edge_targets.push_back(target);
+            m_edge_costs.push_back(cost);
+        }
+        m_edge_offsets.push_back(m_edge_targets.size());
+    }
+}
+
+void GridClusterAbstraction::addBorderEntrances(GridDirection crossing, std::vector<int64_t>& vertex_at_location,
+          std::vector<std::vector<std::pair<VertexID, double>>>& out_edges) {
+    assert(crossing == GridDirection::east || crossing == GridDirection::south);
+    bool is_vertical_border = crossing == GridDirection::east;
+    int border_length = is_vertical_border ? m_map_height : m_map_width;
+    int across_length = is_vertical_border ? m_map_width : m_map_height;
+
+    // For each border, walks along it one cluster at a time, so that entrances do not span clusters
+    for (int border = m_cluster_size - 1; border + 1 < across_length; border += m_cluster_size) {
+        for (int cluster_start = 0; cluster_start < border_length; cluster_start += m_cluster_size) {
+            int cluster_end = std::min(cluster_start + m_cluster_size, border_length);
+            std::optional<GridLocation> run_start;
+            GridLocation run_end;
+
+            for (int along = cluster_start; along < cluster_end; ++along) {
+                GridLocation location = is_vertical_border ? GridLocation(border, along) : GridLocation(along, border);
+                if (m_transitions->isValidState(location) && m_transitions->isApplicable(location, crossing)) {
+                    if (!run_start) {
+                        run_start = location;
+                    }
+                    run_end = location;
+                } else if (run_start) {
+                    addEntrance(*run_start, run_end, crossing, vertex_at_location, out_edges);
+                    run_start.reset();
+                }
+            }
+            if (run_start) {
+                addEntrance(*run_start, run_end, crossing, vertex_at_location, out_edges);
+            }
+        }
+    }
+}
+
+void GridClusterAbstraction::addEntrance(const GridLocation& run_start, const GridLocation& run_end,
+          GridDirection crossing, std::vector<int64_t>& vertex_at_location,
+          std::vector<std::vector<std::pair<VertexID, double>>>& out_edges) {
+    int run_length = std::max(run_end.m_x_coord - run_start.m_x_coord, run_end.m_y_coord - run_start.m_y_coord) + 1;
+
+    std::vector<GridLocation> transition_locations;
+    if (run_length < MAX_SINGLE_TRANSITION_LENGTH) {
+        transition_locations.emplace_back((run_start.m_x_coord + run_end.m_x_coord) / 2,
+                  (run_start.m_y_coord + run_end.m_y_coord) / 2);
+    } else {
+        transition_locations.push_back(run_start);
+        transition_locations.push_back(run_end);
+    }
+
+    GridDirection inverse = m_transitions->getInverse(run_start, crossing).value();
+    for (const GridLocation& location : transition_locations) {
+        GridLocation other_side = location;
+        m_transitions->applyAction(other_side, crossing);
+
+        VertexID vertex = addVertex(location, vertex_at_location);
+        VertexID other_vertex = addVertex(other_side, vertex_at_location);
+        out_edges.resize(m_vertex_locations.size());
+        out_edges[vertex].emplace_back(other_vertex, m_transitions->getActionCost(location, crossing));
+        out_edges[other_vertex].emplace_back(vertex, m_transitions->getActionCost(other_side, inverse));
+    }
+}
+
+GridClusterAbstraction::VertexID GridClusterAbstraction::addVertex(const GridLocation& location,
+          std::vector<int64_t>& vertex_at_location) {
+    int64_t& vertex = vertex_at_location[location.m_x_coord + static_cast<std::size_t>(location.m_y_coord) * m_map_width];
+    if (vertex < 0) {
+        vertex = static_cast<int64_t>(m_vertex_locations.size());
+        m_vertex_locations.push_back(location);
+        m_cluster_vertices[getCluster(location)].push_back(static_cast<VertexID>(vertex));
+    }
+    return static_cast<VertexID>(vertex);
+}
+
+void GridClusterAbstraction::addIntraClusterEdges(std::size_t cluster,
+          std::vector<std::vector<std::pair<VertexID, double>>>& out_edges) const {
+    const std::vector<VertexID>& vertices = m_cluster_vertices[cluster];
+    for (VertexID vertex : vertices) {
+        ClusterSearchResult result = searchInCluster(m_vertex_locations[vertex], std::nullopt);
+        for (VertexID other_vertex : vertices) {
+            double distance = result.m_distances[getPositionInCluster(m_vertex_locations[other_vertex])];
+            if (other_vertex != vertex && distance >= 0.0) {
+                out_edges[vertex].emplace_back(other_vertex, distance);
+            }
+        }
+    }
+}
+
+std::size_t GridClusterAbstraction::getCluster(const GridLocation& location) const {
+    return static_cast<std::size_t>(location.m_x_coord / m_cluster_size) +
+           static_cast<std::size_t>(location.m_y_coord / m_cluster_size) * m_clusters_per_row;
+}
+
+std::size_t GridClusterAbstraction::getPositionInCluster(const GridLocation& location) const {
+    return static_cast<std::size_t>(location.m_x_coord % m_cluster_size) +
+           static_cast<std::size_t>(location.m_y_coord % m_cluster_size) * m_cluster_size;
+}
+
+GridClusterAbstraction::ClusterSearchResult GridClusterAbstraction::searchInCluster(const GridLocation& start,
+          const std::optional<GridLocation>& target) const {
+    int min_x = start.m_x_coord - start.m_x_coord % m_cluster_size;
+    int min_y = start.m_y_coord - start.m_y_coord % m_cluster_size;
+    int max_x = std::min(min_x + m_cluster_size, m_map_width);
+    int max_y = std::min(min_y + m_cluster_size, m_map_height);
+
+    std::size_t num_positions = static_cast<std::size_t>(m_cluster_size) * m_cluster_size;
+    ClusterSearchResult result;
+    result.m_distances.assign(num_positions, -1.0);
+    result.m_parent_actions.assign(num_positions, GridDirection::north);
+    std::vector<bool> is_closed(num_positions, false);
+
+    using QueueEntry = std::pair<double, std::size_t>;
+    std::priority_queue<QueueEntry, std::vector<QueueEntry>, std::greater<>> open;
+    std::size_t start_position = getPositionInCluster(start);
+    result.m_distances[start_position] = 0.0;
+    open.emplace(0.0, start_position);
+
+    std::optional<std::size_t> target_position;
+    if (target) {
+        target_position = getPositionInCluster(*target);
+    }
+
+    while (!open.empty()) {
+        auto [distance, position] = open.top();
+        open.pop();
+        if (is_closed[position]) {
+            continue;
+        }
+        is_closed[position] = true;
+        if (position == target_position) {
+            break;
+        }
+
+        GridLocation location(min_x + static_cast<int>(position % m_cluster_size),
+                  min_y + static_cast<int>(position / m_cluster_size));
+        for (GridDirection action : m_transitions->getActions(location)) {
+            GridLocation child = location;
+            m_transitions->applyAction(child, action);
+            if (child.m_x_coord < min_x || child.m_x_coord >= max_x || child.m_y_coord < min_y || child.m_y_coord >= max_y) {
+                continue;
+            }
+
+            std::size_t child_position = getPositionInCluster(child);
+            double child_distance = distance + m_transitions->getActionCost(location, action);
+            if (result.m_distances[child_position] < 0.0 || fpLess(child_distance, result.m_distances[child_position])) {
+                result.m_distances[child_position] = child_distance;
+                result.m_parent_actions[child_position] = action;
+                open.emplace(child_distance, child_position);
+            }
+        }
+    }
+    return result;
+}
+
+double GridClusterAbstraction::getHeuristicValue(const GridLocation& from, const GridLocation& to) const {
+    int delta_x = std::abs(from.m_x_coord - to.m_x_coord);
+    int delta_y = std::abs(from.m_y_coord - to.m_y_coord);
+    if (m_transitions->getConnectionType() == GridConnectionType::four) {
+        return delta_x + delta_y;
+    }
+    double diagonal_cost = std::min(m_transitions->getDiagonalCost(), 2.0);
+    return std::min(delta_x, delta_y) * diagonal_cost + std::abs(delta_x - delta_y);
+}
+
+GridAbstractPath GridClusterAbstraction::findAbstractPath(const GridLocation& start, const GridLocation& goal) const {
+    GridAbstractPath path;
+    if (m_cluster_vertices.empty() || !m_transitions->isValidState(start) || !m_transitions->isValidState(goal)) {
+        return path;
+    }
+    if (start == goal) {
+        path.m_found_path = true;
+        path.m_waypoints.push_back(start);
+        path.m_cost = 0.0;
+        return path;
+    }
+
+    // The start and goal are added as two extra vertices, connected to the vertices of their clusters
+    std::size_t num_vertices = m_vertex_locations.size();
+    VertexID start_vertex = num_vertices;
+    VertexID goal_vertex = num_vertices + 1;
+    auto get_location = [&](VertexID vertex) -> const GridLocation& {
+        if (vertex == start_vertex) {
+            return start;
+        }
+        return vertex == goal_vertex ? goal : m_vertex_locations[vertex];
+    };
+
+    std::vector<std::pair<VertexID, double>> start_edges;
+    ClusterSearchResult start_search = searchInCluster(start, std::nullopt);
+    for (VertexID vertex : m_cluster_vertices[getCluster(start)]) {
+        double distance = start_search.m_distances[getPositionInCluster(m_vertex_locations[vertex])];
+        if (distance >= 0.0) {
+            start_edges.emplace_back(vertex, distance);
+        }
+    }
+    if (getCluster(start) == getCluster(goal) && start_search.m_distances[getPositionInCluster(goal)] >= 0.0) {
+        start_edges.emplace_back(goal_vertex, start_search.m_distances[getPositionInCluster(goal)]);
+    }
+
+    // Costs are symmetric, so the distance from the goal to a vertex is also the distance from the vertex to the goal
+    std::vector<double> goal_distances(num_vertices, -1.0);
+    ClusterSearchResult goal_search = searchInCluster(goal, std::nullopt);
+    for (VertexID vertex : m_cluster_vertices[getCluster(goal)]) {
+        goal_distances[vertex] = goal_search.m_distances[getPositionInCluster(m_vertex_locations[vertex])];
+    }
+
+    std::vector<double> g_values(num_vertices + 2, std::numeric_limits<double>::infinity());
+    std::vector<VertexID> parents(num_vertices + 2, start_vertex);
+    std::vector<bool> is_closed(num_vertices + 2, false);
+    using QueueEntry = std::pair<double, VertexID>;
+    std::priority_queue<QueueEntry, std::vector<QueueEntry>, std::greater<>> open;
+
+    g_values[start_vertex] = 0.0;
+    open.emplace(getHeuristicValue(start, goal), start_vertex);
+    auto relax = [&](VertexID parent, VertexID child, double cost) {
+        double child_g = g_values[parent] + cost;
+        if (fpLess(child_g, g_values[child])) {
+            g_values[child] = child_g;
+            parents[child] = parent;
+            open.emplace(child_g + getHeuristicValue(get_location(child), goal), child);
+        }
+    };
+
+    while (!open.empty()) {
+        VertexID vertex = open.top().second;
+        open.pop();
+        if (is_closed[vertex]) {
+            continue;
+        }
+        is_closed[vertex] = true;
+        path.m_num_expansions++;
+        if (vertex == goal_vertex) {
+            break;
+        }
+
+        if (vertex == start_vertex) {
+            for (const auto& [child, cost] : start_edges) {
+                relax(vertex, child, cost);
+            }
+            continue;
+        }
+        for (std::size_t edge = m_edge_offsets[vertex]; edge < m_edge_offsets[vertex + 1]; ++edge) {
+            relax(vertex, m_edge_targets[edge], m_edge_costs[edge]);
+        }
+        if (goal_distances[vertex] >= 0.0) {
+            relax(vertex, goal_vertex, goal_distances[vertex]);
+        }
+    }
+
+    if (!is_closed[goal_vertex]) {
+        return path;
+    }
+    path.m_found_path = true;
+    path.m_cost = g_values[goal_vertex];
+    for (VertexID vertex = goal_vertex; vertex != start_vertex; vertex = parents[vertex]) {
+        if (path.m_waypoints.empty() || path.m_waypoints.back() != get_location(vertex)) {
+            path.m_waypoints.push_back(get_location(vertex));
+        }
+    }
+    if (path.m_waypoints.back() != start) {
+        path.m_waypoints.push_back(start);
+    }
+    std::reverse(path.m_waypoints.begin(), path.m_waypoints.end());
+    return path;
+}
+
+std::vector<GridDirection> GridClusterAbstraction::refineSegment(const GridAbstractPath& path,
+          std::size_t segment) const {
+    assert(segment + 1 < path.m_waypoints.size());
+    const GridLocation& from = path.m_waypoints[segment];
+    const GridLocation& to = path.m_waypoints[segment + 1];
+
+    // Segments between clusters are a single cardinal move over the border
+    if (getCluster(from) != getCluster(to)) {
+        for (GridDirection action : {GridDirection::north, GridDirection::east, GridDirection::south, GridDirection::west}) {
+            GridLocation child = from;
+            m_transitions->applyAction(child, action);
+            if (child == to) {
+                return {action};
+            }
+        }
+        assert(false);
+        return {};
+    }
+
+    ClusterSearchResult result = searchInCluster(from, to);
+    assert(result.m_distances[getPositionInCluster(to)] >= 0.0);
+    std::vector<GridDirection> actions;
+    for (GridLocation location = to; location != from;) {
+        GridDirection action = result.m_parent_actions[getPositionInCluster(location)];
+        actions.push_back(action);
+        m_transitions->applyAction(location, m_transitions->getInverse(location, action).value());
+    }
+    std::reverse(actions.begin(), actions.end());
+    return actions;
+}
+
+std::vector<GridDirection> GridClusterAbstraction::refinePath(const GridAbstractPath& path) const {
+    std::vector<GridDirection> actions;
+    for (std::size_t segment = 0; segment + 1 < path.m_waypoints.size(); ++segment) {
+        std::vector<GridDirection> segment_actions = refineSegment(path, segment);
+        actions.insert(actions.end(), segment_actions.begin(), segment_actions.end());
+    }
+    return actions;
+}
+
+bool GridClusterAbstraction::save(std::ostream& out) const {
+    writeBinaryValue(out, FILE_MARKER);
+    writeBinaryValue(out, static_cast<int32_t>(m_map_width));
+    writeBinaryValue(out, static_cast<int32_t>(m_map_height));
+    writeBinaryValue(out, static_cast<int32_t>(m_cluster_size));
+    writeBinaryValue(out, static_cast<uint8_t>(m_transitions->getConnectionType()));
+
+    std::vector<int32_t> coordinates;
+    coordinates.reserve(2 * m_vertex_locations.size());
+    for (const GridLocation& location : m_vertex_locations) {
+        coordinates.push_back(location.m_x_coord);
+        coordinates.push_back(location.m_y_coord);
+    }
+    writeBinaryVector(out, coordinates);
+
+    std::vector<uint64_t> offsets(m_edge_offsets.begin(), m_edge_offsets.end());
+    std::vector<uint64_t> targets(m_edge_targets.begin(), m_edge_targets.end());
+    writeBinaryVector(out, offsets);
+    writeBinaryVector(out, targets);
+    writeBinaryVector(out, m_edge_costs);
+
+    return static_cast<bool>(out);
+}
+
+bool GridClusterAbstraction::load(std::istream& in) {
+    clear();
+
+    uint64_t marker = 0;
+    int32_t map_width = 0;
+    int32_t map_height = 0;
+    int32_t cluster_size = 0;
+    uint8_t connection_type = 0;
+    if (!readBinaryValue(in, marker) || marker != FILE_MARKER || !readBinaryValue(in, map_width) ||
+              !readBinaryValue(in, map_height) || !readBinaryValue(in, cluster_size) ||
+              !readBinaryValue(in, connection_type)) {
+        std::cerr << "Grid cluster abstraction header could not be read.\n";
+        return false;
+    }
+    if (map_width != m_transitions->getMapWidth() || map_height != m_transitions->getMapHeight() ||
+              cluster_size != m_cluster_size ||
+              connection_type != static_cast<uint8_t>(m_transitions->getConnectionType())) {
+        std::cerr << "Grid cluster abstraction was built for a different map, cluster size, or connection type.\n";
+        return false;
+    }
+
+    std::vector<int32_t> coordinates;
+    std::vector<uint64_t> offsets;
+    std::vector<uint64_t> targets;
+    std::vector<double> costs;
+    if (!readBinaryVector(in, coordinates) || !readBinaryVector(in, offsets) || !readBinaryVector(in, targets) ||
+              !readBinaryVector(in, costs)) {
+        std::cerr << "Grid cluster abstraction graph could not be read.\n";
+        return false;
+    }
+    if (coordinates.size() % 2 != 0 || offsets.size() != coordinates.size() / 2 + 1 || targets.size() != costs.size()) {
+        throw std::runtime_error("Grid cluster abstraction graph has inconsistent array sizes");
+    }
+    if (offsets.front() != 0 || offsets.back() != targets.size() ||
+              std::adjacent_find(offsets.begin(), offsets.end(), std::greater<>()) != offsets.end()) {
+        throw std::runtime_error("Grid cluster abstraction edge offsets are not increasing from 0 to the number of edges");
+    }
+    for (std::size_t i = 0; i < coordinates.size(); i += 2) {
+        if (coordinates[i] < 0 || coordinates[i] >= map_width || coordinates[i + 1] < 0 || coordinates[i + 1] >= map_height) {
+            throw std::runtime_error("Grid cluster abstraction has a vertex outside of the map");
+        }
+    }
+    std::size_t num_vertices = coordinates.size() / 2;
+    if (std::any_of(targets.begin(), targets.end(), [num_vertices](uint64_t target) { return target >= num_vertices; })) {
+        throw std::runtime_error("Grid cluster abstraction has an edge to a missing vertex");
+    }
+
+    m_map_width = map_width;
+    m_map_height = map_height;
+    m_clusters_per_row = (m_map_width + m_cluster_size - 1) / m_cluster_size;
+    int clusters_per_column = (m_map_height + m_cluster_size - 1) / m_cluster_size;
+    m_cluster_vertices.resize(static_cast<std::size_t>(m_clusters_per_row) * clusters_per_column);
+    for (std::size_t i = 0; i < coordinates.size(); i += 2) {
+        m_vertex_locations.emplace_back(coordinates[i], coordinates[i + 1]);
+        m_cluster_vertices[getCluster(m_vertex_locations.back())].push_back(m_vertex_locations.size() - 1);
+    }
+    m_edge_offsets.assign(offsets.begin(), offsets.end());
+    m_edge_targets.assign(targets.begin(), targets.end());
+    m_edge_costs = std::move(costs);
+    return true;
+}
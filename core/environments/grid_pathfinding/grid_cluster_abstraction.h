@@ -0,0 +1,249 @@
+#ifndef GRID_CLUSTER_ABSTRACTION_H_
+#define GRID_CLUSTER_ABSTRACTION_H_
+
+#include "grid_location.h"
+#include "grid_pathfinding_action.h"
+#include "grid_pathfinding_transitions.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <optional>
+#include <utility>
+#include <vector>
+
+/**
+ * A path through the abstract graph of a GridClusterAbstraction. Consecutive waypoints are either in the same cluster,
+ * or are adjacent locations on either side of a cluster border.
+ */
+struct GridAbstractPath {
+    bool m_found_path = false;  ///< Whether a path was found
+    std::vector<GridLocation> m_waypoints;  ///< The waypoints of the path, starting at the start and ending at the goal
+    double m_cost = -1.0;  ///< The cost of the path, or -1 if there is none
+    int64_t m_num_expansions = 0;  ///< The number of abstract vertices expanded to find the path
+};
+
+/**
+ * A hierarchical abstraction of a grid map, as used by HPA* (Botea, Muller, and Schaeffer, 2004).
+ *
+ * The map is split into square clusters. Wherever two neighbouring clusters share a run of border locations that can
+ * be crossed with a cardinal move, an entrance is added: one transition in the middle of short runs, and one at each
+ * end of long runs. The locations on either side of each transition are the vertices of the abstract graph. Vertices on
+ * either side of a transition are joined by an edge with the cost of the move, and vertices in the same cluster are
+ * joined by an edge with the cost of the shortest path between them that stays in the cluster. The intra-cluster
+ * costs are found with one Dijkstra search per vertex, and the clusters can be handled in parallel. The graph is stored
+ * in compressed sparse row form.
+ *
+ * To answer a query, the start and goal are connected to the vertices of their clusters, and the abstract graph is
+ * searched with A*. Each segment of the resulting abstract path can then be refined into grid moves when it is needed,
+ * by searching in a single cluster. The paths found are not necessarily optimal.
+ *
+ * The abstraction is built for the map of the given transitions when build is called, and must be rebuilt if the map
+ * changes. It can be saved in a binary format and loaded back for the same map. Only standard action costs are
+ * supported, since the connections to the goal are found by searching from the goal.
+ *
+ * @class GridClusterAbstraction
+ */
+class GridClusterAbstraction {
+public:
+    using VertexID = std::size_t;  ///< The ID of an abstract vertex
+
+    /**
+     * Creates an empty abstraction for the map of the given transitions. Assumes the transitions use standard action
+     * costs.
+     *
+     * @param transitions The transitions of the grid map to abstract
+     * @param cluster_size The width and height of each cluster. Must be positive.
+     */
+    GridClusterAbstraction(const GridPathfindingTransitions& transitions, int cluster_size);
+
+    /**
+     * Builds the abstract graph for the current map.
+     *
+     * @param num_threads The number of threads used to find the intra-cluster costs. Must be positive.
+     */
+    void build(unsigned num_threads = 1);
+
+    /**
+     * Writes the abstract graph to the given binary stream.
+     *
+     * @param out The stream to write to
+     * @return If the write succeeded
+     */
+    bool save(std::ostream& out) const;
+
+    /**
+     * Reads an abstract graph written by save. Fails if it was built for a map with different dimensions, a different
+     * cluster size, or a different connection type.
+     *
+     * @param in The binary stream to read from
+     * @return If the read succeeded. If not, the abstraction is left empty.
+     * @throws std::runtime_error If the graph read is corrupt, such as edge offsets that are not increasing or edges
+     *         to missing vertices. The abstraction is left empty.
+     */
+    bool load(std::istream& in);
+
+    /**
+     * Finds a path from the start to the goal in the abstract graph.
+     *
+     * @param start The start location
+     * @param goal The goal location
+     * @return The abstract path
+     */
+    GridAbstractPath findAbstractPath(const GridLocation& start, const GridLocation& goal) const;
+
+    /**
+     * Refines the given segment of an abstract path into grid moves. Assumes the path was found by this abstraction.
+     *
+     * @param path The abstract path
+     * @param segment The index of the segment, which goes from waypoint segment to waypoint segment + 1
+     * @return The moves from the first waypoint of the segment to the second
+     */
+    std::vector<GridDirection> refineSegment(const GridAbstractPath& path, std::size_t segment) const;
+
+    /**
+     * Refines all of the given abstract path into grid moves.
+     *
+     * @param path The abstract path
+     * @return The moves from the start of the path to its end
+     */
+    std::vector<GridDirection> refinePath(const GridAbstractPath& path) const;
+
+    /**
+     * Gets the size of the clusters.
+     *
+     * @return The width and height of each cluster
+     */
+    int getClusterSize() const { return m_cluster_size; }
+
+    /**
+     * Gets the number of clusters.
+     *
+     * @return The number of clusters
+     */
+    std::size_t getNumClusters() const { return m_cluster_vertices.size(); }
+
+    /**
+     * Gets the number of vertices in the abstract graph.
+     *
+     * @return The number of vertices
+     */
+    std::size_t getNumVertices() const { return m_vertex_locations.size(); }
+
+    /**
+     * Gets the number of edges in the abstract graph.
+     *
+     * @return The number of edges
+     */
+    std::size_t getNumEdges() const { return m_edge_targets.size(); }
+
+    /**
+     * Gets the grid location of the given abstract vertex.
+     *
+     * @param vertex The vertex ID
+     * @return The location of the vertex
+     */
+    const GridLocation& getVertexLocation(VertexID vertex) const { return m_vertex_locations[vertex]; }
+
+private:
+    /**
+     * The result of a search restricted to a single cluster. Indexed by position in the cluster.
+     */
+    struct ClusterSearchResult {
+        std::vector<double> m_distances;  ///< The distance to each location, or -1 if it was not reached
+        std::vector<GridDirection> m_parent_actions;  ///< The action used to reach each reached location
+    };
+
+    /**
+     * Clears the abstract graph.
+     */
+    void clear();
+
+    /**
+     * Finds the cluster of the given location.
+     *
+     * @param location The location
+     * @return The ID of the cluster
+     */
+    std::size_t getCluster(const GridLocation& location) const;
+
+    /**
+     * Gets the position of the given location in its cluster, used to index searches in the cluster.
+     *
+     * @param location The location
+     * @return The position in the cluster
+     */
+    std::size_t getPositionInCluster(const GridLocation& location) const;
+
+    /**
+     * Runs Dijkstra's algorithm from the given location, only generating locations in the same cluster.
+     *
+     * @param start The location to search from
+     * @param target If set, the search stops once this location is expanded
+     * @return The distances and parent actions found
+     */
+    ClusterSearchResult searchInCluster(const GridLocation& start, const std::optional<GridLocation>& target) const;
+
+    /**
+     * Adds an abstract vertex at the given location, unless there is one there already.
+     *
+     * @param location The location of the vertex
+     * @param vertex_at_location The vertex at each location, indexed by x + y * width
+     * @return The ID of the vertex at the location
+     */
+    VertexID addVertex(const GridLocation& location, std::vector<int64_t>& vertex_at_location);
+
+    /**
+     * Adds the transitions for the run of crossable border locations between the given first and last locations.
+     *
+     * @param run_start The first location of the run, on the first side of the border
+     * @param run_end The last location of the run, on the first side of the border
+     * @param crossing The cardinal move that crosses the border
+     * @param vertex_at_location The vertex at each location, indexed by x + y * width
+     * @param out_edges The edges out of each vertex
+     */
+    void addEntrance(const GridLocation& run_start, const GridLocation& run_end, GridDirection crossing,
+              std::vector<int64_t>& vertex_at_location, std::vector<std::vector<std::pair<VertexID, double>>>& out_edges);
+
+    /**
+     * Adds the entrances along the border crossed by the given cardinal move out of each cluster.
+     *
+     * @param crossing The move that crosses the border, either east or south
+     * @param vertex_at_location The vertex at each location, indexed by x + y * width
+     * @param out_edges The edges out of each vertex
+     */
+    void addBorderEntrances(GridDirection crossing, std::vector<int64_t>& vertex_at_location,
+              std::vector<std::vector<std::pair<VertexID, double>>>& out_edges);
+
+    /**
+     * Adds the intra-cluster edges out of the vertices of the given cluster.
+     *
+     * @param cluster The cluster
+     * @param out_edges The edges out of each vertex
+     */
+    void addIntraClusterEdges(std::size_t cluster, std::vector<std::vector<std::pair<VertexID, double>>>& out_edges) const;
+
+    /**
+     * Estimates the cost between the two given locations, for the abstract search.
+     *
+     * @param from The first location
+     * @param to The second location
+     * @return The estimated cost
+     */
+    double getHeuristicValue(const GridLocation& from, const GridLocation& to) const;
+
+    const GridPathfindingTransitions* m_transitions;  ///< The transitions of the abstracted map
+    int m_cluster_size;  ///< The width and height of each cluster
+    int m_map_width = 0;  ///< The width of the map the graph was built for
+    int m_map_height = 0;  ///< The height of the map the graph was built for
+    int m_clusters_per_row = 0;  ///< The number of clusters in each row of clusters
+
+    std::vector<GridLocation> m_vertex_locations;  ///< The location of each abstract vertex
+    std::vector<std::vector<VertexID>> m_cluster_vertices;  ///< The abstract vertices in each cluster
+
+    std::vector<std::size_t> m_edge_offsets;  ///< The edges out of vertex v are at positions m_edge_offsets[v] to m_edge_offsets[v + 1]
+    std::vector<VertexID> m_edge_targets;  ///< The vertex at the end of each edge
+    std::vector<double> m_edge_costs;  ///< The cost of each edge
+};
+
+#endif  //GRID_CLUSTER_ABSTRACTION_H_
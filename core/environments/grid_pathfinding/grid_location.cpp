@@ -20,3 +20,8 @@ bool operator==(const GridLocation& loc1, const GridLocation& loc2) {
 bool operator!=(const GridLocation& loc1, const GridLocation& loc2) {
     return !(loc1 == loc2);
 }
+
+void serialize(ByteSink& sink, const GridLocation& loc) {
+    sink.write(loc.m_x_coord);
+    sink.write(loc.m_y_coord);
+}
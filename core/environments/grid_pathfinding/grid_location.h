@@ -3,6 +3,8 @@
 
 #include <iostream>
 
+#include "utils/byte_sink.h"
+
 /**
  * Defines a state for 2D grid pathfinding. Each state is a location in the grid given as a set of coordinates.
  *
@@ -53,4 +55,12 @@ bool operator==(const GridLocation& loc1, const GridLocation& loc2);
  */
 bool operator!=(const GridLocation& loc1, const GridLocation& loc2);
 
+/**
+ * Writes the grid location to the given byte sink.
+ *
+ * @param sink The byte sink to write to.
+ * @param loc The grid location to write.
+ */
+void serialize(ByteSink& sink, const GridLocation& loc);
+
 #endif /* GRID_LOCATION_H_ */
@@ -12,6 +12,11 @@ uint32_t GridLocationHashFunction::getHashValue(const GridLocation& state) const
     return state.m_x_coord + state.m_y_coord * m_first_dimension_size;
 }
 
+void GridLocationHashFunction::unrank(const uint32_t& hash_value, GridLocation& state) const {
+    state.m_x_coord = static_cast<int>(hash_value % m_first_dimension_size);
+    state.m_y_coord = static_cast<int>(hash_value / m_first_dimension_size);
+}
+
 void GridLocationHashFunction::setMapWidth(uint32_t map_width) {
     assert(map_width <= 65536 && map_width > 0);
     m_first_dimension_size = map_width;
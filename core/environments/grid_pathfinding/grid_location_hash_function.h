@@ -40,6 +40,8 @@ public:
 
     uint32_t getHashValue(const GridLocation& state) const override;
     bool isPerfectHashFunction() const override { return true; }
+    bool isInvertible() const override { return true; }
+    void unrank(const uint32_t& hash_value, GridLocation& state) const override;
 
     // Overriden public SettingsLogger methods
     std::string getName() const override { return CLASS_NAME; }
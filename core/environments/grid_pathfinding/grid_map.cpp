@@ -1,7 +1,9 @@
 #include "grid_map.h"
+#include "grid_map_listener.h"
 #include "utils/io_utils.h"
 #include "utils/string_utils.h"
 
+#include <algorithm>
 #include <cassert>
 #include <iostream>
 #include <optional>
@@ -30,6 +32,34 @@ GridMap::GridMap(const std::string& file_name) {
     assert(load_result);
 }
 
+GridMap::GridMap(const GridMap& other)
+          : m_map_width(other.m_map_width), m_map_height(other.m_map_height), m_grid(other.m_grid) {
+}
+
+GridMap& GridMap::operator=(const GridMap& other) {
+    m_map_width = other.m_map_width;
+    m_map_height = other.m_map_height;
+    m_grid = other.m_grid;
+    return *this;
+}
+
+GridMap::GridMap(GridMap&& other) noexcept
+          : m_map_width(std::exchange(other.m_map_width, -1)),
+            m_map_height(std::exchange(other.m_map_height, -1)),
+            m_grid(std::move(other.m_grid)) {
+    other.m_grid.clear();
+}
+
+GridMap& GridMap::operator=(GridMap&& other) noexcept {
+    if (this != &other) {
+        m_map_width = std::exchange(other.m_map_width, -1);
+        m_map_height = std::exchange(other.m_map_height, -1);
+        m_grid = std::move(other.m_grid);
+        other.m_grid.clear();
+    }
+    return *this;
+}
+
 GridLocationType GridMap::getLocationType(int x_coord, int y_coord) const {
     if (isInMap(x_coord, y_coord)) {
         return m_grid[x_coord][y_coord];
@@ -38,6 +68,29 @@ GridLocationType GridMap::getLocationType(int x_coord, int y_coord) const {
     return GridLocationType::outside_grid;
 }
 
+void GridMap::setLocationType(int x_coord, int y_coord, GridLocationType location_type) {
+    assert(isInMap(x_coord, y_coord));
+    assert(location_type != GridLocationType::outside_grid);
+
+    GridLocationType old_type = m_grid[x_coord][y_coord];
+    if (old_type == location_type) {
+        return;
+    }
+
+    m_grid[x_coord][y_coord] = location_type;
+    for (GridMapListener* listener : m_listeners) {
+        listener->onLocationTypeChanged(x_coord, y_coord, old_type, location_type);
+    }
+}
+
+void GridMap::addListener(GridMapListener& listener) {
+    m_listeners.push_back(&listener);
+}
+
+void GridMap::removeListener(const GridMapListener& listener) {
+    m_listeners.erase(std::remove(m_listeners.begin(), m_listeners.end(), &listener), m_listeners.end());
+}
+
 int GridMap::getWidth() const {
     return m_map_width;
 }
@@ -8,6 +8,8 @@
 #include <utility>
 #include <vector>
 
+class GridMapListener;
+
 /**
  * The different types of locations.
  */
@@ -31,6 +33,10 @@ enum class GridLocationType : std::uint8_t {
  * directions as well as Northeast, Southeast, Southwest, and Northwest.
  *
  * The file reading type is based on the MovingAI benchmark format.
+ *
+ * The type of a location can be changed after the map is created, for example to open a door or add a dynamic
+ * obstacle. Listeners added to the map are notified of each change. Listeners are not owned by the map, and must be
+ * removed before they are destroyed.
  */
 class GridMap {
 
@@ -57,6 +63,39 @@ public:
      */
     explicit GridMap(const std::string& file_name);
 
+    /**
+     * Creates a copy of the given map's locations. The listeners of the given map are not copied, since they are
+     * listening for changes to that map.
+     *
+     * @param other The map to copy
+     */
+    GridMap(const GridMap& other);
+
+    /**
+     * Copies the given map's locations into this map. This map keeps its own listeners, which are not notified of the
+     * locations changed by the copy.
+     *
+     * @param other The map to copy
+     * @return This map
+     */
+    GridMap& operator=(const GridMap& other);
+
+    /**
+     * Moves the given map's locations into a new map. The listeners stay with the given map, which is left empty.
+     *
+     * @param other The map to move from
+     */
+    GridMap(GridMap&& other) noexcept;
+
+    /**
+     * Moves the given map's locations into this map. Both maps keep their own listeners, none of which are notified,
+     * and the given map is left empty.
+     *
+     * @param other The map to move from
+     * @return This map
+     */
+    GridMap& operator=(GridMap&& other) noexcept;
+
     /**
      * Gets the width of the map.
      *
@@ -80,6 +119,30 @@ public:
      */
     GridLocationType getLocationType(int x_coord, int y_coord) const;
 
+    /**
+     * Sets the type of location at the given coordinates, and notifies the listeners if the type changed. Assumes the
+     * location is in the map.
+     *
+     * @param x_coord The x_coordinate
+     * @param y_coord The y_coordinate
+     * @param location_type The new type of location. Cannot be outside_grid.
+     */
+    void setLocationType(int x_coord, int y_coord, GridLocationType location_type);
+
+    /**
+     * Adds a listener to be notified when the type of a location changes.
+     *
+     * @param listener The listener to add
+     */
+    void addListener(GridMapListener& listener);
+
+    /**
+     * Removes the given listener, if it was added.
+     *
+     * @param listener The listener to remove
+     */
+    void removeListener(const GridMapListener& listener);
+
     /**
      * Checks if the given location can be occupied. Requires that it be passable, swamp, or water.
      *
@@ -261,6 +324,7 @@ private:
     int m_map_height = -1;  ///< The map height.
 
     std::vector<std::vector<GridLocationType>> m_grid;  ///< Indexed by location, indicates if it is empty or an obstacle.
+    std::vector<GridMapListener*> m_listeners;  ///< The listeners to notify when a location type changes
 };
 
 
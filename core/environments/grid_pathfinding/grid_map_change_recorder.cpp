@@ -0,0 +1,39 @@
+#include "grid_map_change_recorder.h"
+
+#include <cstddef>
+
+GridMapChangeRecorder::GridMapChangeRecorder(GridMap& grid_map)
+          : m_grid_map(&grid_map),
+            m_is_affected(static_cast<std::size_t>(grid_map.getWidth()) * static_cast<std::size_t>(grid_map.getHeight()), false) {
+    m_grid_map->addListener(*this);
+}
+
+GridMapChangeRecorder::~GridMapChangeRecorder() {
+    m_grid_map->removeListener(*this);
+}
+
+void GridMapChangeRecorder::onLocationTypeChanged(int x_coord, int y_coord, GridLocationType /*old_type*/, GridLocationType /*new_type*/) {
+    m_num_changes++;
+
+    for (int y = y_coord - 1; y <= y_coord + 1; ++y) {
+        for (int x = x_coord - 1; x <= x_coord + 1; ++x) {
+            if (x < 0 || x >= m_grid_map->getWidth() || y < 0 || y >= m_grid_map->getHeight()) {
+                continue;
+            }
+
+            std::size_t index = static_cast<std::size_t>(x) + static_cast<std::size_t>(y) * static_cast<std::size_t>(m_grid_map->getWidth());
+            if (!m_is_affected[index]) {
+                m_is_affected[index] = true;
+                m_affected_locations.emplace_back(x, y);
+            }
+        }
+    }
+}
+
+void GridMapChangeRecorder::clearChanges() {
+    for (const GridLocation& location : m_affected_locations) {
+        m_is_affected[static_cast<std::size_t>(location.m_x_coord) + static_cast<std::size_t>(location.m_y_coord) * static_cast<std::size_t>(m_grid_map->getWidth())] = false;
+    }
+    m_affected_locations.clear();
+    m_num_changes = 0;
+}
@@ -0,0 +1,66 @@
+#ifndef GRID_MAP_CHANGE_RECORDER_H_
+#define GRID_MAP_CHANGE_RECORDER_H_
+
+#include "grid_location.h"
+#include "grid_map.h"
+#include "grid_map_listener.h"
+
+#include <vector>
+
+/**
+ * Records the locations whose moves may have changed since the last time the recorded changes were cleared.
+ *
+ * When the type of a location changes, the moves out of that location and into it may change, as may the diagonal
+ * moves that cut past it. The moves out of the location and out of each of its eight neighbours in the map are
+ * therefore recorded as affected. An incremental search engine can then update only those locations.
+ *
+ * The recorder adds itself as a listener of the given map when created, and removes itself when destroyed.
+ *
+ * @class GridMapChangeRecorder
+ */
+class GridMapChangeRecorder : public GridMapListener {
+public:
+    /**
+     * Creates a recorder for changes to the given map.
+     *
+     * @param grid_map The map to record changes to
+     */
+    explicit GridMapChangeRecorder(GridMap& grid_map);
+
+    /**
+     * Removes the recorder from the map's listeners.
+     */
+    ~GridMapChangeRecorder() override;
+
+    GridMapChangeRecorder(const GridMapChangeRecorder&) = delete;
+    GridMapChangeRecorder& operator=(const GridMapChangeRecorder&) = delete;
+
+    void onLocationTypeChanged(int x_coord, int y_coord, GridLocationType old_type, GridLocationType new_type) override;
+
+    /**
+     * Gets the locations whose moves may have changed since the changes were last cleared. Each location appears once.
+     *
+     * @return The affected locations
+     */
+    const std::vector<GridLocation>& getAffectedLocations() const { return m_affected_locations; }
+
+    /**
+     * Gets the number of location type changes since the changes were last cleared.
+     *
+     * @return The number of changes
+     */
+    int getNumChanges() const { return m_num_changes; }
+
+    /**
+     * Clears the recorded changes.
+     */
+    void clearChanges();
+
+private:
+    GridMap* m_grid_map;  ///< The map changes are recorded for
+    std::vector<GridLocation> m_affected_locations;  ///< The affected locations, without repeats
+    std::vector<bool> m_is_affected;  ///< Indexed by x + y * width, whether a location has been recorded
+    int m_num_changes = 0;  ///< The number of changes recorded
+};
+
+#endif  //GRID_MAP_CHANGE_RECORDER_H_
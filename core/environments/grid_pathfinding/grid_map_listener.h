@@ -0,0 +1,29 @@
+#ifndef GRID_MAP_LISTENER_H_
+#define GRID_MAP_LISTENER_H_
+
+#include "grid_map.h"
+
+/**
+ * An interface for objects that are notified when the type of a location in a grid map changes.
+ *
+ * @class GridMapListener
+ */
+class GridMapListener {
+public:
+    /**
+     * Default destructor.
+     */
+    virtual ~GridMapListener() = default;
+
+    /**
+     * Called after the type of the given location has changed.
+     *
+     * @param x_coord The x coordinate of the location
+     * @param y_coord The y coordinate of the location
+     * @param old_type The type of the location before the change
+     * @param new_type The type of the location after the change
+     */
+    virtual void onLocationTypeChanged(int x_coord, int y_coord, GridLocationType old_type, GridLocationType new_type) = 0;
+};
+
+#endif  //GRID_MAP_LISTENER_H_
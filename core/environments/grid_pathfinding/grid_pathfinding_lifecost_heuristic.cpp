@@ -10,6 +10,7 @@
 #include <algorithm>
 #include <cassert>
 #include <cstdlib>
+#include <memory>
 
 GridPathfindingLifecostHeuristic::GridPathfindingLifecostHeuristic(GridLocation goal_state)
           : m_goal_state(goal_state) {
@@ -62,22 +63,23 @@ GridLocation GridPathfindingLifecostHeuristic::getGoalState() const {
     return m_goal_state;
 }
 
+void GridPathfindingLifecostHeuristic::bindEvaluationStore(const std::shared_ptr<EvaluationStore>& store) {
+    NodeEvaluatorWithCache<GridLocation, GridDirection>::bindEvaluationStore(store);
+    m_distance_to_go_evals.bindToStore(store, getEvaluationStorageType());
+}
+
 double GridPathfindingLifecostHeuristic::getCachedDistanceToGoEval(NodeID node_id) const {
-    assert(node_id < m_distance_to_go_evals.size());
-    return m_distance_to_go_evals[node_id];
+    return m_distance_to_go_evals.getEvaluation(node_id);
 }
 
 void GridPathfindingLifecostHeuristic::setCachedDistanceToGoEval(NodeID node_id, double eval) {
-    if (node_id >= m_distance_to_go_evals.size()) {
-        m_distance_to_go_evals.resize(node_id + 1, 0.0);
-    }
-    m_distance_to_go_evals[node_id] = eval;
+    m_distance_to_go_evals.setEvaluation(node_id, eval);
 }
 
 double GridPathfindingLifecostHeuristic::getLastDistanceToGoEval() const {
     assert(isEvalComputed());
 
-    return m_distance_to_go_evals[getIDofLastEvaluatedNode()];
+    return m_distance_to_go_evals.getEvaluation(getIDofLastEvaluatedNode());
 }
 
 StringMap GridPathfindingLifecostHeuristic::getComponentSettings() const {
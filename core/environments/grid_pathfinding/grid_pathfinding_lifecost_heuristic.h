@@ -2,6 +2,8 @@
 #define GRID_PATHFINDING_LIFECOST_HEURISTIC_H_
 
 #include "building_tools/evaluators/cost_and_distance_to_go_evaluator.h"
+#include "building_tools/evaluators/evaluation_cache.h"
+#include "building_tools/evaluators/evaluation_store.h"
 #include "building_tools/evaluators/node_evaluator_with_cache.h"
 #include "building_tools/evaluators/single_goal_state_evaluator.h"
 #include "grid_location.h"
@@ -11,6 +13,7 @@
 
 #include "logging/logging_terms.h"
 #include "logging/search_component_settings.h"
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -62,6 +65,9 @@ public:
     void setGoalState(const GridLocation& goal_state) override;
     GridLocation getGoalState() const override;
 
+    // Overriden public NodeEvaluatorWithCache functions
+    void bindEvaluationStore(const std::shared_ptr<EvaluationStore>& store) override;
+
     // Overriden public DistanceToGoEvaluation functions
     double getLastDistanceToGoEval() const override;
     double getCachedDistanceToGoEval(NodeID node_id) const override;
@@ -83,7 +89,7 @@ private:
     void doReset() override {}
 
     GridLocation m_goal_state;  ///< The single goal state
-    std::vector<double> m_distance_to_go_evals;  ///< The cached distance-to-go estimates of all nodes
+    EvaluationCache m_distance_to_go_evals{false};  ///< The cached distance-to-go estimates of all nodes
 };
 
 #endif /* GRID_PATHFINDING_LIFECOST_HEURISTIC_H_ */
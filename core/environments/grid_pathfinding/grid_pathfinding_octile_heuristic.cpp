@@ -7,6 +7,7 @@
 
 #include <cassert>
 #include <cstdlib>
+#include <memory>
 #include <iostream>
 
 GridPathfindingOctileHeuristic::GridPathfindingOctileHeuristic(GridLocation goal_state, double diag_cost)
@@ -63,22 +64,23 @@ GridLocation GridPathfindingOctileHeuristic::getGoalState() const {
     return m_goal_state;
 }
 
+void GridPathfindingOctileHeuristic::bindEvaluationStore(const std::shared_ptr<EvaluationStore>& store) {
+    NodeEvaluatorWithCache<GridLocation, GridDirection>::bindEvaluationStore(store);
+    m_distance_to_go_evals.bindToStore(store, getEvaluationStorageType());
+}
+
 double GridPathfindingOctileHeuristic::getCachedDistanceToGoEval(NodeID node_id) const {
-    assert(node_id < m_distance_to_go_evals.size());
-    return m_distance_to_go_evals[node_id];
+    return m_distance_to_go_evals.getEvaluation(node_id);
 }
 
 void GridPathfindingOctileHeuristic::setCachedDistanceToGoEval(NodeID node_id, double eval) {
-    if (node_id >= m_distance_to_go_evals.size()) {
-        m_distance_to_go_evals.resize(node_id + 1, 0.0);
-    }
-    m_distance_to_go_evals[node_id] = eval;
+    m_distance_to_go_evals.setEvaluation(node_id, eval);
 }
 
 double GridPathfindingOctileHeuristic::getLastDistanceToGoEval() const {
     assert(isEvalComputed());
 
-    return m_distance_to_go_evals[getIDofLastEvaluatedNode()];
+    return m_distance_to_go_evals.getEvaluation(getIDofLastEvaluatedNode());
 }
 
 StringMap GridPathfindingOctileHeuristic::getComponentSettings() const {
@@ -2,6 +2,8 @@
 #define GRID_PATHFINDING_OCTILE_HEURISTIC_H_
 
 #include "building_tools/evaluators/cost_and_distance_to_go_evaluator.h"
+#include "building_tools/evaluators/evaluation_cache.h"
+#include "building_tools/evaluators/evaluation_store.h"
 #include "building_tools/evaluators/node_evaluator_with_cache.h"
 #include "building_tools/evaluators/single_goal_state_evaluator.h"
 #include "grid_location.h"
@@ -12,6 +14,7 @@
 #include "search_basics/node_evaluator.h"
 #include "utils/floating_point_utils.h"
 
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -69,6 +72,9 @@ public:
     // Overriden public NodeEvaluator functions
     std::vector<NodeEvaluator<GridLocation, GridDirection>*> getSubEvaluators() const override { return {}; }
 
+    // Overriden public NodeEvaluatorWithCache functions
+    void bindEvaluationStore(const std::shared_ptr<EvaluationStore>& store) override;
+
     // Overriden public DistanceToGoEvaluation functions
     double getLastDistanceToGoEval() const override;
     double getCachedDistanceToGoEval(NodeID node_id) const override;
@@ -95,7 +101,7 @@ protected:
 private:
     GridLocation m_goal_state;  ///< The single goal state
     double m_diag_cost = ROOT_TWO;  ///< The cost of diagonal moves.
-    std::vector<double> m_distance_to_go_evals;  ///< The cached distance-to-go estimates of all nodes
+    EvaluationCache m_distance_to_go_evals{false};  ///< The cached distance-to-go estimates of all nodes
 };
 
 #endif /* GRID_PATHFINDING_OCTILE_HEURISTIC_H_ */
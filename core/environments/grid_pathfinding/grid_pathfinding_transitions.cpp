@@ -43,6 +43,9 @@ bool GridPathfindingTransitions::setDiagonalCost(double diag_cost) {
     return true;
 }
 
+double GridPathfindingTransitions::getDiagonalCost() const {
+    return m_diag_cost;
+}
 
 GridConnectionType GridPathfindingTransitions::getConnectionType() const {
     return m_connection_type;
@@ -201,6 +204,10 @@ void GridPathfindingTransitions::setCostType(GridPathfindingCostType cost_type)
     m_cost_type = cost_type;
 }
 
+GridPathfindingCostType GridPathfindingTransitions::getCostType() const {
+    return m_cost_type;
+}
+
 void GridPathfindingTransitions::setGridMap(const GridMap* grid_map) {
     m_grid_map = grid_map;
 }
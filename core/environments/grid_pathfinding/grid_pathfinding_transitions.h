@@ -124,6 +124,13 @@ public:
      */
     bool setDiagonalCost(double diag_cost);
 
+    /**
+     * Returns the cost of a diagonal move.
+     *
+     * @return The cost of a diagonal move
+     */
+    double getDiagonalCost() const;
+
     /**
      * Sets the action costs to one of the standard types.
      *
@@ -131,6 +138,13 @@ public:
      */
     void setCostType(GridPathfindingCostType cost_type);
 
+    /**
+     * Returns the type of action costs.
+     *
+     * @return The cost type for the transitions
+     */
+    GridPathfindingCostType getCostType() const;
+
     // Overriden public SettingsLogger methods
     std::string getName() const override { return CLASS_NAME; }
 
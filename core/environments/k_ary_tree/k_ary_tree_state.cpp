@@ -1,5 +1,7 @@
 #include "k_ary_tree_state.h"
 
+#include <cstdint>
+
 KAryTreeState::KAryTreeState(const std::vector<KAryTreeAction>& actions)
           : m_actions(actions) {
 }
@@ -22,4 +24,9 @@ bool operator==(const KAryTreeState& state1, const KAryTreeState& state2) {
 bool operator!=(const KAryTreeState& state1, const KAryTreeState& state2) {
     // Compare the actions in the states for inequality
     return !(state1 == state2);
-}
\ No newline at end of file
+}
+
+void serialize(ByteSink& sink, const KAryTreeState& state) {
+    sink.write(static_cast<uint32_t>(state.m_actions.size()));
+    sink.writeVector(state.m_actions);
+}
@@ -5,6 +5,7 @@
 #include <vector>
 
 #include "k_ary_tree_action.h"
+#include "utils/byte_sink.h"
 
 /**
  * Defines a k-ary tree state.
@@ -59,4 +60,13 @@ bool operator==(const KAryTreeState& state1, const KAryTreeState& state2);
  */
 bool operator!=(const KAryTreeState& state1, const KAryTreeState& state2);
 
+/**
+ * Writes the k-ary tree state to the given byte sink. The number of actions is written first, so states at different
+ * depths have different serializations.
+ *
+ * @param sink The byte sink to write to.
+ * @param state The state to write.
+ */
+void serialize(ByteSink& sink, const KAryTreeState& state);
+
 #endif /* K_ARY_TREE_STATE_H_ */
\ No newline at end of file
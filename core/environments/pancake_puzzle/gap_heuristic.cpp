@@ -11,6 +11,9 @@
 #include <algorithm>
 #include <cassert>
 #include <cstdlib>
+#include <memory>
+#include <optional>
+#include <vector>
 
 
 GapHeuristic::GapHeuristic(PancakePuzzleCostType cost_type)
@@ -18,6 +21,10 @@ GapHeuristic::GapHeuristic(PancakePuzzleCostType cost_type)
 }
 
 void GapHeuristic::doEvaluateAndCache(NodeID to_evaluate) {
+    if (m_use_incremental_evaluation && evaluateIncrementally(to_evaluate)) {
+        return;
+    }
+
     const PancakeState& state = getNodeContainer()->getState(to_evaluate);
     double num_gaps = 0.0;
     double extra_weight = 0.0;  // added action costs due to pancake weighting
@@ -44,23 +51,63 @@ void GapHeuristic::doEvaluateAndCache(NodeID to_evaluate) {
     setCachedValues(to_evaluate, num_gaps + extra_weight, false);
 }
 
+bool GapHeuristic::evaluateIncrementally(NodeID to_evaluate) {
+    const auto* nodes = getNodeContainer();
+    const std::optional<NumToFlip>& last_action = nodes->getLastAction(to_evaluate);
+    NodeID parent_id = nodes->getParentID(to_evaluate);
+
+    if (!last_action.has_value() || parent_id == to_evaluate || !hasCachedValue(parent_id)) {
+        return false;
+    }
+
+    const std::vector<int>& perm = nodes->getState(to_evaluate).m_permutation;
+    auto num_pancakes = static_cast<int>(perm.size());
+    int flip = *last_action;
+    assert(flip >= 1 && flip <= num_pancakes);
+
+    // Only the pair at the bottom of the flip changes. Above the flip, the parent's top pancake was at the bottom
+    int old_above = perm[0];
+    int new_above = perm[flip - 1];
+    int below = (flip < num_pancakes) ? perm[flip] : num_pancakes;
+
+    double gap_change = 0.0;
+    double extra_weight_change = 0.0;
+    if (abs(old_above - below) > 1) {
+        gap_change -= 1.0;
+        extra_weight_change -= std::min(old_above, below);
+    }
+    if (abs(new_above - below) > 1) {
+        gap_change += 1.0;
+        extra_weight_change += std::min(new_above, below);
+    }
+
+    double h_value = getCachedEval(parent_id) + gap_change;
+    if (m_cost_type == PancakePuzzleCostType::heavy) {
+        h_value += extra_weight_change;
+    }
+    setCachedDistanceToGoEval(to_evaluate, getCachedDistanceToGoEval(parent_id) + gap_change);
+    setCachedValues(to_evaluate, h_value, false);
+    return true;
+}
+
+void GapHeuristic::bindEvaluationStore(const std::shared_ptr<EvaluationStore>& store) {
+    NodeEvaluatorWithCache<PancakeState, NumToFlip>::bindEvaluationStore(store);
+    m_distance_to_go_evals.bindToStore(store, getEvaluationStorageType());
+}
+
 double GapHeuristic::getCachedDistanceToGoEval(NodeID node_id) const {
-    assert(node_id < m_distance_to_go_evals.size());
-    return m_distance_to_go_evals[node_id];
+    return m_distance_to_go_evals.getEvaluation(node_id);
 }
 
 void GapHeuristic::setCachedDistanceToGoEval(NodeID node_id, double eval) {
-    if (node_id >= m_distance_to_go_evals.size()) {
-        m_distance_to_go_evals.resize(node_id + 1, 0.0);
-    }
-    m_distance_to_go_evals[node_id] = eval;
+    m_distance_to_go_evals.setEvaluation(node_id, eval);
 }
 
 double GapHeuristic::getLastDistanceToGoEval() const {
     using NE = NodeEvaluatorWithCache<PancakeState, NumToFlip>;
     assert(NE::isEvalComputed());
 
-    return m_distance_to_go_evals[NE::getIDofLastEvaluatedNode()];
+    return m_distance_to_go_evals.getEvaluation(NE::getIDofLastEvaluatedNode());
 }
 
 StringMap GapHeuristic::getComponentSettings() const {
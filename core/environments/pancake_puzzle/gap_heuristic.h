@@ -2,6 +2,8 @@
 #define GAP_HEURISTIC_H_
 
 #include "building_tools/evaluators/cost_and_distance_to_go_evaluator.h"
+#include "building_tools/evaluators/evaluation_cache.h"
+#include "building_tools/evaluators/evaluation_store.h"
 #include "building_tools/evaluators/node_evaluator_with_cache.h"
 #include "logging/logging_terms.h"
 #include "logging/search_component_settings.h"
@@ -11,6 +13,7 @@
 #include "search_basics/node_container.h"
 #include "search_basics/node_evaluator.h"
 
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -39,9 +42,25 @@ public:
      */
     ~GapHeuristic() override = default;
 
+    /**
+     * Sets whether nodes are evaluated incrementally from their parent. A flip only changes the adjacency between the
+     * last flipped pancake and the one below it, so the gaps and heavy costs of a child can be computed from those of
+     * its parent by only checking that pair. Nodes without a parent, or whose parent has no cached value, are fully
+     * evaluated.
+     *
+     * Incremental evaluation assumes that the parent of every node has been evaluated by this heuristic since it was
+     * last reset, as is the case during search.
+     *
+     * @param use_incremental_evaluation Whether to evaluate nodes incrementally
+     */
+    void setUseIncrementalEvaluation(bool use_incremental_evaluation) { m_use_incremental_evaluation = use_incremental_evaluation; }
+
     // Overriden public NodeEvaluator functions
     std::vector<NodeEvaluator<PancakeState, NumToFlip>*> getSubEvaluators() const override { return {}; }
 
+    // Overriden public NodeEvaluatorWithCache functions
+    void bindEvaluationStore(const std::shared_ptr<EvaluationStore>& store) override;
+
     // Overriden public DistanceToGoEvaluation functions
     double getLastDistanceToGoEval() const override;
     double getCachedDistanceToGoEval(NodeID node_id) const override;
@@ -62,8 +81,17 @@ private:
     void doReEvaluateAndCache(NodeID /* to_evaluate */) override {}
     void doReset() override {}
 
+    /**
+     * Evaluates the given node from the cached values of its parent, if possible.
+     *
+     * @param to_evaluate The ID of the node to evaluate
+     * @return If the node was evaluated
+     */
+    bool evaluateIncrementally(NodeID to_evaluate);
+
     PancakePuzzleCostType m_cost_type;  ///< The cost type to use
-    std::vector<double> m_distance_to_go_evals;  ///< The cached distance-to-go estimates of all nodes
+    bool m_use_incremental_evaluation = false;  ///< Whether nodes are evaluated from the cached values of their parent
+    EvaluationCache m_distance_to_go_evals{false};  ///< The cached distance-to-go estimates of all nodes
 };
 
 #endif /* GAP_HEURISTIC_H_ */
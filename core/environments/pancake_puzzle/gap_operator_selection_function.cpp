@@ -0,0 +1,71 @@
+#include "gap_operator_selection_function.h"
+#include "logging/logging_terms.h"
+#include "pancake_names.h"
+#include "pancake_state.h"
+#include "pancake_transitions.h"
+#include "pancake_utils.h"
+#include "utils/floating_point_utils.h"
+#include "utils/string_utils.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstdlib>
+#include <limits>
+#include <vector>
+
+GapOperatorSelectionFunction::GapOperatorSelectionFunction(PancakePuzzleCostType cost_type)
+          : m_cost_type(cost_type) {
+}
+
+double GapOperatorSelectionFunction::getFCostChange(const PancakeState& state, NumToFlip action) const {
+    const std::vector<int>& perm = state.m_permutation;
+    auto num_pancakes = static_cast<int>(perm.size());
+    assert(action >= 2 && action <= num_pancakes);
+
+    // After the flip, the top pancake is at the bottom of the flip, above the same pancake as before
+    int old_above = perm[action - 1];
+    int new_above = perm[0];
+    int below = (action < num_pancakes) ? perm[action] : num_pancakes;
+
+    double h_change = 0.0;
+    if (abs(old_above - below) > 1) {
+        h_change -= 1.0;
+        if (m_cost_type == PancakePuzzleCostType::heavy) {
+            h_change -= std::min(old_above, below);
+        }
+    }
+    if (abs(new_above - below) > 1) {
+        h_change += 1.0;
+        if (m_cost_type == PancakePuzzleCostType::heavy) {
+            h_change += std::min(new_above, below);
+        }
+    }
+
+    double action_cost = 1.0;
+    if (m_cost_type == PancakePuzzleCostType::heavy) {
+        action_cost += std::max(perm[0], perm[action - 1]);
+    }
+    return action_cost + h_change;
+}
+
+double GapOperatorSelectionFunction::getActionsWithFCostChange(const PancakeState& state, double f_cost_change,
+          std::vector<NumToFlip>& actions) const {
+    double next_change = std::numeric_limits<double>::infinity();
+    auto num_pancakes = static_cast<int>(state.m_permutation.size());
+
+    for (NumToFlip action = 2; action <= num_pancakes; ++action) {
+        double action_change = getFCostChange(state, action);
+        if (fpEqual(action_change, f_cost_change)) {
+            actions.push_back(action);
+        } else if (fpGreater(action_change, f_cost_change) && fpLess(action_change, next_change)) {
+            next_change = action_change;
+        }
+    }
+    return next_change;
+}
+
+StringMap GapOperatorSelectionFunction::getComponentSettings() const {
+    using namespace pancakeNames;
+
+    return {{SETTING_COST_TYPE, streamableToString(m_cost_type)}};
+}
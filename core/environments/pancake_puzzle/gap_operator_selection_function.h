@@ -0,0 +1,61 @@
+#ifndef GAP_OPERATOR_SELECTION_FUNCTION_H_
+#define GAP_OPERATOR_SELECTION_FUNCTION_H_
+
+#include "logging/logging_terms.h"
+#include "logging/search_component_settings.h"
+#include "pancake_action.h"
+#include "pancake_state.h"
+#include "pancake_transitions.h"
+#include "search_basics/operator_selection_function.h"
+
+#include <string>
+#include <vector>
+
+/**
+ * The operator selection function for the gap heuristic. A flip only changes whether there is a gap below the last
+ * flipped pancake, so the change in f-cost of each flip is found from the pancakes at the top of the stack, at the
+ * bottom of the flip, and below the flip.
+ *
+ * @class GapOperatorSelectionFunction
+ */
+class GapOperatorSelectionFunction : public OperatorSelectionFunction<PancakeState, NumToFlip> {
+public:
+    inline static const std::string CLASS_NAME = "GapOperatorSelectionFunction";  ///< The name of the class. Defines this component's name
+
+    /**
+     * Constructs the operator selection function for the gap heuristic with the given cost type.
+     *
+     * @param cost_type The cost type of the heuristic and the transitions
+     */
+    explicit GapOperatorSelectionFunction(PancakePuzzleCostType cost_type = PancakePuzzleCostType::unit);
+
+    /**
+     * Default destructor.
+     */
+    ~GapOperatorSelectionFunction() override = default;
+
+    /**
+     * Gets the change in f-cost of applying the given flip in the given state.
+     *
+     * @param state The state to apply the flip in
+     * @param action The flip
+     * @return The change in f-cost of the flip
+     */
+    double getFCostChange(const PancakeState& state, NumToFlip action) const;
+
+    // Overridden public OperatorSelectionFunction methods
+    double getActionsWithFCostChange(const PancakeState& state, double f_cost_change, std::vector<NumToFlip>& actions) const override;
+
+    // Overriden public SettingsLogger methods
+    std::string getName() const override { return CLASS_NAME; }
+
+protected:
+    // Overriden protected SettingsLogger methods
+    StringMap getComponentSettings() const override;
+    SearchSettingsMap getSubComponentSettings() const override { return {}; }
+
+private:
+    PancakePuzzleCostType m_cost_type;  ///< The cost type to use
+};
+
+#endif /* GAP_OPERATOR_SELECTION_FUNCTION_H_ */
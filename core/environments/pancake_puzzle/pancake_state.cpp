@@ -19,4 +19,8 @@ bool operator==(const PancakeState& state1, const PancakeState& state2) {
 
 bool operator!=(const PancakeState& state1, const PancakeState& state2) {
     return !(state1 == state2);
-}
\ No newline at end of file
+}
+
+void serialize(ByteSink& sink, const PancakeState& state) {
+    sink.writeVector(state.m_permutation);
+}
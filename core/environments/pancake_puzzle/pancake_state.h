@@ -4,6 +4,8 @@
 #include <iostream>
 #include <vector>
 
+#include "utils/byte_sink.h"
+
 using Pancake = int;  ///< The type of a pancake in a permtuation
 
 /**
@@ -26,6 +28,8 @@ public:
     explicit PancakeState(const std::vector<Pancake>& permutation);
 
     std::vector<Pancake> m_permutation;  ///< The permutation representation of the state.
+
+    static constexpr bool IS_PERMUTATION_ONLY = true;  ///< The state is fully described by its permutation, so permutation hash functions can recover it
 };
 
 /**
@@ -55,4 +59,12 @@ bool operator==(const PancakeState& state1, const PancakeState& state2);
  */
 bool operator!=(const PancakeState& state1, const PancakeState& state2);
 
+/**
+ * Writes the pancake puzzle state to the given byte sink.
+ *
+ * @param sink The byte sink to write to.
+ * @param state The state to write.
+ */
+void serialize(ByteSink& sink, const PancakeState& state);
+
 #endif /* PANCAKE_STATE_H_ */
@@ -4,6 +4,24 @@
 #include "building_tools/hashing/permutation_hash_function.h"
 #include "sliding_tile_state.h"
 
-using SlidingTileHashFunction = PermutationHashFunction<SlidingTileState>;
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+
+/**
+ * The permutation hash function for the sliding tile puzzle. Also updates the location of the blank when recovering a
+ * state from its hash value, so unlike PermutationHashFunction it is invertible for sliding tile states.
+ *
+ * @class SlidingTileHashFunction
+ */
+class SlidingTileHashFunction : public PermutationHashFunction<SlidingTileState> {
+public:
+    bool isInvertible() const override { return true; }
+    void unrank(const uint64_t& hash_value, SlidingTileState& state) const override {
+        PermutationHashFunction<SlidingTileState>::unrank(hash_value, state);
+        auto blank_iter = std::find(state.m_permutation.begin(), state.m_permutation.end(), 0);
+        state.m_blank_loc = static_cast<int>(std::distance(state.m_permutation.begin(), blank_iter));
+    }
+};
 
 #endif  //SLIDING_TILE_HASH_FUNCTION_H_
@@ -8,6 +8,7 @@
 #include "utils/string_utils.h"
 
 #include <cassert>
+#include <memory>
 #include <cmath>
 
 using std::abs;
@@ -77,22 +78,23 @@ SlidingTileState SlidingTileManhattanHeuristic::getGoalState() const {
     return m_goal_state;
 }
 
+void SlidingTileManhattanHeuristic::bindEvaluationStore(const std::shared_ptr<EvaluationStore>& store) {
+    NodeEvaluatorWithCache<SlidingTileState, BlankSlide>::bindEvaluationStore(store);
+    m_distance_to_go_evals.bindToStore(store, getEvaluationStorageType());
+}
+
 double SlidingTileManhattanHeuristic::getCachedDistanceToGoEval(NodeID node_id) const {
-    assert(node_id < m_distance_to_go_evals.size());
-    return m_distance_to_go_evals[node_id];
+    return m_distance_to_go_evals.getEvaluation(node_id);
 }
 
 void SlidingTileManhattanHeuristic::setCachedDistanceToGoEval(NodeID node_id, double eval) {
-    if (node_id >= m_distance_to_go_evals.size()) {
-        m_distance_to_go_evals.resize(node_id + 1, 0.0);
-    }
-    m_distance_to_go_evals[node_id] = eval;
+    m_distance_to_go_evals.setEvaluation(node_id, eval);
 }
 
 double SlidingTileManhattanHeuristic::getLastDistanceToGoEval() const {
     assert(isEvalComputed());
 
-    return m_distance_to_go_evals[getIDofLastEvaluatedNode()];
+    return m_distance_to_go_evals.getEvaluation(getIDofLastEvaluatedNode());
 }
 
 StringMap SlidingTileManhattanHeuristic::getComponentSettings() const {
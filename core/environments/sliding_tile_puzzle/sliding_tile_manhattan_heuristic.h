@@ -2,6 +2,8 @@
 #define SLIDING_TILE_MANHATTAN_HEURISTIC_H_
 
 #include "building_tools/evaluators/cost_and_distance_to_go_evaluator.h"
+#include "building_tools/evaluators/evaluation_cache.h"
+#include "building_tools/evaluators/evaluation_store.h"
 #include "building_tools/evaluators/node_evaluator_with_cache.h"
 #include "building_tools/evaluators/single_goal_state_evaluator.h"
 #include "logging/logging_terms.h"
@@ -12,6 +14,7 @@
 #include "sliding_tile_state.h"
 #include "sliding_tile_transitions.h"
 
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -58,6 +61,9 @@ public:
     // Overriden public NodeEvaluator functions
     std::vector<NodeEvaluator<SlidingTileState, BlankSlide>*> getSubEvaluators() const override { return {}; }
 
+    // Overriden public NodeEvaluatorWithCache functions
+    void bindEvaluationStore(const std::shared_ptr<EvaluationStore>& store) override;
+
     // Overriden public DistanceToGoEvaluation functions
     double getLastDistanceToGoEval() const override;
     double getCachedDistanceToGoEval(NodeID node_id) const override;
@@ -96,7 +102,7 @@ private:
 
     std::vector<std::vector<double>> m_tile_h_value;  ///< The heuristic impact of the current tile in the current position. The first index (for the blank) is unused.
     std::vector<std::vector<double>> m_tile_distance_to_go;  ///< The distance-to-go of the current tile in the current position. The first index (for the blank) is unused.
-    std::vector<double> m_distance_to_go_evals;  ///< The cached distance-to-go estimates of all nodes
+    EvaluationCache m_distance_to_go_evals{false};  ///< The cached distance-to-go estimates of all nodes
 };
 
 #endif /* SLIDING_TILE_MANHATTAN_HEURISTIC_H_ */
\ No newline at end of file
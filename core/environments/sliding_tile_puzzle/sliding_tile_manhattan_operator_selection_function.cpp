@@ -0,0 +1,76 @@
+#include "sliding_tile_manhattan_operator_selection_function.h"
+#include "logging/logging_terms.h"
+#include "sliding_tile_names.h"
+#include "sliding_tile_state.h"
+#include "sliding_tile_transitions.h"
+#include "sliding_tile_utils.h"
+#include "utils/floating_point_utils.h"
+#include "utils/string_utils.h"
+
+#include <cassert>
+#include <cstdlib>
+#include <limits>
+#include <vector>
+
+SlidingTileManhattanOperatorSelectionFunction::SlidingTileManhattanOperatorSelectionFunction(
+          const SlidingTileState& goal_state, SlidingTileCostType cost_type)
+          : m_goal_state(goal_state), m_cost_type(cost_type),
+            m_transitions(goal_state.m_num_rows, goal_state.m_num_cols, cost_type) {
+    int num_cols = goal_state.m_num_cols;
+    int puzzle_size = goal_state.m_num_rows * num_cols;
+    m_tile_move_costs = getTileMoveCosts(puzzle_size, cost_type);
+    m_tile_h_value.resize(puzzle_size, std::vector<double>(puzzle_size, 0.0));
+
+    for (int goal_pos = 0; goal_pos < puzzle_size; goal_pos++) {
+        Tile tile_num = goal_state.m_permutation[goal_pos];
+        if (tile_num == 0) {
+            continue;
+        }
+
+        for (int pos = 0; pos < puzzle_size; pos++) {
+            int distance = std::abs(goal_pos % num_cols - pos % num_cols) + std::abs(goal_pos / num_cols - pos / num_cols);
+            m_tile_h_value[tile_num][pos] = distance * m_tile_move_costs[tile_num];
+        }
+    }
+}
+
+double SlidingTileManhattanOperatorSelectionFunction::getFCostChange(const SlidingTileState& state, BlankSlide action) const {
+    assert(m_transitions.isApplicable(state, action));
+
+    int tile_pos = state.m_blank_loc;
+    if (action == BlankSlide::up) {
+        tile_pos -= state.m_num_cols;
+    } else if (action == BlankSlide::right) {
+        tile_pos++;
+    } else if (action == BlankSlide::down) {
+        tile_pos += state.m_num_cols;
+    } else if (action == BlankSlide::left) {
+        tile_pos--;
+    }
+
+    // The tile moves from its position to that of the blank
+    Tile tile_num = state.m_permutation[tile_pos];
+    return m_tile_move_costs[tile_num] + m_tile_h_value[tile_num][state.m_blank_loc] - m_tile_h_value[tile_num][tile_pos];
+}
+
+double SlidingTileManhattanOperatorSelectionFunction::getActionsWithFCostChange(const SlidingTileState& state,
+          double f_cost_change, std::vector<BlankSlide>& actions) const {
+    double next_change = std::numeric_limits<double>::infinity();
+
+    for (BlankSlide action : m_transitions.getActions(state)) {
+        double action_change = getFCostChange(state, action);
+        if (fpEqual(action_change, f_cost_change)) {
+            actions.push_back(action);
+        } else if (fpGreater(action_change, f_cost_change) && fpLess(action_change, next_change)) {
+            next_change = action_change;
+        }
+    }
+    return next_change;
+}
+
+StringMap SlidingTileManhattanOperatorSelectionFunction::getComponentSettings() const {
+    using namespace slidingTileNames;
+
+    return {{SETTING_COST_TYPE, streamableToString(m_cost_type)},
+              {SETTING_GOAL_STATE, streamableToString(m_goal_state)}};
+}
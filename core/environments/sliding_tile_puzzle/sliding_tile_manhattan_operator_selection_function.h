@@ -0,0 +1,66 @@
+#ifndef SLIDING_TILE_MANHATTAN_OPERATOR_SELECTION_FUNCTION_H_
+#define SLIDING_TILE_MANHATTAN_OPERATOR_SELECTION_FUNCTION_H_
+
+#include "logging/logging_terms.h"
+#include "logging/search_component_settings.h"
+#include "search_basics/operator_selection_function.h"
+#include "sliding_tile_action.h"
+#include "sliding_tile_state.h"
+#include "sliding_tile_transitions.h"
+
+#include <string>
+#include <vector>
+
+/**
+ * The operator selection function for the Manhattan distance heuristic. A move only changes the location of the tile
+ * that is slid into the blank, so the change in f-cost of each move is the cost of moving that tile plus the change in
+ * its weighted Manhattan distance.
+ *
+ * @class SlidingTileManhattanOperatorSelectionFunction
+ */
+class SlidingTileManhattanOperatorSelectionFunction : public OperatorSelectionFunction<SlidingTileState, BlankSlide> {
+public:
+    inline static const std::string CLASS_NAME = "SlidingTileManhattanOperatorSelectionFunction";  ///< The name of the class. Defines this component's name
+
+    /**
+     * Constructs the operator selection function for the Manhattan distance heuristic with the given goal and cost type.
+     *
+     * @param goal_state The goal state of the heuristic
+     * @param cost_type The cost type of the heuristic and the transitions
+     */
+    SlidingTileManhattanOperatorSelectionFunction(const SlidingTileState& goal_state, SlidingTileCostType cost_type);
+
+    /**
+     * Default destructor.
+     */
+    ~SlidingTileManhattanOperatorSelectionFunction() override = default;
+
+    /**
+     * Gets the change in f-cost of applying the given move in the given state.
+     *
+     * @param state The state to apply the move in
+     * @param action The move
+     * @return The change in f-cost of the move
+     */
+    double getFCostChange(const SlidingTileState& state, BlankSlide action) const;
+
+    // Overridden public OperatorSelectionFunction methods
+    double getActionsWithFCostChange(const SlidingTileState& state, double f_cost_change, std::vector<BlankSlide>& actions) const override;
+
+    // Overriden public SettingsLogger methods
+    std::string getName() const override { return CLASS_NAME; }
+
+protected:
+    // Overriden protected SettingsLogger methods
+    StringMap getComponentSettings() const override;
+    SearchSettingsMap getSubComponentSettings() const override { return {}; }
+
+private:
+    SlidingTileState m_goal_state;  ///< The goal state of the heuristic
+    SlidingTileCostType m_cost_type;  ///< The cost type used
+    SlidingTileTransitions m_transitions;  ///< The transitions, used to get the applicable moves
+    std::vector<double> m_tile_move_costs;  ///< The cost of moving each tile
+    std::vector<std::vector<double>> m_tile_h_value;  ///< The heuristic value of each tile in each position. The first index (for the blank) is unused.
+};
+
+#endif /* SLIDING_TILE_MANHATTAN_OPERATOR_SELECTION_FUNCTION_H_ */
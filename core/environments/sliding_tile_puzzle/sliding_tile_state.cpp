@@ -54,3 +54,7 @@ bool operator==(const SlidingTileState& state1, const SlidingTileState& state2)
 bool operator!=(const SlidingTileState& state1, const SlidingTileState& state2) {
     return !(state1 == state2);
 }
+
+void serialize(ByteSink& sink, const SlidingTileState& state) {
+    sink.writeVector(state.m_permutation);
+}
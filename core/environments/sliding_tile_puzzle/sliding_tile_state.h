@@ -4,6 +4,8 @@
 #include <iostream>
 #include <vector>
 
+#include "utils/byte_sink.h"
+
 using Tile = int;
 
 /**
@@ -70,4 +72,13 @@ bool operator==(const SlidingTileState& state1, const SlidingTileState& state2);
  */
 bool operator!=(const SlidingTileState& state1, const SlidingTileState& state2);
 
+/**
+ * Writes the sliding tile puzzle state to the given byte sink. The blank location is not written, since it is
+ * determined by the permutation.
+ *
+ * @param sink The byte sink to write to.
+ * @param state The state to write.
+ */
+void serialize(ByteSink& sink, const SlidingTileState& state);
+
 #endif /* SLIDING_TILE_STATE_H_ */
@@ -0,0 +1,74 @@
+#ifndef SLIDING_TILE_ZOBRIST_HASH_FUNCTION_H_
+#define SLIDING_TILE_ZOBRIST_HASH_FUNCTION_H_
+
+#include "building_tools/hashing/zobrist_hash_function.h"
+#include "sliding_tile_action.h"
+#include "sliding_tile_state.h"
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/**
+ * A Zobrist hash function for the sliding tile puzzle. A move only changes the positions of the blank and one tile, so
+ * the hash value of a child is found from that of its parent with four XORs.
+ *
+ * @tparam Hash_t The hash value type, which is either an unsigned integer type or Hash128
+ * @class SlidingTileZobristHashFunction
+ */
+template<class Hash_t = uint64_t>
+class SlidingTileZobristHashFunction : public ZobristHashFunction<SlidingTileState, BlankSlide, Hash_t> {
+public:
+    inline static const std::string CLASS_NAME = "SlidingTileZobristHashFunction";  ///< The name of the class. Defines this component's name
+
+    /**
+     * Creates a Zobrist hash function for puzzles with the given dimensions.
+     *
+     * @param num_rows The number of rows in the puzzle
+     * @param num_cols The number of columns in the puzzle
+     * @param seed The seed used to generate the random keys
+     */
+    SlidingTileZobristHashFunction(int num_rows, int num_cols, uint64_t seed = 0)
+              : ZobristHashFunction<SlidingTileState, BlankSlide, Hash_t>(static_cast<std::size_t>(num_rows * num_cols), 0,
+                          num_rows * num_cols - 1, seed),
+                m_num_cols(num_cols) {}
+
+    Hash_t getChildHash(Hash_t parent_hash, const SlidingTileState& parent_state, const BlankSlide& action) const override;
+
+    // Overriden public SettingsLogger methods
+    std::string getName() const override { return CLASS_NAME; }
+
+private:
+    int m_num_cols = 0;  ///< The number of columns in the puzzle
+};
+
+template<class Hash_t>
+Hash_t SlidingTileZobristHashFunction<Hash_t>::getChildHash(Hash_t parent_hash, const SlidingTileState& parent_state,
+          const BlankSlide& action) const {
+    assert(parent_state.m_num_cols == m_num_cols);
+    int old_blank_loc = parent_state.m_blank_loc;
+    int new_blank_loc = old_blank_loc;
+
+    if (action == BlankSlide::up) {
+        new_blank_loc -= m_num_cols;
+    } else if (action == BlankSlide::right) {
+        new_blank_loc++;
+    } else if (action == BlankSlide::down) {
+        new_blank_loc += m_num_cols;
+    } else if (action == BlankSlide::left) {
+        new_blank_loc--;
+    }
+
+    auto old_pos = static_cast<std::size_t>(old_blank_loc);
+    auto new_pos = static_cast<std::size_t>(new_blank_loc);
+    Tile tile = parent_state.m_permutation[new_pos];
+
+    parent_hash ^= this->getKey(old_pos, 0);
+    parent_hash ^= this->getKey(new_pos, tile);
+    parent_hash ^= this->getKey(old_pos, tile);
+    parent_hash ^= this->getKey(new_pos, 0);
+    return parent_hash;
+}
+
+#endif  //SLIDING_TILE_ZOBRIST_HASH_FUNCTION_H_
@@ -1,6 +1,7 @@
 #ifndef NODE_CONTAINER_H_
 #define NODE_CONTAINER_H_
 
+#include <cstdint>
 #include <cstdlib>
 #include <optional>
 
@@ -139,6 +140,17 @@ public:
      * @return The number of nodes in the container
      */
     virtual std::size_t size() const = 0;
+
+    /**
+     * Returns the number of times the container has been cleared. Since node IDs are reused after a clear, this tells
+     * users that store values by node ID whether those values still refer to the same nodes.
+     *
+     * @return The number of times the container has been cleared
+     */
+    std::uint64_t getNumClears() const { return m_num_clears; }
+
+protected:
+    std::uint64_t m_num_clears = 0;  ///< The number of times the container has been cleared. Should be incremented by clear
 };
 
 
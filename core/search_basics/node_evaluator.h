@@ -66,6 +66,41 @@ public:
      */
     virtual void evaluate(NodeID to_evaluate) = 0;
 
+    /**
+     * Evaluates all of the nodes with the given IDs, and caches the results so that they can be accessed using other
+     * methods. This allows an evaluator to process all of the children generated by an expansion at once.
+     *
+     * Like evaluate, this should be called after prepareToEvaluate, and the batch is ignored if the evaluator has
+     * already computed an evaluation since it was last prepared. After this call, getIDofLastEvaluatedNode should return
+     * the last ID in the batch.
+     *
+     * The default implementation prepares and evaluates each node in turn.
+     *
+     * @param to_evaluate The IDs of the nodes to evaluate
+     */
+    virtual void evaluateBatch(const std::vector<NodeID>& to_evaluate);
+
+    /**
+     * Evaluates the node with the given ID using the evaluations that its sub-evaluators have already cached for it.
+     * The sub-evaluators are neither prepared nor evaluated, and this evaluator does not need to be prepared first.
+     *
+     * This is used by evaluation schedules, which evaluate every sub-evaluator before the evaluators that use it.
+     * After this call, isEvalComputed should return true and getIDofLastEvaluatedNode should return the given ID.
+     *
+     * The default implementation falls back on prepareToEvaluate and evaluate.
+     *
+     * @param to_evaluate The ID of the node to evaluate
+     */
+    virtual void scheduledEvaluate(NodeID to_evaluate);
+
+    /**
+     * Evaluates all of the nodes with the given IDs using the evaluations that the sub-evaluators have already cached
+     * for them. See scheduledEvaluate.
+     *
+     * @param to_evaluate The IDs of the nodes to evaluate
+     */
+    virtual void scheduledEvaluateBatch(const std::vector<NodeID>& to_evaluate);
+
     /**
      * Evaluates the node with the given ID in the given container, and caches the result so that
      * it can be accessed using other methods. Assumes that there is already a cached value for this
@@ -140,6 +175,14 @@ public:
      */
     virtual std::vector<NodeEvaluator<State_t, Action_t>*> getSubEvaluators() const = 0;
 
+    /**
+     * Returns whether this evaluator decides for itself which of its sub-evaluators to evaluate for each node, in which
+     * case evaluation schedules leave the sub-evaluators to this evaluator rather than evaluating them beforehand.
+     *
+     * @return Whether the sub-evaluators are evaluated lazily
+     */
+    virtual bool evaluatesSubEvaluatorsLazily() const { return false; }
+
     /**
      * Returns the last node evaluation computed.
      *
@@ -155,4 +198,25 @@ public:
     virtual bool isLastNodeADeadEnd() const { return getCachedIsDeadEnd(getIDofLastEvaluatedNode()); }
 };
 
+template<class State_t, class Action_t>
+void NodeEvaluator<State_t, Action_t>::evaluateBatch(const std::vector<NodeID>& to_evaluate) {
+    for (NodeID node_id : to_evaluate) {
+        prepareToEvaluate();
+        evaluate(node_id);
+    }
+}
+
+template<class State_t, class Action_t>
+void NodeEvaluator<State_t, Action_t>::scheduledEvaluate(NodeID to_evaluate) {
+    prepareToEvaluate();
+    evaluate(to_evaluate);
+}
+
+template<class State_t, class Action_t>
+void NodeEvaluator<State_t, Action_t>::scheduledEvaluateBatch(const std::vector<NodeID>& to_evaluate) {
+    for (NodeID node_id : to_evaluate) {
+        scheduledEvaluate(node_id);
+    }
+}
+
 #endif /* NODE_EVALUATOR_H_ */
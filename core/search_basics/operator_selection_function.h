@@ -0,0 +1,34 @@
+#ifndef OPERATOR_SELECTION_FUNCTION_H_
+#define OPERATOR_SELECTION_FUNCTION_H_
+
+#include "logging/settings_logger.h"
+
+#include <vector>
+
+/**
+ * Abstract class for defining an operator selection function, which finds the actions applicable in a state that
+ * change the f-cost by a given amount without generating the children. The change in f-cost of an action is its cost
+ * plus the change in the heuristic value between the state and the child.
+ *
+ * An operator selection function is tied to a specific heuristic, and assumes that heuristic is consistent, so that
+ * no action has a negative change in f-cost.
+ *
+ * @class OperatorSelectionFunction
+ */
+template<class State_t, class Action_t>
+class OperatorSelectionFunction : public SettingsLogger {
+public:
+    /**
+     * Appends the actions applicable in the given state whose change in f-cost equals the given change to the given
+     * list of actions, and returns the smallest change in f-cost of any applicable action that is greater than the
+     * given change.
+     *
+     * @param state The state to get the actions of
+     * @param f_cost_change The change in f-cost of the actions to get
+     * @param actions The list to append the actions to
+     * @return The next larger change in f-cost, or infinity if there is none
+     */
+    virtual double getActionsWithFCostChange(const State_t& state, double f_cost_change, std::vector<Action_t>& actions) const = 0;
+};
+
+#endif /* OPERATOR_SELECTION_FUNCTION_H_ */
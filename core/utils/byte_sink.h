@@ -0,0 +1,91 @@
+#ifndef BYTE_SINK_H_
+#define BYTE_SINK_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+/**
+ * A growable buffer that values are serialized into as raw bytes. Used to give states a compact binary representation
+ * that can be hashed or compared without going through a string.
+ *
+ * States are written to a sink by an overload of the free function serialize(ByteSink&, const State_t&), which should
+ * be declared next to the state type so that it is found by argument-dependent lookup. The buffer keeps its memory when
+ * cleared, so a single sink can be reused to serialize many states without allocating.
+ *
+ * @class ByteSink
+ */
+class ByteSink {
+public:
+    /**
+     * Appends the given bytes to the sink.
+     *
+     * @param data The first byte to append
+     * @param size The number of bytes to append
+     */
+    void writeBytes(const void* data, std::size_t size) {
+        std::size_t old_size = m_bytes.size();
+        m_bytes.resize(old_size + size);
+        if (size > 0) {
+            std::memcpy(m_bytes.data() + old_size, data, size);
+        }
+    }
+
+    /**
+     * Appends the bytes of the given value to the sink.
+     *
+     * @tparam Value_t The type of the value, which must be trivially copyable
+     * @param value The value to append
+     */
+    template<class Value_t>
+    void write(const Value_t& value) {
+        static_assert(std::is_trivially_copyable_v<Value_t>, "Only trivially copyable values can be written as bytes");
+        writeBytes(&value, sizeof(Value_t));
+    }
+
+    /**
+     * Appends the bytes of the values in the given vector to the sink. The size of the vector is not written, so states
+     * whose vectors can have different sizes should write it first.
+     *
+     * @tparam Value_t The type of the values, which must be trivially copyable
+     * @param values The values to append
+     */
+    template<class Value_t>
+    void writeVector(const std::vector<Value_t>& values) {
+        static_assert(std::is_trivially_copyable_v<Value_t>, "Only trivially copyable values can be written as bytes");
+        writeBytes(values.data(), values.size() * sizeof(Value_t));
+    }
+
+    /**
+     * Removes all bytes from the sink, without releasing its memory.
+     */
+    void clear() { m_bytes.clear(); }
+
+    /**
+     * Gets the bytes written to the sink.
+     *
+     * @return A pointer to the first byte
+     */
+    const uint8_t* getData() const { return m_bytes.data(); }
+
+    /**
+     * Gets the number of bytes written to the sink.
+     *
+     * @return The number of bytes
+     */
+    std::size_t getSize() const { return m_bytes.size(); }
+
+    /**
+     * Gets the bytes written to the sink.
+     *
+     * @return The bytes
+     */
+    const std::vector<uint8_t>& getBytes() const { return m_bytes; }
+
+private:
+    std::vector<uint8_t> m_bytes;  ///< The bytes written to the sink
+};
+
+#endif  //BYTE_SINK_H_
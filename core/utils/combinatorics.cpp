@@ -2,6 +2,9 @@
 #include "random_gen_utils.h"
 #include "string_utils.h"
 #include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
 #include <fstream>
 #include <iostream>
 #include <string>
@@ -21,10 +24,174 @@ void convertPermutationState(std::vector<int>& permutation) {
     }
 }
 
+namespace {
+    /**
+     * Returns the number of bits that are set in the given value.
+     */
+    inline unsigned countSetBits(uint64_t bits) {
+#if defined(__GNUC__) || defined(__clang__)
+        return static_cast<unsigned>(__builtin_popcountll(bits));
+#else
+        unsigned count = 0;
+        while (bits != 0) {
+            bits &= bits - 1;
+            count++;
+        }
+        return count;
+#endif
+    }
+
+    /**
+     * Returns the position of the set bit with the given index in the given value, counting from the lowest set bit
+     * starting at 0. The value must have more set bits than the index.
+     *
+     * Narrows down the position with a binary search on the popcounts of the lower half of the remaining bits, so
+     * takes a constant number of steps for 64-bit values.
+     */
+    inline unsigned selectSetBit(uint64_t bits, unsigned index) {
+        assert(index < countSetBits(bits));
+        unsigned position = 0;
+
+        for (unsigned width = 32; width > 0; width /= 2) {
+            uint64_t low_bits = bits & ((uint64_t{1} << width) - 1);
+            unsigned num_low_set = countSetBits(low_bits);
+            if (index >= num_low_set) {
+                index -= num_low_set;
+                bits >>= width;
+                position += width;
+            } else {
+                bits = low_bits;
+            }
+        }
+        return position;
+    }
+
+    /**
+     * Replaces the digits of a rank in the factorial number system, stored in the given array, by the permutation they
+     * encode. Each digit is the index of the entry among the values not used by earlier entries. Runs in time linear in
+     * the size of the permutation, since each value is selected from the bit mask of unused values in constant time.
+     */
+    void convertFactorialDigitsToPermutation(int* permutation, std::size_t size) {
+        assert(size <= 64);
+        uint64_t unused = (size == 64) ? ~uint64_t{0} : (uint64_t{1} << size) - 1;
+        for (std::size_t i = 0; i < size; i++) {
+            unsigned value = selectSetBit(unused, static_cast<unsigned>(permutation[i]));
+            permutation[i] = static_cast<int>(value);
+            unused &= ~(uint64_t{1} << value);
+        }
+    }
+
+    /**
+     * Calculates the rank of a permutation whose values are found by applying the given function to each entry.
+     */
+    template<class ValueFunction_t>
+    uint64_t getPermutationRankHelper(const int* permutation, std::size_t size, ValueFunction_t get_value) {
+        assert(size <= 64);
+        uint64_t seen = 0;
+        uint64_t rank = 0;
+
+        for (std::size_t i = 0; i < size; i++) {
+            auto value = static_cast<unsigned>(get_value(permutation[i]));
+            assert(value < size);
+
+            uint64_t value_bit = uint64_t{1} << value;
+            uint64_t num_smaller_seen = countSetBits(seen & (value_bit - 1));
+            rank = rank * (size - i) + (value - num_smaller_seen);  // Horner's rule for the factorial number system
+            seen |= value_bit;
+        }
+        return rank;
+    }
+
+    /**
+     * Replaces the given 128-bit value with value * multiplier + addend. Works on 32-bit limbs so that it does not
+     * need a 128-bit integer type.
+     */
+    inline void multiplyAdd128(Hash128& value, uint32_t multiplier, uint32_t addend) {
+        const uint64_t low_mask = 0xFFFFFFFFULL;
+        uint64_t carry = addend;
+        uint64_t limb_product = (value.m_low & low_mask) * multiplier + carry;
+        uint64_t low = limb_product & low_mask;
+        carry = limb_product >> 32U;
+
+        limb_product = (value.m_low >> 32U) * multiplier + carry;
+        low |= limb_product << 32U;
+        carry = limb_product >> 32U;
+
+        limb_product = (value.m_high & low_mask) * multiplier + carry;
+        uint64_t high = limb_product & low_mask;
+        carry = limb_product >> 32U;
+
+        limb_product = (value.m_high >> 32U) * multiplier + carry;
+        high |= limb_product << 32U;
+
+        value.m_low = low;
+        value.m_high = high;
+    }
+
+    /**
+     * Divides the given 128-bit value by the given divisor in place, and returns the remainder.
+     */
+    inline uint32_t divideWithRemainder128(Hash128& value, uint32_t divisor) {
+        assert(divisor != 0);
+        const uint64_t low_mask = 0xFFFFFFFFULL;
+        uint64_t limbs[4] = {value.m_high >> 32U, value.m_high & low_mask, value.m_low >> 32U, value.m_low & low_mask};
+
+        uint64_t remainder = 0;
+        for (uint64_t& limb : limbs) {
+            uint64_t current = (remainder << 32U) | limb;
+            limb = current / divisor;
+            remainder = current % divisor;
+        }
+        value.m_high = (limbs[0] << 32U) | limbs[1];
+        value.m_low = (limbs[2] << 32U) | limbs[3];
+        return static_cast<uint32_t>(remainder);
+    }
+
+    /**
+     * Calculates the 128-bit rank of a permutation whose values are found by applying the given function to each
+     * entry. The rank starts from the given initial value, so the result is initial_rank * size! plus the rank.
+     */
+    template<class ValueFunction_t>
+    Hash128 getPermutationRank128Helper(const int* permutation, std::size_t size, Hash128 initial_rank,
+              ValueFunction_t get_value) {
+        assert(size <= 64);
+        uint64_t seen = 0;
+        Hash128 rank = initial_rank;
+
+        for (std::size_t i = 0; i < size; i++) {
+            auto value = static_cast<unsigned>(get_value(permutation[i]));
+            assert(value < size);
+
+            uint64_t value_bit = uint64_t{1} << value;
+            auto num_smaller_seen = countSetBits(seen & (value_bit - 1));
+            multiplyAdd128(rank, static_cast<uint32_t>(size - i), value - num_smaller_seen);
+            seen |= value_bit;
+        }
+        return rank;
+    }
+
+    /**
+     * Writes the permutation with the given 128-bit rank into the given array, and returns what is left of the rank
+     * once the digits of the permutation have been removed.
+     */
+    Hash128 getPermutationFromRank128Helper(Hash128 rank, int* permutation, std::size_t size) {
+        assert(size <= 64);
+        for (std::size_t i = size; i > 0; i--) {
+            permutation[i - 1] = static_cast<int>(divideWithRemainder128(rank, static_cast<uint32_t>(size - i + 1)));
+        }
+        convertFactorialDigitsToPermutation(permutation, size);
+        return rank;
+    }
+}  // namespace
+
 uint64_t getBitVectorRanking(const std::vector<int>& permutation) {
+    return getBitVectorRanking(permutation.data(), permutation.size());
+}
+
+uint64_t getBitVectorRanking(const int* permutation, std::size_t size) {
     uint64_t sign_bit = 0;
     uint64_t twos = 1;
-    for (int i = static_cast<int>(permutation.size()) - 1; i >= 0; i--) {
+    for (auto i = static_cast<int>(size) - 1; i >= 0; i--) {
         if (permutation[i] < 0) {
             sign_bit += twos;
         }
@@ -106,20 +273,65 @@ bool getNextComboHelper(vector<unsigned>& combo, unsigned max_num, unsigned pos,
 }
 
 uint64_t getPermutationRank(const std::vector<int>& permutation) {
-    assert(permutation.size() <= 64);
-    std::vector<int> perm = permutation;
-    auto num_left = static_cast<unsigned>(perm.size());
-    uint64_t hash_value = 0;
-    for (unsigned i = 0; i < perm.size(); i++) {
-        hash_value += perm[i] * get64BitFactorial(num_left - 1);
-        num_left--;
-        for (unsigned j = i + 1; j < perm.size(); j++) {
-            if (perm[j] > perm[i]) {
-                perm[j]--;
-            }
+    return getPermutationRank(permutation.data(), permutation.size());
+}
+
+uint64_t getPermutationRank(const int* permutation, std::size_t size) {
+    return getPermutationRankHelper(permutation, size, [](int value) { return value; });
+}
+
+uint64_t getUnsignedPermutationRank(const int* signed_permutation, std::size_t size) {
+    return getPermutationRankHelper(signed_permutation, size, [](int value) { return abs(value) - 1; });
+}
+
+vector<int> getPermutationFromRank(uint64_t rank, unsigned size) {
+    vector<int> permutation(size);
+    getPermutationFromRank(rank, permutation.data(), permutation.size());
+    return permutation;
+}
+
+void getPermutationFromRank(uint64_t rank, int* permutation, std::size_t size) {
+    assert(size <= 64);
+
+    // Get the digits of the rank in the factorial number system, which give the index of each entry among the unused values
+    for (std::size_t i = size; i > 0; i--) {
+        uint64_t base = size - i + 1;
+        permutation[i - 1] = static_cast<int>(rank % base);
+        rank /= base;
+    }
+    convertFactorialDigitsToPermutation(permutation, size);
+}
+
+Hash128 getPermutationRank128(const int* permutation, std::size_t size) {
+    assert(size <= MAX_128_BIT_PERMUTATION_RANK_SIZE);
+    return getPermutationRank128Helper(permutation, size, Hash128(), [](int value) { return value; });
+}
+
+Hash128 getSignedPermutationRank128(const int* signed_permutation, std::size_t size) {
+    assert(size <= MAX_128_BIT_SIGNED_PERMUTATION_RANK_SIZE);
+    // Starting Horner's rule from the sign bits multiplies them by n!
+    Hash128 sign_rank;
+    sign_rank.m_low = getBitVectorRanking(signed_permutation, size);
+    return getPermutationRank128Helper(signed_permutation, size, sign_rank, [](int value) { return abs(value) - 1; });
+}
+
+void getPermutationFromRank128(Hash128 rank, int* permutation, std::size_t size) {
+    assert(size <= MAX_128_BIT_PERMUTATION_RANK_SIZE);
+    getPermutationFromRank128Helper(rank, permutation, size);
+}
+
+void getSignedPermutationFromRank128(Hash128 rank, int* signed_permutation, std::size_t size) {
+    assert(size <= MAX_128_BIT_SIGNED_PERMUTATION_RANK_SIZE);
+    uint64_t sign_rank = getPermutationFromRank128Helper(rank, signed_permutation, size).m_low;
+
+    for (std::size_t i = 0; i < size; i++) {
+        signed_permutation[i] += 1;
+
+        // The sign of the first entry is the highest bit of the sign rank
+        if ((sign_rank >> (size - 1 - i)) % 2 == 1) {
+            signed_permutation[i] *= -1;
         }
     }
-    return hash_value;
 }
 
 vector<int> getRandomPermutation(unsigned size, std::mt19937& gen) {
@@ -8,6 +8,9 @@
 #ifndef COMBINATORICS_H_
 #define COMBINATORICS_H_
 
+#include "building_tools/hashing/hash_128.h"
+
+#include <cstddef>
 #include <cstdint>
 #include <cstdlib>
 #include <random>
@@ -49,6 +52,15 @@ void convertPermutationState(std::vector<int>& permutation);
 */
 uint64_t getBitVectorRanking(const std::vector<int>& permutation);
 
+/**
+ * Calculates the same ranking as getBitVectorRanking for the given array of integers, without copying it.
+ *
+ * @param permutation The first entry of the array
+ * @param size The number of entries in the array
+ * @return The bit vector ranking
+ */
+uint64_t getBitVectorRanking(const int* permutation, std::size_t size);
+
 /**
  * Given a set (or combination) of natural numbers, generates the next combination in the 
  * lexicographic ordering.
@@ -85,6 +97,105 @@ bool getNextCombo(std::vector<unsigned>& combo, unsigned combo_size, unsigned nu
 */
 uint64_t getPermutationRank(const std::vector<int>& permutation);
 
+/**
+ * Calculates the same ranking as getPermutationRank for the permutation stored in the given array, without copying
+ * it. The rank is the position of the permutation in the lexicographic ordering of all permutations of its size.
+ *
+ * Runs in time linear in the size of the permutation, by keeping the values already seen as a bit mask and counting
+ * the smaller ones with a popcount. Permutations can have at most 64 elements, though the rank only fits in 64 bits
+ * for up to 20 elements.
+ *
+ * @param permutation The first entry of the permutation
+ * @param size The number of entries in the permutation
+ * @return The rank of the permutation
+ */
+uint64_t getPermutationRank(const int* permutation, std::size_t size);
+
+/**
+ * Given a signed permutation of length n stored in the given array, calculates the rank of the permutation found by
+ * dropping the signs and shifting each value down by 1 (see convertPermutationState), without copying the permutation.
+ *
+ * @param signed_permutation The first entry of the signed permutation
+ * @param size The number of entries in the permutation
+ * @return The rank of the unsigned version of the permutation
+ */
+uint64_t getUnsignedPermutationRank(const int* signed_permutation, std::size_t size);
+
+/**
+ * Returns the permutation of the given size with the given rank, as calculated by getPermutationRank.
+ *
+ * @param rank The rank of the permutation
+ * @param size The size of the permutation
+ * @return The permutation with that rank
+ */
+std::vector<int> getPermutationFromRank(uint64_t rank, unsigned size);
+
+/**
+ * Writes the permutation of the given size with the given rank, as calculated by getPermutationRank, into the given
+ * array.
+ *
+ * Runs in time linear in the size of the permutation, by keeping the unused values as a bit mask and selecting each
+ * entry's value from it with a constant number of popcounts.
+ *
+ * @param rank The rank of the permutation
+ * @param permutation The first entry of the array to write the permutation to
+ * @param size The size of the permutation
+ */
+void getPermutationFromRank(uint64_t rank, int* permutation, std::size_t size);
+
+/**
+ * The largest permutation size whose rank fits in 128 bits.
+ */
+constexpr std::size_t MAX_128_BIT_PERMUTATION_RANK_SIZE = 34;
+
+/**
+ * The largest signed permutation size whose rank, as calculated by getSignedPermutationRank128, fits in 128 bits.
+ */
+constexpr std::size_t MAX_128_BIT_SIGNED_PERMUTATION_RANK_SIZE = 28;
+
+/**
+ * Calculates the same ranking as getPermutationRank as a 128-bit value, which allows permutations of up to 34
+ * elements to be ranked. For permutations of up to 20 elements, the high bits are 0 and the low bits are the same as
+ * the 64-bit rank.
+ *
+ * @param permutation The first entry of the permutation
+ * @param size The number of entries in the permutation
+ * @return The rank of the permutation
+ */
+Hash128 getPermutationRank128(const int* permutation, std::size_t size);
+
+/**
+ * Calculates a 128-bit rank of the given signed permutation of length n (ie. an array of the integers from 1 to n, each
+ * of which can be positive or negative). The rank is the bit vector ranking of the signs multiplied by n!, plus the
+ * rank of the unsigned version of the permutation, and so is the same as the rank used by SignedPermutationHashFunction
+ * for up to 16 elements. Signed permutations of up to 28 elements can be ranked.
+ *
+ * @param signed_permutation The first entry of the signed permutation
+ * @param size The number of entries in the permutation
+ * @return The rank of the signed permutation
+ */
+Hash128 getSignedPermutationRank128(const int* signed_permutation, std::size_t size);
+
+/**
+ * Writes the permutation of the given size with the given 128-bit rank, as calculated by getPermutationRank128, into
+ * the given array.
+ *
+ * @param rank The rank of the permutation
+ * @param permutation The first entry of the array to write the permutation to
+ * @param size The size of the permutation
+ */
+void getPermutationFromRank128(Hash128 rank, int* permutation, std::size_t size);
+
+/**
+ * Writes the signed permutation of the given size with the given 128-bit rank, as calculated by
+ * getSignedPermutationRank128, into the given array.
+ *
+ * @param rank The rank of the signed permutation
+ * @param signed_permutation The first entry of the array to write the signed permutation to
+ * @param size The size of the permutation
+ */
+void getSignedPermutationFromRank128(Hash128 rank, int* signed_permutation, std::size_t size);
+
 /**
  * Returns a random permutation of a subset of the natural numbers using the 
  * given random number generator.
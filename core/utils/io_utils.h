@@ -7,8 +7,12 @@
 #ifndef IO_UTILS_H_
 #define IO_UTILS_H_
 
+#include <cstdint>
+#include <iostream>
 #include <sstream>
 #include <string>
+#include <type_traits>
+#include <vector>
 
 /**
  * Loads a file with the given file name and returns a std::stringstream object representing 
@@ -27,4 +31,65 @@ std::stringstream loadFileIntoStringSteam(const std::string& file_name);
  */
 void writeStringToFile(const std::string& data, const std::string& output_file);
 
+/**
+ * Writes the bytes of the given value to a binary stream.
+ *
+ * @tparam Value_t The type of the value, which must be trivially copyable
+ * @param out The stream to write to
+ * @param value The value to write
+ */
+template<class Value_t>
+void writeBinaryValue(std::ostream& out, const Value_t& value) {
+    static_assert(std::is_trivially_copyable_v<Value_t>, "Only trivially copyable values can be written as bytes");
+    out.write(reinterpret_cast<const char*>(&value), sizeof(Value_t));
+}
+
+/**
+ * Writes the size of the given vector and then the bytes of its values to a binary stream.
+ *
+ * @tparam Value_t The type of the values, which must be trivially copyable
+ * @param out The stream to write to
+ * @param values The values to write
+ */
+template<class Value_t>
+void writeBinaryVector(std::ostream& out, const std::vector<Value_t>& values) {
+    static_assert(std::is_trivially_copyable_v<Value_t>, "Only trivially copyable values can be written as bytes");
+    writeBinaryValue(out, static_cast<uint64_t>(values.size()));
+    out.write(reinterpret_cast<const char*>(values.data()), static_cast<std::streamsize>(values.size() * sizeof(Value_t)));
+}
+
+/**
+ * Reads a value written by writeBinaryValue from a binary stream.
+ *
+ * @tparam Value_t The type of the value, which must be trivially copyable
+ * @param in The stream to read from
+ * @param value The value to read into
+ * @return If the read succeeded
+ */
+template<class Value_t>
+bool readBinaryValue(std::istream& in, Value_t& value) {
+    static_assert(std::is_trivially_copyable_v<Value_t>, "Only trivially copyable values can be read as bytes");
+    in.read(reinterpret_cast<char*>(&value), sizeof(Value_t));
+    return static_cast<bool>(in);
+}
+
+/**
+ * Reads a vector written by writeBinaryVector from a binary stream.
+ *
+ * @tparam Value_t The type of the values, which must be trivially copyable
+ * @param in The stream to read from
+ * @param values The vector to read into
+ * @return If the read succeeded
+ */
+template<class Value_t>
+bool readBinaryVector(std::istream& in, std::vector<Value_t>& values) {
+    uint64_t size = 0;
+    if (!readBinaryValue(in, size)) {
+        return false;
+    }
+    values.resize(size);
+    in.read(reinterpret_cast<char*>(values.data()), static_cast<std::streamsize>(size * sizeof(Value_t)));
+    return static_cast<bool>(in);
+}
+
 #endif /* IO_UTILS_H_ */
\ No newline at end of file
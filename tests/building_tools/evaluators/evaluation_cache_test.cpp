@@ -60,6 +60,11 @@ TEST(EvaluationCacheTests, resetValuesTest) {
     ASSERT_EQ(cache.getIsDeadEnd(1), false);
     ASSERT_EQ(cache.getEvaluation(2), 7.8);
     ASSERT_EQ(cache.getIsDeadEnd(2), false);
+    ASSERT_TRUE(cache.hasValues(1));
+
+    cache.clearHasValues();
+    ASSERT_FALSE(cache.hasValues(1));
+    ASSERT_EQ(cache.getEvaluation(1), 99.0);
 
     cache.clearCache();
     ASSERT_EQ(cache.size(), 0);
@@ -83,6 +88,7 @@ TEST(EvaluationCacheTests, defaultsTest) {
     ASSERT_EQ(cache.size(), 4);
     ASSERT_EQ(cache.getEvaluation(3), 99.0);
     ASSERT_EQ(cache.getIsDeadEnd(3), false);
+    ASSERT_FALSE(cache.hasValues(3));
 
     // Test that evaluation is set correctly when only isDeadEnd is set for new node
     cache.setIsDeadEnd(4, true);
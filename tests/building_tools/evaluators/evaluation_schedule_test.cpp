@@ -0,0 +1,181 @@
+#include <gtest/gtest.h>
+
+#include "building_tools/evaluators/evaluation_schedule.h"
+#include "building_tools/evaluators/set_aggregate_evaluator_factory.h"
+#include "engines/engine_components/eval_functions/f_cost_evaluator.h"
+#include "engines/engine_components/eval_functions/g_cost_evaluator.h"
+#include "engines/engine_components/eval_functions/mm_priority_evaluator.h"
+#include "engines/engine_components/eval_functions/weighted_f_cost_evaluator.h"
+#include "engines/engine_components/node_containers/node_list.h"
+#include "environments/grid_pathfinding/grid_location.h"
+#include "environments/grid_pathfinding/grid_pathfinding_action.h"
+#include "environments/grid_pathfinding/grid_pathfinding_manhattan_heuristic.h"
+#include "environments/grid_pathfinding/grid_pathfinding_octile_heuristic.h"
+#include "search_basics/node_evaluator.h"
+#include "utils/floating_point_utils.h"
+
+#include <algorithm>
+#include <type_traits>
+#include <vector>
+
+class EvaluationScheduleTests : public ::testing::Test {
+protected:
+    void SetUp() override {
+        manhattan.setGoalState(10, 10);
+        octile.setGoalState(10, 10);
+        f_cost.setNodeContainer(nodes);
+        g_cost.setNodeContainer(nodes);
+
+        id1 = nodes.addNode(GridLocation(4, 7));
+        id2 = nodes.addNode(GridLocation(10, 4), id1, 2.0, GridDirection::east, 2.0);
+        id3 = nodes.addNode(GridLocation(0, 0), id1, 1.0, GridDirection::north, 1.0);
+    }
+
+public:
+    using Eval = NodeEvaluator<GridLocation, GridDirection>;
+
+    NodeList<GridLocation, GridDirection> nodes;
+    GridPathfindingManhattanHeuristic manhattan;
+    GridPathfindingOctileHeuristic octile;
+    SetAggregateEvaluator<GridLocation, GridDirection> max_h = getMaxEvaluator<GridLocation, GridDirection>({&manhattan, &octile});
+    FCostEvaluator<GridLocation, GridDirection> f_cost{max_h};
+    GCostEvaluator<GridLocation, GridDirection> g_cost;
+
+    NodeID id1 = 0;
+    NodeID id2 = 0;
+    NodeID id3 = 0;
+};
+
+/**
+ * Tests that the schedule is deduplicated and places leaves before the composites that use them.
+ */
+TEST_F(EvaluationScheduleTests, scheduleOrderTest) {
+    EvaluationSchedule<GridLocation, GridDirection> schedule;
+    schedule.compile({&f_cost, &g_cost, &max_h});
+
+    const auto& evals = schedule.getEvaluators();
+    ASSERT_EQ(evals.size(), 5);
+    ASSERT_EQ(schedule.getNumLeafEvaluators(), 3);
+
+    std::vector<Eval*> leaves(evals.begin(), evals.begin() + 3);
+    ASSERT_TRUE(std::find(leaves.begin(), leaves.end(), &manhattan) != leaves.end());
+    ASSERT_TRUE(std::find(leaves.begin(), leaves.end(), &octile) != leaves.end());
+    ASSERT_TRUE(std::find(leaves.begin(), leaves.end(), &g_cost) != leaves.end());
+    ASSERT_EQ(evals[3], &max_h);
+    ASSERT_EQ(evals[4], &f_cost);
+
+    // All evaluators with a cache now share the schedule's store, and the octile heuristic also stores distance-to-go
+    ASSERT_EQ(schedule.getEvaluationStore()->getNumColumns(), 5);
+}
+
+/**
+ * Tests that evaluating nodes through the schedule gives the same values as the prepare/evaluate protocol.
+ */
+TEST_F(EvaluationScheduleTests, scheduledEvaluationTest) {
+    EvaluationSchedule<GridLocation, GridDirection> schedule;
+    schedule.compile({&f_cost});
+
+    schedule.evaluate(id1);
+    ASSERT_EQ(f_cost.getIDofLastEvaluatedNode(), id1);
+    ASSERT_TRUE(fpEqual(f_cost.getLastNodeEval(), 9.0));
+
+    schedule.evaluateBatch({id2, id3});
+    ASSERT_EQ(f_cost.getIDofLastEvaluatedNode(), id3);
+    ASSERT_TRUE(fpEqual(max_h.getCachedEval(id2), 6.0));
+    ASSERT_TRUE(fpEqual(f_cost.getCachedEval(id2), 8.0));
+    ASSERT_TRUE(fpEqual(f_cost.getCachedEval(id3), 21.0));
+
+    // The protocol still works on top of the scheduled values
+    nodes.setGValue(id2, 5.0);
+    f_cost.prepareToEvaluate();
+    f_cost.reEvaluate(id2);
+    ASSERT_TRUE(fpEqual(f_cost.getCachedEval(id2), 11.0));
+}
+
+/**
+ * Tests that the static schedule evaluates concrete evaluator types in the given order.
+ */
+TEST_F(EvaluationScheduleTests, staticScheduleTest) {
+    StaticEvaluationSchedule<GridPathfindingManhattanHeuristic, GridPathfindingOctileHeuristic,
+              SetAggregateEvaluator<GridLocation, GridDirection>, FCostEvaluator<GridLocation, GridDirection>>
+              schedule(manhattan, octile, max_h, f_cost);
+
+    schedule.evaluate(id1);
+    ASSERT_TRUE(fpEqual(f_cost.getCachedEval(id1), 9.0));
+
+    schedule.evaluateBatch({id2, id3});
+    ASSERT_TRUE(fpEqual(f_cost.getCachedEval(id2), 8.0));
+    ASSERT_TRUE(fpEqual(f_cost.getCachedEval(id3), 21.0));
+    ASSERT_EQ(f_cost.getIDofLastEvaluatedNode(), id3);
+}
+
+/**
+ * Tests that sub-evaluators only used by a lazy evaluator are left out of the schedule, but are still evaluated.
+ */
+TEST_F(EvaluationScheduleTests, lazySubEvaluatorsTest) {
+    max_h.setLazyEvaluation(true);
+
+    EvaluationSchedule<GridLocation, GridDirection> schedule;
+    schedule.compile({&f_cost});
+
+    const auto& evals = schedule.getEvaluators();
+    ASSERT_EQ(evals.size(), 2);
+    ASSERT_EQ(evals[0], &max_h);
+    ASSERT_EQ(evals[1], &f_cost);
+
+    schedule.evaluateBatch({id1, id2, id3});
+    ASSERT_TRUE(fpEqual(f_cost.getCachedEval(id1), 9.0));
+    ASSERT_TRUE(fpEqual(f_cost.getCachedEval(id2), 8.0));
+    ASSERT_TRUE(fpEqual(f_cost.getCachedEval(id3), 21.0));
+    ASSERT_EQ(manhattan.getIDofLastEvaluatedNode(), id3);
+}
+
+/**
+ * Tests that compiling a schedule does not take over the caches of evaluators bound to another existing schedule.
+ */
+TEST_F(EvaluationScheduleTests, sharedEvaluatorsTest) {
+    EvaluationSchedule<GridLocation, GridDirection> schedule;
+    schedule.compile({&f_cost});
+    schedule.evaluate(id1);
+    ASSERT_EQ(manhattan.getEvaluationStore(), schedule.getEvaluationStore());
+
+    {
+        FCostEvaluator<GridLocation, GridDirection> other_f_cost(manhattan);
+        other_f_cost.setNodeContainer(nodes);
+
+        EvaluationSchedule<GridLocation, GridDirection> other_schedule;
+        other_schedule.compile({&other_f_cost});
+        ASSERT_EQ(manhattan.getEvaluationStore(), schedule.getEvaluationStore());
+        ASSERT_EQ(other_f_cost.getEvaluationStore(), other_schedule.getEvaluationStore());
+        ASSERT_TRUE(fpEqual(f_cost.getCachedEval(id1), 9.0));
+
+        other_schedule.evaluateBatch({id1, id2});
+        ASSERT_TRUE(fpEqual(other_f_cost.getCachedEval(id2), 8.0));
+        ASSERT_TRUE(fpEqual(manhattan.getCachedEval(id2), 6.0));
+    }
+
+    // Once the schedule that owns the caches no longer exists, they can be taken over
+    GridPathfindingOctileHeuristic unshared_octile;
+    unshared_octile.setNodeContainer(nodes);
+    {
+        EvaluationSchedule<GridLocation, GridDirection> temp_schedule;
+        temp_schedule.compile({&unshared_octile});
+        ASSERT_EQ(unshared_octile.getEvaluationStore(), temp_schedule.getEvaluationStore());
+    }
+    EvaluationSchedule<GridLocation, GridDirection> last_schedule;
+    last_schedule.compile({&unshared_octile});
+    ASSERT_EQ(unshared_octile.getEvaluationStore(), last_schedule.getEvaluationStore());
+}
+
+/**
+ * Tests that the evaluators used in schedules can still be subclassed, since only their scheduled entry points are
+ * final.
+ */
+TEST_F(EvaluationScheduleTests, evaluatorsNotFinalTest) {
+    ASSERT_FALSE((std::is_final_v<FCostEvaluator<GridLocation, GridDirection>>));
+    ASSERT_FALSE((std::is_final_v<GCostEvaluator<GridLocation, GridDirection>>));
+    ASSERT_FALSE((std::is_final_v<WeightedFCostEvaluator<GridLocation, GridDirection>>));
+    ASSERT_FALSE((std::is_final_v<MMPriorityEvaluator<GridLocation, GridDirection>>));
+    ASSERT_FALSE(std::is_final_v<GridPathfindingManhattanHeuristic>);
+    ASSERT_FALSE(std::is_final_v<GridPathfindingOctileHeuristic>);
+}
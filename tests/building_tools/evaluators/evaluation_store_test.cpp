@@ -0,0 +1,179 @@
+#include <gtest/gtest.h>
+
+#include "building_tools/evaluators/evaluation_cache.h"
+#include "building_tools/evaluators/evaluation_store.h"
+
+#include <limits>
+#include <memory>
+#include <stdexcept>
+
+/**
+ * Tests that values set in different columns are kept separate, and that columns grow independently.
+ */
+TEST(EvaluationStoreTests, separateColumnsTest) {
+    EvaluationStore store;
+    auto column1 = store.addColumn();
+    auto column2 = store.addColumn();
+
+    ASSERT_EQ(store.getNumColumns(), 2);
+    ASSERT_EQ(store.getColumnSize(column1), 0);
+
+    store.setValues(column1, 0, 1.5, false);
+    store.setValues(column2, 2, 3.0, true);
+
+    ASSERT_EQ(store.getColumnSize(column1), 1);
+    ASSERT_EQ(store.getColumnSize(column2), 3);
+    ASSERT_EQ(store.getEvaluation(column1, 0), 1.5);
+    ASSERT_FALSE(store.getIsDeadEnd(column1, 0));
+    ASSERT_EQ(store.getEvaluation(column2, 0), 0.0);
+    ASSERT_EQ(store.getEvaluation(column2, 2), 3.0);
+    ASSERT_TRUE(store.getIsDeadEnd(column2, 2));
+
+    store.setEvaluation(column1, 0, 2.5);
+    store.setIsDeadEnd(column1, 0, true);
+    ASSERT_EQ(store.getEvaluation(column1, 0), 2.5);
+    ASSERT_TRUE(store.getIsDeadEnd(column1, 0));
+}
+
+/**
+ * Tests that only nodes whose values were set with setValues are flagged as having values, and that clearing the
+ * flags leaves the values in place.
+ */
+TEST(EvaluationStoreTests, hasValuesTest) {
+    EvaluationStore store;
+    auto column1 = store.addColumn();
+    auto column2 = store.addColumn(EvaluationStorageType::int16, false);
+
+    store.setValues(column1, 2, 1.5, false);
+    store.setEvaluation(column2, 1, 4.0);
+    store.growToFit(5);
+
+    ASSERT_TRUE(store.hasValues(column1, 2));
+    ASSERT_FALSE(store.hasValues(column1, 1));
+    ASSERT_FALSE(store.hasValues(column1, 5));
+    ASSERT_FALSE(store.hasValues(column1, 6));
+    ASSERT_FALSE(store.hasValues(column2, 1));
+    ASSERT_FALSE(store.hasValues(column2, 2));
+
+    store.setValues(column2, 1, 3.0, false);
+    ASSERT_TRUE(store.hasValues(column2, 1));
+
+    store.clearHasValues(column1);
+    ASSERT_FALSE(store.hasValues(column1, 2));
+    ASSERT_EQ(store.getEvaluation(column1, 2), 1.5);
+    ASSERT_TRUE(store.hasValues(column2, 1));
+
+    store.clearColumn(column2);
+    ASSERT_FALSE(store.hasValues(column2, 1));
+}
+
+/**
+ * Tests that growing the store grows all columns, and that clearing empties them without removing them.
+ */
+TEST(EvaluationStoreTests, growAndClearTest) {
+    EvaluationStore store;
+    auto column1 = store.addColumn();
+    auto column2 = store.addColumn();
+
+    store.growToFit(9);
+    ASSERT_EQ(store.getColumnSize(column1), 10);
+    ASSERT_EQ(store.getColumnSize(column2), 10);
+    ASSERT_EQ(store.getEvaluation(column2, 9), 0.0);
+    ASSERT_FALSE(store.getIsDeadEnd(column2, 9));
+
+    store.clearColumn(column1);
+    ASSERT_EQ(store.getColumnSize(column1), 0);
+    ASSERT_EQ(store.getColumnSize(column2), 10);
+
+    store.clearAllColumns();
+    ASSERT_EQ(store.getColumnSize(column2), 0);
+    ASSERT_EQ(store.getNumColumns(), 2);
+}
+
+/**
+ * Tests that each storage type gives back the values stored, with infinite values kept by the integer types, and that
+ * the memory used per node matches the column types.
+ */
+TEST(EvaluationStoreTests, storageTypesTest) {
+    const double infinity = std::numeric_limits<double>::infinity();
+    EvaluationStore store;
+    auto float64_column = store.addColumn(EvaluationStorageType::float64);
+    auto float32_column = store.addColumn(EvaluationStorageType::float32);
+    auto int32_column = store.addColumn(EvaluationStorageType::int32);
+    auto int16_column = store.addColumn(EvaluationStorageType::int16, false);
+
+    ASSERT_EQ(store.getStorageType(int32_column), EvaluationStorageType::int32);
+
+    store.setValues(float64_column, 1, 0.1, true);
+    store.setValues(float32_column, 1, 0.5, false);
+    store.setValues(int32_column, 1, 100000.0, true);
+    store.setEvaluation(int16_column, 1, 17.0);
+    store.setEvaluation(int32_column, 0, infinity);
+    store.setEvaluation(int16_column, 0, infinity);
+
+    ASSERT_EQ(store.getEvaluation(float64_column, 1), 0.1);
+    ASSERT_EQ(store.getEvaluation(float32_column, 1), 0.5);
+    ASSERT_EQ(store.getEvaluation(int32_column, 1), 100000.0);
+    ASSERT_EQ(store.getEvaluation(int16_column, 1), 17.0);
+    ASSERT_EQ(store.getEvaluation(int32_column, 0), infinity);
+    ASSERT_EQ(store.getEvaluation(int16_column, 0), infinity);
+
+    ASSERT_TRUE(store.getIsDeadEnd(float64_column, 1));
+    ASSERT_TRUE(store.getIsDeadEnd(int32_column, 1));
+    ASSERT_FALSE(store.getIsDeadEnd(int16_column, 1));
+
+    ASSERT_EQ(store.getBytesPerNode(), 8.0 + 4.0 + 4.0 + 2.0 + 7.0 / 8.0);
+}
+
+/**
+ * Tests that evaluations that cannot be stored exactly in an integer column are rejected.
+ */
+TEST(EvaluationStoreTests, integerColumnRangeTest) {
+    EvaluationStore store;
+    auto int32_column = store.addColumn(EvaluationStorageType::int32);
+    auto int16_column = store.addColumn(EvaluationStorageType::int16);
+
+    ASSERT_THROW(store.setEvaluation(int32_column, 0, 1.5), std::domain_error);
+    ASSERT_THROW(store.setEvaluation(int16_column, 0, 40000.0), std::domain_error);
+    ASSERT_THROW(store.setValues(int16_column, 0, -40000.0, false), std::domain_error);
+
+    store.setEvaluation(int16_column, 0, -32000.0);
+    ASSERT_EQ(store.getEvaluation(int16_column, 0), -32000.0);
+}
+
+/**
+ * Tests that an evaluation cache bound to a store reads and writes through its column.
+ */
+TEST(EvaluationStoreTests, boundEvaluationCacheTest) {
+    auto store = std::make_shared<EvaluationStore>();
+    EvaluationCache cache1;
+    EvaluationCache cache2;
+
+    cache1.setValues(3, 4.0, false);
+    cache1.bindToStore(store);
+    cache2.bindToStore(store);
+
+    ASSERT_TRUE(cache1.isBoundToStore());
+    ASSERT_EQ(cache1.size(), 0);
+    ASSERT_EQ(store->getNumColumns(), 2);
+
+    cache1.setValues(1, 7.0, true);
+    cache2.setEvaluation(0, 2.0);
+
+    ASSERT_EQ(cache1.size(), 2);
+    ASSERT_EQ(cache1.getEvaluation(1), 7.0);
+    ASSERT_TRUE(cache1.getIsDeadEnd(1));
+    ASSERT_EQ(store->getEvaluation(0, 1), 7.0);
+    ASSERT_EQ(store->getEvaluation(1, 0), 2.0);
+
+    cache1.clearCache();
+    ASSERT_EQ(cache1.size(), 0);
+    ASSERT_EQ(cache2.size(), 1);
+
+    EvaluationCache distance_cache(false);
+    distance_cache.bindToStore(store, EvaluationStorageType::int16);
+    distance_cache.setEvaluation(2, 5.0);
+    ASSERT_EQ(distance_cache.getEvaluation(2), 5.0);
+    ASSERT_FALSE(distance_cache.getIsDeadEnd(2));
+    ASSERT_EQ(store->getBytesPerNode(), 8.0 + 8.0 + 2.0 + 5.0 / 8.0);
+}
@@ -105,4 +105,36 @@ TEST(EvaluatorFactoryTests, slidingTileSumTest) {
     ASSERT_TRUE(checkStateEvaluation(sum_heuristic, state1, 179.0, false));
     ASSERT_TRUE(checkStateEvaluation(sum_heuristic, state2, 14.0, true));
     ASSERT_TRUE(checkStateEvaluation(sum_heuristic, state3, 75.0, true));
-}
\ No newline at end of file
+}
+/**
+ * Tests the evaluators with operators known at compile time on map pathfinding states
+ */
+TEST(EvaluatorFactoryTests, mapPathfindingStaticOperatorTest) {
+    GridLocation state1(123, 839);
+    GridLocation state2(69, 420);
+
+    StateStringHashFunction<GridLocation> hash_function;
+    HashMapHeuristic<GridLocation, GridDirection, std::string> heuristic1(hash_function, 32.0);
+    heuristic1.addHeuristicValue(state1, 55.0, false);
+    heuristic1.addHeuristicValue(state2, 11.0, true);
+
+    HashMapHeuristic<GridLocation, GridDirection, std::string> heuristic2(hash_function, 32.0);
+    heuristic2.addHeuristicValue(state1, 69.0, false);
+    heuristic2.addHeuristicValue(state2, 5.0, false);
+
+    auto max_heuristic = getStaticMaxEvaluator<GridLocation, GridDirection>({&heuristic1, &heuristic2});
+    auto min_heuristic = getStaticMinEvaluator<GridLocation, GridDirection>({&heuristic1, &heuristic2});
+    auto sum_heuristic = getStaticSumEvaluator<GridLocation, GridDirection>({&heuristic1, &heuristic2});
+
+    ASSERT_TRUE(checkStateEvaluation(max_heuristic, state1, 69.0, false));
+    ASSERT_TRUE(checkStateEvaluation(max_heuristic, state2, 11.0, true));
+
+    // The sub-evaluators are shared, so clear their previous evaluations before using the next aggregate
+    max_heuristic.reset();
+    ASSERT_TRUE(checkStateEvaluation(min_heuristic, state1, 55.0, false));
+    ASSERT_TRUE(checkStateEvaluation(min_heuristic, state2, 5.0, true));
+
+    min_heuristic.reset();
+    ASSERT_TRUE(checkStateEvaluation(sum_heuristic, state1, 124.0, false));
+    ASSERT_TRUE(checkStateEvaluation(sum_heuristic, state2, 16.0, true));
+}
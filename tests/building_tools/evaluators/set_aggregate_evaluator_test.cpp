@@ -4,6 +4,7 @@
 #include "building_tools/evaluators/evaluator_tools_terms.h"
 #include "building_tools/evaluators/hash_map_heuristic.h"
 #include "building_tools/evaluators/set_aggregate_evaluator.h"
+#include "building_tools/evaluators/set_aggregate_operators.h"
 #include "building_tools/hashing/state_string_hash_function.h"
 #include "engines/engine_components/node_containers/node_list.h"
 #include "environments/grid_pathfinding/grid_location.h"
@@ -14,7 +15,9 @@
 #include "test_helpers.h"
 
 #include <algorithm>
+#include <cstdint>
 #include <string>
+#include <vector>
 
 /**
  * Tests that the correct values and default values are used after states are added. Map pathfinding is used for the
@@ -49,6 +52,130 @@ TEST(SetAggregateEvaluatorTest, mapPathfindingMinTest) {
     ASSERT_TRUE(checkStateEvaluation(min_evaluator, state3, 32.0, true));
 }
 
+/**
+ * Tests that evaluating a batch of nodes gives the same values as evaluating each node individually.
+ */
+TEST(SetAggregateEvaluatorTest, evaluateBatchTest) {
+    GridLocation state1(123, 839);
+    GridLocation state2(69, 420);
+    GridLocation state3(901, 2048);
+
+    StateStringHashFunction<GridLocation> hash_function;
+    HashMapHeuristic<GridLocation, GridDirection, std::string> heuristic1(hash_function, 32.0);
+    heuristic1.addHeuristicValue(state1, 55.0, false);
+    heuristic1.addHeuristicValue(state2, 11.0, true);
+
+    HashMapHeuristic<GridLocation, GridDirection, std::string> heuristic2(hash_function, 32.0);
+    heuristic2.addHeuristicValue(state1, 69.0, false);
+    heuristic2.addHeuristicValue(state3, 5.0, false);
+
+    auto min = [](double first, double second) {
+        return std::min(first, second);
+    };
+    SetAggregateEvaluator<GridLocation, GridDirection> min_evaluator({&heuristic1, &heuristic2}, min, "min");
+
+    NodeList<GridLocation, GridDirection> nodes;
+    min_evaluator.setNodeContainer(nodes);
+    NodeID id1 = nodes.addNode(state1);
+    NodeID id2 = nodes.addNode(state2);
+    NodeID id3 = nodes.addNode(state3);
+
+    min_evaluator.prepareToEvaluate();
+    min_evaluator.evaluateBatch({id1, id2, id3});
+
+    ASSERT_EQ(min_evaluator.getIDofLastEvaluatedNode(), id3);
+    ASSERT_EQ(min_evaluator.getCachedEval(id1), 55.0);
+    ASSERT_EQ(min_evaluator.getCachedEval(id2), 11.0);
+    ASSERT_EQ(min_evaluator.getCachedEval(id3), 5.0);
+    ASSERT_FALSE(min_evaluator.getCachedIsDeadEnd(id1));
+    ASSERT_TRUE(min_evaluator.getCachedIsDeadEnd(id2));
+    ASSERT_FALSE(min_evaluator.getCachedIsDeadEnd(id3));
+
+    // Batch is ignored until the evaluator is prepared again
+    heuristic1.addHeuristicValue(state3, 1.0, false);
+    min_evaluator.evaluateBatch({id3});
+    ASSERT_EQ(min_evaluator.getCachedEval(id3), 5.0);
+}
+
+/**
+ * Tests that lazy evaluation stops at dead ends and skips sub-evaluators whose upper bound cannot improve the max, and
+ * that win counts are kept.
+ */
+TEST(SetAggregateEvaluatorTest, lazyEvaluationTest) {
+    GridLocation state1(123, 839);
+    GridLocation state2(69, 420);
+    GridLocation state3(901, 2048);
+
+    StateStringHashFunction<GridLocation> hash_function;
+    HashMapHeuristic<GridLocation, GridDirection, std::string> heuristic1(hash_function, 32.0);
+    heuristic1.addHeuristicValue(state1, 55.0, false);
+    heuristic1.addHeuristicValue(state2, 11.0, true);
+    heuristic1.addHeuristicValue(state3, 5.0, false);
+
+    HashMapHeuristic<GridLocation, GridDirection, std::string> heuristic2(hash_function, 32.0);
+    heuristic2.addHeuristicValue(state1, 40.0, false);
+    heuristic2.addHeuristicValue(state2, 69.0, false);
+    heuristic2.addHeuristicValue(state3, 9.0, false);
+
+    SetAggregateEvaluator<GridLocation, GridDirection, MaxAggregateOperator> max_evaluator(
+              {&heuristic1, &heuristic2}, MaxAggregateOperator(), "max");
+    max_evaluator.setLazyEvaluation(true);
+    max_evaluator.setSubEvaluatorUpperBound(1, 50.0);
+    max_evaluator.setSubEvaluatorMayReportDeadEnds(1, false);
+    ASSERT_TRUE(max_evaluator.evaluatesSubEvaluatorsLazily());
+
+    NodeList<GridLocation, GridDirection> nodes;
+    max_evaluator.setNodeContainer(nodes);
+    NodeID id1 = nodes.addNode(state1);
+    NodeID id2 = nodes.addNode(state2);
+    NodeID id3 = nodes.addNode(state3);
+
+    ASSERT_TRUE(checkNodeEvaluation(max_evaluator, id1, 55.0, false));  // Bound of heuristic2 can't beat 55
+    ASSERT_TRUE(checkNodeEvaluation(max_evaluator, id2, 11.0, true));  // Stops at the dead end
+    ASSERT_TRUE(checkNodeEvaluation(max_evaluator, id3, 9.0, false));
+    ASSERT_EQ(max_evaluator.getNumSkippedEvaluations(), 2);
+    ASSERT_EQ(heuristic2.getIDofLastEvaluatedNode(), id3);
+
+    // Dead ends are not counted as wins
+    ASSERT_EQ(max_evaluator.getWinCounts(), (std::vector<std::uint64_t>{1, 1}));
+
+    max_evaluator.reset();
+    ASSERT_EQ(max_evaluator.getNumSkippedEvaluations(), 0);
+    ASSERT_EQ(max_evaluator.getWinCounts(), (std::vector<std::uint64_t>{0, 0}));
+}
+
+/**
+ * Tests that lazy evaluation does not skip a sub-evaluator by its upper bound if it may identify dead ends.
+ */
+TEST(SetAggregateEvaluatorTest, lazyEvaluationDeadEndTest) {
+    GridLocation state1(123, 839);
+
+    StateStringHashFunction<GridLocation> hash_function;
+    HashMapHeuristic<GridLocation, GridDirection, std::string> heuristic1(hash_function, 32.0);
+    heuristic1.addHeuristicValue(state1, 55.0, false);
+
+    HashMapHeuristic<GridLocation, GridDirection, std::string> heuristic2(hash_function, 32.0);
+    heuristic2.addHeuristicValue(state1, 40.0, true);
+
+    SetAggregateEvaluator<GridLocation, GridDirection, MaxAggregateOperator> max_evaluator(
+              {&heuristic1, &heuristic2}, MaxAggregateOperator(), "max");
+    max_evaluator.setLazyEvaluation(true);
+    max_evaluator.setSubEvaluatorUpperBound(1, 50.0);
+
+    NodeList<GridLocation, GridDirection> nodes;
+    max_evaluator.setNodeContainer(nodes);
+    NodeID id1 = nodes.addNode(state1);
+
+    ASSERT_TRUE(checkNodeEvaluation(max_evaluator, id1, 55.0, true));
+    ASSERT_EQ(max_evaluator.getNumSkippedEvaluations(), 0);
+
+    // Once the sub-evaluator is marked as never reporting dead ends, it is skipped, even though the value is wrong here
+    max_evaluator.setSubEvaluatorMayReportDeadEnds(1, false);
+    max_evaluator.reset();
+    ASSERT_TRUE(checkNodeEvaluation(max_evaluator, id1, 55.0, false));
+    ASSERT_EQ(max_evaluator.getNumSkippedEvaluations(), 1);
+}
+
 /**
  * Tests that re-evaluate works as expected.
  */
@@ -0,0 +1,86 @@
+#include <gtest/gtest.h>
+
+#include "building_tools/hashing/large_permutation_hash_function.h"
+#include "building_tools/hashing/permutation_hash_function.h"
+#include "building_tools/hashing/signed_permutation_hash_function.h"
+#include "environments/burnt_pancake_puzzle/burnt_pancake_state.h"
+#include "environments/pancake_puzzle/pancake_state.h"
+#include "environments/sliding_tile_puzzle/sliding_tile_state.h"
+#include "utils/combinatorics.h"
+
+#include <random>
+#include <unordered_set>
+#include <vector>
+
+/**
+ * Tests that the large permutation hash function gives the same values as the permutation hash function when both can
+ * be used.
+ */
+TEST(LargePermutationHashFunctionTests, matchesPermutationHashFunctionTest) {
+    LargePermutationHashFunction<PancakeState> large_hasher;
+    PermutationHashFunction<PancakeState> hasher;
+
+    PancakeState state(std::vector<int>{3, 1, 0, 2, 5, 4});
+    ASSERT_EQ(large_hasher.getHashValue(state), (Hash128{385, 0}));
+    ASSERT_EQ(large_hasher.getHashValue(state).m_low, hasher.getHashValue(state));
+    ASSERT_TRUE(large_hasher.isPerfectHashFunction());
+}
+
+/**
+ * Tests that the large permutation hash function distinguishes and recovers 24-puzzle states.
+ */
+TEST(LargePermutationHashFunctionTests, slidingTile5x5Test) {
+    LargePermutationHashFunction<SlidingTileState> hasher;
+    std::mt19937 gen(7);
+    std::unordered_set<Hash128> hash_values;
+
+    SlidingTileState unranked_state(5, 5);
+    for (int i = 0; i < 100; i++) {
+        SlidingTileState state(getRandomPermutation(25, gen), 5, 5);
+        Hash128 hash_value = hasher.getHashValue(state);
+        hash_values.insert(hash_value);
+
+        hasher.unrank(hash_value, unranked_state);
+        ASSERT_EQ(unranked_state.m_permutation, state.m_permutation);
+    }
+    ASSERT_EQ(hash_values.size(), 100U);
+
+    // Only the permutation is recovered, so the location of the blank would be left unchanged
+    ASSERT_FALSE(hasher.isInvertible());
+}
+
+/**
+ * Tests that the large signed permutation hash function gives the same values as the signed permutation hash function
+ * for small stacks, and recovers larger ones.
+ */
+TEST(LargePermutationHashFunctionTests, burntPancakeTest) {
+    LargeSignedPermutationHashFunction<BurntPancakeState> large_hasher;
+    SignedPermutationHashFunction<BurntPancakeState> hasher;
+
+    BurntPancakeState small_state(std::vector<int>{-4, -3, -2, -1});
+    ASSERT_EQ(large_hasher.getHashValue(small_state).m_low, hasher.getHashValue(small_state));
+
+    std::vector<int> perm(24);
+    for (int i = 0; i < 24; i++) {
+        perm[static_cast<std::size_t>(i)] = (i % 3 == 0) ? -(24 - i) : 24 - i;
+    }
+    BurntPancakeState large_state(perm);
+    BurntPancakeState unranked_state(std::vector<int>(24, 1));
+    large_hasher.unrank(large_hasher.getHashValue(large_state), unranked_state);
+    ASSERT_EQ(unranked_state, large_state);
+    ASSERT_TRUE(large_hasher.isPerfectHashFunction());
+}
+
+/**
+ * Checks that getAllSettings returns the correct values.
+ */
+TEST(LargePermutationHashFunctionTests, getSettingsTest) {
+    LargePermutationHashFunction<PancakeState> hasher;
+    auto settings = hasher.getAllSettings();
+    ASSERT_EQ(settings.m_name, LargePermutationHashFunction<PancakeState>::CLASS_NAME);
+    ASSERT_EQ(settings.m_main_settings.size(), 0);
+    ASSERT_EQ(settings.m_sub_component_settings.size(), 0);
+
+    LargeSignedPermutationHashFunction<BurntPancakeState> signed_hasher;
+    ASSERT_EQ(signed_hasher.getAllSettings().m_name, LargeSignedPermutationHashFunction<BurntPancakeState>::CLASS_NAME);
+}
@@ -0,0 +1,113 @@
+#include <gtest/gtest.h>
+
+#include "building_tools/hashing/packed_permutation_hash_function.h"
+#include "building_tools/hashing/permutation_hash_selection.h"
+#include "building_tools/hashing/state_string_hash_function.h"
+#include "environments/burnt_pancake_puzzle/burnt_pancake_state.h"
+#include "environments/pancake_puzzle/pancake_state.h"
+#include "utils/combinatorics.h"
+
+#include <functional>
+#include <numeric>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+/**
+ * Tests that packed keys of different 40-pancake states are different and can be used in a hash set, and that states
+ * are recovered from their keys.
+ */
+TEST(PackedPermutationHashFunctionTests, pancakeTest) {
+    PackedPermutationHashFunction<PancakeState> hasher;
+    std::mt19937 gen(11);
+    std::unordered_set<PackedPermutationKey<>> keys;
+
+    PancakeState unranked_state(std::vector<int>{0});
+    for (int i = 0; i < 100; i++) {
+        PancakeState state(getRandomPermutation(40, gen));
+        PackedPermutationKey<> key = hasher.getHashValue(state);
+        ASSERT_EQ(key, hasher.getHashValue(state));
+        keys.insert(key);
+
+        hasher.unrank(key, unranked_state);
+        ASSERT_EQ(unranked_state, state);
+    }
+    ASSERT_EQ(keys.size(), 100U);
+    ASSERT_TRUE(hasher.isPerfectHashFunction());
+    ASSERT_TRUE(hasher.isInvertible());
+}
+
+/**
+ * Tests that packed keys keep the signs of burnt pancakes.
+ */
+TEST(PackedPermutationHashFunctionTests, burntPancakeTest) {
+    PackedPermutationHashFunction<BurntPancakeState> hasher;
+
+    BurntPancakeState state1(std::vector<int>{1, -3, 4, 2});
+    BurntPancakeState state2(std::vector<int>{1, 3, 4, 2});
+    ASSERT_NE(hasher.getHashValue(state1), hasher.getHashValue(state2));
+
+    std::ostringstream out;
+    out << hasher.getHashValue(state1);
+    ASSERT_EQ(out.str(), "1 -3 4 2");
+}
+
+/**
+ * Tests that permutations that are too large for the key, or whose entries do not fit in a byte, are rejected.
+ */
+TEST(PackedPermutationHashFunctionTests, unpackableStateTest) {
+    PackedPermutationHashFunction<PancakeState, 8> hasher;
+    std::vector<int> perm(9);
+    std::iota(perm.begin(), perm.end(), 0);
+    ASSERT_THROW(hasher.getHashValue(PancakeState(perm)), std::length_error);
+
+    perm.resize(8);
+    perm[7] = 128;
+    ASSERT_THROW(hasher.getHashValue(PancakeState(perm)), std::domain_error);
+
+    perm[7] = -128;
+    ASSERT_NO_THROW(hasher.getHashValue(PancakeState(perm)));
+}
+
+/**
+ * Tests that the hash function type is selected by the size of the permutations.
+ */
+TEST(PackedPermutationHashFunctionTests, getPermutationHashTypeTest) {
+    ASSERT_EQ(getPermutationHashType(16, false), PermutationHashType::rank64);
+    ASSERT_EQ(getPermutationHashType(20, false), PermutationHashType::rank64);
+    ASSERT_EQ(getPermutationHashType(25, false), PermutationHashType::rank128);
+    ASSERT_EQ(getPermutationHashType(34, false), PermutationHashType::rank128);
+    ASSERT_EQ(getPermutationHashType(40, false), PermutationHashType::packed_bytes);
+    ASSERT_EQ(getPermutationHashType(64, false), PermutationHashType::packed_bytes);
+    ASSERT_EQ(getPermutationHashType(65, false), PermutationHashType::state_string);
+
+    ASSERT_EQ(getPermutationHashType(16, true), PermutationHashType::rank64);
+    ASSERT_EQ(getPermutationHashType(20, true), PermutationHashType::rank128);
+    ASSERT_EQ(getPermutationHashType(29, true), PermutationHashType::packed_bytes);
+    ASSERT_EQ(getPermutationHashType(100, true), PermutationHashType::state_string);
+}
+
+/**
+ * Tests that the selected hash function is called with and gives the expected hash values.
+ */
+TEST(PackedPermutationHashFunctionTests, callWithPermutationHashFunctionTest) {
+    std::vector<std::string> names;
+    auto record_name = [&names](const auto& hash_function) { names.push_back(hash_function.getName()); };
+
+    callWithPermutationHashFunction<PancakeState>(12, false, record_name);
+    callWithPermutationHashFunction<PancakeState>(24, false, record_name);
+    callWithPermutationHashFunction<PancakeState>(40, false, record_name);
+    callWithPermutationHashFunction<PancakeState>(80, false, record_name);
+    callWithPermutationHashFunction<BurntPancakeState>(12, true, record_name);
+    callWithPermutationHashFunction<BurntPancakeState>(20, true, record_name);
+
+    std::vector<std::string> expected_names = {PermutationHashFunction<PancakeState>::CLASS_NAME,
+              LargePermutationHashFunction<PancakeState>::CLASS_NAME, PackedPermutationHashFunction<PancakeState>::CLASS_NAME,
+              StateStringHashFunction<PancakeState>::CLASS_NAME,
+              SignedPermutationHashFunction<BurntPancakeState>::CLASS_NAME,
+              LargeSignedPermutationHashFunction<BurntPancakeState>::CLASS_NAME};
+    ASSERT_EQ(names, expected_names);
+}
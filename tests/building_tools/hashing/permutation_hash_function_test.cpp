@@ -21,6 +21,9 @@ TEST(PermutationHashFunctionTests, slidingTileTest) {
     ASSERT_EQ(hasher.getHashValue(state1), expected_hash1);
     ASSERT_EQ(hasher.getHashValue(state2), expected_hash2);
     ASSERT_TRUE(hasher.isPerfectHashFunction());
+
+    // Sliding tile states also store the location of the blank, which unrank does not restore
+    ASSERT_FALSE(hasher.isInvertible());
 }
 
 /**
@@ -43,6 +46,25 @@ TEST(PermutationHashFunctionTests, pancakeTest) {
     ASSERT_TRUE(hasher.isPerfectHashFunction());
 }
 
+/**
+ * Tests that unrank recovers the permutation of every state of a small pancake puzzle.
+ */
+TEST(PermutationHashFunctionTests, unrankTest) {
+    PermutationHashFunction<PancakeState> hasher;
+    ASSERT_TRUE(hasher.isInvertible());
+
+    PancakeState state(std::vector<int>{0, 1, 2, 3, 4});
+    for (uint64_t rank = 0; rank < 120; rank++) {
+        hasher.unrank(rank, state);
+        ASSERT_EQ(hasher.getHashValue(state), rank);
+    }
+
+    PancakeState expected_state(std::vector<int>{3, 1, 0, 2, 5, 4});
+    PancakeState unranked_state(std::vector<int>{0, 1, 2, 3, 4, 5});
+    hasher.unrank(385, unranked_state);
+    ASSERT_EQ(unranked_state, expected_state);
+}
+
 /**
  * Checks that getAllSettings returns the correct values.
  */
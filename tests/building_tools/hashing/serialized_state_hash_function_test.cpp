@@ -0,0 +1,99 @@
+#include <gtest/gtest.h>
+
+#include "building_tools/hashing/byte_hash.h"
+#include "building_tools/hashing/hash_128.h"
+#include "building_tools/hashing/serialized_state_hash_function.h"
+#include "environments/k_ary_tree/k_ary_tree_state.h"
+#include "environments/pancake_puzzle/pancake_state.h"
+#include "utils/byte_sink.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_set>
+#include <vector>
+
+/**
+ * Tests that the byte hash depends on every byte, on the length, and on the seed.
+ */
+TEST(SerializedStateHashFunctionTests, byteHashTest) {
+    std::vector<uint8_t> bytes(100);
+    for (std::size_t i = 0; i < bytes.size(); ++i) {
+        bytes[i] = static_cast<uint8_t>(i * 7);
+    }
+
+    std::unordered_set<uint64_t> hash_values;
+    for (std::size_t size = 0; size <= bytes.size(); ++size) {
+        hash_values.insert(hashBytes64(bytes.data(), size));
+        ASSERT_EQ(hashBytes64(bytes.data(), size), hashBytes64(bytes.data(), size));
+    }
+    ASSERT_EQ(hash_values.size(), bytes.size() + 1);
+
+    uint64_t original = hashBytes64(bytes.data(), bytes.size());
+    for (std::size_t i = 0; i < bytes.size(); ++i) {
+        bytes[i] ^= 1U;
+        ASSERT_NE(hashBytes64(bytes.data(), bytes.size()), original) << "Flipped byte " << i;
+        bytes[i] ^= 1U;
+    }
+
+    ASSERT_NE(hashBytes64(bytes.data(), bytes.size(), 1), original);
+    Hash128 hash_128 = hashBytes128(bytes.data(), bytes.size());
+    ASSERT_EQ(hash_128.m_low, original);
+    ASSERT_NE(hash_128.m_high, original);
+}
+
+/**
+ * Tests that k-ary tree states are hashed by their serialization, including states of different depths.
+ */
+TEST(SerializedStateHashFunctionTests, kAryTreeTest) {
+    SerializedStateHashFunction<KAryTreeState> hasher;
+
+    KAryTreeState root;
+    KAryTreeState state1({0, 1, 2});
+    KAryTreeState state2({0, 1, 2});
+    KAryTreeState state3({0, 1, 2, 0});
+    KAryTreeState state4({2, 1, 0});
+
+    ASSERT_EQ(hasher.getHashValue(state1), hasher.getHashValue(state2));
+    ASSERT_NE(hasher.getHashValue(state1), hasher.getHashValue(state3));
+    ASSERT_NE(hasher.getHashValue(state1), hasher.getHashValue(state4));
+    ASSERT_NE(hasher.getHashValue(root), hasher.getHashValue(state1));
+    ASSERT_FALSE(hasher.isPerfectHashFunction());
+
+    ByteSink sink;
+    serialize(sink, state3);
+    ASSERT_EQ(sink.getSize(), sizeof(uint32_t) + 4 * sizeof(KAryTreeAction));
+    ASSERT_EQ(hasher.getHashValue(state3), hashBytes64(sink.getData(), sink.getSize()));
+}
+
+/**
+ * Tests that all pancake states of a small size get different 64-bit and 128-bit hash values.
+ */
+TEST(SerializedStateHashFunctionTests, pancakeTest) {
+    SerializedStateHashFunction<PancakeState> hasher;
+    SerializedStateHashFunction<PancakeState, Hash128> hasher_128(3);
+
+    std::vector<int> perm = {0, 1, 2, 3, 4, 5, 6};
+    std::unordered_set<uint64_t> hash_values;
+    std::unordered_set<Hash128> hash_values_128;
+    do {
+        hash_values.insert(hasher.getHashValue(PancakeState(perm)));
+        hash_values_128.insert(hasher_128.getHashValue(PancakeState(perm)));
+    } while (std::next_permutation(perm.begin(), perm.end()));
+
+    ASSERT_EQ(hash_values.size(), 5040);
+    ASSERT_EQ(hash_values_128.size(), 5040);
+}
+
+/**
+ * Checks that getAllSettings returns the correct values.
+ */
+TEST(SerializedStateHashFunctionTests, getSettingsTest) {
+    SerializedStateHashFunction<PancakeState> hasher(7);
+
+    auto settings = hasher.getAllSettings();
+    ASSERT_EQ(settings.m_name, SerializedStateHashFunction<PancakeState>::CLASS_NAME);
+    ASSERT_EQ(settings.m_main_settings.size(), 1);
+    ASSERT_EQ(settings.m_main_settings.at("seed"), "7");
+    ASSERT_EQ(settings.m_sub_component_settings.size(), 0);
+}
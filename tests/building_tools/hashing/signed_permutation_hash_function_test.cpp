@@ -43,6 +43,24 @@ TEST(SignedPermutationHashFunctionTests, burntPancakeTest) {
     ASSERT_TRUE(hasher.isPerfectHashFunction());
 }
 
+/**
+ * Tests that unrank recovers the signed permutation of every state of a small burnt pancake puzzle.
+ */
+TEST(SignedPermutationHashFunctionTests, unrankTest) {
+    SignedPermutationHashFunction<BurntPancakeState> hasher;
+    ASSERT_TRUE(hasher.isInvertible());
+
+    BurntPancakeState state(std::vector<int>{1, 2, 3, 4});
+    for (uint64_t rank = 0; rank < 384; rank++) {
+        hasher.unrank(rank, state);
+        ASSERT_EQ(hasher.getHashValue(state), rank);
+    }
+
+    BurntPancakeState expected_state(std::vector<int>{1, -3, -4, 2});
+    hasher.unrank(147, state);
+    ASSERT_EQ(state, expected_state);
+}
+
 /**
  * Checks that getAllSettings returns the correct values.
  */
@@ -0,0 +1,35 @@
+#include <gtest/gtest.h>
+
+#include "building_tools/transitions/inverse_transition_system.h"
+#include "environments/sliding_tile_puzzle/sliding_tile_action.h"
+#include "environments/sliding_tile_puzzle/sliding_tile_state.h"
+#include "environments/sliding_tile_puzzle/sliding_tile_transitions.h"
+
+#include <optional>
+#include <vector>
+
+/**
+ * Tests that each action generates a predecessor of the state, whose cost is that of the forward action leading back
+ * to the state.
+ */
+TEST(InverseTransitionSystemTests, predecessorTest) {
+    SlidingTileTransitions forward_transitions(2, 3, SlidingTileCostType::heavy);
+    InverseTransitionSystem<SlidingTileState, BlankSlide> backward_transitions(forward_transitions);
+    SlidingTileState state(std::vector<Tile>{1, 0, 2, 3, 4, 5}, 2, 3);
+
+    ASSERT_EQ(backward_transitions.getActions(state), forward_transitions.getActions(state));
+
+    for (BlankSlide action : backward_transitions.getActions(state)) {
+        SlidingTileState predecessor = backward_transitions.getChildState(state, action);
+        std::optional<BlankSlide> forward_action = backward_transitions.getInverse(state, action);
+        ASSERT_TRUE(forward_action.has_value());
+
+        ASSERT_EQ(forward_transitions.getChildState(predecessor, forward_action.value()), state);
+        ASSERT_EQ(backward_transitions.getActionCost(state, action),
+                  forward_transitions.getActionCost(predecessor, forward_action.value()));
+    }
+
+    // Moving the blank left in the state moves tile 1, which is moved back by the forward action
+    ASSERT_EQ(backward_transitions.getActionCost(state, BlankSlide::left), 1.0);
+    ASSERT_EQ(backward_transitions.getActionCost(state, BlankSlide::down), 4.0);
+}
@@ -1,14 +1,24 @@
+#include "building_tools/evaluators/constant_heuristic.h"
 #include "building_tools/evaluators/hash_map_heuristic.h"
 #include "building_tools/goal_tests/single_state_goal_test.h"
 #include "building_tools/hashing/permutation_hash_function.h"
 #include "building_tools/hashing/state_string_hash_function.h"
 #include "engines/best_first_search/a_star_epsilon.h"
+#include "environments/graph/csr_graph.h"
+#include "environments/graph/csr_graph_action.h"
+#include "environments/graph/csr_graph_state.h"
+#include "environments/graph/csr_graph_transitions.h"
+#include "environments/graph/csr_vertex_hash_function.h"
 #include "environments/graph/graph_transitions.h"
 #include "environments/graph/graph_utils.h"
 #include "environments/graph/vertex_hash_function.h"
 #include "environments/sliding_tile_puzzle/sliding_tile_manhattan_heuristic.h"
 #include "environments/sliding_tile_puzzle/sliding_tile_transitions.h"
+#include "environments/sliding_tile_puzzle/sliding_tile_zobrist_hash_function.h"
 #include "gtest/gtest.h"
+#include "utils/plan_and_path_utils.h"
+
+#include <string>
 
 /** 
 * Creates a fixture for A Star Epsilon tests. Uses sliding tile environment and manhattan distance heuristic.
@@ -261,6 +271,65 @@ TEST_F(AStarEpsilonSlidingTileTest, getSearchStatisticsTest) {
     ASSERT_EQ(stats.m_num_evals, 11);
 }
 
+/**
+ * Checks that using an incremental hash function gives the same search as the permutation hash function.
+ */
+TEST_F(AStarEpsilonSlidingTileTest, incrementalHashFunctionTest) {
+    AStarEpsilon<SlidingTileState, BlankSlide, uint64_t> engine(params);
+    SlidingTileZobristHashFunction<> zobrist_hash_function(2, 3);
+
+    engine.setHeuristic(heuristic);
+    engine.setTransitionSystem(transitions);
+    engine.setGoalTest(goal_test);
+    engine.setHashFunction(zobrist_hash_function);
+
+    engine.searchForPlan(init_state);
+    ASSERT_TRUE(engine.hasFoundSolution());
+
+    auto stats = engine.getStandardEngineStatistics();
+    ASSERT_EQ(stats.m_num_goal_tests, 7);
+    ASSERT_EQ(stats.m_num_states_generated, 15);
+    ASSERT_EQ(stats.m_num_evals, 11);
+}
+
+/**
+ * A hash function for sliding tile states that only uses the location of the blank, used to test that states with
+ * colliding hash values are kept apart.
+ */
+class BlankLocationHashFunction : public StateHashFunction<SlidingTileState, uint64_t> {
+public:
+    uint64_t getHashValue(const SlidingTileState& state) const override { return state.m_blank_loc; }
+    bool isPerfectHashFunction() const override { return false; }
+    std::string getName() const override { return "BlankLocationHashFunction"; }
+
+protected:
+    StringMap getComponentSettings() const override { return {}; }
+    SearchSettingsMap getSubComponentSettings() const override { return {}; }
+};
+
+/**
+ * Checks that generated states are compared to stored states when the hash function is not perfect.
+ */
+TEST_F(AStarEpsilonSlidingTileTest, hashCollisionTest) {
+    AStarEpsilon<SlidingTileState, BlankSlide, uint64_t> engine(params);
+    engine.setHeuristic(heuristic);
+    engine.setTransitionSystem(transitions);
+    engine.setGoalTest(goal_test);
+    engine.setHashFunction(hash_function);
+    engine.searchForPlan(init_state);
+    ASSERT_TRUE(engine.hasFoundSolution());
+    double optimal_cost = engine.getLastSolutionPlanCost();
+    ASSERT_EQ(engine.getEngineSpecificStatistics().at("num_hash_collisions"), "0");
+
+    BlankLocationHashFunction blank_hash;
+    engine.setHashFunction(blank_hash);
+    engine.searchForPlan(init_state);
+    ASSERT_TRUE(engine.hasFoundSolution());
+    ASSERT_EQ(engine.getLastSolutionPlanCost(), optimal_cost);
+    ASSERT_TRUE(checkSolutionPlan(init_state, engine.getLastSolutionPlan(), transitions, goal_test).m_is_valid);
+    ASSERT_GT(std::stoi(engine.getEngineSpecificStatistics().at("num_hash_collisions")), 0);
+}
+
 /**
  * Checks that resource limits are applied correctly.
  */
@@ -561,6 +630,32 @@ TEST(AStarEpsilonGraphTest, nodeReopenedTest) {
 //    ASSERT_EQ(engine.getNodeTable().getNode(0).m_evals[0], 8);
 //}
 
+/**
+ * Checks that a child reached twice in the same expansion is only evaluated and added to open once, with the path of
+ * the cheaper parallel arc.
+ */
+TEST(AStarEpsilonGraphTest, parallelArcTest) {
+    CsrGraph graph(3, {{0, 1, 5}, {0, 1, 3}, {1, 2, 1}});
+    CsrGraphTransitions transitions(graph);
+    SingleStateGoalTest<CsrGraphState> goal_test(CsrGraphState{2});
+    ConstantHeuristic<CsrGraphState, CsrGraphAction> heuristic;
+    CsrVertexHashFunction hash_function;
+
+    AStarEpsilonParams params;
+    AStarEpsilon<CsrGraphState, CsrGraphAction, uint32_t> engine(params);
+    engine.setHeuristic(heuristic);
+    engine.setTransitionSystem(transitions);
+    engine.setGoalTest(goal_test);
+    engine.setHashFunction(hash_function);
+
+    CsrGraphState init_state{0};
+    engine.searchForPlan(init_state);
+    ASSERT_TRUE(engine.hasFoundSolution());
+    ASSERT_EQ(engine.getLastSolutionPlanCost(), 4.0);
+    ASSERT_EQ(engine.getNodes().size(), 3u);
+    ASSERT_TRUE(checkSolutionPlan(init_state, engine.getLastSolutionPlan(), transitions, goal_test).m_is_valid);
+}
+
 /**
 * Tests that get settings works as intended
 */
@@ -0,0 +1,24 @@
+#include <gtest/gtest.h>
+
+#include "engines/best_first_search/anytime_weighted_a_star_params.h"
+#include "utils/string_utils.h"
+
+/**
+ * Tests that getParameterLog contains the correct values
+ */
+TEST(AnytimeWeightedAStarParamsTests, getParameterLogTest) {
+    AnytimeWeightedAStarParams params;
+    StringMap log = params.getParameterLog();
+
+    ASSERT_EQ(log.at("initial_weight"), roundAndToString(params.m_initial_weight, 2));
+    ASSERT_EQ(log.at("weight_decrement"), roundAndToString(params.m_weight_decrement, 2));
+    ASSERT_EQ(log.at("final_weight"), roundAndToString(params.m_final_weight, 2));
+
+    params.m_initial_weight = 3.0;
+    params.m_weight_decrement = 0.5;
+    params.m_final_weight = 1.5;
+    log = params.getParameterLog();
+    ASSERT_EQ(log.at("initial_weight"), roundAndToString(3.0, 2));
+    ASSERT_EQ(log.at("weight_decrement"), roundAndToString(0.5, 2));
+    ASSERT_EQ(log.at("final_weight"), roundAndToString(1.5, 2));
+}
@@ -0,0 +1,209 @@
+#include <gtest/gtest.h>
+
+#include "building_tools/evaluators/constant_heuristic.h"
+#include "building_tools/goal_tests/single_state_goal_test.h"
+#include "building_tools/hashing/permutation_hash_function.h"
+#include "building_tools/hashing/serialized_state_hash_function.h"
+#include "engines/best_first_search/anytime_weighted_a_star.h"
+#include "environments/graph/csr_graph.h"
+#include "environments/graph/csr_graph_action.h"
+#include "environments/graph/csr_graph_state.h"
+#include "environments/graph/csr_graph_transitions.h"
+#include "environments/graph/csr_vertex_hash_function.h"
+#include "environments/sliding_tile_puzzle/sliding_tile_action.h"
+#include "environments/sliding_tile_puzzle/sliding_tile_manhattan_heuristic.h"
+#include "environments/sliding_tile_puzzle/sliding_tile_state.h"
+#include "environments/sliding_tile_puzzle/sliding_tile_transitions.h"
+#include "test_helpers.h"
+#include "utils/plan_and_path_utils.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+/**
+ * Checks that the solutions in the stream get cheaper over time, that the last one matches the incumbent, and that the
+ * weights used never increase.
+ */
+void checkSolutionStream(const std::vector<AnytimeSolution>& stream, double incumbent_cost) {
+    ASSERT_FALSE(stream.empty());
+    for (std::size_t i = 1; i < stream.size(); ++i) {
+        ASSERT_LT(stream[i].m_cost, stream[i - 1].m_cost);
+        ASSERT_GE(stream[i].m_time_seconds, stream[i - 1].m_time_seconds);
+        ASSERT_GE(stream[i].m_num_expansions, stream[i - 1].m_num_expansions);
+        ASSERT_LE(stream[i].m_weight, stream[i - 1].m_weight);
+    }
+    ASSERT_EQ(stream.back().m_cost, incumbent_cost);
+}
+
+/**
+ * Checks that the engine can only run once the heuristic and the hash function are set.
+ */
+TEST(AnytimeWeightedAStarTests, setAndCanRunTest) {
+    SlidingTileState goal_state(2, 3);
+    SingleStateGoalTest<SlidingTileState> goal_test(goal_state);
+    SlidingTileTransitions transitions(2, 3);
+    SlidingTileManhattanHeuristic heuristic(goal_state, SlidingTileCostType::unit);
+    PermutationHashFunction<SlidingTileState> hash_function;
+    SerializedStateHashFunction<SlidingTileState> non_perfect_hash_function;
+
+    AnytimeWeightedAStarParams params;
+    AnytimeWeightedAStar<SlidingTileState, BlankSlide, uint64_t> engine(params);
+    engine.setTransitionSystem(transitions);
+    engine.setGoalTest(goal_test);
+    ASSERT_FALSE(engine.canRunSearch());
+
+    engine.setHeuristic(heuristic);
+    ASSERT_FALSE(engine.canRunSearch());
+
+    engine.setHashFunction(non_perfect_hash_function);
+    ASSERT_FALSE(engine.canRunSearch());
+
+    engine.setHashFunction(hash_function);
+    ASSERT_TRUE(engine.canRunSearch());
+    ASSERT_EQ(engine.getName(), "AWAStar");
+
+    params.m_weight_decrement = 1.0;
+    engine.setEngineParams(params);
+    ASSERT_EQ(engine.getName(), "ARAStar");
+}
+
+/**
+ * Checks that AWA* finds a stream of improving solutions on the 8-puzzle, and ends with a solution that is proven
+ * optimal.
+ */
+TEST(AnytimeWeightedAStarTests, awaStarTest) {
+    std::mt19937 rand_gen(19);
+    SlidingTileState goal_state(3, 3);
+    SingleStateGoalTest<SlidingTileState> goal_test(goal_state);
+    PermutationHashFunction<SlidingTileState> hash_function;
+    std::size_t num_improved = 0;
+
+    for (SlidingTileCostType cost_type : {SlidingTileCostType::unit, SlidingTileCostType::heavy}) {
+        SlidingTileTransitions transitions(3, 3, cost_type);
+
+        for (int trial = 0; trial < 5; ++trial) {
+            SlidingTileState init_state = getRandomWalkState(goal_state, transitions, 80, rand_gen);
+            SlidingTileManhattanHeuristic a_star_heuristic(goal_state, cost_type);
+            double a_star_cost = getAStarCost(init_state, transitions, goal_test, a_star_heuristic, hash_function);
+
+            SlidingTileManhattanHeuristic heuristic(goal_state, cost_type);
+            AnytimeWeightedAStarParams params;
+            params.m_initial_weight = 5.0;
+            AnytimeWeightedAStar<SlidingTileState, BlankSlide, uint64_t> engine(params);
+            engine.setHeuristic(heuristic);
+            engine.setTransitionSystem(transitions);
+            engine.setGoalTest(goal_test);
+            engine.setHashFunction(hash_function);
+            engine.searchForPlan(init_state);
+
+            ASSERT_EQ(engine.getStatus(), EngineStatus::search_completed);
+            ASSERT_TRUE(engine.isSolutionProvenOptimal());
+            ASSERT_EQ(engine.getLastSolutionPlanCost(), a_star_cost);
+            ASSERT_TRUE(checkSolutionPlan(init_state, engine.getLastSolutionPlan(), transitions, goal_test).m_is_valid);
+            checkSolutionStream(engine.getSolutionStream(), engine.getLastSolutionPlanCost());
+            ASSERT_EQ(engine.getSolutionStream().front().m_weight, 5.0);
+            num_improved += engine.getSolutionStream().size() - 1;
+        }
+    }
+    ASSERT_GT(num_improved, 0u);
+}
+
+/**
+ * Checks that ARA* lowers the weight after each solution while keeping its open and closed lists, and ends with a
+ * solution that is proven optimal.
+ */
+TEST(AnytimeWeightedAStarTests, araStarTest) {
+    std::mt19937 rand_gen(23);
+    SlidingTileState goal_state(3, 3);
+    SingleStateGoalTest<SlidingTileState> goal_test(goal_state);
+    PermutationHashFunction<SlidingTileState> hash_function;
+
+    for (SlidingTileCostType cost_type : {SlidingTileCostType::unit, SlidingTileCostType::heavy}) {
+        SlidingTileTransitions transitions(3, 3, cost_type);
+
+        for (int trial = 0; trial < 5; ++trial) {
+            SlidingTileState init_state = getRandomWalkState(goal_state, transitions, 80, rand_gen);
+            SlidingTileManhattanHeuristic a_star_heuristic(goal_state, cost_type);
+            double a_star_cost = getAStarCost(init_state, transitions, goal_test, a_star_heuristic, hash_function);
+
+            SlidingTileManhattanHeuristic heuristic(goal_state, cost_type);
+            AnytimeWeightedAStarParams params;
+            params.m_initial_weight = 3.0;
+            params.m_weight_decrement = 0.5;
+            AnytimeWeightedAStar<SlidingTileState, BlankSlide, uint64_t> engine(params);
+            engine.setHeuristic(heuristic);
+            engine.setTransitionSystem(transitions);
+            engine.setGoalTest(goal_test);
+            engine.setHashFunction(hash_function);
+            engine.searchForPlan(init_state);
+
+            ASSERT_TRUE(engine.isSolutionProvenOptimal());
+            ASSERT_EQ(engine.getLastSolutionPlanCost(), a_star_cost);
+            ASSERT_TRUE(checkSolutionPlan(init_state, engine.getLastSolutionPlan(), transitions, goal_test).m_is_valid);
+
+            const std::vector<AnytimeSolution>& stream = engine.getSolutionStream();
+            checkSolutionStream(stream, engine.getLastSolutionPlanCost());
+            for (std::size_t i = 0; i < stream.size(); ++i) {
+                // Each solution is within the weight it was found with of the optimal cost
+                ASSERT_LE(stream[i].m_cost, stream[i].m_weight * a_star_cost + 1e-9);
+            }
+            ASSERT_EQ(stream.front().m_weight, 3.0);
+            ASSERT_LE(engine.getCurrentWeight(), std::max(1.0, stream.back().m_weight - 0.5));
+        }
+    }
+}
+
+/**
+ * Checks that the search ends without a solution when the goal cannot be reached.
+ */
+TEST(AnytimeWeightedAStarTests, noSolutionTest) {
+    SlidingTileState goal_state(2, 3);
+    SingleStateGoalTest<SlidingTileState> goal_test(goal_state);
+    SlidingTileTransitions transitions(2, 3);
+    SlidingTileManhattanHeuristic heuristic(goal_state, SlidingTileCostType::unit);
+    PermutationHashFunction<SlidingTileState> hash_function;
+    SlidingTileState init_state(std::vector<Tile>{0, 2, 1, 3, 4, 5}, 2, 3);
+
+    AnytimeWeightedAStarParams params;
+    AnytimeWeightedAStar<SlidingTileState, BlankSlide, uint64_t> engine(params);
+    engine.setHeuristic(heuristic);
+    engine.setTransitionSystem(transitions);
+    engine.setGoalTest(goal_test);
+    engine.setHashFunction(hash_function);
+    engine.searchForPlan(init_state);
+
+    ASSERT_EQ(engine.getStatus(), EngineStatus::search_completed);
+    ASSERT_FALSE(engine.hasFoundSolution());
+    ASSERT_FALSE(engine.isSolutionProvenOptimal());
+    ASSERT_TRUE(engine.getSolutionStream().empty());
+    ASSERT_EQ(engine.getNodes().size(), 360u);
+}
+
+/**
+ * Checks that a child reached twice in the same expansion is only evaluated and added to open once, with the path of
+ * the cheaper parallel arc.
+ */
+TEST(AnytimeWeightedAStarTests, parallelArcTest) {
+    CsrGraph graph(3, {{0, 1, 5}, {0, 1, 3}, {1, 2, 1}});
+    CsrGraphTransitions transitions(graph);
+    SingleStateGoalTest<CsrGraphState> goal_test(CsrGraphState{2});
+    ConstantHeuristic<CsrGraphState, CsrGraphAction> heuristic;
+    CsrVertexHashFunction hash_function;
+
+    AnytimeWeightedAStarParams params;
+    AnytimeWeightedAStar<CsrGraphState, CsrGraphAction, uint32_t> engine(params);
+    engine.setHeuristic(heuristic);
+    engine.setTransitionSystem(transitions);
+    engine.setGoalTest(goal_test);
+    engine.setHashFunction(hash_function);
+
+    CsrGraphState init_state{0};
+    engine.searchForPlan(init_state);
+    ASSERT_TRUE(engine.hasFoundSolution());
+    ASSERT_EQ(engine.getLastSolutionPlanCost(), 4.0);
+    ASSERT_EQ(engine.getNodes().size(), 3u);
+    ASSERT_TRUE(checkSolutionPlan(init_state, engine.getLastSolutionPlan(), transitions, goal_test).m_is_valid);
+}
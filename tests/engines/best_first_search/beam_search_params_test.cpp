@@ -0,0 +1,32 @@
+#include <gtest/gtest.h>
+
+#include "engines/best_first_search/beam_search_params.h"
+#include "utils/string_utils.h"
+
+#include <string>
+
+/**
+ * Tests that getParameterLog contains the correct values
+ */
+TEST(BeamSearchParamsTests, getParameterLogTest) {
+    BeamSearchParams params;
+    StringMap log = params.getParameterLog();
+
+    ASSERT_EQ(log.at("beam_width"), std::to_string(params.m_beam_width));
+    ASSERT_EQ(log.at("use_closed_list"), boolToString(params.m_use_closed_list));
+    ASSERT_EQ(log.at("widen_on_failure"), boolToString(params.m_widen_on_failure));
+    ASSERT_EQ(log.at("width_multiplier"), roundAndToString(params.m_width_multiplier, 2));
+    ASSERT_EQ(log.at("max_beam_width"), std::to_string(params.m_max_beam_width));
+
+    params.m_beam_width = 7;
+    params.m_use_closed_list = false;
+    params.m_widen_on_failure = true;
+    params.m_width_multiplier = 1.5;
+    params.m_max_beam_width = 500;
+    log = params.getParameterLog();
+    ASSERT_EQ(log.at("beam_width"), "7");
+    ASSERT_EQ(log.at("use_closed_list"), boolToString(false));
+    ASSERT_EQ(log.at("widen_on_failure"), boolToString(true));
+    ASSERT_EQ(log.at("width_multiplier"), roundAndToString(1.5, 2));
+    ASSERT_EQ(log.at("max_beam_width"), "500");
+}
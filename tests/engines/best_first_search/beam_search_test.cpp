@@ -0,0 +1,272 @@
+#include <gtest/gtest.h>
+
+#include "building_tools/goal_tests/single_state_goal_test.h"
+#include "building_tools/hashing/permutation_hash_function.h"
+#include "building_tools/hashing/serialized_state_hash_function.h"
+#include "engines/best_first_search/beam_search.h"
+#include "engines/engine_components/eval_functions/f_cost_evaluator.h"
+#include "engines/engine_components/open_lists/evaluator_and_comparing_usage.h"
+#include "environments/pancake_puzzle/gap_heuristic.h"
+#include "environments/pancake_puzzle/pancake_action.h"
+#include "environments/pancake_puzzle/pancake_state.h"
+#include "environments/pancake_puzzle/pancake_transitions.h"
+#include "environments/sliding_tile_puzzle/sliding_tile_action.h"
+#include "environments/sliding_tile_puzzle/sliding_tile_manhattan_heuristic.h"
+#include "environments/sliding_tile_puzzle/sliding_tile_state.h"
+#include "environments/sliding_tile_puzzle/sliding_tile_transitions.h"
+#include "test_helpers.h"
+#include "utils/plan_and_path_utils.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <vector>
+
+/**
+ * Checks that the engine can only run once the evaluators and the hash function are set, and the beam width is positive.
+ */
+TEST(BeamSearchTests, setAndCanRunTest) {
+    SlidingTileState goal_state(2, 3);
+    SingleStateGoalTest<SlidingTileState> goal_test(goal_state);
+    SlidingTileTransitions transitions(2, 3);
+    SlidingTileManhattanHeuristic heuristic(goal_state, SlidingTileCostType::unit);
+    PermutationHashFunction<SlidingTileState> hash_function;
+    SerializedStateHashFunction<SlidingTileState> non_perfect_hash_function;
+
+    BeamSearchParams params;
+    BeamSearch<SlidingTileState, BlankSlide, uint64_t> engine(params);
+    engine.setTransitionSystem(transitions);
+    engine.setGoalTest(goal_test);
+    ASSERT_FALSE(engine.canRunSearch());
+
+    engine.setEvaluator(heuristic);
+    ASSERT_FALSE(engine.canRunSearch());
+
+    engine.setHashFunction(non_perfect_hash_function);
+    ASSERT_FALSE(engine.canRunSearch());
+
+    engine.setHashFunction(hash_function);
+    ASSERT_TRUE(engine.canRunSearch());
+    ASSERT_EQ(engine.getName(), "BeamSearch");
+
+    params.m_beam_width = 0;
+    engine.setEngineParams(params);
+    ASSERT_FALSE(engine.canRunSearch());
+}
+
+/**
+ * Checks that with a beam wide enough to hold every layer, beam search on a unit-cost problem is breadth-first search
+ * and so finds optimal solutions.
+ */
+TEST(BeamSearchTests, wideBeamTest) {
+    std::mt19937 rand_gen(29);
+    SlidingTileState goal_state(3, 3);
+    SingleStateGoalTest<SlidingTileState> goal_test(goal_state);
+    SlidingTileTransitions transitions(3, 3);
+    SlidingTileManhattanHeuristic heuristic(goal_state, SlidingTileCostType::unit);
+    FCostEvaluator<SlidingTileState, BlankSlide> f_cost_evaluator(heuristic);
+    SlidingTileManhattanHeuristic a_star_heuristic(goal_state, SlidingTileCostType::unit);
+    PermutationHashFunction<SlidingTileState> hash_function;
+
+    for (int trial = 0; trial < 5; ++trial) {
+        SlidingTileState init_state = getRandomWalkState(goal_state, transitions, 60, rand_gen);
+
+        BeamSearchParams params;
+        params.m_beam_width = 200000;
+        BeamSearch<SlidingTileState, BlankSlide, uint64_t> engine(params);
+        engine.setEvaluator(f_cost_evaluator);
+        engine.setTransitionSystem(transitions);
+        engine.setGoalTest(goal_test);
+        engine.setHashFunction(hash_function);
+        engine.searchForPlan(init_state);
+
+        ASSERT_EQ(engine.getStatus(), EngineStatus::search_completed);
+        ASSERT_EQ(engine.getLastSolutionPlanCost(), getAStarCost(init_state, transitions, goal_test, a_star_heuristic, hash_function));
+        ASSERT_TRUE(checkSolutionPlan(init_state, engine.getLastSolutionPlan(), transitions, goal_test).m_is_valid);
+        ASSERT_EQ(engine.getEngineSpecificStatistics().at("num_discarded"), "0");
+    }
+}
+
+/**
+ * Checks that narrow beams keep at most the beam width of nodes in each layer, and return valid plans whenever they find
+ * one.
+ */
+TEST(BeamSearchTests, narrowBeamTest) {
+    std::mt19937 rand_gen(31);
+    SlidingTileState goal_state(3, 3);
+    SingleStateGoalTest<SlidingTileState> goal_test(goal_state);
+    SlidingTileTransitions transitions(3, 3);
+    SlidingTileManhattanHeuristic heuristic(goal_state, SlidingTileCostType::unit);
+    FCostEvaluator<SlidingTileState, BlankSlide> f_cost_evaluator(heuristic);
+    SlidingTileManhattanHeuristic a_star_heuristic(goal_state, SlidingTileCostType::unit);
+    PermutationHashFunction<SlidingTileState> hash_function;
+    EvalsAndUsageVec<SlidingTileState, BlankSlide> evals;
+    evals.emplace_back(f_cost_evaluator, true);
+    evals.emplace_back(heuristic, true);
+    int num_solved = 0;
+
+    for (int trial = 0; trial < 5; ++trial) {
+        SlidingTileState init_state = getRandomWalkState(goal_state, transitions, 60, rand_gen);
+        double a_star_cost = getAStarCost(init_state, transitions, goal_test, a_star_heuristic, hash_function);
+
+        for (std::size_t width : {1U, 5U, 50U}) {
+            BeamSearchParams params;
+            params.m_beam_width = width;
+            BeamSearch<SlidingTileState, BlankSlide, uint64_t> engine(params);
+            engine.setEvaluators(evals);
+            engine.setTransitionSystem(transitions);
+            engine.setGoalTest(goal_test);
+            engine.setHashFunction(hash_function);
+            engine.searchForPlan(init_state);
+
+            ASSERT_EQ(engine.getStatus(), EngineStatus::search_completed);
+            ASSERT_LE(engine.getCurrentLayer().size(), width);
+            if (engine.hasFoundSolution()) {
+                num_solved++;
+                ASSERT_GE(engine.getLastSolutionPlanCost(), a_star_cost);
+                ASSERT_TRUE(checkSolutionPlan(init_state, engine.getLastSolutionPlan(), transitions, goal_test).m_is_valid);
+            }
+        }
+    }
+    ASSERT_GT(num_solved, 0);
+}
+
+/**
+ * Checks that widening on failure restarts with a wider beam until an attempt with the maximum beam width fails.
+ */
+TEST(BeamSearchTests, widenOnFailureTest) {
+    SlidingTileState goal_state(2, 3);
+    SingleStateGoalTest<SlidingTileState> goal_test(goal_state);
+    SlidingTileTransitions transitions(2, 3);
+    SlidingTileManhattanHeuristic heuristic(goal_state, SlidingTileCostType::unit);
+    PermutationHashFunction<SlidingTileState> hash_function;
+    SlidingTileState init_state(std::vector<Tile>{0, 2, 1, 3, 4, 5}, 2, 3);
+
+    BeamSearchParams params;
+    params.m_beam_width = 1;
+    params.m_widen_on_failure = true;
+    params.m_width_multiplier = 2.0;
+    params.m_max_beam_width = 64;
+    BeamSearch<SlidingTileState, BlankSlide, uint64_t> engine(params);
+    engine.setEvaluator(heuristic);
+    engine.setTransitionSystem(transitions);
+    engine.setGoalTest(goal_test);
+    engine.setHashFunction(hash_function);
+    engine.searchForPlan(init_state);
+
+    ASSERT_EQ(engine.getStatus(), EngineStatus::search_completed);
+    ASSERT_FALSE(engine.hasFoundSolution());
+    ASSERT_EQ(engine.getNumRestarts(), 6);
+    ASSERT_EQ(engine.getCurrentBeamWidth(), 64u);
+
+    // The last attempt uses the maximum beam width even if it is not reached by multiplying
+    params.m_max_beam_width = 50;
+    engine.setEngineParams(params);
+    engine.searchForPlan(init_state);
+    ASSERT_FALSE(engine.hasFoundSolution());
+    ASSERT_EQ(engine.getNumRestarts(), 6);
+    ASSERT_EQ(engine.getCurrentBeamWidth(), 50u);
+
+    // Solvable problems are always solved once the beam is wide enough
+    std::mt19937 rand_gen(37);
+    SlidingTileTransitions transitions_3x3(3, 3);
+    SlidingTileState goal_state_3x3(3, 3);
+    SingleStateGoalTest<SlidingTileState> goal_test_3x3(goal_state_3x3);
+    SlidingTileManhattanHeuristic heuristic_3x3(goal_state_3x3, SlidingTileCostType::unit);
+    params.m_max_beam_width = 1000000;
+    engine.setEngineParams(params);
+    engine.setEvaluator(heuristic_3x3);
+    engine.setTransitionSystem(transitions_3x3);
+    engine.setGoalTest(goal_test_3x3);
+
+    for (int trial = 0; trial < 5; ++trial) {
+        SlidingTileState start_state = getRandomWalkState(goal_state_3x3, transitions_3x3, 60, rand_gen);
+        engine.searchForPlan(start_state);
+
+        ASSERT_TRUE(engine.hasFoundSolution());
+        ASSERT_TRUE(checkSolutionPlan(start_state, engine.getLastSolutionPlan(), transitions_3x3, goal_test_3x3).m_is_valid);
+    }
+}
+
+/**
+ * Checks that a greedy beam on the gap heuristic finds valid plans for pancake puzzles too large for breadth-first
+ * search.
+ */
+TEST(BeamSearchTests, pancakeTest) {
+    std::mt19937 rand_gen(41);
+    const int num_pancakes = 16;
+    std::vector<Pancake> goal_perm(num_pancakes);
+    std::iota(goal_perm.begin(), goal_perm.end(), 0);
+    PancakeState goal_state(goal_perm);
+    SingleStateGoalTest<PancakeState> goal_test(goal_state);
+    PancakeTransitions transitions(num_pancakes);
+    GapHeuristic heuristic;
+    PermutationHashFunction<PancakeState> hash_function;
+
+    for (int trial = 0; trial < 5; ++trial) {
+        std::vector<Pancake> start_perm = goal_perm;
+        std::shuffle(start_perm.begin(), start_perm.end(), rand_gen);
+        PancakeState start_state(start_perm);
+
+        BeamSearchParams params;
+        params.m_beam_width = 20;
+        params.m_widen_on_failure = true;
+        BeamSearch<PancakeState, NumToFlip, uint64_t> engine(params);
+        engine.setEvaluator(heuristic);
+        engine.setTransitionSystem(transitions);
+        engine.setGoalTest(goal_test);
+        engine.setHashFunction(hash_function);
+        engine.searchForPlan(start_state);
+
+        ASSERT_TRUE(engine.hasFoundSolution());
+        ASSERT_TRUE(checkSolutionPlan(start_state, engine.getLastSolutionPlan(), transitions, goal_test).m_is_valid);
+    }
+}
+
+/**
+ * Checks that evaluating the gap heuristic incrementally from the parent of each candidate gives the same search as
+ * evaluating every candidate from scratch, so the parent of each candidate must be in the list the heuristic is given.
+ */
+TEST(BeamSearchTests, incrementalEvaluationTest) {
+    std::mt19937 rand_gen(43);
+    const int num_pancakes = 12;
+    std::vector<Pancake> goal_perm(num_pancakes);
+    std::iota(goal_perm.begin(), goal_perm.end(), 0);
+    PancakeState goal_state(goal_perm);
+    SingleStateGoalTest<PancakeState> goal_test(goal_state);
+    PancakeTransitions transitions(num_pancakes);
+    PermutationHashFunction<PancakeState> hash_function;
+    GapHeuristic heuristic;
+    GapHeuristic incremental_heuristic;
+    incremental_heuristic.setUseIncrementalEvaluation(true);
+
+    BeamSearchParams params;
+    params.m_beam_width = 10;
+    BeamSearch<PancakeState, NumToFlip, uint64_t> engine(params);
+    engine.setEvaluator(heuristic);
+    engine.setTransitionSystem(transitions);
+    engine.setGoalTest(goal_test);
+    engine.setHashFunction(hash_function);
+
+    BeamSearch<PancakeState, NumToFlip, uint64_t> incremental_engine(params);
+    incremental_engine.setEvaluator(incremental_heuristic);
+    incremental_engine.setTransitionSystem(transitions);
+    incremental_engine.setGoalTest(goal_test);
+    incremental_engine.setHashFunction(hash_function);
+
+    for (int trial = 0; trial < 5; ++trial) {
+        std::vector<Pancake> start_perm = goal_perm;
+        std::shuffle(start_perm.begin(), start_perm.end(), rand_gen);
+        PancakeState start_state(start_perm);
+
+        engine.searchForPlan(start_state);
+        incremental_engine.searchForPlan(start_state);
+
+        ASSERT_EQ(incremental_engine.hasFoundSolution(), engine.hasFoundSolution());
+        ASSERT_EQ(incremental_engine.getLastSolutionPlan(), engine.getLastSolutionPlan());
+        ASSERT_EQ(incremental_engine.getEngineSpecificStatistics().at("num_candidates"),
+                  engine.getEngineSpecificStatistics().at("num_candidates"));
+    }
+}
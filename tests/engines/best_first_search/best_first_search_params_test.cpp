@@ -12,6 +12,8 @@ TEST(BestFirstSearchParamsTests, getParameterLogTest) {
 
     ASSERT_EQ(log.at("use_reopened"), boolToString(params.m_use_reopened));
     ASSERT_EQ(log.at("store_expansion_order"), boolToString(params.m_store_expansion_order));
+    ASSERT_EQ(log.at("verify_hash_matches"), boolToString(params.m_verify_hash_matches));
+    ASSERT_EQ(log.at("use_deferred_evaluation"), boolToString(params.m_use_deferred_evaluation));
 
     log = params.getParameterLog();
 
@@ -22,4 +24,12 @@ TEST(BestFirstSearchParamsTests, getParameterLogTest) {
     params.m_store_expansion_order = true;
     log = params.getParameterLog();
     ASSERT_EQ(log.at("store_expansion_order"), boolToString(params.m_store_expansion_order));
+
+    params.m_verify_hash_matches = true;
+    log = params.getParameterLog();
+    ASSERT_EQ(log.at("verify_hash_matches"), boolToString(params.m_verify_hash_matches));
+
+    params.m_use_deferred_evaluation = true;
+    log = params.getParameterLog();
+    ASSERT_EQ(log.at("use_deferred_evaluation"), boolToString(params.m_use_deferred_evaluation));
 }
\ No newline at end of file
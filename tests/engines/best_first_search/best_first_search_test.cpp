@@ -3,15 +3,31 @@
 #include "building_tools/evaluators/constant_heuristic.h"
 #include "building_tools/evaluators/hash_map_heuristic.h"
 #include "building_tools/goal_tests/single_state_goal_test.h"
+#include "building_tools/hashing/hash_128.h"
 #include "building_tools/hashing/state_string_hash_function.h"
 #include "engines/best_first_search/best_first_search.h"
 #include "engines/best_first_search/best_first_search_params.h"
 #include "engines/engine_components/eval_functions/eval_function_terms.h"
 #include "engines/engine_components/eval_functions/f_cost_evaluator.h"
 #include "engines/engine_components/eval_functions/g_cost_evaluator.h"
+#include "engines/engine_components/node_containers/ranked_node_list.h"
+#include "environments/graph/csr_graph.h"
+#include "environments/graph/csr_graph_action.h"
+#include "environments/graph/csr_graph_state.h"
+#include "environments/graph/csr_graph_transitions.h"
+#include "environments/graph/csr_vertex_hash_function.h"
 #include "environments/graph/graph_transitions.h"
 #include "environments/graph/graph_utils.h"
 #include "environments/graph/vertex_hash_function.h"
+#include "environments/sliding_tile_puzzle/sliding_tile_hash_function.h"
+#include "environments/sliding_tile_puzzle/sliding_tile_manhattan_heuristic.h"
+#include "environments/sliding_tile_puzzle/sliding_tile_transitions.h"
+#include "environments/sliding_tile_puzzle/sliding_tile_zobrist_hash_function.h"
+#include "utils/plan_and_path_utils.h"
+
+#include <cstdint>
+#include <set>
+#include <string>
 
 /**
  * Creates a fixture for IDEngine tests. Just a simple complete tree to depth 2 and will use a zero heuristic.
@@ -201,6 +217,61 @@ TEST_F(BestFirstSearchSimpleGraphTests, searchForPlanAndResetTest) {
     ASSERT_EQ(engine.getExpansionOrder().size(), 0);
 }
 
+/**
+ * A hash function for graph states that maps all vertices to one of two hash values, used to test hash match
+ * verification.
+ */
+class ParityVertexHashFunction : public StateHashFunction<GraphState, uint32_t> {
+public:
+    uint32_t getHashValue(const GraphState& state) const override { return state.m_vertex_id % 2; }
+    bool isPerfectHashFunction() const override { return false; }
+    std::string getName() const override { return "ParityVertexHashFunction"; }
+
+protected:
+    StringMap getComponentSettings() const override { return {}; }
+    SearchSettingsMap getSubComponentSettings() const override { return {}; }
+};
+
+/**
+ * Checks that verifying hash matches keeps states with colliding hash values apart.
+ */
+TEST_F(BestFirstSearchSimpleGraphTests, verifyHashMatchesTest) {
+    ParityVertexHashFunction parity_hash;
+    params.m_verify_hash_matches = true;
+    engine.setEngineParams(params);
+    engine.setEvaluator(f_cost_evaluator);
+    engine.setTransitionSystem(transitions);
+    engine.setGoalTest(goal_test);
+    engine.setHashFunction(parity_hash);
+
+    engine.searchForPlan(init_state);
+    ASSERT_TRUE(engine.hasFoundSolution());
+    ASSERT_EQ(engine.getLastSolutionPlanCost(), 2);
+
+    auto plan = engine.getLastSolutionPlan();
+    ASSERT_EQ(plan.size(), 2);
+    ASSERT_EQ(plan[0], transitions.getEdgeAction("a", "d"));
+    ASSERT_EQ(plan[1], transitions.getEdgeAction("d", "d3"));
+    ASSERT_GT(std::stoi(engine.getEngineSpecificStatistics().at("num_hash_collisions")), 0);
+}
+
+/**
+ * Checks that hash matches are verified for hash functions that are not perfect, even if this is not set in the params.
+ */
+TEST_F(BestFirstSearchSimpleGraphTests, verifyNonPerfectHashMatchesTest) {
+    ParityVertexHashFunction parity_hash;
+    ASSERT_FALSE(params.m_verify_hash_matches);
+    engine.setEvaluator(f_cost_evaluator);
+    engine.setTransitionSystem(transitions);
+    engine.setGoalTest(goal_test);
+    engine.setHashFunction(parity_hash);
+
+    engine.searchForPlan(init_state);
+    ASSERT_TRUE(engine.hasFoundSolution());
+    ASSERT_EQ(engine.getLastSolutionPlanCost(), 2);
+    ASSERT_GT(std::stoi(engine.getEngineSpecificStatistics().at("num_hash_collisions")), 0);
+}
+
 /**
  * Checks that the statistics are being calculated correctly.
  */
@@ -632,6 +703,33 @@ TEST(BestFirstSearchGraphTests, nodeReopenedTest) {
     ASSERT_EQ(f_cost_evaluator.getCachedEval(4), 10);
 }
 
+/**
+ * Checks that a child reached twice in the same expansion is only evaluated and added to open once, with the path of
+ * the cheaper parallel arc.
+ */
+TEST(BestFirstSearchGraphTests, parallelArcTest) {
+    CsrGraph graph(3, {{0, 1, 5}, {0, 1, 3}, {1, 2, 1}});
+    CsrGraphTransitions transitions(graph);
+    SingleStateGoalTest<CsrGraphState> goal_test(CsrGraphState{2});
+    ConstantHeuristic<CsrGraphState, CsrGraphAction> zero_heuristic;
+    FCostEvaluator<CsrGraphState, CsrGraphAction> f_cost_evaluator(zero_heuristic);
+    CsrVertexHashFunction hash_function;
+
+    BestFirstSearchParams params;
+    BestFirstSearch<CsrGraphState, CsrGraphAction, uint32_t> engine(params);
+    engine.setEvaluator(f_cost_evaluator);
+    engine.setTransitionSystem(transitions);
+    engine.setGoalTest(goal_test);
+    engine.setHashFunction(hash_function);
+
+    CsrGraphState init_state{0};
+    engine.searchForPlan(init_state);
+    ASSERT_TRUE(engine.hasFoundSolution());
+    ASSERT_EQ(engine.getLastSolutionPlanCost(), 4.0);
+    ASSERT_EQ(engine.getNodes().size(), 3u);
+    ASSERT_TRUE(checkSolutionPlan(init_state, engine.getLastSolutionPlan(), transitions, goal_test).m_is_valid);
+}
+
 /**
 * Tests that get settings works as intended
 */
@@ -659,11 +757,13 @@ TEST(BestFirstSearchGraphTests, getSettingsTest) {
     auto engine_settings = engine.getAllSettings();
     ASSERT_EQ(engine_settings.m_name, "BestFirstSearch");
     auto& main_settings = engine_settings.m_main_settings;
-    ASSERT_EQ(main_settings.size(), 4);
+    ASSERT_EQ(main_settings.size(), 6);
     ASSERT_EQ(main_settings.at("use_stored_seed"), "false");
     ASSERT_TRUE(main_settings.find("random_seed") != main_settings.end());
     ASSERT_EQ(main_settings.at("use_reopened"), "true");
     ASSERT_EQ(main_settings.at("store_expansion_order"), "false");
+    ASSERT_EQ(main_settings.at("verify_hash_matches"), "false");
+    ASSERT_EQ(main_settings.at("use_deferred_evaluation"), "false");
 
     ASSERT_EQ(engine_settings.m_sub_component_settings.size(), 2);
 
@@ -677,4 +777,225 @@ TEST(BestFirstSearchGraphTests, getSettingsTest) {
     ASSERT_EQ(hash_settings.m_name, "StateStringHashFunction");
     ASSERT_EQ(hash_settings.m_main_settings.size(), 0);
     ASSERT_EQ(hash_settings.m_sub_component_settings.size(), 0);
-}
\ No newline at end of file
+}
+
+/**
+ * Checks that using an incremental 128-bit hash function gives the same search as the permutation hash function.
+ */
+TEST(BestFirstSearchSlidingTileTests, incrementalHashFunctionTest) {
+    SlidingTileState init_state(std::vector<Tile>{7, 2, 4, 5, 0, 6, 8, 3, 1}, 3, 3);
+    SlidingTileState goal_state(3, 3);
+    SingleStateGoalTest<SlidingTileState> goal_test(goal_state);
+    SlidingTileTransitions transitions(3, 3);
+    SlidingTileManhattanHeuristic perm_heuristic(goal_state, SlidingTileCostType::unit);
+    SlidingTileManhattanHeuristic zobrist_heuristic(goal_state, SlidingTileCostType::unit);
+    FCostEvaluator<SlidingTileState, BlankSlide> perm_f_cost_evaluator(perm_heuristic);
+    FCostEvaluator<SlidingTileState, BlankSlide> zobrist_f_cost_evaluator(zobrist_heuristic);
+
+    BestFirstSearchParams params;
+    BestFirstSearch<SlidingTileState, BlankSlide, uint64_t> perm_engine(params);
+    SlidingTileHashFunction perm_hash_function;
+    perm_engine.setEvaluator(perm_f_cost_evaluator);
+    perm_engine.setTransitionSystem(transitions);
+    perm_engine.setGoalTest(goal_test);
+    perm_engine.setHashFunction(perm_hash_function);
+    perm_engine.searchForPlan(init_state);
+
+    BestFirstSearch<SlidingTileState, BlankSlide, Hash128> zobrist_engine(params);
+    SlidingTileZobristHashFunction<Hash128> zobrist_hash_function(3, 3);
+    zobrist_engine.setEvaluator(zobrist_f_cost_evaluator);
+    zobrist_engine.setTransitionSystem(transitions);
+    zobrist_engine.setGoalTest(goal_test);
+    zobrist_engine.setHashFunction(zobrist_hash_function);
+    zobrist_engine.searchForPlan(init_state);
+
+    ASSERT_TRUE(perm_engine.hasFoundSolution());
+    ASSERT_TRUE(zobrist_engine.hasFoundSolution());
+    ASSERT_EQ(zobrist_engine.getLastSolutionPlanCost(), perm_engine.getLastSolutionPlanCost());
+    ASSERT_EQ(zobrist_engine.getClosedListSize(), perm_engine.getClosedListSize());
+    ASSERT_EQ(zobrist_engine.getStandardEngineStatistics().m_num_goal_tests,
+              perm_engine.getStandardEngineStatistics().m_num_goal_tests);
+}
+
+/**
+ * A hash function for sliding tile states that only uses the location of the blank, so that most states share their hash
+ * value with others.
+ */
+class BlankLocationHashFunction : public StateHashFunction<SlidingTileState, uint64_t> {
+public:
+    uint64_t getHashValue(const SlidingTileState& state) const override { return state.m_blank_loc; }
+    bool isPerfectHashFunction() const override { return false; }
+    std::string getName() const override { return "BlankLocationHashFunction"; }
+
+protected:
+    StringMap getComponentSettings() const override { return {}; }
+    SearchSettingsMap getSubComponentSettings() const override { return {}; }
+};
+
+/**
+ * Checks that states whose hash values collide are found again when they are regenerated, so that the search stores
+ * each state once and is the same as the search with a perfect hash function.
+ */
+TEST(BestFirstSearchSlidingTileTests, hashCollisionChainingTest) {
+    SlidingTileState init_state(std::vector<Tile>{7, 2, 4, 5, 0, 6, 8, 3, 1}, 3, 3);
+    SlidingTileState goal_state(3, 3);
+    SingleStateGoalTest<SlidingTileState> goal_test(goal_state);
+    SlidingTileTransitions transitions(3, 3);
+    SlidingTileManhattanHeuristic perm_heuristic(goal_state, SlidingTileCostType::unit);
+    SlidingTileManhattanHeuristic blank_heuristic(goal_state, SlidingTileCostType::unit);
+    FCostEvaluator<SlidingTileState, BlankSlide> perm_f_cost_evaluator(perm_heuristic);
+    FCostEvaluator<SlidingTileState, BlankSlide> blank_f_cost_evaluator(blank_heuristic);
+
+    BestFirstSearchParams params;
+    BestFirstSearch<SlidingTileState, BlankSlide, uint64_t> perm_engine(params);
+    SlidingTileHashFunction perm_hash_function;
+    perm_engine.setEvaluator(perm_f_cost_evaluator);
+    perm_engine.setTransitionSystem(transitions);
+    perm_engine.setGoalTest(goal_test);
+    perm_engine.setHashFunction(perm_hash_function);
+    perm_engine.searchForPlan(init_state);
+
+    BestFirstSearch<SlidingTileState, BlankSlide, uint64_t> blank_engine(params);
+    BlankLocationHashFunction blank_hash_function;
+    blank_engine.setEvaluator(blank_f_cost_evaluator);
+    blank_engine.setTransitionSystem(transitions);
+    blank_engine.setGoalTest(goal_test);
+    blank_engine.setHashFunction(blank_hash_function);
+    blank_engine.searchForPlan(init_state);
+
+    ASSERT_TRUE(perm_engine.hasFoundSolution());
+    ASSERT_TRUE(blank_engine.hasFoundSolution());
+    ASSERT_EQ(blank_engine.getLastSolutionPlanCost(), perm_engine.getLastSolutionPlanCost());
+    ASSERT_EQ(blank_engine.getNodes().size(), perm_engine.getNodes().size());
+    ASSERT_EQ(blank_engine.getClosedListSize(), perm_engine.getClosedListSize());
+
+    // Colliding states are regenerated many times, but each is stored once
+    auto stats = blank_engine.getEngineSpecificStatistics();
+    ASSERT_GT(std::stoll(stats.at("num_hash_collisions")), static_cast<int64_t>(blank_engine.getNodes().size()));
+    std::set<uint64_t> stored_ranks;
+    for (NodeID node_id = 0; node_id < blank_engine.getNodes().size(); node_id++) {
+        stored_ranks.insert(perm_hash_function.getHashValue(blank_engine.getNodes().getState(node_id)));
+    }
+    ASSERT_EQ(stored_ranks.size(), blank_engine.getNodes().size());
+}
+
+/**
+ * Checks that storing the ranks of states in a ranked node list gives the same search as storing the states.
+ */
+TEST(BestFirstSearchSlidingTileTests, rankedNodeListTest) {
+    SlidingTileState init_state(std::vector<Tile>{7, 2, 4, 5, 0, 6, 8, 3, 1}, 3, 3);
+    SlidingTileState goal_state(3, 3);
+    SingleStateGoalTest<SlidingTileState> goal_test(goal_state);
+    SlidingTileTransitions transitions(3, 3);
+    SlidingTileHashFunction hash_function;
+    SlidingTileManhattanHeuristic list_heuristic(goal_state, SlidingTileCostType::unit);
+    SlidingTileManhattanHeuristic ranked_heuristic(goal_state, SlidingTileCostType::unit);
+    FCostEvaluator<SlidingTileState, BlankSlide> list_f_cost_evaluator(list_heuristic);
+    FCostEvaluator<SlidingTileState, BlankSlide> ranked_f_cost_evaluator(ranked_heuristic);
+
+    BestFirstSearchParams params;
+    params.m_store_expansion_order = true;
+    BestFirstSearch<SlidingTileState, BlankSlide, uint64_t> list_engine(params);
+    list_engine.setEvaluator(list_f_cost_evaluator);
+    list_engine.setTransitionSystem(transitions);
+    list_engine.setGoalTest(goal_test);
+    list_engine.setHashFunction(hash_function);
+    list_engine.searchForPlan(init_state);
+
+    BestFirstSearch<SlidingTileState, BlankSlide, uint64_t, RankedNodeList<SlidingTileState, BlankSlide>> ranked_engine(params);
+    ranked_engine.setEvaluator(ranked_f_cost_evaluator);
+    ranked_engine.setTransitionSystem(transitions);
+    ranked_engine.setGoalTest(goal_test);
+    ranked_engine.setHashFunction(hash_function);
+    ranked_engine.searchForPlan(init_state);
+
+    ASSERT_TRUE(list_engine.hasFoundSolution());
+    ASSERT_TRUE(ranked_engine.hasFoundSolution());
+    ASSERT_EQ(ranked_engine.getLastSolutionPlan(), list_engine.getLastSolutionPlan());
+    ASSERT_EQ(ranked_engine.getExpansionOrder(), list_engine.getExpansionOrder());
+
+    const auto& ranked_nodes = ranked_engine.getNodes();
+    ASSERT_EQ(ranked_nodes.size(), list_engine.getNodes().size());
+    for (NodeID node_id = 0; node_id < ranked_nodes.size(); node_id++) {
+        ASSERT_EQ(ranked_nodes.getState(node_id), list_engine.getNodes().getState(node_id));
+        ASSERT_EQ(ranked_nodes.getRank(node_id), hash_function.getHashValue(ranked_nodes.getState(node_id)));
+    }
+}
+
+/**
+ * Checks that deferred evaluation with greedy best-first search finds a solution with fewer evaluations, and that the
+ * statistics account for the evaluations that were saved.
+ */
+TEST(BestFirstSearchSlidingTileTests, deferredEvaluationTest) {
+    SlidingTileState init_state(std::vector<Tile>{7, 2, 4, 5, 0, 6, 8, 3, 1}, 3, 3);
+    SlidingTileState goal_state(3, 3);
+    SingleStateGoalTest<SlidingTileState> goal_test(goal_state);
+    SlidingTileTransitions transitions(3, 3);
+    SlidingTileHashFunction hash_function;
+    SlidingTileManhattanHeuristic eager_heuristic(goal_state, SlidingTileCostType::unit);
+    SlidingTileManhattanHeuristic deferred_heuristic(goal_state, SlidingTileCostType::unit);
+
+    BestFirstSearchParams params;
+    BestFirstSearch<SlidingTileState, BlankSlide, uint64_t> eager_engine(params);
+    eager_engine.setEvaluator(eager_heuristic);
+    eager_engine.setTransitionSystem(transitions);
+    eager_engine.setGoalTest(goal_test);
+    eager_engine.setHashFunction(hash_function);
+    eager_engine.searchForPlan(init_state);
+
+    params.m_use_deferred_evaluation = true;
+    BestFirstSearch<SlidingTileState, BlankSlide, uint64_t> deferred_engine(params);
+    deferred_engine.setEvaluator(deferred_heuristic);
+    deferred_engine.setTransitionSystem(transitions);
+    deferred_engine.setGoalTest(goal_test);
+    deferred_engine.setHashFunction(hash_function);
+    deferred_engine.searchForPlan(init_state);
+
+    ASSERT_TRUE(eager_engine.hasFoundSolution());
+    ASSERT_TRUE(deferred_engine.hasFoundSolution());
+    ASSERT_TRUE(checkSolutionPlan(init_state, deferred_engine.getLastSolutionPlan(), transitions, goal_test).m_is_valid);
+
+    StringMap stats = deferred_engine.getEngineSpecificStatistics();
+    int64_t num_deferred_children = std::stoll(stats.at("num_deferred_children"));
+    int64_t num_deferred_evals = std::stoll(stats.at("num_deferred_evals"));
+    ASSERT_GT(num_deferred_children, 0);
+    ASSERT_GT(num_deferred_evals, 0);
+    ASSERT_GT(std::stoll(stats.at("num_deferred_reinsertions")), 0);
+    ASSERT_EQ(std::stoll(stats.at("num_evals_saved")), num_deferred_children - num_deferred_evals);
+    ASSERT_GT(std::stoll(stats.at("num_evals_saved")), 0);
+
+    ASSERT_LT(deferred_engine.getStandardEngineStatistics().m_num_evals, eager_engine.getStandardEngineStatistics().m_num_evals);
+    ASSERT_EQ(std::stoll(eager_engine.getEngineSpecificStatistics().at("num_deferred_children")), 0);
+}
+
+/**
+ * Checks that deferred evaluation can be used with a tie-breaking evaluator that cannot have its cached values set,
+ * and that A* with an {f, g} tie-break still finds an optimal solution.
+ */
+TEST(BestFirstSearchSlidingTileTests, deferredEvaluationTieBreakingTest) {
+    SlidingTileState init_state(std::vector<Tile>{7, 2, 4, 5, 0, 6, 8, 3, 1}, 3, 3);
+    SlidingTileState goal_state(3, 3);
+    SingleStateGoalTest<SlidingTileState> goal_test(goal_state);
+    SlidingTileTransitions transitions(3, 3);
+    SlidingTileHashFunction hash_function;
+    SlidingTileManhattanHeuristic heuristic(goal_state, SlidingTileCostType::unit);
+    FCostEvaluator<SlidingTileState, BlankSlide> f_cost_evaluator(heuristic);
+    GCostEvaluator<SlidingTileState, BlankSlide> g_cost_evaluator;
+
+    BestFirstSearchParams params;
+    params.m_use_deferred_evaluation = true;
+    BestFirstSearch<SlidingTileState, BlankSlide, uint64_t> engine(params);
+    EvalsAndUsageVec<SlidingTileState, BlankSlide> evals;
+    evals.emplace_back(f_cost_evaluator, true);
+    evals.emplace_back(g_cost_evaluator, false);  // High-g tie-breaking
+    engine.setEvaluators(evals);
+    engine.setTransitionSystem(transitions);
+    engine.setGoalTest(goal_test);
+    engine.setHashFunction(hash_function);
+    engine.searchForPlan(init_state);
+
+    ASSERT_TRUE(engine.hasFoundSolution());
+    ASSERT_EQ(engine.getLastSolutionPlanCost(), 26.0);
+    ASSERT_TRUE(checkSolutionPlan(init_state, engine.getLastSolutionPlan(), transitions, goal_test).m_is_valid);
+    ASSERT_GT(std::stoll(engine.getEngineSpecificStatistics().at("num_deferred_children")), 0);
+}
@@ -0,0 +1,18 @@
+#include <gtest/gtest.h>
+
+#include "engines/best_first_search/breadth_first_heuristic_search_params.h"
+#include "utils/string_utils.h"
+
+/**
+ * Tests that getParameterLog contains the correct values
+ */
+TEST(BreadthFirstHeuristicSearchParamsTests, getParameterLogTest) {
+    BreadthFirstHeuristicSearchParams params;
+    StringMap log = params.getParameterLog();
+
+    ASSERT_EQ(log.at("initial_upper_bound"), roundAndToString(params.m_initial_upper_bound, 2));
+
+    params.m_initial_upper_bound = 12.0;
+    log = params.getParameterLog();
+    ASSERT_EQ(log.at("initial_upper_bound"), roundAndToString(12.0, 2));
+}
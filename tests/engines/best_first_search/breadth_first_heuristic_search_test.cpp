@@ -0,0 +1,172 @@
+#include <gtest/gtest.h>
+
+#include "building_tools/goal_tests/single_state_goal_test.h"
+#include "building_tools/hashing/permutation_hash_function.h"
+#include "building_tools/hashing/serialized_state_hash_function.h"
+#include "engines/best_first_search/breadth_first_heuristic_search.h"
+#include "environments/grid_pathfinding/grid_location.h"
+#include "environments/grid_pathfinding/grid_location_hash_function.h"
+#include "environments/grid_pathfinding/grid_map.h"
+#include "environments/grid_pathfinding/grid_pathfinding_action.h"
+#include "environments/grid_pathfinding/grid_pathfinding_manhattan_heuristic.h"
+#include "environments/grid_pathfinding/grid_pathfinding_transitions.h"
+#include "environments/sliding_tile_puzzle/sliding_tile_action.h"
+#include "environments/sliding_tile_puzzle/sliding_tile_manhattan_heuristic.h"
+#include "environments/sliding_tile_puzzle/sliding_tile_state.h"
+#include "environments/sliding_tile_puzzle/sliding_tile_transitions.h"
+#include "test_helpers.h"
+#include "utils/plan_and_path_utils.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+/**
+ * Checks that the engine can only run once the heuristic and the hash function are set.
+ */
+TEST(BreadthFirstHeuristicSearchTests, setAndCanRunTest) {
+    SlidingTileState goal_state(2, 3);
+    SingleStateGoalTest<SlidingTileState> goal_test(goal_state);
+    SlidingTileTransitions transitions(2, 3);
+    SlidingTileManhattanHeuristic heuristic(goal_state, SlidingTileCostType::unit);
+    PermutationHashFunction<SlidingTileState> hash_function;
+    SerializedStateHashFunction<SlidingTileState> non_perfect_hash_function;
+
+    BreadthFirstHeuristicSearchParams params;
+    BreadthFirstHeuristicSearch<SlidingTileState, BlankSlide, uint64_t> engine(params);
+    engine.setTransitionSystem(transitions);
+    engine.setGoalTest(goal_test);
+    ASSERT_FALSE(engine.canRunSearch());
+
+    engine.setHeuristic(heuristic);
+    ASSERT_FALSE(engine.canRunSearch());
+
+    engine.setHashFunction(non_perfect_hash_function);
+    ASSERT_FALSE(engine.canRunSearch());
+
+    engine.setHashFunction(hash_function);
+    ASSERT_TRUE(engine.canRunSearch());
+    ASSERT_EQ(engine.getStatus(), EngineStatus::ready);
+}
+
+/**
+ * Checks the solutions found for an initial state that is the goal and for one that is a single action away.
+ */
+TEST(BreadthFirstHeuristicSearchTests, shortPlanTest) {
+    SlidingTileState goal_state(2, 3);
+    SingleStateGoalTest<SlidingTileState> goal_test(goal_state);
+    SlidingTileTransitions transitions(2, 3);
+    SlidingTileManhattanHeuristic heuristic(goal_state, SlidingTileCostType::unit);
+    PermutationHashFunction<SlidingTileState> hash_function;
+
+    BreadthFirstHeuristicSearchParams params;
+    BreadthFirstHeuristicSearch<SlidingTileState, BlankSlide, uint64_t> engine(params);
+    engine.setHeuristic(heuristic);
+    engine.setTransitionSystem(transitions);
+    engine.setGoalTest(goal_test);
+    engine.setHashFunction(hash_function);
+
+    engine.searchForPlan(goal_state);
+    ASSERT_TRUE(engine.hasFoundSolution());
+    ASSERT_EQ(engine.getLastSolutionPlanCost(), 0.0);
+    ASSERT_TRUE(engine.getLastSolutionPlan().empty());
+
+    SlidingTileState init_state(std::vector<Tile>{1, 0, 2, 3, 4, 5}, 2, 3);
+    engine.searchForPlan(init_state);
+    ASSERT_TRUE(engine.hasFoundSolution());
+    ASSERT_EQ(engine.getLastSolutionPlanCost(), 1.0);
+    ASSERT_EQ(engine.getLastSolutionPlan(), std::vector<BlankSlide>{BlankSlide::left});
+}
+
+/**
+ * Checks that optimal solutions are found on the 8-puzzle for each cost type, both when the bound starts at the
+ * heuristic value and when it starts at a given upper bound, and that fewer nodes are stored than by A*.
+ */
+TEST(BreadthFirstHeuristicSearchTests, slidingTileTest) {
+    std::mt19937 rand_gen(13);
+    SlidingTileState goal_state(3, 3);
+    SingleStateGoalTest<SlidingTileState> goal_test(goal_state);
+    PermutationHashFunction<SlidingTileState> hash_function;
+    std::size_t num_a_star_nodes = 0;
+    std::size_t num_bfhs_nodes = 0;
+
+    for (SlidingTileCostType cost_type : {SlidingTileCostType::unit, SlidingTileCostType::heavy, SlidingTileCostType::inverse}) {
+        SlidingTileTransitions transitions(3, 3, cost_type);
+
+        for (int trial = 0; trial < 4; ++trial) {
+            SlidingTileState init_state = getRandomWalkState(goal_state, transitions, 60, rand_gen);
+            SlidingTileManhattanHeuristic a_star_heuristic(goal_state, cost_type);
+            AStarResult a_star_result = runAStar(init_state, transitions, goal_test, a_star_heuristic, hash_function);
+
+            for (bool use_upper_bound : {false, true}) {
+                SlidingTileManhattanHeuristic heuristic(goal_state, cost_type);
+                BreadthFirstHeuristicSearchParams params;
+                if (use_upper_bound) {
+                    params.m_initial_upper_bound = a_star_result.m_cost + 2.0;
+                }
+                BreadthFirstHeuristicSearch<SlidingTileState, BlankSlide, uint64_t> engine(params);
+                engine.setHeuristic(heuristic);
+                engine.setTransitionSystem(transitions);
+                engine.setGoalTest(goal_test);
+                engine.setHashFunction(hash_function);
+                engine.searchForPlan(init_state);
+
+                ASSERT_TRUE(engine.hasFoundSolution());
+                ASSERT_NEAR(engine.getLastSolutionPlanCost(), a_star_result.m_cost, 1e-9);
+                ASSERT_TRUE(checkSolutionPlan(init_state, engine.getLastSolutionPlan(), transitions, goal_test).m_is_valid);
+                if (use_upper_bound) {
+                    ASSERT_EQ(engine.getNumIterations(), 1);
+                } else if (cost_type == SlidingTileCostType::unit) {
+                    num_a_star_nodes += a_star_result.m_num_nodes;
+                    num_bfhs_nodes += engine.getMaxNodesStored();
+                }
+            }
+        }
+    }
+    ASSERT_LT(num_bfhs_nodes, num_a_star_nodes);
+}
+
+/**
+ * Checks that optimal solutions are found on a 4-connected grid map with obstacles, and that no solution is reported
+ * when the goal cannot be reached.
+ */
+TEST(BreadthFirstHeuristicSearchTests, gridPathfindingTest) {
+    std::mt19937 rand_gen(17);
+    const int map_size = 32;
+    GridMap map = createRandomMap(map_size, 0.3, rand_gen);
+    GridPathfindingTransitions transitions(&map, GridConnectionType::four);
+    GridLocationHashFunction hash_function;
+
+    std::vector<GridLocation> open_cells = getOpenLocations(map);
+    std::uniform_int_distribution<std::size_t> cell_dist(0, open_cells.size() - 1);
+
+    int num_solved = 0;
+    for (int trial = 0; trial < 30; ++trial) {
+        GridLocation start = open_cells[cell_dist(rand_gen)];
+        GridLocation goal = open_cells[cell_dist(rand_gen)];
+        SingleStateGoalTest<GridLocation> goal_test(goal);
+        GridPathfindingManhattanHeuristic a_star_heuristic(goal);
+        AStarResult a_star_result = runAStar(start, transitions, goal_test, a_star_heuristic, hash_function);
+
+        GridPathfindingManhattanHeuristic heuristic(goal);
+        BreadthFirstHeuristicSearchParams params;
+        BreadthFirstHeuristicSearch<GridLocation, GridDirection, uint32_t> engine(params);
+        engine.setHeuristic(heuristic);
+        engine.setTransitionSystem(transitions);
+        engine.setGoalTest(goal_test);
+        engine.setHashFunction(hash_function);
+        engine.searchForPlan(start);
+
+        if (a_star_result.m_cost < 0.0) {
+            ASSERT_FALSE(engine.hasFoundSolution());
+            ASSERT_EQ(engine.getStatus(), EngineStatus::search_completed);
+            continue;
+        }
+        num_solved++;
+        ASSERT_TRUE(engine.hasFoundSolution());
+        ASSERT_NEAR(engine.getLastSolutionPlanCost(), a_star_result.m_cost, 1e-9);
+        ASSERT_TRUE(checkSolutionPlan(start, engine.getLastSolutionPlan(), transitions, goal_test).m_is_valid);
+    }
+    ASSERT_GT(num_solved, 0);
+}
@@ -0,0 +1,17 @@
+#include <gtest/gtest.h>
+
+#include "engines/best_first_search/d_star_lite_params.h"
+#include "utils/string_utils.h"
+
+/**
+ * Tests that getParameterLog contains the correct values
+ */
+TEST(DStarLiteParamsTests, getParameterLogTest) {
+    DStarLiteParams params;
+    StringMap log = params.getParameterLog();
+    ASSERT_EQ(log.at("reuse_previous_search"), boolToString(true));
+
+    params.m_reuse_previous_search = false;
+    log = params.getParameterLog();
+    ASSERT_EQ(log.at("reuse_previous_search"), boolToString(false));
+}
@@ -0,0 +1,223 @@
+#include <gtest/gtest.h>
+
+#include "building_tools/goal_tests/single_state_goal_test.h"
+#include "building_tools/hashing/permutation_hash_function.h"
+#include "engines/best_first_search/d_star_lite.h"
+#include "environments/grid_pathfinding/grid_location.h"
+#include "environments/grid_pathfinding/grid_location_hash_function.h"
+#include "environments/grid_pathfinding/grid_map.h"
+#include "environments/grid_pathfinding/grid_map_change_recorder.h"
+#include "environments/grid_pathfinding/grid_pathfinding_action.h"
+#include "environments/grid_pathfinding/grid_pathfinding_octile_heuristic.h"
+#include "environments/grid_pathfinding/grid_pathfinding_transitions.h"
+#include "environments/sliding_tile_puzzle/sliding_tile_action.h"
+#include "environments/sliding_tile_puzzle/sliding_tile_manhattan_heuristic.h"
+#include "environments/sliding_tile_puzzle/sliding_tile_state.h"
+#include "environments/sliding_tile_puzzle/sliding_tile_transitions.h"
+#include "test_helpers.h"
+#include "utils/plan_and_path_utils.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+/**
+ * Makes the given location and its neighbours passable, so that it cannot be walled in. Assumes the neighbours are in
+ * the map.
+ */
+void clearNeighbourhood(GridMap& map, const GridLocation& location) {
+    for (int y = location.m_y_coord - 1; y <= location.m_y_coord + 1; ++y) {
+        for (int x = location.m_x_coord - 1; x <= location.m_x_coord + 1; ++x) {
+            map.setLocationType(x, y, GridLocationType::passable);
+        }
+    }
+}
+
+/**
+ * Checks the cost and validity of the engine's last plan against A*, or that it found no plan if A* found none.
+ */
+void checkGridResult(const DStarLite<GridLocation, GridDirection, uint32_t>& engine, const GridLocation& start,
+          const GridPathfindingTransitions& transitions, const SingleStateGoalTest<GridLocation>& goal_test,
+          const GridLocationHashFunction& hash_function) {
+    GridPathfindingOctileHeuristic a_star_heuristic(goal_test.getGoalState());
+    double a_star_cost = getAStarCost(start, transitions, goal_test, a_star_heuristic, hash_function);
+
+    ASSERT_EQ(engine.getStatus(), EngineStatus::search_completed);
+    if (a_star_cost < 0.0) {
+        ASSERT_FALSE(engine.hasFoundSolution());
+        return;
+    }
+    ASSERT_TRUE(engine.hasFoundSolution());
+    ASSERT_NEAR(engine.getLastSolutionPlanCost(), a_star_cost, 1e-9);
+    ASSERT_TRUE(checkSolutionPlan(start, engine.getLastSolutionPlan(), transitions, goal_test).m_is_valid);
+}
+
+/**
+ * Checks that the engine can only run once the heuristic and hash function are set, and the goal test has a single
+ * goal state.
+ */
+TEST(DStarLiteTests, setAndCanRunTest) {
+    GridMap map(5, 5);
+    GridPathfindingTransitions transitions(&map, GridConnectionType::eight);
+    SingleStateGoalTest<GridLocation> goal_test(GridLocation(4, 4));
+    GridPathfindingOctileHeuristic heuristic;
+    GridLocationHashFunction hash_function;
+
+    DStarLiteParams params;
+    DStarLite<GridLocation, GridDirection, uint32_t> engine(params);
+    engine.setTransitionSystem(transitions);
+    engine.setGoalTest(goal_test);
+    ASSERT_FALSE(engine.canRunSearch());
+
+    engine.setHeuristic(heuristic);
+    ASSERT_FALSE(engine.canRunSearch());
+
+    engine.setHashFunction(hash_function);
+    ASSERT_TRUE(engine.canRunSearch());
+    ASSERT_EQ(engine.getName(), "DStarLite");
+}
+
+/**
+ * Checks that D* Lite finds optimal solutions on the sliding tile puzzle when it does not reuse earlier searches.
+ */
+TEST(DStarLiteTests, slidingTileTest) {
+    std::mt19937 rand_gen(53);
+    SlidingTileState goal_state(3, 3);
+    SingleStateGoalTest<SlidingTileState> goal_test(goal_state);
+    PermutationHashFunction<SlidingTileState> hash_function;
+
+    for (SlidingTileCostType cost_type : {SlidingTileCostType::unit, SlidingTileCostType::heavy}) {
+        SlidingTileTransitions transitions(3, 3, cost_type);
+        SlidingTileManhattanHeuristic heuristic(goal_state, cost_type);
+
+        DStarLiteParams params;
+        params.m_reuse_previous_search = false;
+        DStarLite<SlidingTileState, BlankSlide, uint64_t> engine(params);
+        engine.setHeuristic(heuristic);
+        engine.setTransitionSystem(transitions);
+        engine.setGoalTest(goal_test);
+        engine.setHashFunction(hash_function);
+
+        for (int trial = 0; trial < 3; ++trial) {
+            SlidingTileState init_state = getRandomWalkState(goal_state, transitions, 40, rand_gen);
+            SlidingTileManhattanHeuristic a_star_heuristic(goal_state, cost_type);
+            double a_star_cost = getAStarCost(init_state, transitions, goal_test, a_star_heuristic, hash_function);
+
+            engine.searchForPlan(init_state);
+            ASSERT_EQ(engine.getStatus(), EngineStatus::search_completed);
+            ASSERT_NEAR(engine.getLastSolutionPlanCost(), a_star_cost, 1e-9);
+            ASSERT_TRUE(checkSolutionPlan(init_state, engine.getLastSolutionPlan(), transitions, goal_test).m_is_valid);
+            ASSERT_EQ(engine.getNumRepairs(), 0);
+        }
+    }
+}
+
+/**
+ * Checks that with a fixed start and goal, repairing the search after random obstacles are toggled gives optimal
+ * solutions, and that it takes fewer expansions than the initial search on average.
+ */
+TEST(DStarLiteTests, changingMapTest) {
+    std::mt19937 rand_gen(59);
+    const int map_size = 32;
+    GridMap map = createRandomMap(map_size, 0.2, rand_gen);
+    GridPathfindingTransitions transitions(&map, GridConnectionType::eight);
+    GridLocationHashFunction hash_function;
+    hash_function.setMapWidth(transitions);
+    GridMapChangeRecorder recorder(map);
+
+    GridLocation start(1, 1);
+    GridLocation goal(map_size - 2, map_size - 2);
+    clearNeighbourhood(map, start);
+    clearNeighbourhood(map, goal);
+    SingleStateGoalTest<GridLocation> goal_test(goal);
+    GridPathfindingOctileHeuristic heuristic;
+
+    DStarLiteParams params;
+    DStarLite<GridLocation, GridDirection, uint32_t> engine(params);
+    engine.setHeuristic(heuristic);
+    engine.setTransitionSystem(transitions);
+    engine.setGoalTest(goal_test);
+    engine.setHashFunction(hash_function);
+    engine.searchForPlan(start);
+    checkGridResult(engine, start, transitions, goal_test, hash_function);
+    int64_t initial_expansions = std::stoll(engine.getEngineSpecificStatistics().at("num_expansions"));
+
+    std::uniform_int_distribution<int> coord_dist(0, map_size - 1);
+    int64_t total_repair_expansions = 0;
+    const int num_repairs = 30;
+    for (int repair = 0; repair < num_repairs; ++repair) {
+        recorder.clearChanges();
+        for (int toggle = 0; toggle < 3; ++toggle) {
+            GridLocation location(coord_dist(rand_gen), coord_dist(rand_gen));
+            if (location == start || location == goal) {
+                continue;
+            }
+            bool is_obstacle = map.getLocationType(location.m_x_coord, location.m_y_coord) == GridLocationType::obstacle;
+            map.setLocationType(location.m_x_coord, location.m_y_coord, is_obstacle ? GridLocationType::passable : GridLocationType::obstacle);
+        }
+        for (const GridLocation& location : recorder.getAffectedLocations()) {
+            engine.notifyStateChanged(location);
+        }
+
+        engine.searchForPlan(start);
+        checkGridResult(engine, start, transitions, goal_test, hash_function);
+        ASSERT_EQ(engine.getNumRepairs(), repair + 1);
+        total_repair_expansions += std::stoll(engine.getEngineSpecificStatistics().at("num_expansions"));
+    }
+    ASSERT_LT(total_repair_expansions, initial_expansions * num_repairs);
+}
+
+/**
+ * Checks that an agent moving along its plan, and replanning from its new location as obstacles appear and disappear,
+ * always gets an optimal plan from its current location.
+ */
+TEST(DStarLiteTests, movingStartTest) {
+    std::mt19937 rand_gen(61);
+    const int map_size = 24;
+    GridMap map = createRandomMap(map_size, 0.15, rand_gen);
+    GridPathfindingTransitions transitions(&map, GridConnectionType::eight);
+    GridLocationHashFunction hash_function;
+    hash_function.setMapWidth(transitions);
+    GridMapChangeRecorder recorder(map);
+
+    GridLocation start(1, map_size / 2);
+    GridLocation goal(map_size - 2, map_size / 2);
+    clearNeighbourhood(map, start);
+    clearNeighbourhood(map, goal);
+    SingleStateGoalTest<GridLocation> goal_test(goal);
+    GridPathfindingOctileHeuristic heuristic;
+
+    DStarLiteParams params;
+    DStarLite<GridLocation, GridDirection, uint32_t> engine(params);
+    engine.setHeuristic(heuristic);
+    engine.setTransitionSystem(transitions);
+    engine.setGoalTest(goal_test);
+    engine.setHashFunction(hash_function);
+
+    std::uniform_int_distribution<int> coord_dist(0, map_size - 1);
+    GridLocation current = start;
+    engine.searchForPlan(current);
+    checkGridResult(engine, current, transitions, goal_test, hash_function);
+
+    int num_moves = 0;
+    while (engine.hasFoundSolution() && current != goal) {
+        transitions.applyAction(current, engine.getLastSolutionPlan().front());
+        num_moves++;
+
+        recorder.clearChanges();
+        GridLocation location(coord_dist(rand_gen), coord_dist(rand_gen));
+        if (location != current && location != goal) {
+            bool is_obstacle = map.getLocationType(location.m_x_coord, location.m_y_coord) == GridLocationType::obstacle;
+            map.setLocationType(location.m_x_coord, location.m_y_coord, is_obstacle ? GridLocationType::passable : GridLocationType::obstacle);
+        }
+        for (const GridLocation& affected : recorder.getAffectedLocations()) {
+            engine.notifyStateChanged(affected);
+        }
+
+        engine.searchForPlan(current);
+        checkGridResult(engine, current, transitions, goal_test, hash_function);
+    }
+    ASSERT_GT(num_moves, 0);
+    ASSERT_GT(engine.getNumRepairs(), 0);
+}
@@ -0,0 +1,23 @@
+#include <gtest/gtest.h>
+
+#include "engines/best_first_search/explicit_estimation_search_params.h"
+#include "utils/string_utils.h"
+
+/**
+ * Tests that getParameterLog contains the correct values
+ */
+TEST(ExplicitEstimationSearchParamsTests, getParameterLogTest) {
+    ExplicitEstimationSearchParams params;
+    StringMap log = params.getParameterLog();
+    ASSERT_EQ(log.at("weight"), roundAndToString(2.0, 2));
+    ASSERT_EQ(log.at("use_reopened"), boolToString(true));
+    ASSERT_EQ(log.at("use_error_correction"), boolToString(true));
+
+    params.m_weight = 1.5;
+    params.m_use_reopened = false;
+    params.m_use_error_correction = false;
+    log = params.getParameterLog();
+    ASSERT_EQ(log.at("weight"), roundAndToString(1.5, 2));
+    ASSERT_EQ(log.at("use_reopened"), boolToString(false));
+    ASSERT_EQ(log.at("use_error_correction"), boolToString(false));
+}
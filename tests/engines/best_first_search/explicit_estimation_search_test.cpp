@@ -0,0 +1,342 @@
+#include <gtest/gtest.h>
+
+#include "building_tools/evaluators/constant_heuristic.h"
+#include "building_tools/evaluators/cost_and_distance_to_go_evaluator.h"
+#include "building_tools/goal_tests/single_state_goal_test.h"
+#include "building_tools/hashing/permutation_hash_function.h"
+#include "engines/best_first_search/explicit_estimation_search.h"
+#include "environments/graph/csr_graph.h"
+#include "environments/graph/csr_graph_action.h"
+#include "environments/graph/csr_graph_state.h"
+#include "environments/graph/csr_graph_transitions.h"
+#include "environments/graph/csr_vertex_hash_function.h"
+#include "environments/grid_pathfinding/grid_location.h"
+#include "environments/grid_pathfinding/grid_location_hash_function.h"
+#include "environments/grid_pathfinding/grid_map.h"
+#include "environments/grid_pathfinding/grid_pathfinding_action.h"
+#include "environments/grid_pathfinding/grid_pathfinding_lifecost_heuristic.h"
+#include "environments/grid_pathfinding/grid_pathfinding_transitions.h"
+#include "environments/sliding_tile_puzzle/sliding_tile_action.h"
+#include "environments/sliding_tile_puzzle/sliding_tile_manhattan_heuristic.h"
+#include "environments/sliding_tile_puzzle/sliding_tile_state.h"
+#include "environments/sliding_tile_puzzle/sliding_tile_transitions.h"
+#include "environments/sliding_tile_puzzle/sliding_tile_zobrist_hash_function.h"
+#include "logging/search_component_settings.h"
+#include "search_basics/node_container.h"
+#include "test_helpers.h"
+#include "utils/plan_and_path_utils.h"
+#include "utils/string_utils.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+/**
+ * Checks that the engine can only run once the heuristic and hash function are set.
+ */
+TEST(ExplicitEstimationSearchTests, setAndCanRunTest) {
+    SlidingTileState goal_state(2, 3);
+    SingleStateGoalTest<SlidingTileState> goal_test(goal_state);
+    SlidingTileTransitions transitions(2, 3, SlidingTileCostType::unit);
+    SlidingTileManhattanHeuristic heuristic(goal_state, SlidingTileCostType::unit);
+    PermutationHashFunction<SlidingTileState> hash_function;
+
+    ExplicitEstimationSearchParams params;
+    ExplicitEstimationSearch<SlidingTileState, BlankSlide, uint64_t> engine(params);
+    engine.setTransitionSystem(transitions);
+    engine.setGoalTest(goal_test);
+    ASSERT_FALSE(engine.canRunSearch());
+
+    engine.setHeuristic(heuristic);
+    ASSERT_FALSE(engine.canRunSearch());
+
+    engine.setHashFunction(hash_function);
+    ASSERT_TRUE(engine.canRunSearch());
+    ASSERT_EQ(engine.getName(), "ExplicitEstimationSearch");
+}
+
+/**
+ * Checks that the solutions on the 8-puzzle with each cost type are within the suboptimality bound, and optimal with a
+ * weight of 1.
+ */
+TEST(ExplicitEstimationSearchTests, slidingTileBoundTest) {
+    std::mt19937 rand_gen(17);
+    SlidingTileState goal_state(3, 3);
+    SingleStateGoalTest<SlidingTileState> goal_test(goal_state);
+    PermutationHashFunction<SlidingTileState> hash_function;
+
+    for (SlidingTileCostType cost_type :
+              {SlidingTileCostType::unit, SlidingTileCostType::heavy, SlidingTileCostType::inverse}) {
+        SlidingTileTransitions transitions(3, 3, cost_type);
+        SlidingTileManhattanHeuristic heuristic(goal_state, cost_type);
+
+        for (int problem = 0; problem < 5; ++problem) {
+            SlidingTileState init_state = getRandomWalkState(goal_state, transitions, 100, rand_gen);
+            double optimal_cost = getAStarCost(init_state, transitions, goal_test, heuristic, hash_function);
+
+            for (double weight : {1.0, 1.5, 3.0}) {
+                ExplicitEstimationSearchParams params;
+                params.m_weight = weight;
+                ExplicitEstimationSearch<SlidingTileState, BlankSlide, uint64_t> engine(params);
+                engine.setTransitionSystem(transitions);
+                engine.setGoalTest(goal_test);
+                engine.setHeuristic(heuristic);
+                engine.setHashFunction(hash_function);
+
+                ASSERT_EQ(engine.searchForPlan(init_state), EngineStatus::search_completed);
+                ASSERT_TRUE(engine.hasFoundSolution());
+                ASSERT_LE(engine.getLastSolutionPlanCost(), weight * optimal_cost + 1e-9);
+                SequenceCheckResult check = checkSolutionPlan(init_state, engine.getLastSolutionPlan(), transitions,
+                          goal_test);
+                ASSERT_TRUE(check.m_is_valid);
+                ASSERT_NEAR(check.m_sequence_cost, engine.getLastSolutionPlanCost(), 1e-9);
+            }
+        }
+    }
+}
+
+/**
+ * Checks that the solutions on life-cost grids are within the suboptimality bound, with and without error correction.
+ */
+TEST(ExplicitEstimationSearchTests, lifeCostGridBoundTest) {
+    std::mt19937 rand_gen(3);
+    std::bernoulli_distribution is_obstacle(0.2);
+    GridMap map(20, 20);
+    for (int y = 0; y < 20; ++y) {
+        for (int x = 0; x < 20; ++x) {
+            if (is_obstacle(rand_gen)) {
+                map.setLocationType(x, y, GridLocationType::obstacle);
+            }
+        }
+    }
+    GridLocation start(0, 19);
+    GridLocation goal(19, 19);
+    map.setLocationType(start.m_x_coord, start.m_y_coord, GridLocationType::passable);
+    map.setLocationType(goal.m_x_coord, goal.m_y_coord, GridLocationType::passable);
+
+    GridPathfindingTransitions transitions(&map, GridConnectionType::four, GridPathfindingCostType::life);
+    SingleStateGoalTest<GridLocation> goal_test(goal);
+    GridPathfindingLifecostHeuristic heuristic(goal);
+    GridLocationHashFunction hash_function;
+    double optimal_cost = getAStarCost(start, transitions, goal_test, heuristic, hash_function);
+
+    for (bool use_error_correction : {true, false}) {
+        for (double weight : {1.0, 1.2, 2.0, 5.0}) {
+            ExplicitEstimationSearchParams params;
+            params.m_weight = weight;
+            params.m_use_error_correction = use_error_correction;
+            ExplicitEstimationSearch<GridLocation, GridDirection, uint32_t> engine(params);
+            engine.setTransitionSystem(transitions);
+            engine.setGoalTest(goal_test);
+            engine.setHeuristic(heuristic);
+            engine.setHashFunction(hash_function);
+
+            engine.searchForPlan(start);
+            if (optimal_cost < 0.0) {
+                ASSERT_FALSE(engine.hasFoundSolution());
+                continue;
+            }
+            ASSERT_TRUE(engine.hasFoundSolution());
+            ASSERT_LE(engine.getLastSolutionPlanCost(), weight * optimal_cost + 1e-9);
+            ASSERT_TRUE(checkSolutionPlan(start, engine.getLastSolutionPlan(), transitions, goal_test).m_is_valid);
+        }
+    }
+}
+
+/**
+ * Checks the one-step error estimates and the corrected values, and that the orderings stay in sync during search.
+ */
+TEST(ExplicitEstimationSearchTests, errorCorrectionTest) {
+    std::mt19937 rand_gen(5);
+    SlidingTileState goal_state(3, 3);
+    SingleStateGoalTest<SlidingTileState> goal_test(goal_state);
+    SlidingTileTransitions transitions(3, 3, SlidingTileCostType::heavy);
+    SlidingTileManhattanHeuristic heuristic(goal_state, SlidingTileCostType::heavy);
+    PermutationHashFunction<SlidingTileState> hash_function;
+    SlidingTileState init_state = getRandomWalkState(goal_state, transitions, 100, rand_gen);
+
+    ExplicitEstimationSearchParams params;
+    params.m_use_error_correction = false;
+    ExplicitEstimationSearch<SlidingTileState, BlankSlide, uint64_t> engine(params);
+    engine.setTransitionSystem(transitions);
+    engine.setGoalTest(goal_test);
+    engine.setHeuristic(heuristic);
+    engine.setHashFunction(hash_function);
+
+    engine.searchForPlan(init_state);
+    ASSERT_EQ(engine.getHeuristicError(), 0.0);
+    ASSERT_EQ(engine.getDistanceError(), 0.0);
+    const auto& nodes = engine.getNodes();
+    for (NodeID node_id = 0; node_id < nodes.size(); ++node_id) {
+        ASSERT_NEAR(engine.getCorrectedFCost(node_id), nodes.getGValue(node_id) + heuristic.getCachedEval(node_id), 1e-9);
+        ASSERT_EQ(engine.getCorrectedDistance(node_id), heuristic.getCachedDistanceToGoEval(node_id));
+    }
+
+    params.m_use_error_correction = true;
+    engine.setEngineParams(params);
+    engine.initializeSearch(init_state);
+    while (engine.getStatus() == EngineStatus::active) {
+        ASSERT_GE(engine.getFocalListSize(), 1u);
+        ASSERT_LE(engine.getFocalListSize(), engine.getOpenListSize());
+        engine.singleSearchStep();
+    }
+    ASSERT_TRUE(engine.hasFoundSolution());
+    ASSERT_GT(engine.getHeuristicError(), 0.0);
+    ASSERT_GT(engine.getDistanceError(), 0.0);
+    ASSERT_LE(engine.getDistanceError(), engine.MAX_DISTANCE_ERROR);
+    ASSERT_GE(engine.getCorrectedDistance(0), heuristic.getCachedDistanceToGoEval(0));
+}
+
+/**
+ * Checks that the search ends without a solution when the goal cannot be reached.
+ */
+TEST(ExplicitEstimationSearchTests, noSolutionTest) {
+    SlidingTileState goal_state(2, 3);
+    SlidingTileState init_state(std::vector<Tile>{0, 2, 1, 3, 4, 5}, 2, 3);
+    SingleStateGoalTest<SlidingTileState> goal_test(goal_state);
+    SlidingTileTransitions transitions(2, 3, SlidingTileCostType::unit);
+    SlidingTileManhattanHeuristic heuristic(goal_state, SlidingTileCostType::unit);
+    PermutationHashFunction<SlidingTileState> hash_function;
+
+    ExplicitEstimationSearchParams params;
+    ExplicitEstimationSearch<SlidingTileState, BlankSlide, uint64_t> engine(params);
+    engine.setTransitionSystem(transitions);
+    engine.setGoalTest(goal_test);
+    engine.setHeuristic(heuristic);
+    engine.setHashFunction(hash_function);
+
+    ASSERT_EQ(engine.searchForPlan(init_state), EngineStatus::search_completed);
+    ASSERT_FALSE(engine.hasFoundSolution());
+    ASSERT_EQ(engine.getOpenListSize(), 0u);
+    ASSERT_EQ(engine.getNodes().size(), 360u);
+}
+
+/**
+ * Checks that the engine reports its statistics and settings.
+ */
+TEST(ExplicitEstimationSearchTests, statisticsTest) {
+    std::vector<Tile> init_perm{3, 5, 1, 4, 0, 2};
+    SlidingTileState init_state(init_perm, 2, 3);
+    SlidingTileState goal_state(2, 3);
+    SingleStateGoalTest<SlidingTileState> goal_test(goal_state);
+    SlidingTileTransitions transitions(2, 3, SlidingTileCostType::unit);
+    SlidingTileManhattanHeuristic heuristic(goal_state, SlidingTileCostType::unit);
+    PermutationHashFunction<SlidingTileState> hash_function;
+
+    ExplicitEstimationSearchParams params;
+    ExplicitEstimationSearch<SlidingTileState, BlankSlide, uint64_t> engine(params);
+    engine.setTransitionSystem(transitions);
+    engine.setGoalTest(goal_test);
+    engine.setHeuristic(heuristic);
+    engine.setHashFunction(hash_function);
+    engine.searchForPlan(init_state);
+
+    StringMap stats = engine.getEngineSpecificStatistics();
+    int64_t num_expansions = std::stoll(stats.at("num_focal_expansions")) + std::stoll(stats.at("num_f_hat_expansions")) +
+                             std::stoll(stats.at("num_f_expansions"));
+    ASSERT_GT(num_expansions, 0);
+    ASSERT_EQ(stats.count("num_reopenings"), 1u);
+    ASSERT_EQ(stats.count("heuristic_error"), 1u);
+    ASSERT_EQ(stats.count("distance_error"), 1u);
+
+    SearchComponentSettings settings = engine.getAllSettings();
+    ASSERT_EQ(settings.m_main_settings.at("weight"), roundAndToString(2.0, 2));
+    ASSERT_EQ(settings.m_sub_component_settings.count("heuristic"), 1u);
+}
+
+/**
+ * Checks that the search does not depend on the hash function used. A perfect hash function, an incremental Zobrist
+ * hash function, and an 8-bit Zobrist hash function whose values collide often should all give the same nodes, solution
+ * and number of generated states.
+ */
+TEST(ExplicitEstimationSearchTests, hashFunctionTest) {
+    std::mt19937 rand_gen(19);
+    SlidingTileState goal_state(3, 3);
+    SingleStateGoalTest<SlidingTileState> goal_test(goal_state);
+    SlidingTileTransitions transitions(3, 3, SlidingTileCostType::heavy);
+    SlidingTileManhattanHeuristic perm_heuristic(goal_state, SlidingTileCostType::heavy);
+    SlidingTileManhattanHeuristic zobrist_heuristic(goal_state, SlidingTileCostType::heavy);
+    SlidingTileManhattanHeuristic small_heuristic(goal_state, SlidingTileCostType::heavy);
+    PermutationHashFunction<SlidingTileState> perm_hash_function;
+    SlidingTileZobristHashFunction<uint64_t> zobrist_hash_function(3, 3);
+    SlidingTileZobristHashFunction<uint8_t> small_hash_function(3, 3);
+
+    ExplicitEstimationSearchParams params;
+    ExplicitEstimationSearch<SlidingTileState, BlankSlide, uint64_t> perm_engine(params);
+    perm_engine.setTransitionSystem(transitions);
+    perm_engine.setGoalTest(goal_test);
+    perm_engine.setHeuristic(perm_heuristic);
+    perm_engine.setHashFunction(perm_hash_function);
+
+    ExplicitEstimationSearch<SlidingTileState, BlankSlide, uint64_t> zobrist_engine(params);
+    zobrist_engine.setTransitionSystem(transitions);
+    zobrist_engine.setGoalTest(goal_test);
+    zobrist_engine.setHeuristic(zobrist_heuristic);
+    zobrist_engine.setHashFunction(zobrist_hash_function);
+
+    ExplicitEstimationSearch<SlidingTileState, BlankSlide, uint8_t> small_engine(params);
+    small_engine.setTransitionSystem(transitions);
+    small_engine.setGoalTest(goal_test);
+    small_engine.setHeuristic(small_heuristic);
+    small_engine.setHashFunction(small_hash_function);
+
+    for (int problem = 0; problem < 3; ++problem) {
+        SlidingTileState init_state = getRandomWalkState(goal_state, transitions, 100, rand_gen);
+        perm_engine.searchForPlan(init_state);
+        zobrist_engine.searchForPlan(init_state);
+        small_engine.searchForPlan(init_state);
+
+        ASSERT_TRUE(perm_engine.hasFoundSolution());
+        ASSERT_EQ(zobrist_engine.getLastSolutionPlan(), perm_engine.getLastSolutionPlan());
+        ASSERT_EQ(small_engine.getLastSolutionPlan(), perm_engine.getLastSolutionPlan());
+        ASSERT_EQ(zobrist_engine.getNodes().size(), perm_engine.getNodes().size());
+        ASSERT_EQ(small_engine.getNodes().size(), perm_engine.getNodes().size());
+
+        // Each child is generated once, whether or not its hash value is calculated from its parent's
+        int64_t num_generated = perm_engine.getStandardEngineStatistics().m_num_states_generated;
+        ASSERT_EQ(zobrist_engine.getStandardEngineStatistics().m_num_states_generated, num_generated);
+        ASSERT_EQ(small_engine.getStandardEngineStatistics().m_num_states_generated, num_generated);
+        ASSERT_GT(std::stoll(small_engine.getEngineSpecificStatistics().at("num_hash_collisions")), 0);
+    }
+}
+
+/**
+ * A zero heuristic and distance-to-go estimate for graphs, as needed by EES.
+ *
+ * @class ZeroCsrGraphHeuristic
+ */
+class ZeroCsrGraphHeuristic : public ConstantHeuristic<CsrGraphState, CsrGraphAction>,
+                              virtual public CostAndDistanceToGoEvaluator<CsrGraphState, CsrGraphAction> {
+public:
+    double getLastDistanceToGoEval() const override { return 0.0; }
+    double getCachedDistanceToGoEval(NodeID /* node_id */) const override { return 0.0; }
+    void setCachedDistanceToGoEval(NodeID /* node_id */, double /* eval */) override {}
+};
+
+/**
+ * Checks that a child reached twice in the same expansion is only evaluated and added to open once, with the path of
+ * the cheaper parallel arc.
+ */
+TEST(ExplicitEstimationSearchTests, parallelArcTest) {
+    CsrGraph graph(3, {{0, 1, 5}, {0, 1, 3}, {1, 2, 1}});
+    CsrGraphTransitions transitions(graph);
+    SingleStateGoalTest<CsrGraphState> goal_test(CsrGraphState{2});
+    ZeroCsrGraphHeuristic heuristic;
+    CsrVertexHashFunction hash_function;
+
+    ExplicitEstimationSearchParams params;
+    ExplicitEstimationSearch<CsrGraphState, CsrGraphAction, uint32_t> engine(params);
+    engine.setHeuristic(heuristic);
+    engine.setTransitionSystem(transitions);
+    engine.setGoalTest(goal_test);
+    engine.setHashFunction(hash_function);
+
+    CsrGraphState init_state{0};
+    engine.searchForPlan(init_state);
+    ASSERT_TRUE(engine.hasFoundSolution());
+    ASSERT_EQ(engine.getLastSolutionPlanCost(), 4.0);
+    ASSERT_EQ(engine.getNodes().size(), 3u);
+    ASSERT_TRUE(checkSolutionPlan(init_state, engine.getLastSolutionPlan(), transitions, goal_test).m_is_valid);
+}
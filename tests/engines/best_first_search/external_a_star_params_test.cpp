@@ -0,0 +1,25 @@
+#include <gtest/gtest.h>
+
+#include "engines/best_first_search/external_a_star_params.h"
+
+#include <string>
+
+/**
+ * Tests that getParameterLog contains the correct values
+ */
+TEST(ExternalAStarParamsTests, getParameterLogTest) {
+    ExternalAStarParams params;
+    StringMap log = params.getParameterLog();
+
+    ASSERT_EQ(log.at("directory"), "");
+    ASSERT_EQ(log.at("memory_budget_bytes"), std::to_string(params.m_memory_budget_bytes));
+    ASSERT_EQ(log.at("max_merge_fan_in"), std::to_string(params.m_max_merge_fan_in));
+
+    params.m_directory = "/tmp/search";
+    params.m_memory_budget_bytes = 4096;
+    params.m_max_merge_fan_in = 8;
+    log = params.getParameterLog();
+    ASSERT_EQ(log.at("directory"), "/tmp/search");
+    ASSERT_EQ(log.at("memory_budget_bytes"), "4096");
+    ASSERT_EQ(log.at("max_merge_fan_in"), "8");
+}
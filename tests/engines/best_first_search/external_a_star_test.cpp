@@ -0,0 +1,149 @@
+#include <gtest/gtest.h>
+
+#include "building_tools/goal_tests/single_state_goal_test.h"
+#include "building_tools/hashing/permutation_hash_function.h"
+#include "engines/best_first_search/external_a_star.h"
+#include "environments/sliding_tile_puzzle/sliding_tile_action.h"
+#include "environments/sliding_tile_puzzle/sliding_tile_hash_function.h"
+#include "environments/sliding_tile_puzzle/sliding_tile_manhattan_heuristic.h"
+#include "environments/sliding_tile_puzzle/sliding_tile_state.h"
+#include "environments/sliding_tile_puzzle/sliding_tile_transitions.h"
+#include "test_helpers.h"
+#include "utils/plan_and_path_utils.h"
+
+#include <cstddef>
+#include <filesystem>
+#include <random>
+#include <string>
+#include <vector>
+
+/**
+ * Checks that the engine can only run once the heuristic and a perfect, invertible hash function are set. The generic
+ * permutation hash function does not restore the location of the blank, so it cannot be used.
+ */
+TEST(ExternalAStarTests, setAndCanRunTest) {
+    SlidingTileState goal_state(2, 3);
+    SingleStateGoalTest<SlidingTileState> goal_test(goal_state);
+    SlidingTileTransitions transitions(2, 3);
+    SlidingTileManhattanHeuristic heuristic(goal_state, SlidingTileCostType::unit);
+    SlidingTileHashFunction hash_function;
+    PermutationHashFunction<SlidingTileState> permutation_hash_function;
+
+    ExternalAStarParams params;
+    ExternalAStar<SlidingTileState, BlankSlide> engine(params);
+    engine.setTransitionSystem(transitions);
+    engine.setGoalTest(goal_test);
+    ASSERT_FALSE(engine.canRunSearch());
+
+    engine.setHeuristic(heuristic);
+    ASSERT_FALSE(engine.canRunSearch());
+
+    engine.setHashFunction(permutation_hash_function);
+    ASSERT_FALSE(engine.canRunSearch());
+
+    engine.setHashFunction(hash_function);
+    ASSERT_TRUE(engine.canRunSearch());
+    ASSERT_EQ(engine.getStatus(), EngineStatus::ready);
+}
+
+/**
+ * Checks that the search stops with an empty plan when the initial state is the goal, and that its files are removed
+ * when the engine is reset.
+ */
+TEST(ExternalAStarTests, initialGoalTest) {
+    SlidingTileState goal_state(3, 3);
+    SingleStateGoalTest<SlidingTileState> goal_test(goal_state);
+    SlidingTileTransitions transitions(3, 3);
+    SlidingTileManhattanHeuristic heuristic(goal_state, SlidingTileCostType::unit);
+    SlidingTileHashFunction hash_function;
+
+    ExternalAStarParams params;
+    ExternalAStar<SlidingTileState, BlankSlide> engine(params);
+    engine.setHeuristic(heuristic);
+    engine.setTransitionSystem(transitions);
+    engine.setGoalTest(goal_test);
+    engine.setHashFunction(hash_function);
+    engine.searchForPlan(goal_state);
+
+    ASSERT_TRUE(engine.hasFoundSolution());
+    ASSERT_EQ(engine.getLastSolutionPlanCost(), 0.0);
+    ASSERT_TRUE(engine.getLastSolutionPlan().empty());
+
+    std::filesystem::path search_directory = engine.getSearchDirectory();
+    ASSERT_TRUE(std::filesystem::exists(search_directory));
+    engine.reset();
+    ASSERT_FALSE(std::filesystem::exists(search_directory));
+}
+
+/**
+ * Checks that external A* finds optimal solutions on the 8-puzzle for each cost type, with both a large memory budget
+ * and one small enough that bucket files must be sorted in several runs.
+ */
+TEST(ExternalAStarTests, slidingTileTest) {
+    std::mt19937 rand_gen(5);
+    SlidingTileState goal_state(3, 3);
+    SingleStateGoalTest<SlidingTileState> goal_test(goal_state);
+    SlidingTileHashFunction hash_function;
+
+    for (SlidingTileCostType cost_type : {SlidingTileCostType::unit, SlidingTileCostType::heavy, SlidingTileCostType::inverse}) {
+        SlidingTileTransitions transitions(3, 3, cost_type);
+
+        for (std::size_t memory_budget : {std::size_t{1} << 20, std::size_t{256}}) {
+            for (int trial = 0; trial < 3; ++trial) {
+                SlidingTileState init_state = getRandomWalkState(goal_state, transitions, 30, rand_gen);
+                SlidingTileManhattanHeuristic a_star_heuristic(goal_state, cost_type);
+                double a_star_cost = getAStarCost(init_state, transitions, goal_test, a_star_heuristic, hash_function);
+
+                SlidingTileManhattanHeuristic heuristic(goal_state, cost_type);
+                ExternalAStarParams params;
+                params.m_memory_budget_bytes = memory_budget;
+                ExternalAStar<SlidingTileState, BlankSlide> engine(params);
+                engine.setHeuristic(heuristic);
+                engine.setTransitionSystem(transitions);
+                engine.setGoalTest(goal_test);
+                engine.setHashFunction(hash_function);
+                engine.searchForPlan(init_state);
+
+                ASSERT_TRUE(engine.hasFoundSolution());
+                ASSERT_NEAR(engine.getLastSolutionPlanCost(), a_star_cost, 1e-9);
+                ASSERT_TRUE(checkSolutionPlan(init_state, engine.getLastSolutionPlan(), transitions, goal_test).m_is_valid);
+
+                const ExternalIOStatistics& io_stats = engine.getIOStatistics();
+                ASSERT_GT(io_stats.m_bytes_written, 0u);
+                ASSERT_GT(io_stats.m_bytes_read, 0u);
+                ASSERT_GT(io_stats.m_num_sort_passes, 0u);
+
+                StringMap stats = engine.getEngineSpecificStatistics();
+                ASSERT_EQ(stats.at("bytes_written"), std::to_string(io_stats.m_bytes_written));
+            }
+        }
+    }
+}
+
+/**
+ * Checks that the search ends without a solution when the goal cannot be reached.
+ */
+TEST(ExternalAStarTests, noSolutionTest) {
+    SlidingTileState goal_state(2, 3);
+    SingleStateGoalTest<SlidingTileState> goal_test(goal_state);
+    SlidingTileTransitions transitions(2, 3);
+    SlidingTileManhattanHeuristic heuristic(goal_state, SlidingTileCostType::unit);
+    SlidingTileHashFunction hash_function;
+
+    // Swapping two tiles changes the parity of the permutation, so the goal cannot be reached
+    SlidingTileState init_state(std::vector<Tile>{0, 2, 1, 3, 4, 5}, 2, 3);
+
+    ExternalAStarParams params;
+    params.m_memory_budget_bytes = 1024;
+    ExternalAStar<SlidingTileState, BlankSlide> engine(params);
+    engine.setHeuristic(heuristic);
+    engine.setTransitionSystem(transitions);
+    engine.setGoalTest(goal_test);
+    engine.setHashFunction(hash_function);
+    engine.searchForPlan(init_state);
+
+    ASSERT_FALSE(engine.hasFoundSolution());
+    ASSERT_EQ(engine.getStatus(), EngineStatus::search_completed);
+    StringMap stats = engine.getEngineSpecificStatistics();
+    ASSERT_EQ(stats.at("num_expansions"), "360");
+}
@@ -0,0 +1,18 @@
+#include <gtest/gtest.h>
+
+#include "engines/best_first_search/mm_search_params.h"
+#include "utils/string_utils.h"
+
+/**
+ * Tests that getParameterLog contains the correct values
+ */
+TEST(MMSearchParamsTests, getParameterLogTest) {
+    MMSearchParams params;
+    StringMap log = params.getParameterLog();
+
+    ASSERT_EQ(log.at("min_action_cost"), roundAndToString(params.m_min_action_cost, 2));
+
+    params.m_min_action_cost = 1.5;
+    log = params.getParameterLog();
+    ASSERT_EQ(log.at("min_action_cost"), roundAndToString(1.5, 2));
+}
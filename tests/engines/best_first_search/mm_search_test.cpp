@@ -0,0 +1,318 @@
+#include <gtest/gtest.h>
+
+#include "building_tools/evaluators/constant_heuristic.h"
+#include "building_tools/goal_tests/multi_state_hash_based_goal_test.h"
+#include "building_tools/goal_tests/single_state_goal_test.h"
+#include "building_tools/hashing/permutation_hash_function.h"
+#include "building_tools/hashing/serialized_state_hash_function.h"
+#include "engines/best_first_search/best_first_search.h"
+#include "engines/best_first_search/mm_search.h"
+#include "engines/engine_components/eval_functions/f_cost_evaluator.h"
+#include "environments/graph/csr_graph.h"
+#include "environments/graph/csr_graph_action.h"
+#include "environments/graph/csr_graph_state.h"
+#include "environments/graph/csr_graph_transitions.h"
+#include "environments/graph/csr_vertex_hash_function.h"
+#include "environments/grid_pathfinding/grid_location.h"
+#include "environments/grid_pathfinding/grid_location_hash_function.h"
+#include "environments/grid_pathfinding/grid_map.h"
+#include "environments/grid_pathfinding/grid_pathfinding_action.h"
+#include "environments/grid_pathfinding/grid_pathfinding_octile_heuristic.h"
+#include "environments/grid_pathfinding/grid_pathfinding_transitions.h"
+#include "environments/pancake_puzzle/gap_heuristic.h"
+#include "environments/pancake_puzzle/pancake_action.h"
+#include "environments/pancake_puzzle/pancake_state.h"
+#include "environments/pancake_puzzle/pancake_transitions.h"
+#include "environments/sliding_tile_puzzle/sliding_tile_action.h"
+#include "environments/sliding_tile_puzzle/sliding_tile_manhattan_heuristic.h"
+#include "environments/sliding_tile_puzzle/sliding_tile_state.h"
+#include "environments/sliding_tile_puzzle/sliding_tile_transitions.h"
+#include "experiment_running/experiment_results.h"
+#include "experiment_running/experiment_runner.h"
+#include "experiment_running/search_resource_limits.h"
+#include "test_helpers.h"
+#include "utils/plan_and_path_utils.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+/**
+ * Checks that the engine can only run once both heuristics and the hash function are set, and the goal test has a
+ * single goal state.
+ */
+TEST(MMSearchTests, setAndCanRunTest) {
+    SlidingTileState goal_state(2, 3);
+    SingleStateGoalTest<SlidingTileState> goal_test(goal_state);
+    SlidingTileTransitions transitions(2, 3);
+    SlidingTileManhattanHeuristic forward_heuristic(goal_state, SlidingTileCostType::unit);
+    SlidingTileManhattanHeuristic backward_heuristic(goal_state, SlidingTileCostType::unit);
+    PermutationHashFunction<SlidingTileState> hash_function;
+    SerializedStateHashFunction<SlidingTileState> non_perfect_hash_function;
+
+    MMSearchParams params;
+    MMSearch<SlidingTileState, BlankSlide, uint64_t> engine(params);
+    ASSERT_FALSE(engine.canRunSearch());
+
+    engine.setForwardHeuristic(forward_heuristic);
+    engine.setTransitionSystem(transitions);
+    engine.setHashFunction(hash_function);
+    engine.setGoalTest(goal_test);
+    ASSERT_FALSE(engine.canRunSearch());
+
+    engine.setBackwardHeuristic(backward_heuristic);
+    ASSERT_TRUE(engine.canRunSearch());
+    ASSERT_EQ(engine.getStatus(), EngineStatus::ready);
+
+    engine.setHashFunction(non_perfect_hash_function);
+    ASSERT_FALSE(engine.canRunSearch());
+    engine.setHashFunction(hash_function);
+
+    HashBasedMultiGoalTest<SlidingTileState, uint64_t> multi_goal_test(hash_function, {goal_state});
+    engine.setGoalTest(multi_goal_test);
+    ASSERT_FALSE(engine.canRunSearch());
+}
+
+/**
+ * Checks that the backward heuristic is set to estimate the cost from the initial state, and that the search stops
+ * immediately with an empty plan when the initial state is the goal.
+ */
+TEST(MMSearchTests, initializationTest) {
+    SlidingTileState init_state(std::vector<Tile>{1, 0, 2, 3, 4, 5}, 2, 3);
+    SlidingTileState goal_state(2, 3);
+    SingleStateGoalTest<SlidingTileState> goal_test(goal_state);
+    SlidingTileTransitions transitions(2, 3);
+    SlidingTileManhattanHeuristic forward_heuristic(init_state, SlidingTileCostType::unit);
+    SlidingTileManhattanHeuristic backward_heuristic(goal_state, SlidingTileCostType::unit);
+    PermutationHashFunction<SlidingTileState> hash_function;
+
+    MMSearchParams params;
+    MMSearch<SlidingTileState, BlankSlide, uint64_t> engine(params);
+    engine.setForwardHeuristic(forward_heuristic);
+    engine.setBackwardHeuristic(backward_heuristic);
+    engine.setTransitionSystem(transitions);
+    engine.setGoalTest(goal_test);
+    engine.setHashFunction(hash_function);
+
+    engine.initializeSearch(init_state);
+    ASSERT_EQ(forward_heuristic.getGoalState(), goal_state);
+    ASSERT_EQ(backward_heuristic.getGoalState(), init_state);
+    ASSERT_EQ(engine.getLowerBound(), 1.0);
+
+    engine.searchForPlan(goal_state);
+    ASSERT_TRUE(engine.hasFoundSolution());
+    ASSERT_EQ(engine.getLastSolutionPlanCost(), 0.0);
+    ASSERT_TRUE(engine.getLastSolutionPlan().empty());
+}
+
+/**
+ * Checks that MM finds optimal solutions on the 8-puzzle for each cost type, using the inverse of the forward
+ * transitions as the backward transitions.
+ */
+TEST(MMSearchTests, slidingTileTest) {
+    std::mt19937 rand_gen(7);
+    SlidingTileState goal_state(3, 3);
+    SingleStateGoalTest<SlidingTileState> goal_test(goal_state);
+    PermutationHashFunction<SlidingTileState> hash_function;
+    int64_t num_forward_expansions = 0;
+    int64_t num_backward_expansions = 0;
+
+    for (SlidingTileCostType cost_type : {SlidingTileCostType::unit, SlidingTileCostType::heavy, SlidingTileCostType::inverse}) {
+        SlidingTileTransitions transitions(3, 3, cost_type);
+
+        for (int trial = 0; trial < 5; ++trial) {
+            SlidingTileState init_state = getRandomWalkState(goal_state, transitions, 40, rand_gen);
+            SlidingTileManhattanHeuristic a_star_heuristic(goal_state, cost_type);
+            double a_star_cost = getAStarCost(init_state, transitions, goal_test, a_star_heuristic, hash_function);
+
+            SlidingTileManhattanHeuristic forward_heuristic(goal_state, cost_type);
+            SlidingTileManhattanHeuristic backward_heuristic(goal_state, cost_type);
+            MMSearchParams params;
+            params.m_min_action_cost = cost_type == SlidingTileCostType::inverse ? 1.0 / 8.0 : 1.0;
+            MMSearch<SlidingTileState, BlankSlide, uint64_t> engine(params);
+            engine.setForwardHeuristic(forward_heuristic);
+            engine.setBackwardHeuristic(backward_heuristic);
+            engine.setTransitionSystem(transitions);
+            engine.setGoalTest(goal_test);
+            engine.setHashFunction(hash_function);
+            engine.searchForPlan(init_state);
+
+            ASSERT_TRUE(engine.hasFoundSolution());
+            ASSERT_NEAR(engine.getLastSolutionPlanCost(), a_star_cost, 1e-9);
+            ASSERT_TRUE(checkSolutionPlan(init_state, engine.getLastSolutionPlan(), transitions, goal_test).m_is_valid);
+            num_forward_expansions += engine.getNumForwardExpansions();
+            num_backward_expansions += engine.getNumBackwardExpansions();
+        }
+    }
+    ASSERT_GT(num_forward_expansions, 0);
+    ASSERT_GT(num_backward_expansions, 0);
+}
+
+/**
+ * Checks that MM finds optimal solutions on a grid map with obstacles, and reports no solution when the goal cannot
+ * be reached.
+ */
+TEST(MMSearchTests, gridPathfindingTest) {
+    std::mt19937 rand_gen(11);
+    const int map_size = 24;
+    std::bernoulli_distribution is_obstacle(0.25);
+    std::ostringstream map_text;
+    map_text << "height " + std::to_string(map_size) + "\nwidth " + std::to_string(map_size) + "\nmap\n";
+    for (int y = 0; y < map_size; ++y) {
+        for (int x = 0; x < map_size; ++x) {
+            map_text << (is_obstacle(rand_gen) ? '@' : '.');
+        }
+        map_text << "\n";
+    }
+    std::istringstream map_stream(map_text.str());
+    GridMap map(map_stream);
+    GridPathfindingTransitions transitions(&map, GridConnectionType::eight);
+    GridLocationHashFunction hash_function;
+
+    std::vector<GridLocation> open_cells = getOpenLocations(map);
+    std::uniform_int_distribution<std::size_t> cell_dist(0, open_cells.size() - 1);
+
+    int num_solved = 0;
+    for (int trial = 0; trial < 20; ++trial) {
+        GridLocation start = open_cells[cell_dist(rand_gen)];
+        GridLocation goal = open_cells[cell_dist(rand_gen)];
+        SingleStateGoalTest<GridLocation> goal_test(goal);
+        GridPathfindingOctileHeuristic a_star_heuristic(goal);
+        double a_star_cost = getAStarCost(start, transitions, goal_test, a_star_heuristic, hash_function);
+
+        GridPathfindingOctileHeuristic forward_heuristic(goal);
+        GridPathfindingOctileHeuristic backward_heuristic(goal);
+        MMSearchParams params;
+        params.m_min_action_cost = 1.0;
+        MMSearch<GridLocation, GridDirection, uint32_t> engine(params);
+        engine.setForwardHeuristic(forward_heuristic);
+        engine.setBackwardHeuristic(backward_heuristic);
+        engine.setTransitionSystem(transitions);
+        engine.setGoalTest(goal_test);
+        engine.setHashFunction(hash_function);
+        engine.searchForPlan(start);
+
+        if (a_star_cost < 0.0) {
+            ASSERT_FALSE(engine.hasFoundSolution());
+            continue;
+        }
+        num_solved++;
+        ASSERT_TRUE(engine.hasFoundSolution());
+        ASSERT_NEAR(engine.getLastSolutionPlanCost(), a_star_cost, 1e-9);
+        ASSERT_TRUE(checkSolutionPlan(start, engine.getLastSolutionPlan(), transitions, goal_test).m_is_valid);
+    }
+    ASSERT_GT(num_solved, 0);
+}
+
+/**
+ * Checks that a given backward transition system is used, with a heuristic that is not specific to a goal state in
+ * the backward direction.
+ */
+TEST(MMSearchTests, backwardTransitionSystemTest) {
+    const int num_pancakes = 8;
+    std::mt19937 rand_gen(5);
+    // Each flip is its own inverse, so the forward transitions also generate the predecessors of a state
+    PancakeTransitions transitions(num_pancakes);
+    std::vector<Pancake> goal_perm(num_pancakes);
+    std::iota(goal_perm.begin(), goal_perm.end(), 0);
+    SingleStateGoalTest<PancakeState> goal_test(PancakeState{goal_perm});
+    PermutationHashFunction<PancakeState> hash_function;
+
+    for (int trial = 0; trial < 5; ++trial) {
+        std::vector<Pancake> perm = goal_perm;
+        std::shuffle(perm.begin(), perm.end(), rand_gen);
+        PancakeState init_state(perm);
+        GapHeuristic a_star_heuristic;
+        double a_star_cost = getAStarCost(init_state, transitions, goal_test, a_star_heuristic, hash_function);
+
+        GapHeuristic forward_heuristic;
+        ConstantHeuristic<PancakeState, NumToFlip> backward_heuristic;
+        MMSearchParams params;
+        params.m_min_action_cost = 1.0;
+        MMSearch<PancakeState, NumToFlip, uint64_t> engine(params);
+        engine.setForwardHeuristic(forward_heuristic);
+        engine.setBackwardHeuristic(backward_heuristic);
+        engine.setBackwardTransitionSystem(transitions);
+        engine.setTransitionSystem(transitions);
+        engine.setGoalTest(goal_test);
+        engine.setHashFunction(hash_function);
+        engine.searchForPlan(init_state);
+
+        ASSERT_TRUE(engine.hasFoundSolution());
+        ASSERT_EQ(engine.getLastSolutionPlanCost(), a_star_cost);
+        ASSERT_TRUE(checkSolutionPlan(init_state, engine.getLastSolutionPlan(), transitions, goal_test).m_is_valid);
+    }
+}
+
+/**
+ * Checks that MM can be run on a suite of start and goal pairs, with each heuristic retargeted for every experiment.
+ */
+TEST(MMSearchTests, runExperimentsTest) {
+    std::vector<SlidingTileState> starts = {SlidingTileState({1, 4, 2, 3, 0, 5}, 2, 3), SlidingTileState({1, 2, 3, 5, 4, 0}, 2, 3)};
+    std::vector<SlidingTileState> goals = {SlidingTileState({0, 1, 2, 3, 4, 5}, 2, 3), SlidingTileState({1, 2, 5, 3, 4, 0}, 2, 3)};
+    SlidingTileTransitions transitions(2, 3);
+    SlidingTileManhattanHeuristic forward_heuristic(goals[0], SlidingTileCostType::unit);
+    SlidingTileManhattanHeuristic backward_heuristic(goals[0], SlidingTileCostType::unit);
+    PermutationHashFunction<SlidingTileState> hash_function;
+    SearchResourceLimits limits;
+
+    MMSearchParams params;
+    MMSearch<SlidingTileState, BlankSlide, uint64_t> engine(params);
+    engine.setForwardHeuristic(forward_heuristic);
+    engine.setBackwardHeuristic(backward_heuristic);
+    engine.setHashFunction(hash_function);
+
+    std::vector<ExperimentResults<BlankSlide>> results = runExperiments(engine, transitions, limits, starts, goals);
+    ASSERT_EQ(results.size(), 2u);
+    ASSERT_EQ(forward_heuristic.getGoalState(), goals[1]);
+    ASSERT_EQ(backward_heuristic.getGoalState(), starts[1]);
+
+    for (std::size_t i = 0; i < results.size(); ++i) {
+        SingleStateGoalTest<SlidingTileState> goal_test(goals[i]);
+        SlidingTileManhattanHeuristic a_star_heuristic(goals[i], SlidingTileCostType::unit);
+        double a_star_cost = getAStarCost(starts[i], transitions, goal_test, a_star_heuristic, hash_function);
+
+        // The second start state and goal state are in different halves of the state space
+        if (a_star_cost < 0.0) {
+            ASSERT_FALSE(results[i].m_has_found_plan);
+            continue;
+        }
+        ASSERT_TRUE(results[i].m_has_found_plan);
+        ASSERT_EQ(results[i].m_plan_cost, a_star_cost);
+        ASSERT_TRUE(checkSolutionPlan(starts[i], results[i].m_plan, transitions, goal_test).m_is_valid);
+    }
+}
+
+/**
+ * Checks that a child reached twice in the same expansion is only evaluated and added to open once, with the path of
+ * the cheaper parallel arc, in both search directions.
+ */
+TEST(MMSearchTests, parallelArcTest) {
+    // Every arc has a reverse arc of the same cost, so the forward transitions also generate the predecessors of a state
+    CsrGraph graph(3, {{0, 1, 5}, {1, 0, 5}, {0, 1, 3}, {1, 0, 3}, {1, 2, 1}, {2, 1, 1}});
+    CsrGraphTransitions transitions(graph);
+    SingleStateGoalTest<CsrGraphState> goal_test(CsrGraphState{2});
+    ConstantHeuristic<CsrGraphState, CsrGraphAction> forward_heuristic;
+    ConstantHeuristic<CsrGraphState, CsrGraphAction> backward_heuristic;
+    CsrVertexHashFunction hash_function;
+
+    MMSearchParams params;
+    params.m_min_action_cost = 1.0;
+    MMSearch<CsrGraphState, CsrGraphAction, uint32_t> engine(params);
+    engine.setForwardHeuristic(forward_heuristic);
+    engine.setBackwardHeuristic(backward_heuristic);
+    engine.setBackwardTransitionSystem(transitions);
+    engine.setTransitionSystem(transitions);
+    engine.setGoalTest(goal_test);
+    engine.setHashFunction(hash_function);
+
+    CsrGraphState init_state{0};
+    engine.searchForPlan(init_state);
+    ASSERT_TRUE(engine.hasFoundSolution());
+    ASSERT_EQ(engine.getLastSolutionPlanCost(), 4.0);
+    ASSERT_TRUE(checkSolutionPlan(init_state, engine.getLastSolutionPlan(), transitions, goal_test).m_is_valid);
+}
@@ -0,0 +1,203 @@
+#include <gtest/gtest.h>
+
+#include "building_tools/evaluators/constant_heuristic.h"
+#include "building_tools/goal_tests/single_state_goal_test.h"
+#include "building_tools/hashing/permutation_hash_function.h"
+#include "building_tools/hashing/serialized_state_hash_function.h"
+#include "engines/best_first_search/partial_expansion_a_star.h"
+#include "environments/graph/csr_graph.h"
+#include "environments/graph/csr_graph_action.h"
+#include "environments/graph/csr_graph_state.h"
+#include "environments/graph/csr_graph_transitions.h"
+#include "environments/graph/csr_vertex_hash_function.h"
+#include "environments/pancake_puzzle/gap_heuristic.h"
+#include "environments/pancake_puzzle/gap_operator_selection_function.h"
+#include "environments/pancake_puzzle/pancake_action.h"
+#include "environments/pancake_puzzle/pancake_state.h"
+#include "environments/pancake_puzzle/pancake_transitions.h"
+#include "environments/sliding_tile_puzzle/sliding_tile_action.h"
+#include "environments/sliding_tile_puzzle/sliding_tile_manhattan_heuristic.h"
+#include "environments/sliding_tile_puzzle/sliding_tile_manhattan_operator_selection_function.h"
+#include "environments/sliding_tile_puzzle/sliding_tile_state.h"
+#include "environments/sliding_tile_puzzle/sliding_tile_transitions.h"
+#include "test_helpers.h"
+#include "utils/plan_and_path_utils.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+/**
+ * Checks that the engine can only run once all necessary parts have been set, and that the operator selection
+ * function is optional.
+ */
+TEST(PartialExpansionAStarTests, setAndCanRunTest) {
+    SlidingTileState goal_state(2, 3);
+    SingleStateGoalTest<SlidingTileState> goal_test(goal_state);
+    SlidingTileTransitions transitions(2, 3);
+    SlidingTileManhattanHeuristic heuristic(goal_state, SlidingTileCostType::unit);
+    PermutationHashFunction<SlidingTileState> hash_function;
+    SerializedStateHashFunction<SlidingTileState> non_perfect_hash_function;
+
+    PartialExpansionAStarParams params;
+    PartialExpansionAStar<SlidingTileState, BlankSlide, uint64_t> engine(params);
+    ASSERT_FALSE(engine.canRunSearch());
+
+    engine.setHeuristic(heuristic);
+    engine.setTransitionSystem(transitions);
+    engine.setGoalTest(goal_test);
+    ASSERT_FALSE(engine.canRunSearch());
+
+    engine.setHashFunction(non_perfect_hash_function);
+    ASSERT_FALSE(engine.canRunSearch());
+
+    engine.setHashFunction(hash_function);
+    ASSERT_TRUE(engine.canRunSearch());
+    ASSERT_EQ(engine.getStatus(), EngineStatus::ready);
+}
+
+/**
+ * Checks that the stored f-cost of the initial node is raised after its first partial expansion, and that only the
+ * children with the f-cost of the initial node are generated.
+ */
+TEST(PartialExpansionAStarTests, partialExpansionStepTest) {
+    SlidingTileState init_state(std::vector<Tile>{1, 0, 2, 3, 4, 5}, 2, 3);
+    SlidingTileState goal_state(2, 3);
+    SingleStateGoalTest<SlidingTileState> goal_test(goal_state);
+    SlidingTileTransitions transitions(2, 3);
+    SlidingTileManhattanHeuristic heuristic(goal_state, SlidingTileCostType::unit);
+    SlidingTileManhattanOperatorSelectionFunction op_selection(goal_state, SlidingTileCostType::unit);
+    PermutationHashFunction<SlidingTileState> hash_function;
+
+    PartialExpansionAStarParams params;
+    PartialExpansionAStar<SlidingTileState, BlankSlide, uint64_t> engine(params);
+    engine.setHeuristic(heuristic);
+    engine.setOperatorSelectionFunction(op_selection);
+    engine.setTransitionSystem(transitions);
+    engine.setGoalTest(goal_test);
+    engine.setHashFunction(hash_function);
+
+    engine.initializeSearch(init_state);
+    ASSERT_EQ(engine.getStoredFCost(0), 1.0);
+
+    // Moving the blank left solves the puzzle. The other two moves increase the f-cost by 2
+    engine.singleSearchStep();
+    ASSERT_EQ(engine.getNodes().size(), 2u);
+    ASSERT_EQ(engine.getNodes().getLastAction(1), BlankSlide::left);
+    ASSERT_EQ(engine.getStoredFCost(0), 3.0);
+    ASSERT_TRUE(engine.getOpenList().isNodeInOpen(0));
+    ASSERT_EQ(engine.getEngineSpecificStatistics().at("num_partial_expansions"), "1");
+}
+
+/**
+ * Checks that EPEA* and PEA* find optimal solutions on pancake puzzles while storing fewer nodes than A*.
+ */
+TEST(PartialExpansionAStarTests, pancakeTest) {
+    const int num_pancakes = 10;
+    std::mt19937 rand_gen(13);
+    PancakeTransitions transitions(num_pancakes);
+    std::vector<Pancake> goal_perm(num_pancakes);
+    std::iota(goal_perm.begin(), goal_perm.end(), 0);
+    SingleStateGoalTest<PancakeState> goal_test(PancakeState{goal_perm});
+    PermutationHashFunction<PancakeState> hash_function;
+    GapOperatorSelectionFunction op_selection;
+
+    for (int trial = 0; trial < 5; ++trial) {
+        std::vector<Pancake> perm(num_pancakes);
+        std::iota(perm.begin(), perm.end(), 0);
+        std::shuffle(perm.begin(), perm.end(), rand_gen);
+        PancakeState init_state(perm);
+
+        GapHeuristic a_star_heuristic;
+        AStarResult a_star_result = runAStar(init_state, transitions, goal_test, a_star_heuristic, hash_function);
+
+        for (bool use_op_selection : {true, false}) {
+            GapHeuristic heuristic;
+            PartialExpansionAStarParams params;
+            PartialExpansionAStar<PancakeState, NumToFlip, uint64_t> engine(params);
+            engine.setHeuristic(heuristic);
+            if (use_op_selection) {
+                engine.setOperatorSelectionFunction(op_selection);
+            }
+            engine.setTransitionSystem(transitions);
+            engine.setGoalTest(goal_test);
+            engine.setHashFunction(hash_function);
+            engine.searchForPlan(init_state);
+
+            ASSERT_TRUE(engine.hasFoundSolution());
+            ASSERT_DOUBLE_EQ(engine.getLastSolutionPlanCost(), a_star_result.m_cost);
+            ASSERT_TRUE(checkSolutionPlan(init_state, engine.getLastSolutionPlan(), transitions, goal_test).m_is_valid);
+            ASSERT_LT(engine.getNodes().size(), a_star_result.m_num_nodes);
+
+            StringMap stats = engine.getEngineSpecificStatistics();
+            ASSERT_GT(std::stoll(stats.at("num_partial_expansions")), 0);
+            if (use_op_selection) {
+                ASSERT_EQ(stats.at("num_discarded_children"), "0");
+            } else {
+                ASSERT_GT(std::stoll(stats.at("num_discarded_children")), 0);
+            }
+        }
+    }
+}
+
+/**
+ * Checks that EPEA* finds optimal solutions on the 8-puzzle.
+ */
+TEST(PartialExpansionAStarTests, slidingTileTest) {
+    SlidingTileState goal_state(3, 3);
+    SingleStateGoalTest<SlidingTileState> goal_test(goal_state);
+    SlidingTileTransitions transitions(3, 3);
+    SlidingTileManhattanOperatorSelectionFunction op_selection(goal_state, SlidingTileCostType::unit);
+    PermutationHashFunction<SlidingTileState> hash_function;
+
+    // The optimal solution costs of these instances are known
+    std::vector<std::pair<std::vector<Tile>, double>> instances = {
+              {{7, 2, 4, 5, 0, 6, 8, 3, 1}, 26.0}, {{1, 2, 0, 3, 4, 5, 6, 7, 8}, 2.0}, {{3, 1, 2, 6, 4, 5, 0, 7, 8}, 2.0}};
+
+    for (const auto& [perm, optimal_cost] : instances) {
+        SlidingTileState init_state(perm, 3, 3);
+        SlidingTileManhattanHeuristic heuristic(goal_state, SlidingTileCostType::unit);
+
+        PartialExpansionAStarParams params;
+        PartialExpansionAStar<SlidingTileState, BlankSlide, uint64_t> engine(params);
+        engine.setHeuristic(heuristic);
+        engine.setOperatorSelectionFunction(op_selection);
+        engine.setTransitionSystem(transitions);
+        engine.setGoalTest(goal_test);
+        engine.setHashFunction(hash_function);
+        engine.searchForPlan(init_state);
+
+        ASSERT_TRUE(engine.hasFoundSolution());
+        ASSERT_EQ(engine.getLastSolutionPlanCost(), optimal_cost);
+        ASSERT_TRUE(checkSolutionPlan(init_state, engine.getLastSolutionPlan(), transitions, goal_test).m_is_valid);
+    }
+}
+
+/**
+ * Checks that a child reached twice in the same expansion is only evaluated and added to open once, with the path of
+ * the cheaper parallel arc.
+ */
+TEST(PartialExpansionAStarTests, parallelArcTest) {
+    CsrGraph graph(3, {{0, 1, 5}, {0, 1, 3}, {1, 2, 1}});
+    CsrGraphTransitions transitions(graph);
+    SingleStateGoalTest<CsrGraphState> goal_test(CsrGraphState{2});
+    ConstantHeuristic<CsrGraphState, CsrGraphAction> heuristic;
+    CsrVertexHashFunction hash_function;
+
+    PartialExpansionAStarParams params;
+    PartialExpansionAStar<CsrGraphState, CsrGraphAction, uint32_t> engine(params);
+    engine.setHeuristic(heuristic);
+    engine.setTransitionSystem(transitions);
+    engine.setGoalTest(goal_test);
+    engine.setHashFunction(hash_function);
+
+    CsrGraphState init_state{0};
+    engine.searchForPlan(init_state);
+    ASSERT_TRUE(engine.hasFoundSolution());
+    ASSERT_EQ(engine.getLastSolutionPlanCost(), 4.0);
+    ASSERT_EQ(engine.getNodes().size(), 3u);
+    ASSERT_TRUE(checkSolutionPlan(init_state, engine.getLastSolutionPlan(), transitions, goal_test).m_is_valid);
+}
@@ -7,6 +7,7 @@
 #include "environments/grid_pathfinding/grid_pathfinding_action.h"
 #include "environments/grid_pathfinding/grid_pathfinding_manhattan_heuristic.h"
 #include "test_helpers.h"
+#include "utils/floating_point_utils.h"
 
 class FCostEvaluatorTests : public ::testing::Test {
 protected:
@@ -62,6 +63,34 @@ TEST_F(FCostEvaluatorTests, reEvaluateTest) {
     ASSERT_TRUE(checkNodeEvaluation(evaluator, node1_id, 56.0, false, true));
 }
 
+/**
+ * Tests that evaluating a batch of nodes caches the same values as evaluating them one at a time, including when the
+ * heuristic has already processed the batch.
+ */
+TEST_F(FCostEvaluatorTests, evaluateBatchTest) {
+    FCostEvaluator<GridLocation, GridDirection> evaluator(manhattan);
+    evaluator.setNodeContainer(nodes);
+
+    NodeID node1_id = nodes.addNode(GridLocation(50, 50), 1, 0.0, GridDirection::east, 1);
+    NodeID node2_id = nodes.addNode(GridLocation(145, 123), 2, 52.7, GridDirection::north, 1);
+    NodeID node3_id = nodes.addNode(GridLocation(100, 98), 2, 3.0, GridDirection::south, 1);
+
+    evaluator.prepareToEvaluate();
+    evaluator.evaluateBatch({node1_id, node2_id});
+    ASSERT_EQ(evaluator.getIDofLastEvaluatedNode(), node2_id);
+    ASSERT_TRUE(fpEqual(evaluator.getCachedEval(node1_id), 100.0));
+    ASSERT_TRUE(fpEqual(evaluator.getCachedEval(node2_id), 120.7));
+    ASSERT_TRUE(fpEqual(manhattan.getCachedEval(node2_id), 68.0));
+
+    // Heuristic evaluated first, as done by the search engines
+    manhattan.prepareToEvaluate();
+    evaluator.prepareToEvaluate();
+    manhattan.evaluateBatch({node3_id});
+    evaluator.evaluateBatch({node3_id});
+    ASSERT_TRUE(fpEqual(evaluator.getCachedEval(node3_id), 5.0));
+    ASSERT_EQ(evaluator.getIDofLastEvaluatedNode(), node3_id);
+}
+
 /**
  * Tests the getAllSettings functionality
  */
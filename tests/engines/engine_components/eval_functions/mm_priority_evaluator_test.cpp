@@ -0,0 +1,47 @@
+#include <gtest/gtest.h>
+
+#include "engines/engine_components/eval_functions/mm_priority_evaluator.h"
+#include "engines/engine_components/node_containers/node_list.h"
+#include "environments/grid_pathfinding/grid_location.h"
+#include "environments/grid_pathfinding/grid_pathfinding_action.h"
+#include "environments/grid_pathfinding/grid_pathfinding_manhattan_heuristic.h"
+#include "test_helpers.h"
+
+class MMPriorityEvaluatorTests : public ::testing::Test {
+protected:
+    void SetUp() override {
+        manhattan.setGoalState(100, 100);
+    }
+
+public:
+    NodeList<GridLocation, GridDirection> nodes;
+    GridPathfindingManhattanHeuristic manhattan;
+};
+
+/**
+ * Tests that the priority is the f-cost when it is larger than twice the g-cost, and twice the g-cost otherwise.
+ */
+TEST_F(MMPriorityEvaluatorTests, priorityTest) {
+    MMPriorityEvaluator<GridLocation, GridDirection> evaluator(manhattan);
+    evaluator.setNodeContainer(nodes);
+
+    NodeID node1_id = nodes.addNode(GridLocation(50, 50), 1, 10.0, GridDirection::east, 1);
+    ASSERT_TRUE(checkNodeEvaluation(evaluator, node1_id, 110.0, false));
+
+    NodeID node2_id = nodes.addNode(GridLocation(90, 90), 1, 30.0, GridDirection::east, 1);
+    ASSERT_TRUE(checkNodeEvaluation(evaluator, node2_id, 60.0, false));
+}
+
+/**
+ * Tests that re-evaluating uses the new g-cost of the node.
+ */
+TEST_F(MMPriorityEvaluatorTests, reEvaluateTest) {
+    MMPriorityEvaluator<GridLocation, GridDirection> evaluator(manhattan);
+    evaluator.setNodeContainer(nodes);
+
+    NodeID node_id = nodes.addNode(GridLocation(90, 90), 1, 30.0, GridDirection::east, 1);
+    ASSERT_TRUE(checkNodeEvaluation(evaluator, node_id, 60.0, false));
+
+    nodes.setGValue(node_id, 5.0);
+    ASSERT_TRUE(checkNodeEvaluation(evaluator, node_id, 25.0, false, true));
+}
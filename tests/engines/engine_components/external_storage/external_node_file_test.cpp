@@ -0,0 +1,150 @@
+#include <gtest/gtest.h>
+
+#include "engines/engine_components/external_storage/external_node_file.h"
+#include "test_helpers.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <random>
+#include <set>
+#include <string>
+#include <tuple>
+#include <vector>
+
+const std::string TEST_NAME = "external_node_file_test";  ///< Prefixes the names of the files used by these tests
+
+/**
+ * Reads all of the records in the given file.
+ */
+std::vector<ExternalNodeRecord> readAllRecords(const std::string& path, ExternalIOStatistics& stats) {
+    std::vector<ExternalNodeRecord> records;
+    ExternalNodeReader reader(path, 3, stats);
+    ExternalNodeRecord record;
+    while (reader.readNext(record)) {
+        records.push_back(record);
+    }
+    return records;
+}
+
+/**
+ * Checks that appended records are read back in order, and that the bytes read and written are counted.
+ */
+TEST(ExternalNodeFileTests, appendAndReadTest) {
+    std::string path = getTestFilePath(TEST_NAME, "append.bin");
+    ExternalIOStatistics stats;
+    ASSERT_EQ(getNumNodeRecords(path), 0u);
+
+    appendNodeRecords(path, {{5, 1}, {3, 2}}, stats);
+    appendNodeRecords(path, {{7, 4}}, stats);
+    ASSERT_EQ(getNumNodeRecords(path), 3u);
+    ASSERT_EQ(stats.m_bytes_written, 3 * sizeof(ExternalNodeRecord));
+
+    std::vector<ExternalNodeRecord> records = readAllRecords(path, stats);
+    ASSERT_EQ(records.size(), 3u);
+    ASSERT_EQ(records[0].m_rank, 5u);
+    ASSERT_EQ(records[1].m_parent_rank, 2u);
+    ASSERT_EQ(records[2].m_rank, 7u);
+    ASSERT_EQ(stats.m_bytes_read, 3 * sizeof(ExternalNodeRecord));
+
+    ExternalNodeReader reader(path, 2, stats);
+    ASSERT_EQ(reader.peekNext()->m_rank, 5u);
+    ASSERT_EQ(reader.peekNext()->m_rank, 5u);
+
+    stats.reset();
+    ASSERT_EQ(stats.m_bytes_read, 0u);
+    std::filesystem::remove(path);
+}
+
+/**
+ * Checks that sorting removes duplicates, both when the file fits in memory and when it has to be split into runs, and
+ * that runs are merged in several passes when there are more of them than can be merged at once.
+ */
+TEST(ExternalNodeFileTests, sortAndRemoveDuplicatesTest) {
+    std::mt19937 rand_gen(3);
+    std::uniform_int_distribution<uint64_t> rank_dist(0, 200);
+
+    // The memory in records, the maximum fan-in, and the expected number of sort passes for 300 records
+    std::vector<std::tuple<std::size_t, std::size_t, uint64_t>> settings{
+              {1000, 64, 1}, {100, 64, 2}, {100, 2, 3}, {7, 64, 4}, {1, 64, 10}};
+    for (auto [max_records, max_fan_in, expected_num_passes] : settings) {
+        std::string path = getTestFilePath(TEST_NAME, "sort.bin");
+        std::vector<ExternalNodeRecord> records;
+        std::set<uint64_t> ranks;
+        for (int i = 0; i < 300; ++i) {
+            records.push_back({rank_dist(rand_gen), static_cast<uint64_t>(i)});
+            ranks.insert(records.back().m_rank);
+        }
+        ExternalIOStatistics stats;
+        appendNodeRecords(path, records, stats);
+
+        std::size_t num_records = sortAndRemoveDuplicateNodeRecords(path, max_records, max_fan_in, stats);
+        ASSERT_EQ(num_records, ranks.size());
+        ASSERT_EQ(getNumNodeRecords(path), ranks.size());
+        ASSERT_EQ(stats.m_num_sort_passes, expected_num_passes);
+
+        std::vector<ExternalNodeRecord> sorted = readAllRecords(path, stats);
+        std::vector<uint64_t> sorted_ranks;
+        for (const auto& record : sorted) {
+            sorted_ranks.push_back(record.m_rank);
+        }
+        ASSERT_EQ(sorted_ranks, std::vector<uint64_t>(ranks.begin(), ranks.end()));
+        std::filesystem::remove(path);
+
+        // The runs are removed after they are merged
+        for (const auto& entry : std::filesystem::directory_iterator(std::filesystem::temp_directory_path())) {
+            ASSERT_EQ(entry.path().string().find(path + ".run"), std::string::npos);
+        }
+    }
+
+    std::string empty_path = getTestFilePath(TEST_NAME, "empty.bin");
+    ExternalIOStatistics stats;
+    ASSERT_EQ(sortAndRemoveDuplicateNodeRecords(empty_path, 10, 64, stats), 0u);
+    std::filesystem::remove(empty_path);
+}
+
+/**
+ * Checks that subtracting one sorted file from another removes exactly the shared ranks.
+ */
+TEST(ExternalNodeFileTests, subtractTest) {
+    std::string path = getTestFilePath(TEST_NAME, "subtract.bin");
+    std::string other_path = getTestFilePath(TEST_NAME, "subtract_other.bin");
+    ExternalIOStatistics stats;
+    appendNodeRecords(path, {{1, 0}, {3, 0}, {4, 0}, {8, 0}, {9, 0}}, stats);
+    appendNodeRecords(other_path, {{2, 0}, {3, 0}, {9, 0}, {12, 0}}, stats);
+
+    ASSERT_EQ(subtractNodeRecords(path, other_path, 2, stats), 3u);
+    std::vector<ExternalNodeRecord> records = readAllRecords(path, stats);
+    ASSERT_EQ(records.size(), 3u);
+    ASSERT_EQ(records[0].m_rank, 1u);
+    ASSERT_EQ(records[1].m_rank, 4u);
+    ASSERT_EQ(records[2].m_rank, 8u);
+
+    std::filesystem::remove(path);
+    std::filesystem::remove(other_path);
+}
+
+/**
+ * Checks that records are found by rank in a sorted file.
+ */
+TEST(ExternalNodeFileTests, findTest) {
+    std::string path = getTestFilePath(TEST_NAME, "find.bin");
+    ExternalIOStatistics stats;
+    std::vector<ExternalNodeRecord> records;
+    for (uint64_t rank = 0; rank < 50; ++rank) {
+        records.push_back({rank * 2, rank + 100});
+    }
+    appendNodeRecords(path, records, stats);
+
+    for (uint64_t rank = 0; rank < 100; ++rank) {
+        auto found = findNodeRecord(path, rank, stats);
+        if (rank % 2 == 0) {
+            ASSERT_TRUE(found.has_value());
+            ASSERT_EQ(found->m_parent_rank, rank / 2 + 100);
+        } else {
+            ASSERT_FALSE(found.has_value());
+        }
+    }
+    ASSERT_FALSE(findNodeRecord(getTestFilePath(TEST_NAME, "find_missing.bin"), 4, stats).has_value());
+    std::filesystem::remove(path);
+}
@@ -0,0 +1,119 @@
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <optional>
+#include <vector>
+
+#include "engines/engine_components/node_containers/ranked_node_list.h"
+#include "environments/sliding_tile_puzzle/sliding_tile_action.h"
+#include "environments/sliding_tile_puzzle/sliding_tile_hash_function.h"
+#include "environments/sliding_tile_puzzle/sliding_tile_state.h"
+
+/**
+* Tests that adding nodes works properly. Uses sliding tile environment for the test.
+*/
+TEST(RankedNodeListTests, addNodeTest) {
+    SlidingTileHashFunction hash_function;
+    RankedNodeList<SlidingTileState, BlankSlide> nodes(hash_function);
+
+    std::vector<Tile> parent_perm{1, 0, 2, 3, 4, 5};
+    std::vector<Tile> child_perm{1, 4, 2, 3, 0, 5};
+
+    SlidingTileState parent_state(parent_perm, 2, 3);
+    SlidingTileState child_state(child_perm, 2, 3);
+
+    NodeID parent_id = nodes.addNode(parent_state);
+    ASSERT_EQ(parent_id, 0);
+
+    NodeID child_id = nodes.addNode(child_state, 0, 1, BlankSlide::up, 1);
+    ASSERT_EQ(child_id, 1);
+
+    ASSERT_EQ(nodes.getState(parent_id), parent_state);
+    ASSERT_EQ(nodes.getState(child_id), child_state);
+    ASSERT_EQ(nodes.getRank(parent_id), hash_function.getHashValue(parent_state));
+    ASSERT_EQ(nodes.getRank(child_id), hash_function.getHashValue(child_state));
+
+    ASSERT_EQ(nodes.getGValue(parent_id), 0.0);
+    ASSERT_EQ(nodes.getGValue(child_id), 1.0);
+
+    ASSERT_EQ(nodes.getLastAction(parent_id), std::nullopt);
+    ASSERT_EQ(nodes.getLastAction(child_id), BlankSlide::up);
+
+    ASSERT_EQ(nodes.getParentID(parent_id), 0);
+    ASSERT_EQ(nodes.getParentID(child_id), 0);
+
+    ASSERT_EQ(nodes.size(), 2);
+    ASSERT_EQ(nodes.getNumUnranks(), 0);
+
+    nodes.clear();
+    ASSERT_EQ(nodes.size(), 0);
+
+    // After clearing, the scratch states take the shape of the new states
+    std::vector<SlidingTileState> states;
+    std::vector<Tile> perm{0, 1, 2, 3};
+    for (int i = 0; i < 6; i++) {
+        std::swap(perm[static_cast<std::size_t>(i % 3)], perm[static_cast<std::size_t>(i % 3 + 1)]);
+        states.emplace_back(perm, 2, 2);
+        nodes.addNode(states.back());
+    }
+    for (NodeID node_id = 0; node_id < states.size(); node_id++) {
+        ASSERT_EQ(nodes.getState(node_id), states[node_id]);
+    }
+}
+
+/**
+ * Tests that states that are no longer in the scratch states are recovered from their ranks, including the location
+ * of the blank.
+ */
+TEST(RankedNodeListTests, unrankTest) {
+    SlidingTileHashFunction hash_function;
+    RankedNodeList<SlidingTileState, BlankSlide> nodes(hash_function);
+
+    std::vector<SlidingTileState> states;
+    std::vector<Tile> perm{0, 1, 2, 3, 4, 5, 6, 7, 8};
+    for (int i = 0; i < 10; i++) {
+        std::swap(perm[static_cast<std::size_t>(i % 8)], perm[static_cast<std::size_t>(i % 8 + 1)]);
+        states.emplace_back(perm, 3, 3);
+        nodes.addNode(states.back());
+    }
+
+    // The most recently added states are still in the scratch states, so only the others are unranked
+    for (NodeID node_id = states.size(); node_id-- > 0;) {
+        ASSERT_EQ(nodes.getState(node_id), states[node_id]);
+        ASSERT_EQ(nodes.getState(node_id).m_blank_loc, states[node_id].m_blank_loc);
+    }
+    std::size_t num_scratch_states = RankedNodeList<SlidingTileState, BlankSlide>::NUM_SCRATCH_STATES;
+    ASSERT_EQ(nodes.getNumUnranks(), states.size() - num_scratch_states);
+
+    // The most recently recovered state is found without unranking again
+    uint64_t num_unranks = nodes.getNumUnranks();
+    ASSERT_EQ(nodes.getState(0), states[0]);
+    ASSERT_EQ(nodes.getNumUnranks(), num_unranks);
+}
+
+/**
+ * Tests the setters methods works correctly.
+ */
+TEST(RankedNodeListTests, settersTest) {
+    SlidingTileHashFunction hash_function;
+    RankedNodeList<SlidingTileState, BlankSlide> nodes(hash_function);
+
+    SlidingTileState parent_state(std::vector<Tile>{1, 0, 2, 3, 4, 5}, 2, 3);
+    SlidingTileState child_state(std::vector<Tile>{1, 4, 2, 3, 0, 5}, 2, 3);
+
+    NodeID parent_id = nodes.addNode(parent_state);
+    NodeID child_id = nodes.addNode(child_state, parent_id, 1, BlankSlide::up, 1);
+
+    nodes.setGValue(child_id, 5.0);
+    nodes.setParentID(child_id, child_id);
+    nodes.setLastAction(child_id, BlankSlide::down);
+    nodes.setLastActionCost(child_id, 2.0);
+
+    ASSERT_EQ(nodes.getGValue(child_id), 5.0);
+    ASSERT_EQ(nodes.getParentID(child_id), child_id);
+    ASSERT_EQ(nodes.getLastAction(child_id), BlankSlide::down);
+    ASSERT_EQ(nodes.getLastActionCost(child_id), 2.0);
+
+    nodes.popBack();
+    ASSERT_EQ(nodes.size(), 1);
+    ASSERT_EQ(nodes.getState(parent_id), parent_state);
+}
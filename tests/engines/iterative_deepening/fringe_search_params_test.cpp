@@ -0,0 +1,18 @@
+#include <gtest/gtest.h>
+
+#include "engines/iterative_deepening/fringe_search_params.h"
+
+#include <string>
+
+/**
+ * Tests that getParameterLog contains the correct values
+ */
+TEST(FringeSearchParamsTests, getParameterLogTest) {
+    FringeSearchParams params;
+    StringMap log = params.getParameterLog();
+    ASSERT_EQ(log.at("num_cells"), "0");
+
+    params.m_num_cells = 1024;
+    log = params.getParameterLog();
+    ASSERT_EQ(log.at("num_cells"), "1024");
+}
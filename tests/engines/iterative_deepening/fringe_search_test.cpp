@@ -0,0 +1,157 @@
+#include <gtest/gtest.h>
+
+#include "building_tools/goal_tests/single_state_goal_test.h"
+#include "building_tools/hashing/permutation_hash_function.h"
+#include "engines/iterative_deepening/fringe_search.h"
+#include "environments/grid_pathfinding/grid_location.h"
+#include "environments/grid_pathfinding/grid_location_hash_function.h"
+#include "environments/grid_pathfinding/grid_map.h"
+#include "environments/grid_pathfinding/grid_pathfinding_action.h"
+#include "environments/grid_pathfinding/grid_pathfinding_octile_heuristic.h"
+#include "environments/grid_pathfinding/grid_pathfinding_transitions.h"
+#include "environments/sliding_tile_puzzle/sliding_tile_action.h"
+#include "environments/sliding_tile_puzzle/sliding_tile_manhattan_heuristic.h"
+#include "environments/sliding_tile_puzzle/sliding_tile_state.h"
+#include "environments/sliding_tile_puzzle/sliding_tile_transitions.h"
+#include "test_helpers.h"
+#include "utils/plan_and_path_utils.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+/**
+ * Checks that the engine can only run once the heuristic and the hash function are set.
+ */
+TEST(FringeSearchTests, setAndCanRunTest) {
+    SlidingTileState goal_state(2, 3);
+    SingleStateGoalTest<SlidingTileState> goal_test(goal_state);
+    SlidingTileTransitions transitions(2, 3);
+    SlidingTileManhattanHeuristic heuristic(goal_state, SlidingTileCostType::unit);
+    PermutationHashFunction<SlidingTileState> hash_function;
+
+    FringeSearchParams params;
+    FringeSearch<SlidingTileState, BlankSlide, uint64_t> engine(params);
+    engine.setTransitionSystem(transitions);
+    engine.setGoalTest(goal_test);
+    ASSERT_FALSE(engine.canRunSearch());
+
+    engine.setHeuristic(heuristic);
+    ASSERT_FALSE(engine.canRunSearch());
+
+    engine.setHashFunction(hash_function);
+    ASSERT_TRUE(engine.canRunSearch());
+    ASSERT_EQ(engine.getStatus(), EngineStatus::ready);
+    ASSERT_EQ(engine.getName(), "FringeSearch");
+}
+
+/**
+ * Checks that fringe search finds optimal solutions on the sliding tile puzzle with unit and non-unit action costs, and
+ * that reusing the engine for later searches does not depend on the cells left from earlier ones.
+ */
+TEST(FringeSearchTests, slidingTileTest) {
+    std::mt19937 rand_gen(43);
+    SlidingTileState goal_state(3, 3);
+    SingleStateGoalTest<SlidingTileState> goal_test(goal_state);
+    PermutationHashFunction<SlidingTileState> hash_function;
+
+    for (SlidingTileCostType cost_type : {SlidingTileCostType::unit, SlidingTileCostType::heavy, SlidingTileCostType::inverse}) {
+        SlidingTileTransitions transitions(3, 3, cost_type);
+        SlidingTileManhattanHeuristic heuristic(goal_state, cost_type);
+
+        FringeSearchParams params;
+        FringeSearch<SlidingTileState, BlankSlide, uint64_t> engine(params);
+        engine.setHeuristic(heuristic);
+        engine.setTransitionSystem(transitions);
+        engine.setGoalTest(goal_test);
+        engine.setHashFunction(hash_function);
+
+        for (int trial = 0; trial < 5; ++trial) {
+            SlidingTileState init_state = getRandomWalkState(goal_state, transitions, 60, rand_gen);
+            SlidingTileManhattanHeuristic a_star_heuristic(goal_state, cost_type);
+            double a_star_cost = getAStarCost(init_state, transitions, goal_test, a_star_heuristic, hash_function);
+
+            engine.searchForPlan(init_state);
+
+            ASSERT_EQ(engine.getStatus(), EngineStatus::search_completed);
+            ASSERT_NEAR(engine.getLastSolutionPlanCost(), a_star_cost, 1e-9);
+            ASSERT_TRUE(checkSolutionPlan(init_state, engine.getLastSolutionPlan(), transitions, goal_test).m_is_valid);
+            ASSERT_NEAR(engine.getThresholds().back(), a_star_cost, 1e-9);
+        }
+    }
+}
+
+/**
+ * Checks that the search ends without a solution when the goal cannot be reached, after storing every reachable state.
+ */
+TEST(FringeSearchTests, noSolutionTest) {
+    SlidingTileState goal_state(2, 3);
+    SingleStateGoalTest<SlidingTileState> goal_test(goal_state);
+    SlidingTileTransitions transitions(2, 3);
+    SlidingTileManhattanHeuristic heuristic(goal_state, SlidingTileCostType::unit);
+    PermutationHashFunction<SlidingTileState> hash_function;
+    SlidingTileState init_state(std::vector<Tile>{0, 2, 1, 3, 4, 5}, 2, 3);
+
+    FringeSearchParams params;
+    FringeSearch<SlidingTileState, BlankSlide, uint64_t> engine(params);
+    engine.setHeuristic(heuristic);
+    engine.setTransitionSystem(transitions);
+    engine.setGoalTest(goal_test);
+    engine.setHashFunction(hash_function);
+    engine.searchForPlan(init_state);
+
+    ASSERT_EQ(engine.getStatus(), EngineStatus::search_completed);
+    ASSERT_FALSE(engine.hasFoundSolution());
+    ASSERT_EQ(engine.getNodes().size(), 360u);
+    ASSERT_EQ(engine.getFringeSize(), 0u);
+}
+
+/**
+ * Checks that fringe search finds optimal paths on an eight-connected grid with the octile heuristic, using one cell
+ * per grid location.
+ */
+TEST(FringeSearchTests, gridPathfindingTest) {
+    std::mt19937 rand_gen(47);
+    const int map_size = 40;
+    GridMap map = createRandomMap(map_size, 0.25, rand_gen);
+    GridPathfindingTransitions transitions(&map, GridConnectionType::eight);
+    GridLocationHashFunction hash_function;
+    hash_function.setMapWidth(transitions);
+
+    std::vector<GridLocation> open_cells = getOpenLocations(map);
+    std::uniform_int_distribution<std::size_t> cell_dist(0, open_cells.size() - 1);
+
+    GridPathfindingOctileHeuristic heuristic;
+    FringeSearchParams params;
+    params.m_num_cells = static_cast<std::size_t>(map_size * map_size);
+    FringeSearch<GridLocation, GridDirection, uint32_t> engine(params);
+    engine.setHeuristic(heuristic);
+    engine.setTransitionSystem(transitions);
+    engine.setHashFunction(hash_function);
+
+    int num_solved = 0;
+    for (int trial = 0; trial < 30; ++trial) {
+        GridLocation start = open_cells[cell_dist(rand_gen)];
+        GridLocation goal = open_cells[cell_dist(rand_gen)];
+        SingleStateGoalTest<GridLocation> goal_test(goal);
+        GridPathfindingOctileHeuristic a_star_heuristic(goal);
+        double a_star_cost = getAStarCost(start, transitions, goal_test, a_star_heuristic, hash_function);
+
+        heuristic.setGoalState(goal);
+        engine.setGoalTest(goal_test);
+        engine.searchForPlan(start);
+        ASSERT_EQ(engine.getNumCells(), static_cast<std::size_t>(map_size * map_size));
+
+        if (a_star_cost < 0.0) {
+            ASSERT_FALSE(engine.hasFoundSolution());
+            ASSERT_EQ(engine.getStatus(), EngineStatus::search_completed);
+            continue;
+        }
+        num_solved++;
+        ASSERT_TRUE(engine.hasFoundSolution());
+        ASSERT_NEAR(engine.getLastSolutionPlanCost(), a_star_cost, 1e-9);
+        ASSERT_TRUE(checkSolutionPlan(start, engine.getLastSolutionPlan(), transitions, goal_test).m_is_valid);
+    }
+    ASSERT_GT(num_solved, 0);
+}
@@ -0,0 +1,20 @@
+#include <gtest/gtest.h>
+
+#include "engines/real_time/lss_lrta_star_params.h"
+#include "utils/string_utils.h"
+
+#include <string>
+
+/**
+ * Tests that getParameterLog contains the correct values
+ */
+TEST(LssLrtaStarParamsTests, getParameterLogTest) {
+    LssLrtaStarParams params;
+    params.m_lookahead_expansions = 10;
+    params.m_lookahead_microseconds = 250.0;
+    params.m_max_moves_per_trial = 1000;
+    StringMap log = params.getParameterLog();
+    ASSERT_EQ(log.at("lookahead_expansions"), std::to_string(10));
+    ASSERT_EQ(log.at("lookahead_microseconds"), std::to_string(250.0));
+    ASSERT_EQ(log.at("max_moves_per_trial"), std::to_string(1000));
+}
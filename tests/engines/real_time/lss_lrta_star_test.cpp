@@ -0,0 +1,307 @@
+#include <gtest/gtest.h>
+
+#include "building_tools/goal_tests/single_state_goal_test.h"
+#include "building_tools/hashing/permutation_hash_function.h"
+#include "building_tools/hashing/serialized_state_hash_function.h"
+#include "engines/real_time/lss_lrta_star.h"
+#include "environments/grid_pathfinding/grid_location.h"
+#include "environments/grid_pathfinding/grid_location_hash_function.h"
+#include "environments/grid_pathfinding/grid_map.h"
+#include "environments/grid_pathfinding/grid_pathfinding_action.h"
+#include "environments/grid_pathfinding/grid_pathfinding_octile_heuristic.h"
+#include "environments/grid_pathfinding/grid_pathfinding_transitions.h"
+#include "environments/sliding_tile_puzzle/sliding_tile_action.h"
+#include "environments/sliding_tile_puzzle/sliding_tile_manhattan_heuristic.h"
+#include "environments/sliding_tile_puzzle/sliding_tile_state.h"
+#include "environments/sliding_tile_puzzle/sliding_tile_transitions.h"
+#include "logging/search_component_settings.h"
+#include "test_helpers.h"
+#include "utils/plan_and_path_utils.h"
+#include "utils/string_utils.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <random>
+#include <string>
+#include <vector>
+
+/**
+ * Checks that the engine can only run once the heuristic and hash function are set.
+ */
+TEST(LssLrtaStarTests, setAndCanRunTest) {
+    GridMap map(5, 5);
+    GridPathfindingTransitions transitions(&map, GridConnectionType::eight);
+    SingleStateGoalTest<GridLocation> goal_test(GridLocation(4, 4));
+    GridPathfindingOctileHeuristic heuristic;
+    GridLocationHashFunction hash_function;
+
+    LssLrtaStarParams params;
+    LssLrtaStar<GridLocation, GridDirection, uint32_t> engine(params);
+    engine.setTransitionSystem(transitions);
+    engine.setGoalTest(goal_test);
+    ASSERT_FALSE(engine.canRunSearch());
+
+    engine.setHeuristic(heuristic);
+    ASSERT_FALSE(engine.canRunSearch());
+
+    engine.setHashFunction(hash_function);
+    ASSERT_TRUE(engine.canRunSearch());
+    ASSERT_EQ(engine.getName(), "LssLrtaStar");
+}
+
+/**
+ * Checks that the engine cannot run with a hash function that is not perfect, since the learned heuristic values are
+ * keyed by hash value alone.
+ */
+TEST(LssLrtaStarTests, nonPerfectHashTest) {
+    SlidingTileState goal_state(2, 3);
+    SingleStateGoalTest<SlidingTileState> goal_test(goal_state);
+    SlidingTileTransitions transitions(2, 3);
+    SlidingTileManhattanHeuristic heuristic(goal_state, SlidingTileCostType::unit);
+    SerializedStateHashFunction<SlidingTileState> non_perfect_hash_function;
+    PermutationHashFunction<SlidingTileState> hash_function;
+
+    LssLrtaStarParams params;
+    LssLrtaStar<SlidingTileState, BlankSlide, uint64_t> engine(params);
+    engine.setTransitionSystem(transitions);
+    engine.setGoalTest(goal_test);
+    engine.setHeuristic(heuristic);
+    engine.setHashFunction(non_perfect_hash_function);
+    ASSERT_FALSE(engine.canRunSearch());
+
+    engine.setHashFunction(hash_function);
+    ASSERT_TRUE(engine.canRunSearch());
+}
+
+
+/**
+ * Checks that a lookahead that reaches the goal gives an optimal path on the first trial when the heuristic is perfect,
+ * and that the trial does not change any heuristic value.
+ */
+TEST(LssLrtaStarTests, perfectHeuristicTest) {
+    GridMap map(10, 10);
+    GridPathfindingTransitions transitions(&map, GridConnectionType::eight);
+    GridLocation start(0, 0);
+    SingleStateGoalTest<GridLocation> goal_test(GridLocation(9, 6));
+    GridPathfindingOctileHeuristic heuristic(goal_test.getGoalState());
+    GridPathfindingOctileHeuristic a_star_heuristic(goal_test.getGoalState());
+    GridLocationHashFunction hash_function;
+
+    LssLrtaStarParams params;
+    LssLrtaStar<GridLocation, GridDirection, uint32_t> engine(params);
+    engine.setTransitionSystem(transitions);
+    engine.setGoalTest(goal_test);
+    engine.setHeuristic(heuristic);
+    engine.setHashFunction(hash_function);
+
+    ASSERT_EQ(engine.searchForPlan(start), EngineStatus::search_completed);
+    ASSERT_TRUE(engine.hasFoundSolution());
+    ASSERT_NEAR(engine.getLastSolutionPlanCost(),
+              getAStarCost(start, transitions, goal_test, a_star_heuristic, hash_function), 1e-9);
+    ASSERT_TRUE(checkSolutionPlan(start, engine.getLastSolutionPlan(), transitions, goal_test).m_is_valid);
+    ASSERT_TRUE(engine.hasConverged());
+    ASSERT_EQ(engine.getNumTrials(), 1);
+    ASSERT_EQ(engine.getMoveLatencies().size(), engine.getLastSolutionPlan().size());
+}
+
+/**
+ * Checks that repeated trials converge to an optimal path for several lookahead sizes, including LRTA*'s lookahead of a
+ * single expansion, and that every trial reaches the goal with a valid plan.
+ */
+TEST(LssLrtaStarTests, convergenceTest) {
+    GridLocation start(0, 0);
+    GridLocation goal(14, 14);
+    GridPathfindingOctileHeuristic heuristic(goal);
+    GridPathfindingOctileHeuristic a_star_heuristic(goal);
+    GridLocationHashFunction hash_function;
+    SingleStateGoalTest<GridLocation> goal_test(goal);
+
+    for (unsigned seed : {1u, 2u, 3u}) {
+        std::mt19937 rand_gen(seed);
+        GridMap map = createRandomMap(15, 0.25, rand_gen);
+        map.setLocationType(start.m_x_coord, start.m_y_coord, GridLocationType::passable);
+        map.setLocationType(goal.m_x_coord, goal.m_y_coord, GridLocationType::passable);
+        GridPathfindingTransitions transitions(&map, GridConnectionType::eight);
+        double a_star_cost = getAStarCost(start, transitions, goal_test, a_star_heuristic, hash_function);
+        if (a_star_cost < 0.0) {
+            continue;
+        }
+
+        for (int64_t lookahead : {1, 8, 64}) {
+            LssLrtaStarParams params;
+            params.m_lookahead_expansions = lookahead;
+            LssLrtaStar<GridLocation, GridDirection, uint32_t> engine(params);
+            engine.setTransitionSystem(transitions);
+            engine.setGoalTest(goal_test);
+            engine.setHeuristic(heuristic);
+            engine.setHashFunction(hash_function);
+
+            for (int trial = 0; trial < 1000 && !engine.hasConverged(); ++trial) {
+                ASSERT_EQ(engine.searchForPlan(start), EngineStatus::search_completed);
+                ASSERT_TRUE(engine.hasFoundSolution());
+                ASSERT_TRUE(checkSolutionPlan(start, engine.getLastSolutionPlan(), transitions, goal_test).m_is_valid);
+            }
+            ASSERT_TRUE(engine.hasConverged()) << "seed " << seed << ", lookahead " << lookahead;
+            ASSERT_NEAR(engine.getLastSolutionPlanCost(), a_star_cost, 1e-9) << "seed " << seed << ", lookahead "
+                                                                              << lookahead;
+            ASSERT_GT(engine.getNumLearnedValues(), 0u);
+        }
+    }
+}
+
+/**
+ * Checks that the learned values are kept between trials to the same goal, and cleared when the goal changes.
+ */
+TEST(LssLrtaStarTests, learnedValuesTest) {
+    GridMap map(10, 10);
+    for (int y = 0; y < 8; ++y) {
+        map.setLocationType(5, y, GridLocationType::obstacle);
+    }
+    GridPathfindingTransitions transitions(&map, GridConnectionType::four);
+    GridLocation start(0, 0);
+    GridPathfindingOctileHeuristic heuristic;
+    GridLocationHashFunction hash_function;
+
+    LssLrtaStarParams params;
+    params.m_lookahead_expansions = 4;
+    LssLrtaStar<GridLocation, GridDirection, uint32_t> engine(params);
+    engine.setTransitionSystem(transitions);
+    engine.setHeuristic(heuristic);
+    engine.setHashFunction(hash_function);
+
+    SingleStateGoalTest<GridLocation> goal_test(GridLocation(9, 0));
+    heuristic.setGoalState(goal_test.getGoalState());
+    engine.setGoalTest(goal_test);
+    ASSERT_EQ(engine.searchForPlan(start), EngineStatus::search_completed);
+    ASSERT_FALSE(engine.hasConverged());
+    std::size_t num_learned = engine.getNumLearnedValues();
+    ASSERT_GT(num_learned, 0u);
+    std::optional<double> start_value = engine.getLearnedHValue(start);
+    ASSERT_TRUE(start_value.has_value());
+    ASSERT_GE(*start_value, 9.0);
+
+    // A new goal test object for the same goal keeps the learned values
+    SingleStateGoalTest<GridLocation> same_goal_test(GridLocation(9, 0));
+    engine.setGoalTest(same_goal_test);
+    ASSERT_EQ(engine.searchForPlan(start), EngineStatus::search_completed);
+    ASSERT_EQ(engine.getNumTrials(), 2);
+    ASSERT_GE(engine.getNumLearnedValues(), num_learned);
+    ASSERT_GE(*engine.getLearnedHValue(start), *start_value);
+
+    SingleStateGoalTest<GridLocation> other_goal_test(GridLocation(0, 9));
+    heuristic.setGoalState(other_goal_test.getGoalState());
+    engine.setGoalTest(other_goal_test);
+    ASSERT_EQ(engine.searchForPlan(start), EngineStatus::search_completed);
+    ASSERT_TRUE(engine.hasFoundSolution());
+    ASSERT_EQ(engine.getNumTrials(), 1);
+
+    engine.clearLearnedHeuristic();
+    ASSERT_EQ(engine.getNumLearnedValues(), 0u);
+    ASSERT_EQ(engine.getNumTrials(), 0);
+    ASSERT_FALSE(engine.getLearnedHValue(start).has_value());
+}
+
+/**
+ * Checks that a time budget of zero gives the same moves as a lookahead of one expansion, since at least one node is
+ * always expanded.
+ */
+TEST(LssLrtaStarTests, timeBudgetTest) {
+    GridLocation start(0, 0);
+    GridLocation goal(11, 11);
+    std::mt19937 rand_gen(5);
+    GridMap map = createRandomMap(12, 0.2, rand_gen);
+    map.setLocationType(start.m_x_coord, start.m_y_coord, GridLocationType::passable);
+    map.setLocationType(goal.m_x_coord, goal.m_y_coord, GridLocationType::passable);
+    GridPathfindingTransitions transitions(&map, GridConnectionType::eight);
+    SingleStateGoalTest<GridLocation> goal_test(goal);
+    GridPathfindingOctileHeuristic heuristic(goal);
+    GridLocationHashFunction hash_function;
+
+    std::vector<std::vector<GridDirection>> plans;
+    for (bool use_time_budget : {false, true}) {
+        LssLrtaStarParams params;
+        if (use_time_budget) {
+            params.m_lookahead_microseconds = 0.0;
+        } else {
+            params.m_lookahead_expansions = 1;
+        }
+        LssLrtaStar<GridLocation, GridDirection, uint32_t> engine(params);
+        engine.setTransitionSystem(transitions);
+        engine.setGoalTest(goal_test);
+        engine.setHeuristic(heuristic);
+        engine.setHashFunction(hash_function);
+        engine.searchForPlan(start);
+        plans.push_back(engine.getLastSolutionPlan());
+    }
+    ASSERT_EQ(plans[0], plans[1]);
+}
+
+/**
+ * Checks that a trial stops at the move limit, and that a trial ends without a plan when the lookahead shows that the
+ * goal cannot be reached.
+ */
+TEST(LssLrtaStarTests, moveLimitAndUnreachableGoalTest) {
+    GridMap map(10, 10);
+    for (int y = 0; y < 10; ++y) {
+        map.setLocationType(5, y, GridLocationType::obstacle);
+    }
+    GridPathfindingTransitions transitions(&map, GridConnectionType::eight);
+    GridLocation start(0, 0);
+    SingleStateGoalTest<GridLocation> goal_test(GridLocation(9, 9));
+    GridPathfindingOctileHeuristic heuristic(goal_test.getGoalState());
+    GridLocationHashFunction hash_function;
+
+    LssLrtaStarParams params;
+    params.m_lookahead_expansions = 1;
+    params.m_max_moves_per_trial = 3;
+    LssLrtaStar<GridLocation, GridDirection, uint32_t> engine(params);
+    engine.setTransitionSystem(transitions);
+    engine.setGoalTest(goal_test);
+    engine.setHeuristic(heuristic);
+    engine.setHashFunction(hash_function);
+    ASSERT_EQ(engine.searchForPlan(start), EngineStatus::resource_limit_hit);
+    ASSERT_FALSE(engine.hasFoundSolution());
+    ASSERT_EQ(engine.getMoveLatencies().size(), 3u);
+
+    params.m_lookahead_expansions = 100;
+    params.m_max_moves_per_trial = 1000;
+    engine.setEngineParams(params);
+    ASSERT_EQ(engine.searchForPlan(start), EngineStatus::search_completed);
+    ASSERT_FALSE(engine.hasFoundSolution());
+    ASSERT_FALSE(engine.hasConverged());
+    ASSERT_EQ(engine.selectAction(start), std::nullopt);
+}
+
+/**
+ * Checks that the engine reports its trial and latency statistics.
+ */
+TEST(LssLrtaStarTests, statisticsTest) {
+    GridMap map(8, 8);
+    GridPathfindingTransitions transitions(&map, GridConnectionType::eight);
+    SingleStateGoalTest<GridLocation> goal_test(GridLocation(7, 3));
+    GridPathfindingOctileHeuristic heuristic(goal_test.getGoalState());
+    GridLocationHashFunction hash_function;
+
+    LssLrtaStarParams params;
+    params.m_lookahead_expansions = 2;
+    LssLrtaStar<GridLocation, GridDirection, uint32_t> engine(params);
+    engine.setTransitionSystem(transitions);
+    engine.setGoalTest(goal_test);
+    engine.setHeuristic(heuristic);
+    engine.setHashFunction(hash_function);
+    engine.searchForPlan(GridLocation(0, 0));
+
+    StringMap stats = engine.getEngineSpecificStatistics();
+    ASSERT_EQ(stats.at("num_trials"), "1");
+    ASSERT_EQ(stats.at("num_moves"), "7");
+    ASSERT_EQ(stats.at("has_converged"), boolToString(true));
+    for (const char* key : {"move_latency_microseconds_p50", "move_latency_microseconds_p90",
+                   "move_latency_microseconds_p99", "move_latency_microseconds_max"}) {
+        ASSERT_GE(std::stod(stats.at(key)), 0.0);
+    }
+    ASSERT_LE(std::stod(stats.at("move_latency_microseconds_p50")), std::stod(stats.at("move_latency_microseconds_max")));
+    SearchComponentSettings settings = engine.getAllSettings();
+    ASSERT_EQ(settings.m_main_settings.at("lookahead_expansions"), "2");
+    ASSERT_EQ(settings.m_sub_component_settings.count("heuristic"), 1u);
+}
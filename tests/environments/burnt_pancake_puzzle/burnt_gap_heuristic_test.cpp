@@ -1,10 +1,17 @@
 #include <gtest/gtest.h>
 
+#include "engines/engine_components/node_containers/node_list.h"
 #include "environments/burnt_pancake_puzzle/burnt_gap_heuristic.h"
 #include "environments/burnt_pancake_puzzle/burnt_pancake_state.h"
+#include "environments/burnt_pancake_puzzle/burnt_pancake_transitions.h"
 #include "environments/pancake_puzzle/pancake_names.h"
 #include "test_helpers.h"
 
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <vector>
+
 /**
  * Tests heuristic computation in BurntGapHeuristic for some permutations. Expected values calculated by hand.
  */
@@ -80,4 +87,52 @@ TEST(BurntGapHeuristicTests, getSettingsTest) {
     ASSERT_EQ(settings.m_main_settings.size(), 1);
     ASSERT_EQ(settings.m_main_settings[SETTING_COST_TYPE], COST_HEAVY);
     ASSERT_EQ(settings.m_sub_component_settings.size(), 0);
-}
\ No newline at end of file
+}
+
+/**
+ * Tests that incremental evaluation gives the same values as full evaluation for every child generated along a random
+ * walk, for both cost types.
+ */
+TEST(BurntGapHeuristicTests, incrementalEvaluationTest) {
+    const int num_pancakes = 12;
+    std::mt19937 rand_gen(7);
+
+    for (auto cost_type : {PancakePuzzleCostType::unit, PancakePuzzleCostType::heavy}) {
+        BurntPancakeTransitions transitions(num_pancakes, cost_type);
+        BurntGapHeuristic full_heuristic(cost_type);
+        BurntGapHeuristic incremental_heuristic(cost_type);
+        incremental_heuristic.setUseIncrementalEvaluation(true);
+
+        NodeList<BurntPancakeState, NumToFlip> nodes;
+        full_heuristic.setNodeContainer(nodes);
+        incremental_heuristic.setNodeContainer(nodes);
+
+        std::vector<BurntPancake> perm(num_pancakes);
+        std::iota(perm.begin(), perm.end(), 1);
+        std::shuffle(perm.begin(), perm.end(), rand_gen);
+        NodeID parent_id = nodes.addNode(BurntPancakeState(perm));
+        incremental_heuristic.prepareToEvaluate();
+        incremental_heuristic.evaluate(parent_id);
+
+        for (int step = 0; step < 100; ++step) {
+            BurntPancakeState parent = nodes.getState(parent_id);
+            std::vector<NodeID> children;
+
+            for (NumToFlip action : transitions.getActions(parent)) {
+                BurntPancakeState child = transitions.getChildState(parent, action);
+                NodeID child_id = nodes.addNode(child, parent_id, 0.0, action, 1.0);
+                children.push_back(child_id);
+
+                full_heuristic.prepareToEvaluate();
+                full_heuristic.evaluate(child_id);
+                incremental_heuristic.prepareToEvaluate();
+                incremental_heuristic.evaluate(child_id);
+
+                ASSERT_EQ(incremental_heuristic.getLastNodeEval(), full_heuristic.getLastNodeEval());
+                ASSERT_EQ(incremental_heuristic.getLastDistanceToGoEval(), full_heuristic.getLastDistanceToGoEval());
+            }
+            std::uniform_int_distribution<std::size_t> dist(0, children.size() - 1);
+            parent_id = children[dist(rand_gen)];
+        }
+    }
+}
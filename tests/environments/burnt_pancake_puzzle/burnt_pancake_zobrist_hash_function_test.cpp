@@ -0,0 +1,83 @@
+#include <gtest/gtest.h>
+
+#include "building_tools/hashing/hash_128.h"
+#include "environments/burnt_pancake_puzzle/burnt_pancake_state.h"
+#include "environments/burnt_pancake_puzzle/burnt_pancake_transitions.h"
+#include "environments/burnt_pancake_puzzle/burnt_pancake_zobrist_hash_function.h"
+#include "test_helpers.h"
+#include "utils/combinatorics.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <unordered_set>
+#include <vector>
+
+/**
+ * Gets a random burnt pancake state with 12 pancakes.
+ */
+BurntPancakeState getRandomBurntPancakeState(std::mt19937& rand_gen) {
+    std::vector<int> perm = getRandomPermutation(12, rand_gen);
+    for (int& pancake : perm) {
+        pancake = (pancake % 2 == 0) ? pancake + 1 : -(pancake + 1);
+    }
+    return BurntPancakeState(perm);
+}
+
+/**
+ * Tests that incremental hashing matches full hashing for 64-bit hash values.
+ */
+TEST(BurntPancakeZobristHashFunctionTests, incrementalHashTest) {
+    std::mt19937 rand_gen(3);
+    BurntPancakeTransitions transitions(12);
+    BurntPancakeZobristHashFunction<uint64_t> hasher(12, 11);
+    checkIncrementalHashing(hasher, transitions, getRandomBurntPancakeState(rand_gen), 200, rand_gen);
+}
+
+/**
+ * Tests that incremental hashing matches full hashing for 128-bit hash values.
+ */
+TEST(BurntPancakeZobristHashFunctionTests, incrementalHash128Test) {
+    std::mt19937 rand_gen(3);
+    BurntPancakeTransitions transitions(12);
+    BurntPancakeZobristHashFunction<Hash128> hasher(12, 11);
+    checkIncrementalHashing(hasher, transitions, getRandomBurntPancakeState(rand_gen), 200, rand_gen);
+}
+
+/**
+ * Tests that all signed permutations of a small stack get different hash values.
+ */
+TEST(BurntPancakeZobristHashFunctionTests, distinctHashValuesTest) {
+    BurntPancakeZobristHashFunction<> hasher(4, 5);
+
+    std::vector<int> perm = {1, 2, 3, 4};
+    std::unordered_set<uint64_t> hash_values;
+    do {
+        for (int signs = 0; signs < 16; ++signs) {
+            std::vector<int> signed_perm = perm;
+            for (std::size_t i = 0; i < signed_perm.size(); ++i) {
+                if ((signs >> i) % 2 == 1) {
+                    signed_perm[i] *= -1;
+                }
+            }
+            hash_values.insert(hasher.getHashValue(BurntPancakeState(signed_perm)));
+        }
+    } while (std::next_permutation(perm.begin(), perm.end()));
+
+    ASSERT_EQ(hash_values.size(), 384);
+    ASSERT_FALSE(hasher.isPerfectHashFunction());
+}
+
+/**
+ * Checks that getAllSettings returns the correct values.
+ */
+TEST(BurntPancakeZobristHashFunctionTests, getSettingsTest) {
+    BurntPancakeZobristHashFunction<> hasher(6, 5);
+
+    auto settings = hasher.getAllSettings();
+    ASSERT_EQ(settings.m_name, BurntPancakeZobristHashFunction<>::CLASS_NAME);
+    ASSERT_EQ(settings.m_main_settings.size(), 1);
+    ASSERT_EQ(settings.m_main_settings.at("seed"), "5");
+    ASSERT_EQ(settings.m_sub_component_settings.size(), 0);
+}
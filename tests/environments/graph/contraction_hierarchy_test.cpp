@@ -0,0 +1,235 @@
+#include <gtest/gtest.h>
+
+#include "building_tools/evaluators/constant_heuristic.h"
+#include "building_tools/goal_tests/single_state_goal_test.h"
+#include "engines/best_first_search/best_first_search.h"
+#include "engines/best_first_search/best_first_search_params.h"
+#include "engines/engine_components/eval_functions/f_cost_evaluator.h"
+#include "environments/graph/contraction_hierarchy.h"
+#include "environments/graph/contraction_hierarchy_search.h"
+#include "environments/graph/graph.h"
+#include "environments/graph/graph_transitions.h"
+#include "environments/graph/vertex_hash_function.h"
+#include "experiment_running/experiment_runner.h"
+#include "utils/floating_point_utils.h"
+#include "utils/plan_and_path_utils.h"
+
+#include <cstdint>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+/**
+ * Creates a random graph with the given number of vertices, where each vertex has edges to a few random vertices and
+ * some edges have an inverse.
+ */
+Graph createRandomGraph(int num_vertices, unsigned seed) {
+    Graph graph;
+    std::mt19937 random(seed);
+    std::uniform_int_distribution<int> vertex_dist(0, num_vertices - 1);
+    std::uniform_int_distribution<int> cost_dist(1, 20);
+    for (int vertex = 0; vertex < num_vertices; ++vertex) {
+        graph.addVertex("v" + std::to_string(vertex));
+    }
+    for (int vertex = 0; vertex < num_vertices; ++vertex) {
+        for (int edge = 0; edge < 3; ++edge) {
+            int other = vertex_dist(random);
+            double cost = cost_dist(random);
+            graph.addEdge("v" + std::to_string(vertex), "v" + std::to_string(other), cost);
+            if (edge == 0) {
+                graph.addEdge("v" + std::to_string(other), "v" + std::to_string(vertex), cost);
+            }
+        }
+    }
+    return graph;
+}
+
+/**
+ * Checks that the contraction hierarchy engine finds a valid optimal plan for every pair of vertices, by comparing to
+ * Dijkstra's algorithm.
+ */
+void checkAllQueries(const Graph& graph, const ContractionHierarchy& hierarchy) {
+    GraphTransitions transitions(graph);
+    VertexHashFunction hash;
+    ConstantHeuristic<GraphState, GraphAction> zero_heuristic;
+    FCostEvaluator<GraphState, GraphAction> f_cost_evaluator(zero_heuristic);
+    BestFirstSearchParams params;
+    BestFirstSearch<GraphState, GraphAction, uint32_t> dijkstra(params);
+    dijkstra.setEvaluator(f_cost_evaluator);
+    dijkstra.setHashFunction(hash);
+    dijkstra.setTransitionSystem(transitions);
+
+    ContractionHierarchySearch ch_search;
+    ch_search.setHierarchy(hierarchy);
+    ch_search.setTransitionSystem(transitions);
+
+    for (VertexID start = 0; start < graph.getNumVertices(); ++start) {
+        for (VertexID goal = 0; goal < graph.getNumVertices(); ++goal) {
+            GraphState start_state{start, &graph};
+            SingleStateGoalTest<GraphState> goal_test(GraphState{goal, &graph});
+            dijkstra.setGoalTest(goal_test);
+            ch_search.setGoalTest(goal_test);
+            dijkstra.searchForPlan(start_state);
+            ASSERT_EQ(ch_search.searchForPlan(start_state), EngineStatus::search_completed);
+
+            ASSERT_EQ(ch_search.hasFoundSolution(), dijkstra.hasFoundSolution()) << start << " to " << goal;
+            if (!dijkstra.hasFoundSolution()) {
+                continue;
+            }
+            ASSERT_TRUE(fpEqual(ch_search.getLastSolutionPlanCost(), dijkstra.getLastSolutionPlanCost()))
+                      << start << " to " << goal;
+            SequenceCheckResult check = checkSolutionPlan(start_state, ch_search.getLastSolutionPlan(), transitions,
+                      goal_test);
+            ASSERT_TRUE(check.m_is_valid);
+            ASSERT_TRUE(fpEqual(check.m_sequence_cost, ch_search.getLastSolutionPlanCost()));
+        }
+    }
+}
+
+/**
+ * Tests the hierarchy of a path, where contracting the middle vertices must add shortcuts.
+ */
+TEST(ContractionHierarchyTests, pathTest) {
+    Graph graph;
+    graph.addEdge("a", "b", 1);
+    graph.addEdge("b", "c", 2);
+    graph.addEdge("c", "d", 3);
+    graph.addEdge("d", "e", 4);
+    ContractionHierarchy hierarchy(graph);
+    ASSERT_FALSE(hierarchy.isBuilt());
+    hierarchy.build();
+    ASSERT_TRUE(hierarchy.isBuilt());
+
+    // Every edge is kept, and any shortcut stands for a subpath
+    ASSERT_GE(hierarchy.getNumArcs(), graph.getNumEdges());
+    for (ContractionHierarchy::ArcID arc_id = 0; arc_id < hierarchy.getNumArcs(); ++arc_id) {
+        std::vector<EdgeID> edges;
+        hierarchy.unpackArc(arc_id, edges);
+        const ContractionHierarchy::Arc& arc = hierarchy.getArc(arc_id);
+        ASSERT_EQ(graph.getEdgeByID(edges.front()).m_from_vertex_id, arc.m_from_vertex_id);
+        ASSERT_EQ(graph.getEdgeByID(edges.back()).m_to_vertex_id, arc.m_to_vertex_id);
+        double cost = 0.0;
+        for (std::size_t i = 0; i < edges.size(); ++i) {
+            cost += graph.getEdgeByID(edges[i]).m_cost;
+            if (i > 0) {
+                ASSERT_EQ(graph.getEdgeByID(edges[i - 1]).m_to_vertex_id, graph.getEdgeByID(edges[i]).m_from_vertex_id);
+            }
+        }
+        ASSERT_EQ(cost, arc.m_cost);
+    }
+
+    for (VertexID vertex = 0; vertex < graph.getNumVertices(); ++vertex) {
+        auto [first, last] = hierarchy.getUpwardArcs(vertex);
+        for (std::size_t i = first; i < last; ++i) {
+            const ContractionHierarchy::Arc& arc = hierarchy.getArc(hierarchy.getUpwardArcList()[i]);
+            ASSERT_EQ(arc.m_from_vertex_id, vertex);
+            ASSERT_GT(hierarchy.getRank(arc.m_to_vertex_id), hierarchy.getRank(vertex));
+        }
+    }
+    checkAllQueries(graph, hierarchy);
+}
+
+/**
+ * Tests that queries on random graphs are optimal, including with very limited witness searches.
+ */
+TEST(ContractionHierarchyTests, randomGraphTest) {
+    for (unsigned seed : {1u, 2u, 3u}) {
+        Graph graph = createRandomGraph(40, seed);
+        ContractionHierarchy hierarchy(graph);
+        hierarchy.build();
+        checkAllQueries(graph, hierarchy);
+
+        ContractionHierarchy limited_hierarchy(graph);
+        limited_hierarchy.build(1, 1);
+        checkAllQueries(graph, limited_hierarchy);
+    }
+}
+
+/**
+ * Tests that building with several threads gives the same hierarchy as building with one.
+ */
+TEST(ContractionHierarchyTests, parallelBuildTest) {
+    Graph graph = createRandomGraph(100, 7);
+    ContractionHierarchy serial_hierarchy(graph);
+    serial_hierarchy.build(1);
+    ContractionHierarchy parallel_hierarchy(graph);
+    parallel_hierarchy.build(4);
+
+    ASSERT_EQ(serial_hierarchy.getNumArcs(), parallel_hierarchy.getNumArcs());
+    ASSERT_EQ(serial_hierarchy.getNumShortcuts(), parallel_hierarchy.getNumShortcuts());
+    ASSERT_EQ(serial_hierarchy.getUpwardArcList(), parallel_hierarchy.getUpwardArcList());
+    for (VertexID vertex = 0; vertex < graph.getNumVertices(); ++vertex) {
+        ASSERT_EQ(serial_hierarchy.getRank(vertex), parallel_hierarchy.getRank(vertex));
+    }
+}
+
+/**
+ * Tests that a saved hierarchy can be loaded for the same graph, but not for a different one.
+ */
+TEST(ContractionHierarchyTests, saveAndLoadTest) {
+    Graph graph = createRandomGraph(30, 11);
+    ContractionHierarchy hierarchy(graph);
+    hierarchy.build();
+    std::stringstream saved;
+    ASSERT_TRUE(hierarchy.save(saved));
+
+    ContractionHierarchy loaded(graph);
+    ASSERT_TRUE(loaded.load(saved));
+    ASSERT_TRUE(loaded.isBuilt());
+    ASSERT_EQ(loaded.getNumArcs(), hierarchy.getNumArcs());
+    ASSERT_EQ(loaded.getNumShortcuts(), hierarchy.getNumShortcuts());
+    ASSERT_EQ(loaded.getDownwardArcList(), hierarchy.getDownwardArcList());
+    checkAllQueries(graph, loaded);
+
+    Graph other_graph = createRandomGraph(31, 11);
+    ContractionHierarchy other(other_graph);
+    std::stringstream saved_again(saved.str());
+    ASSERT_FALSE(other.load(saved_again));
+    ASSERT_FALSE(other.isBuilt());
+
+    std::stringstream truncated(saved.str().substr(0, saved.str().size() / 2));
+    ASSERT_FALSE(loaded.load(truncated));
+    ASSERT_FALSE(loaded.isBuilt());
+}
+
+/**
+ * Tests that the engine reports its results through the experiment runner.
+ */
+TEST(ContractionHierarchyTests, experimentResultsTest) {
+    Graph graph;
+    graph.addEdge("a", "b", 1);
+    graph.addEdge("b", "c", 1);
+    graph.addEdge("a", "c", 5);
+    graph.addEdge("d", "a", 1);
+    ContractionHierarchy hierarchy(graph);
+    hierarchy.build();
+    GraphTransitions transitions(graph);
+
+    ContractionHierarchySearch engine;
+    ASSERT_FALSE(engine.canRunSearch());
+    engine.setHierarchy(hierarchy);
+    engine.setTransitionSystem(transitions);
+    ASSERT_FALSE(engine.canRunSearch());
+
+    SingleStateGoalTest<GraphState> goal_test(transitions.getVertexState("c"));
+    engine.setGoalTest(goal_test);
+    ASSERT_TRUE(engine.canRunSearch());
+
+    ExperimentResults<GraphAction> result = runExperiment(engine, transitions.getVertexState("a"));
+    ASSERT_TRUE(result.m_has_found_plan);
+    ASSERT_EQ(result.m_plan_cost, 2.0);
+    ASSERT_EQ(result.m_plan, (std::vector<GraphAction>{transitions.getEdgeAction("a", "b"), transitions.getEdgeAction("b", "c")}));
+    ASSERT_EQ(result.m_engine_specific_stats.count("num_forward_settled"), 1u);
+
+    std::vector<NodeEvaluator<GraphState, GraphAction>*> evaluators;
+    ExperimentResults<GraphAction> no_path = runExperiment(engine, transitions.getVertexState("c"),
+              transitions.getVertexState("d"), evaluators);
+    ASSERT_FALSE(no_path.m_has_found_plan);
+
+    engine.setGoalTest(goal_test);
+    ExperimentResults<GraphAction> same_vertex = runExperiment(engine, transitions.getVertexState("c"));
+    ASSERT_TRUE(same_vertex.m_has_found_plan);
+    ASSERT_TRUE(same_vertex.m_plan.empty());
+    ASSERT_EQ(same_vertex.m_plan_cost, 0.0);
+}
@@ -0,0 +1,184 @@
+#include <gtest/gtest.h>
+
+#include "environments/graph/csr_graph.h"
+#include "environments/graph/csr_graph_loading.h"
+#include "test_helpers.h"
+
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+const std::string TEST_NAME = "csr_graph_loading_test";  ///< Prefixes the names of the files used by these tests
+
+/**
+ * Writes the given text to a test file, and returns the path to the file.
+ */
+std::string writeTestFile(const std::string& name, const std::string& text) {
+    std::string path = getTestFilePath(TEST_NAME, name);
+    std::ofstream file(path, std::ios::binary);
+    file << text;
+    return path;
+}
+
+/**
+ * Checks that both graphs have the same edges in the same order.
+ */
+void assertSameGraph(const CsrGraph& graph1, const CsrGraph& graph2) {
+    ASSERT_EQ(graph1.getEdgeOffsets(), graph2.getEdgeOffsets());
+    ASSERT_EQ(graph1.getEdgeTargets(), graph2.getEdgeTargets());
+    ASSERT_EQ(graph1.getEdgeCosts(), graph2.getEdgeCosts());
+}
+
+/**
+ * Tests that a DIMACS graph is loaded with vertices numbered from 0, and that the result does not depend on the number
+ * of threads or on the block size, including blocks shorter than a line.
+ */
+TEST(CsrGraphLoadingTests, dimacsGraphTest) {
+    std::string text = "c A small graph\n"
+                       "p sp 4 5\n"
+                       "a 1 2 3\n"
+                       "a 2 1 3\n"
+                       "c A comment between arcs\n"
+                       "\n"
+                       "a 2 3 1.5\r\n"
+                       "a 3 4 2\n"
+                       "a 4 1 7";
+    std::string path = writeTestFile("small.gr", text);
+
+    std::optional<CsrGraph> graph = loadDimacsGraph(path);
+    ASSERT_TRUE(graph.has_value());
+    ASSERT_EQ(graph->getNumVertices(), 4u);
+    ASSERT_EQ(graph->getNumEdges(), 5u);
+    ASSERT_FALSE(graph->hasLabels());
+    ASSERT_EQ(graph->getEdgeCost(*graph->findEdge(1, 2)), 1.5);
+    ASSERT_EQ(graph->getEdgeCost(*graph->findEdge(3, 0)), 7.0);
+    ASSERT_EQ(graph->getInverseEdge(*graph->findEdge(0, 1)), graph->findEdge(1, 0));
+
+    for (unsigned num_threads : {2u, 3u, 8u, 64u}) {
+        std::optional<CsrGraph> threaded_graph = loadDimacsGraph(path, num_threads);
+        ASSERT_TRUE(threaded_graph.has_value());
+        assertSameGraph(*graph, *threaded_graph);
+    }
+    for (std::size_t block_size : {1u, 2u, 7u, 16u, 1000u}) {
+        for (unsigned num_threads : {1u, 3u}) {
+            std::optional<CsrGraph> block_graph = loadDimacsGraph(path, num_threads, block_size);
+            ASSERT_TRUE(block_graph.has_value());
+            assertSameGraph(*graph, *block_graph);
+        }
+    }
+}
+
+/**
+ * Tests that malformed DIMACS graphs are not loaded.
+ */
+TEST(CsrGraphLoadingTests, malformedDimacsGraphTest) {
+    std::vector<std::string> texts = {
+              "a 1 2 3\n",  // No problem line
+              "p sp 2 1\np sp 2 1\na 1 2 3\n",  // Two problem lines
+              "p sp 2 2\na 1 2 3\n",  // Wrong number of arcs
+              "p sp 2 1\na 1 3 3\n",  // Vertex out of range
+              "p sp 2 1\na 0 1 3\n",  // Vertex numbered from 0
+              "p sp 2 1\na 1 2\n",  // Missing cost
+              "p sp 2 1\na 1 2 3 4\n",  // Extra field
+              "p sp 2 1\na 1 2x 3\n",  // Not a number
+              "p sp 2 1\nb 1 2 3\n",  // Unknown line
+              "p max 2 1\na 1 2 3\n"};  // Wrong problem type
+    for (std::size_t i = 0; i < texts.size(); ++i) {
+        std::string path = writeTestFile("malformed" + std::to_string(i) + ".gr", texts[i]);
+        ASSERT_EQ(loadDimacsGraph(path), std::nullopt) << texts[i];
+        ASSERT_EQ(loadDimacsGraph(path, 4), std::nullopt) << texts[i];
+        ASSERT_EQ(loadDimacsGraph(path, 2, 5), std::nullopt) << texts[i];
+    }
+    ASSERT_EQ(loadDimacsGraph(getTestFilePath(TEST_NAME, "missing.gr")), std::nullopt);
+}
+
+/**
+ * Tests that DIMACS coordinates are loaded in vertex order.
+ */
+TEST(CsrGraphLoadingTests, dimacsCoordinatesTest) {
+    std::string text = "c Coordinates\n"
+                       "p aux sp co 3\n"
+                       "v 2 -73530767 41085396\n"
+                       "v 1 -73530538 41086098\n"
+                       "v 3 -73519366 41048796\n";
+    std::string path = writeTestFile("small.co", text);
+
+    for (auto [num_threads, block_size] : {std::pair{1u, DIMACS_BLOCK_SIZE}, std::pair{3u, DIMACS_BLOCK_SIZE},
+                   std::pair{1u, std::size_t{3}}, std::pair{2u, std::size_t{20}}}) {
+        auto coordinates = loadDimacsCoordinates(path, num_threads, block_size);
+        ASSERT_TRUE(coordinates.has_value());
+        ASSERT_EQ(coordinates->size(), 3u);
+        ASSERT_EQ((*coordinates)[0].m_x, -73530538);
+        ASSERT_EQ((*coordinates)[0].m_y, 41086098);
+        ASSERT_EQ((*coordinates)[1].m_x, -73530767);
+        ASSERT_EQ((*coordinates)[2].m_y, 41048796);
+    }
+
+    std::string missing_path = writeTestFile("missing_vertex.co", "p aux sp co 3\nv 1 0 0\nv 2 0 0\n");
+    ASSERT_EQ(loadDimacsCoordinates(missing_path), std::nullopt);
+    std::string out_of_range_path = writeTestFile("out_of_range_vertex.co", "p aux sp co 2\nv 1 0 0\nv 3 0 0\n");
+    ASSERT_EQ(loadDimacsCoordinates(out_of_range_path, 1, 4), std::nullopt);
+}
+
+/**
+ * Tests that a written binary edge list is loaded as the same graph.
+ */
+TEST(CsrGraphLoadingTests, binaryEdgeListTest) {
+    std::vector<CsrGraphEdge> edges = {{0, 1, 1.0}, {1, 0, 1.0}, {1, 4, 2.5}, {4, 2, 0.25}};
+    std::string path = getTestFilePath(TEST_NAME, "edges.bin");
+    ASSERT_TRUE(writeBinaryEdgeList(edges, path));
+
+    std::optional<CsrGraph> graph = loadBinaryEdgeList(path);
+    ASSERT_TRUE(graph.has_value());
+    ASSERT_EQ(graph->getNumVertices(), 5u);
+    assertSameGraph(*graph, CsrGraph(5, edges));
+
+    std::optional<CsrGraph> larger_graph = loadBinaryEdgeList(path, 7);
+    ASSERT_TRUE(larger_graph.has_value());
+    ASSERT_EQ(larger_graph->getNumVertices(), 7u);
+    ASSERT_EQ(loadBinaryEdgeList(path, 3), std::nullopt);
+
+    std::string partial_path = writeTestFile("partial_edges.bin", "12345");
+    ASSERT_EQ(loadBinaryEdgeList(partial_path), std::nullopt);
+}
+
+/**
+ * Tests that the cache is used when it matches the source file, and rewritten when the source file changes.
+ */
+TEST(CsrGraphLoadingTests, cacheTest) {
+    std::string path = writeTestFile("cached.gr", "p sp 3 2\na 1 2 1\na 2 3 2\n");
+    std::string cache_path = getTestFilePath(TEST_NAME, "cached.gr.cache");
+    int num_loads = 0;
+    auto loader = [&num_loads](const std::string& file_name) {
+        num_loads++;
+        return loadDimacsGraph(file_name);
+    };
+
+    std::optional<CsrGraph> graph = loadCsrGraphWithCache(path, cache_path, loader);
+    ASSERT_TRUE(graph.has_value());
+    ASSERT_EQ(num_loads, 1);
+    ASSERT_TRUE(std::filesystem::exists(cache_path));
+
+    std::optional<CsrGraph> cached_graph = loadCsrGraphWithCache(path, cache_path, loader);
+    ASSERT_TRUE(cached_graph.has_value());
+    ASSERT_EQ(num_loads, 1);
+    assertSameGraph(*graph, *cached_graph);
+
+    writeTestFile("cached.gr", "p sp 3 3\na 1 2 1\na 2 3 2\na 3 1 4\n");
+    std::optional<CsrGraph> changed_graph = loadCsrGraphWithCache(path, cache_path, loader);
+    ASSERT_TRUE(changed_graph.has_value());
+    ASSERT_EQ(num_loads, 2);
+    ASSERT_EQ(changed_graph->getNumEdges(), 3u);
+
+    std::ofstream(cache_path, std::ios::binary) << "not a cache";
+    std::optional<CsrGraph> recovered_graph = loadCsrGraphWithCache(path, cache_path, loader);
+    ASSERT_TRUE(recovered_graph.has_value());
+    ASSERT_EQ(num_loads, 3);
+    assertSameGraph(*changed_graph, *recovered_graph);
+
+    ASSERT_EQ(loadCsrGraphWithCache(getTestFilePath(TEST_NAME, "missing.gr"), cache_path, loader), std::nullopt);
+}
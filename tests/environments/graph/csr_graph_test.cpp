@@ -0,0 +1,119 @@
+#include <gtest/gtest.h>
+
+#include "environments/graph/csr_graph.h"
+#include "environments/graph/graph.h"
+
+#include <optional>
+#include <sstream>
+#include <string>
+#include <vector>
+
+/**
+ * Tests that a graph built from an edge list stores the edges out of each vertex contiguously, sorted by to vertex.
+ */
+TEST(CsrGraphTests, edgeListTest) {
+    std::vector<CsrGraphEdge> edges = {{2, 0, 4.0}, {0, 2, 1.0}, {0, 1, 2.0}, {1, 2, 3.0}, {0, 3, 5.0}};
+    CsrGraph graph(4, edges);
+
+    ASSERT_EQ(graph.getNumVertices(), 4u);
+    ASSERT_EQ(graph.getNumEdges(), 5u);
+    ASSERT_FALSE(graph.hasLabels());
+    ASSERT_EQ(graph.getEdgeOffsets(), (std::vector<CsrEdgeID>{0, 3, 4, 5, 5}));
+    ASSERT_EQ(graph.getEdgeTargets(), (std::vector<CsrVertexID>{1, 2, 3, 2, 0}));
+    ASSERT_EQ(graph.getEdgeCosts(), (std::vector<double>{2.0, 1.0, 5.0, 3.0, 4.0}));
+
+    ASSERT_EQ(graph.getOutEdges(0).size(), 3u);
+    ASSERT_EQ(graph.getOutEdges(3).size(), 0u);
+    std::vector<CsrVertexID> targets;
+    for (CsrEdgeID edge_id : graph.getOutEdges(0)) {
+        targets.push_back(graph.getEdgeTarget(edge_id));
+    }
+    ASSERT_EQ(targets, (std::vector<CsrVertexID>{1, 2, 3}));
+
+    ASSERT_EQ(graph.findEdge(0, 2), std::optional<CsrEdgeID>(1));
+    ASSERT_EQ(graph.findEdge(2, 0), std::optional<CsrEdgeID>(4));
+    ASSERT_EQ(graph.findEdge(2, 1), std::nullopt);
+    ASSERT_EQ(graph.findEdge(3, 0), std::nullopt);
+    ASSERT_EQ(graph.findVertex("a"), std::nullopt);
+}
+
+/**
+ * Tests that the inverse of an edge is only set when there is an edge in the opposite direction.
+ */
+TEST(CsrGraphTests, inverseEdgeTest) {
+    std::vector<CsrGraphEdge> edges = {{0, 1, 1.0}, {1, 0, 1.0}, {1, 2, 1.0}, {2, 2, 1.0}};
+    CsrGraph graph(3, edges);
+
+    ASSERT_EQ(graph.getInverseEdge(*graph.findEdge(0, 1)), graph.findEdge(1, 0));
+    ASSERT_EQ(graph.getInverseEdge(*graph.findEdge(1, 0)), graph.findEdge(0, 1));
+    ASSERT_EQ(graph.getInverseEdge(*graph.findEdge(1, 2)), std::nullopt);
+    ASSERT_EQ(graph.getInverseEdge(*graph.findEdge(2, 2)), std::nullopt);
+}
+
+/**
+ * Tests that a graph built from a Graph keeps its vertex IDs, edges, and labels.
+ */
+TEST(CsrGraphTests, fromGraphTest) {
+    Graph base_graph;
+    base_graph.addEdge("a", "d", 15);
+    base_graph.addEdge("a", "b", 1);
+    base_graph.addEdge("a", "c", 5);
+    base_graph.addEdge("b", "c", 2, "b_to_c");
+    base_graph.addEdge("b", "a", 100);
+    base_graph.addEdge("c", "d", 3);
+
+    CsrGraph graph(base_graph);
+    ASSERT_EQ(graph.getNumVertices(), base_graph.getNumVertices());
+    ASSERT_EQ(graph.getNumEdges(), base_graph.getNumEdges());
+    ASSERT_TRUE(graph.hasLabels());
+
+    for (EdgeID edge_id = 0; edge_id < base_graph.getNumEdges(); ++edge_id) {
+        const Edge& edge = base_graph.getEdgeByID(edge_id);
+        std::optional<CsrEdgeID> csr_edge = graph.findEdge(static_cast<CsrVertexID>(edge.m_from_vertex_id),
+                  static_cast<CsrVertexID>(edge.m_to_vertex_id));
+        ASSERT_TRUE(csr_edge.has_value());
+        ASSERT_EQ(graph.getEdgeCost(*csr_edge), edge.m_cost);
+        ASSERT_EQ(graph.getEdgeLabel(*csr_edge), edge.m_label);
+        ASSERT_EQ(graph.getInverseEdge(*csr_edge).has_value(), edge.m_inverse_id != edge.m_edge_id);
+    }
+
+    ASSERT_EQ(graph.findVertex("c"), std::optional<CsrVertexID>(static_cast<CsrVertexID>(base_graph.getVertexID("c"))));
+    ASSERT_EQ(graph.getVertexLabel(*graph.findVertex("c")), "c");
+    ASSERT_EQ(graph.findVertex("e"), std::nullopt);
+    ASSERT_EQ(graph.getEdgeLabel(*graph.findEdge(*graph.findVertex("b"), *graph.findVertex("c"))), "b_to_c");
+
+    CsrGraph unlabelled_graph(base_graph, false);
+    ASSERT_FALSE(unlabelled_graph.hasLabels());
+    ASSERT_EQ(unlabelled_graph.getEdgeTargets(), graph.getEdgeTargets());
+    ASSERT_EQ(unlabelled_graph.findVertex("c"), std::nullopt);
+}
+
+/**
+ * Tests that a saved graph is loaded with the same edges and inverses, and that bad input leaves the graph empty.
+ */
+TEST(CsrGraphTests, saveAndLoadTest) {
+    std::vector<CsrGraphEdge> edges = {{0, 1, 1.5}, {1, 0, 2.5}, {1, 2, 3.0}, {3, 1, 0.5}};
+    CsrGraph graph(4, edges);
+    std::stringstream saved;
+    ASSERT_TRUE(graph.save(saved));
+
+    CsrGraph loaded;
+    ASSERT_TRUE(loaded.load(saved));
+    ASSERT_EQ(loaded.getNumVertices(), 4u);
+    ASSERT_EQ(loaded.getEdgeOffsets(), graph.getEdgeOffsets());
+    ASSERT_EQ(loaded.getEdgeTargets(), graph.getEdgeTargets());
+    ASSERT_EQ(loaded.getEdgeCosts(), graph.getEdgeCosts());
+    ASSERT_EQ(loaded.getInverseEdge(*loaded.findEdge(0, 1)), loaded.findEdge(1, 0));
+    ASSERT_EQ(loaded.getInverseEdge(*loaded.findEdge(3, 1)), std::nullopt);
+
+    std::string truncated = saved.str().substr(0, saved.str().size() - 4);
+    std::stringstream truncated_stream(truncated);
+    ASSERT_FALSE(loaded.load(truncated_stream));
+    ASSERT_EQ(loaded.getNumVertices(), 0u);
+    ASSERT_EQ(loaded.getNumEdges(), 0u);
+
+    std::stringstream empty_saved;
+    ASSERT_TRUE(CsrGraph().save(empty_saved));
+    ASSERT_TRUE(loaded.load(empty_saved));
+    ASSERT_EQ(loaded.getNumVertices(), 0u);
+}
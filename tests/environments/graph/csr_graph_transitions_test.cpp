@@ -0,0 +1,163 @@
+#include <gtest/gtest.h>
+
+#include "building_tools/evaluators/constant_heuristic.h"
+#include "building_tools/goal_tests/single_state_goal_test.h"
+#include "engines/best_first_search/best_first_search.h"
+#include "engines/engine_components/eval_functions/f_cost_evaluator.h"
+#include "environments/graph/csr_graph.h"
+#include "environments/graph/csr_graph_action.h"
+#include "environments/graph/csr_graph_state.h"
+#include "environments/graph/csr_graph_transitions.h"
+#include "environments/graph/csr_vertex_hash_function.h"
+#include "environments/graph/graph.h"
+#include "environments/graph/graph_action.h"
+#include "environments/graph/graph_state.h"
+#include "environments/graph/graph_transitions.h"
+#include "environments/graph/vertex_hash_function.h"
+#include "utils/plan_and_path_utils.h"
+
+#include <cstddef>
+#include <optional>
+#include <random>
+#include <string>
+#include <vector>
+
+/**
+ * Creates a fixture with a test graph and transitions based on it.
+ *
+ * @class CsrGraphTransitionsTests
+ */
+class CsrGraphTransitionsTests : public ::testing::Test {
+protected:
+    void SetUp() override {
+        base_graph.addEdge("a", "b", 1);
+        base_graph.addEdge("a", "c", 5);
+        base_graph.addEdge("a", "d", 15);
+        base_graph.addEdge("b", "c", 2);
+        base_graph.addEdge("b", "a", 100);
+        base_graph.addEdge("c", "d", 3);
+        graph = CsrGraph(base_graph);
+    }
+
+    /**
+     * Gets the state for the vertex with the given label.
+     */
+    CsrGraphState getState(const std::string& label) const { return {graph.findVertex(label).value()}; }
+
+    /**
+     * Gets the action for the edge between the vertices with the given labels.
+     */
+    CsrGraphAction getAction(const std::string& from_label, const std::string& to_label) const {
+        return {graph.findEdge(getState(from_label).m_vertex_id, getState(to_label).m_vertex_id).value()};
+    }
+
+public:
+    Graph base_graph;  ///< The graph the CSR graph is built from
+    CsrGraph graph;  ///< The graph for the tests
+    CsrGraphTransitions transitions = CsrGraphTransitions(graph);  ///< The transitions for the tests
+};
+
+/**
+ * Tests that the applicable actions, their costs, and their results match the graph.
+ */
+TEST_F(CsrGraphTransitionsTests, actionsTest) {
+    CsrGraphState state_a = getState("a");
+    std::vector<CsrGraphAction> actions = transitions.getActions(state_a);
+    ASSERT_EQ(actions.size(), 3u);
+    ASSERT_EQ(transitions.getOutEdges(state_a).size(), 3u);
+
+    std::size_t action_index = 0;
+    for (CsrEdgeID edge_id : transitions.getOutEdges(state_a)) {
+        ASSERT_EQ(actions[action_index++].m_edge_id, edge_id);
+    }
+
+    ASSERT_TRUE(transitions.isApplicable(state_a, getAction("a", "c")));
+    ASSERT_FALSE(transitions.isApplicable(state_a, getAction("b", "c")));
+    ASSERT_EQ(transitions.getActionCost(state_a, getAction("a", "d")), 15.0);
+    ASSERT_TRUE(transitions.getActions(getState("d")).empty());
+
+    CsrGraphState state = state_a;
+    transitions.applyAction(state, getAction("a", "b"));
+    ASSERT_EQ(state, getState("b"));
+    transitions.applyAction(state, getAction("b", "c"));
+    ASSERT_EQ(state, getState("c"));
+}
+
+/**
+ * Tests that inverse actions are only given for edges with an edge in the other direction.
+ */
+TEST_F(CsrGraphTransitionsTests, inverseTest) {
+    ASSERT_EQ(transitions.getInverse(getState("a"), getAction("a", "b")), std::optional<CsrGraphAction>(getAction("b", "a")));
+    ASSERT_EQ(transitions.getInverse(getState("b"), getAction("b", "a")), std::optional<CsrGraphAction>(getAction("a", "b")));
+    ASSERT_EQ(transitions.getInverse(getState("a"), getAction("a", "c")), std::nullopt);
+}
+
+/**
+ * Tests that states are only valid if they are vertices in the graph.
+ */
+TEST_F(CsrGraphTransitionsTests, isValidStateTest) {
+    ASSERT_TRUE(transitions.isValidState(getState("d")));
+    ASSERT_FALSE(transitions.isValidState({4}));
+    ASSERT_EQ(sizeof(CsrGraphState), 4u);
+}
+
+/**
+ * Tests that uniform cost search finds plans with the same cost on a random graph as a Graph and as a CsrGraph.
+ */
+TEST(CsrGraphSearchTests, matchesGraphSearchTest) {
+    std::mt19937 rand_gen(79);
+    const int num_vertices = 200;
+    std::uniform_int_distribution<int> vertex_dist(0, num_vertices - 1);
+    std::uniform_int_distribution<int> cost_dist(1, 20);
+
+    Graph base_graph;
+    for (int vertex = 0; vertex < num_vertices; ++vertex) {
+        base_graph.addVertex(std::to_string(vertex));
+    }
+    for (int edge = 0; edge < 4 * num_vertices; ++edge) {
+        base_graph.addEdge(std::to_string(vertex_dist(rand_gen)), std::to_string(vertex_dist(rand_gen)), cost_dist(rand_gen));
+    }
+    CsrGraph graph(base_graph, false);
+
+    GraphTransitions graph_transitions(base_graph);
+    VertexHashFunction graph_hash_function;
+    ConstantHeuristic<GraphState, GraphAction> graph_heuristic;
+    FCostEvaluator<GraphState, GraphAction> graph_f_cost(graph_heuristic);
+    BestFirstSearchParams params;
+    BestFirstSearch<GraphState, GraphAction, uint32_t> graph_engine(params);
+    graph_engine.setEvaluator(graph_f_cost);
+    graph_engine.setTransitionSystem(graph_transitions);
+    graph_engine.setHashFunction(graph_hash_function);
+
+    CsrGraphTransitions csr_transitions(graph);
+    CsrVertexHashFunction csr_hash_function;
+    ConstantHeuristic<CsrGraphState, CsrGraphAction> csr_heuristic;
+    FCostEvaluator<CsrGraphState, CsrGraphAction> csr_f_cost(csr_heuristic);
+    BestFirstSearch<CsrGraphState, CsrGraphAction, uint32_t> csr_engine(params);
+    csr_engine.setEvaluator(csr_f_cost);
+    csr_engine.setTransitionSystem(csr_transitions);
+    csr_engine.setHashFunction(csr_hash_function);
+
+    int num_solved = 0;
+    for (int trial = 0; trial < 30; ++trial) {
+        auto start = static_cast<CsrVertexID>(vertex_dist(rand_gen));
+        auto goal = static_cast<CsrVertexID>(vertex_dist(rand_gen));
+
+        SingleStateGoalTest<GraphState> graph_goal_test({goal, &base_graph});
+        graph_engine.setGoalTest(graph_goal_test);
+        graph_engine.searchForPlan({start, &base_graph});
+
+        SingleStateGoalTest<CsrGraphState> csr_goal_test({goal});
+        csr_engine.setGoalTest(csr_goal_test);
+        csr_engine.searchForPlan({start});
+
+        ASSERT_EQ(csr_engine.hasFoundSolution(), graph_engine.hasFoundSolution());
+        ASSERT_EQ(csr_engine.getLastSolutionPlanCost(), graph_engine.getLastSolutionPlanCost());
+        if (csr_engine.hasFoundSolution()) {
+            num_solved++;
+            ASSERT_TRUE(checkSolutionPlan(CsrGraphState{start}, csr_engine.getLastSolutionPlan(), csr_transitions,
+                      csr_goal_test).m_is_valid);
+        }
+    }
+    ASSERT_GT(num_solved, 0);
+}
@@ -0,0 +1,207 @@
+#include <gtest/gtest.h>
+
+#include "building_tools/goal_tests/single_state_goal_test.h"
+#include "environments/grid_pathfinding/grid_cluster_abstraction.h"
+#include "environments/grid_pathfinding/grid_location.h"
+#include "environments/grid_pathfinding/grid_location_hash_function.h"
+#include "environments/grid_pathfinding/grid_map.h"
+#include "environments/grid_pathfinding/grid_pathfinding_action.h"
+#include "environments/grid_pathfinding/grid_pathfinding_octile_heuristic.h"
+#include "environments/grid_pathfinding/grid_pathfinding_transitions.h"
+#include "test_helpers.h"
+#include "utils/floating_point_utils.h"
+#include "utils/plan_and_path_utils.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+/**
+ * Tests the abstract graph built for an open map, and that a query on it is refined into a valid plan.
+ */
+TEST(GridClusterAbstractionTests, openMapTest) {
+    GridMap map(8, 8);
+    GridPathfindingTransitions transitions(&map, GridConnectionType::eight);
+    GridClusterAbstraction abstraction(transitions, 4);
+    ASSERT_EQ(abstraction.getNumVertices(), 0u);
+
+    abstraction.build();
+    ASSERT_EQ(abstraction.getNumClusters(), 4u);
+    ASSERT_EQ(abstraction.getClusterSize(), 4);
+
+    // Each of the four borders has a single transition in its middle, with two vertices
+    ASSERT_EQ(abstraction.getNumVertices(), 8u);
+    ASSERT_EQ(abstraction.getVertexLocation(0), GridLocation(3, 1));
+    ASSERT_EQ(abstraction.getVertexLocation(1), GridLocation(4, 1));
+
+    // Two edges per transition, and two edges between the two vertices in each cluster
+    ASSERT_EQ(abstraction.getNumEdges(), 16u);
+
+    GridLocation start(0, 0);
+    GridLocation goal(7, 7);
+    GridAbstractPath path = abstraction.findAbstractPath(start, goal);
+    ASSERT_TRUE(path.m_found_path);
+    ASSERT_EQ(path.m_waypoints.front(), start);
+    ASSERT_EQ(path.m_waypoints.back(), goal);
+    ASSERT_FALSE(fpLess(path.m_cost, 7 * ROOT_TWO));
+
+    SingleStateGoalTest<GridLocation> goal_test(goal);
+    auto check_result = checkSolutionPlan(start, abstraction.refinePath(path), transitions, goal_test);
+    ASSERT_TRUE(check_result.m_is_valid);
+    ASSERT_NEAR(check_result.m_sequence_cost, path.m_cost, 1e-9);
+
+    // Queries in a single cluster can use a direct path
+    GridAbstractPath local_path = abstraction.findAbstractPath(GridLocation(0, 0), GridLocation(2, 2));
+    ASSERT_TRUE(local_path.m_found_path);
+    ASSERT_NEAR(local_path.m_cost, 2 * ROOT_TWO, 1e-9);
+    ASSERT_EQ(local_path.m_waypoints.size(), 2u);
+
+    GridAbstractPath same_path = abstraction.findAbstractPath(start, start);
+    ASSERT_TRUE(same_path.m_found_path);
+    ASSERT_EQ(same_path.m_cost, 0.0);
+    ASSERT_TRUE(abstraction.refinePath(same_path).empty());
+}
+
+/**
+ * Tests that on random maps, paths are found exactly when A* finds one, cost no less than the A* path, and refine into
+ * valid plans with the same cost as the abstract path.
+ */
+TEST(GridClusterAbstractionTests, randomMapTest) {
+    std::mt19937 rand_gen(67);
+    const int map_size = 48;
+
+    for (GridConnectionType connection_type : {GridConnectionType::four, GridConnectionType::eight}) {
+        GridMap map = createRandomMap(map_size, 0.25, rand_gen);
+        GridPathfindingTransitions transitions(&map, connection_type);
+        GridLocationHashFunction hash_function;
+        hash_function.setMapWidth(transitions);
+        GridClusterAbstraction abstraction(transitions, 8);
+        abstraction.build();
+
+        std::vector<GridLocation> open_locations = getOpenLocations(map);
+        std::uniform_int_distribution<std::size_t> location_dist(0, open_locations.size() - 1);
+        int num_solved = 0;
+        for (int trial = 0; trial < 40; ++trial) {
+            GridLocation start = open_locations[location_dist(rand_gen)];
+            GridLocation goal = open_locations[location_dist(rand_gen)];
+            SingleStateGoalTest<GridLocation> goal_test(goal);
+            GridPathfindingOctileHeuristic a_star_heuristic(goal);
+            double a_star_cost = getAStarCost(start, transitions, goal_test, a_star_heuristic, hash_function);
+
+            GridAbstractPath path = abstraction.findAbstractPath(start, goal);
+            ASSERT_EQ(path.m_found_path, a_star_cost >= 0.0);
+            if (!path.m_found_path) {
+                continue;
+            }
+            num_solved++;
+            ASSERT_FALSE(fpLess(path.m_cost, a_star_cost));
+
+            // Refining one segment at a time gives the same plan as refining all of it
+            std::vector<GridDirection> plan;
+            for (std::size_t segment = 0; segment + 1 < path.m_waypoints.size(); ++segment) {
+                std::vector<GridDirection> segment_plan = abstraction.refineSegment(path, segment);
+                plan.insert(plan.end(), segment_plan.begin(), segment_plan.end());
+            }
+            ASSERT_EQ(plan, abstraction.refinePath(path));
+
+            auto check_result = checkSolutionPlan(start, plan, transitions, goal_test);
+            ASSERT_TRUE(check_result.m_is_valid);
+            ASSERT_NEAR(check_result.m_sequence_cost, path.m_cost, 1e-9);
+        }
+        ASSERT_GT(num_solved, 0);
+    }
+}
+
+/**
+ * Tests that building with several threads gives the same graph as building with one.
+ */
+TEST(GridClusterAbstractionTests, parallelBuildTest) {
+    std::mt19937 rand_gen(71);
+    GridMap map = createRandomMap(64, 0.2, rand_gen);
+    GridPathfindingTransitions transitions(&map, GridConnectionType::eight);
+
+    GridClusterAbstraction serial_abstraction(transitions, 8);
+    serial_abstraction.build(1);
+    GridClusterAbstraction parallel_abstraction(transitions, 8);
+    parallel_abstraction.build(4);
+
+    ASSERT_EQ(serial_abstraction.getNumVertices(), parallel_abstraction.getNumVertices());
+    ASSERT_EQ(serial_abstraction.getNumEdges(), parallel_abstraction.getNumEdges());
+
+    std::ostringstream serial_out;
+    std::ostringstream parallel_out;
+    ASSERT_TRUE(serial_abstraction.save(serial_out));
+    ASSERT_TRUE(parallel_abstraction.save(parallel_out));
+    ASSERT_EQ(serial_out.str(), parallel_out.str());
+}
+
+/**
+ * Tests that a saved abstraction loads back to give the same queries, and cannot be loaded with a different cluster
+ * size or for a different map.
+ */
+TEST(GridClusterAbstractionTests, saveAndLoadTest) {
+    std::mt19937 rand_gen(73);
+    GridMap map = createRandomMap(40, 0.2, rand_gen);
+    GridPathfindingTransitions transitions(&map, GridConnectionType::eight);
+    GridClusterAbstraction abstraction(transitions, 10);
+    abstraction.build();
+
+    std::stringstream saved(std::ios::in | std::ios::out | std::ios::binary);
+    ASSERT_TRUE(abstraction.save(saved));
+
+    GridClusterAbstraction loaded(transitions, 10);
+    ASSERT_TRUE(loaded.load(saved));
+    ASSERT_EQ(loaded.getNumClusters(), abstraction.getNumClusters());
+    ASSERT_EQ(loaded.getNumVertices(), abstraction.getNumVertices());
+    ASSERT_EQ(loaded.getNumEdges(), abstraction.getNumEdges());
+
+    std::vector<GridLocation> open_locations = getOpenLocations(map);
+    std::uniform_int_distribution<std::size_t> location_dist(0, open_locations.size() - 1);
+    for (int trial = 0; trial < 20; ++trial) {
+        GridLocation start = open_locations[location_dist(rand_gen)];
+        GridLocation goal = open_locations[location_dist(rand_gen)];
+        GridAbstractPath path = abstraction.findAbstractPath(start, goal);
+        GridAbstractPath loaded_path = loaded.findAbstractPath(start, goal);
+        ASSERT_EQ(path.m_found_path, loaded_path.m_found_path);
+        ASSERT_EQ(path.m_cost, loaded_path.m_cost);
+        ASSERT_EQ(path.m_waypoints, loaded_path.m_waypoints);
+    }
+
+    std::istringstream wrong_size_in(saved.str());
+    GridClusterAbstraction wrong_size(transitions, 8);
+    ASSERT_FALSE(wrong_size.load(wrong_size_in));
+    ASSERT_EQ(wrong_size.getNumVertices(), 0u);
+
+    GridMap other_map(41, 40);
+    GridPathfindingTransitions other_transitions(&other_map, GridConnectionType::eight);
+    std::istringstream wrong_map_in(saved.str());
+    GridClusterAbstraction wrong_map(other_transitions, 10);
+    ASSERT_FALSE(wrong_map.load(wrong_map_in));
+
+    std::istringstream truncated_in(saved.str().substr(0, saved.str().size() / 2));
+    GridClusterAbstraction truncated(transitions, 10);
+    ASSERT_FALSE(truncated.load(truncated_in));
+    ASSERT_FALSE(truncated.findAbstractPath(open_locations.front(), open_locations.back()).m_found_path);
+
+    // Swaps the second and third edge offsets, which follow the header and the vertex coordinates
+    std::string corrupt_str = saved.str();
+    std::size_t header_size = sizeof(uint64_t) + 3 * sizeof(int32_t) + sizeof(uint8_t);
+    std::size_t coordinates_size = sizeof(uint64_t) + 2 * abstraction.getNumVertices() * sizeof(int32_t);
+    std::size_t offsets_start = header_size + coordinates_size + sizeof(uint64_t);
+    uint64_t first_offset = 0;
+    uint64_t second_offset = 0;
+    std::memcpy(&first_offset, &corrupt_str[offsets_start + sizeof(uint64_t)], sizeof(uint64_t));
+    std::memcpy(&second_offset, &corrupt_str[offsets_start + 2 * sizeof(uint64_t)], sizeof(uint64_t));
+    ASSERT_LT(first_offset, second_offset);
+    std::memcpy(&corrupt_str[offsets_start + sizeof(uint64_t)], &second_offset, sizeof(uint64_t));
+    std::memcpy(&corrupt_str[offsets_start + 2 * sizeof(uint64_t)], &first_offset, sizeof(uint64_t));
+    std::istringstream corrupt_in(corrupt_str);
+    GridClusterAbstraction corrupt(transitions, 10);
+    ASSERT_THROW(corrupt.load(corrupt_in), std::runtime_error);
+    ASSERT_EQ(corrupt.getNumVertices(), 0u);
+}
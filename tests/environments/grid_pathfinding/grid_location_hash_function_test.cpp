@@ -51,6 +51,23 @@ TEST(GridLocationHashFunctionTests, getHashValueSetWidthWithTransitionsTest) {
     ASSERT_EQ(hasher.getHashValue(GridLocation(3, 3)), 15u);
 }
 
+/**
+ * Tests that unrank recovers the location with the given hash value.
+ */
+TEST(GridLocationHashFunctionTests, unrankTest) {
+    GridLocationHashFunction hasher;
+    hasher.setMapWidth(4);
+    ASSERT_TRUE(hasher.isInvertible());
+
+    GridLocation location;
+    for (uint32_t hash_value = 0; hash_value < 16; hash_value++) {
+        hasher.unrank(hash_value, location);
+        ASSERT_EQ(hasher.getHashValue(location), hash_value);
+    }
+    hasher.unrank(6, location);
+    ASSERT_EQ(location, GridLocation(2, 1));
+}
+
 /**
  * Tests that isPerfectHashFunction always returns true.
  */
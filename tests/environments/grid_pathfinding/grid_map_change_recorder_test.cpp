@@ -0,0 +1,57 @@
+#include <gtest/gtest.h>
+
+#include "environments/grid_pathfinding/grid_location.h"
+#include "environments/grid_pathfinding/grid_map.h"
+#include "environments/grid_pathfinding/grid_map_change_recorder.h"
+
+#include <algorithm>
+#include <vector>
+
+/**
+ * Tests that a change records the changed location and its neighbours in the map, each once, until cleared.
+ */
+TEST(GridMapChangeRecorderTests, affectedLocationsTest) {
+    GridMap grid(5, 4);
+    GridMapChangeRecorder recorder(grid);
+    ASSERT_TRUE(recorder.getAffectedLocations().empty());
+
+    grid.setLocationType(0, 0, GridLocationType::obstacle);
+    ASSERT_EQ(recorder.getNumChanges(), 1);
+    ASSERT_EQ(recorder.getAffectedLocations().size(), 4u);
+
+    // Overlapping neighbourhoods only record each location once
+    grid.setLocationType(1, 1, GridLocationType::obstacle);
+    ASSERT_EQ(recorder.getNumChanges(), 2);
+    ASSERT_EQ(recorder.getAffectedLocations().size(), 9u);
+    const std::vector<GridLocation>& affected = recorder.getAffectedLocations();
+    for (int y = 0; y <= 2; ++y) {
+        for (int x = 0; x <= 2; ++x) {
+            ASSERT_NE(std::find(affected.begin(), affected.end(), GridLocation(x, y)), affected.end());
+        }
+    }
+
+    // Unchanged types are not recorded
+    grid.setLocationType(1, 1, GridLocationType::obstacle);
+    ASSERT_EQ(recorder.getNumChanges(), 2);
+
+    recorder.clearChanges();
+    ASSERT_EQ(recorder.getNumChanges(), 0);
+    ASSERT_TRUE(recorder.getAffectedLocations().empty());
+
+    grid.setLocationType(4, 3, GridLocationType::tree);
+    ASSERT_EQ(recorder.getAffectedLocations().size(), 4u);
+}
+
+/**
+ * Tests that the recorder stops recording changes once destroyed.
+ */
+TEST(GridMapChangeRecorderTests, removedOnDestructionTest) {
+    GridMap grid(3, 3);
+    {
+        GridMapChangeRecorder recorder(grid);
+        grid.setLocationType(1, 1, GridLocationType::obstacle);
+        ASSERT_EQ(recorder.getAffectedLocations().size(), 9u);
+    }
+    grid.setLocationType(1, 1, GridLocationType::passable);
+    ASSERT_EQ(grid.getLocationType(1, 1), GridLocationType::passable);
+}
@@ -1,6 +1,29 @@
 #include <gtest/gtest.h>
 
 #include "environments/grid_pathfinding/grid_map.h"
+#include "environments/grid_pathfinding/grid_map_listener.h"
+
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * A listener that stores the location type changes it is notified of.
+ */
+class ChangeStoringListener : public GridMapListener {
+public:
+    void onLocationTypeChanged(int x_coord, int y_coord, GridLocationType old_type, GridLocationType new_type) override {
+        m_x_coords.push_back(x_coord);
+        m_y_coords.push_back(y_coord);
+        m_old_types.push_back(old_type);
+        m_new_types.push_back(new_type);
+    }
+
+    std::vector<int> m_x_coords;  ///< The x coordinates of the changes
+    std::vector<int> m_y_coords;  ///< The y coordinates of the changes
+    std::vector<GridLocationType> m_old_types;  ///< The types before the changes
+    std::vector<GridLocationType> m_new_types;  ///< The types after the changes
+};
 
 /**
  * Checks that if we create a map with no locations, the expected behaviour occurs
@@ -224,4 +247,99 @@ TEST(GridMapTests, canMoveTest) {
     ASSERT_TRUE(grid.canMoveWest(2, 2));
     ASSERT_FALSE(grid.canMoveNorthWest(2, 2, true));  // blocked by obstacle to north
     ASSERT_TRUE(grid.canMoveNorthWest(2, 2, false));  // Check that ignore works correctly
-}
\ No newline at end of file
+}
+
+/**
+ * Tests that location types can be changed, and that listeners are notified only of actual changes while added.
+ */
+TEST(GridMapTests, setLocationTypeTest) {
+    GridMap grid(4, 3);
+    ChangeStoringListener listener;
+    grid.addListener(listener);
+
+    grid.setLocationType(2, 1, GridLocationType::obstacle);
+    ASSERT_EQ(grid.getLocationType(2, 1), GridLocationType::obstacle);
+    ASSERT_FALSE(grid.canOccupyLocation(2, 1));
+    ASSERT_FALSE(grid.canMoveEast(1, 1));
+
+    // Setting the same type is not a change
+    grid.setLocationType(2, 1, GridLocationType::obstacle);
+    grid.setLocationType(0, 2, GridLocationType::water);
+
+    ASSERT_EQ(listener.m_x_coords, std::vector<int>({2, 0}));
+    ASSERT_EQ(listener.m_y_coords, std::vector<int>({1, 2}));
+    ASSERT_EQ(listener.m_old_types, std::vector<GridLocationType>({GridLocationType::passable, GridLocationType::passable}));
+    ASSERT_EQ(listener.m_new_types, std::vector<GridLocationType>({GridLocationType::obstacle, GridLocationType::water}));
+
+    grid.removeListener(listener);
+    grid.setLocationType(2, 1, GridLocationType::passable);
+    ASSERT_EQ(grid.getLocationType(2, 1), GridLocationType::passable);
+    ASSERT_TRUE(grid.canMoveEast(1, 1));
+    ASSERT_EQ(listener.m_x_coords.size(), 2u);
+}
+
+/**
+ * Tests that copying a map copies its locations but not its listeners, and that changes to the copy are not seen by
+ * the listeners of the original.
+ */
+TEST(GridMapTests, copyTest) {
+    GridMap grid(4, 3);
+    grid.setLocationType(1, 1, GridLocationType::obstacle);
+    ChangeStoringListener listener;
+    grid.addListener(listener);
+
+    GridMap copy(grid);
+    ASSERT_EQ(copy.getWidth(), 4);
+    ASSERT_EQ(copy.getHeight(), 3);
+    ASSERT_EQ(copy.getLocationType(1, 1), GridLocationType::obstacle);
+    copy.setLocationType(2, 2, GridLocationType::obstacle);
+    ASSERT_EQ(grid.getLocationType(2, 2), GridLocationType::passable);
+    ASSERT_TRUE(listener.m_x_coords.empty());
+
+    ChangeStoringListener copy_listener;
+    copy.addListener(copy_listener);
+    copy = GridMap(2, 2);
+    ASSERT_EQ(copy.getWidth(), 2);
+    ASSERT_EQ(copy.getLocationType(1, 1), GridLocationType::passable);
+    copy.setLocationType(1, 1, GridLocationType::obstacle);
+    ASSERT_EQ(copy_listener.m_x_coords, std::vector<int>({1}));
+    ASSERT_TRUE(listener.m_x_coords.empty());
+
+    grid.removeListener(listener);
+    copy.removeListener(copy_listener);
+}
+
+/**
+ * Tests that moving a map moves its locations but leaves its listeners with the moved-from map, and that a map moved
+ * into keeps its own listeners.
+ */
+TEST(GridMapTests, moveTest) {
+    static_assert(std::is_nothrow_move_constructible_v<GridMap> && std::is_nothrow_move_assignable_v<GridMap>);
+
+    GridMap grid(4, 3);
+    grid.setLocationType(1, 1, GridLocationType::obstacle);
+    ChangeStoringListener listener;
+    grid.addListener(listener);
+
+    GridMap moved(std::move(grid));
+    ASSERT_EQ(moved.getWidth(), 4);
+    ASSERT_EQ(moved.getHeight(), 3);
+    ASSERT_EQ(moved.getLocationType(1, 1), GridLocationType::obstacle);
+    moved.setLocationType(2, 2, GridLocationType::obstacle);
+    ASSERT_TRUE(listener.m_x_coords.empty());
+
+    ChangeStoringListener moved_listener;
+    moved.addListener(moved_listener);
+    GridMap other(2, 2);
+    other.setLocationType(0, 1, GridLocationType::obstacle);
+    moved = std::move(other);
+    ASSERT_EQ(moved.getWidth(), 2);
+    ASSERT_EQ(moved.getHeight(), 2);
+    ASSERT_EQ(moved.getLocationType(0, 1), GridLocationType::obstacle);
+    moved.setLocationType(1, 1, GridLocationType::obstacle);
+    ASSERT_EQ(moved_listener.m_x_coords, std::vector<int>({1}));
+    ASSERT_TRUE(listener.m_x_coords.empty());
+
+    grid.removeListener(listener);
+    moved.removeListener(moved_listener);
+}
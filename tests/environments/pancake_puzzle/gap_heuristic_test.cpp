@@ -1,10 +1,22 @@
 #include <gtest/gtest.h>
 
+#include "building_tools/goal_tests/single_state_goal_test.h"
+#include "engines/best_first_search/breadth_first_heuristic_search.h"
+#include "engines/best_first_search/external_a_star.h"
+#include "engines/engine_components/node_containers/node_list.h"
 #include "environments/pancake_puzzle/gap_heuristic.h"
+#include "environments/pancake_puzzle/pancake_hash_function.h"
 #include "environments/pancake_puzzle/pancake_names.h"
 #include "environments/pancake_puzzle/pancake_state.h"
+#include "environments/pancake_puzzle/pancake_transitions.h"
 #include "test_helpers.h"
 
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
 /**
  * Tests heuristic computation in GapHeuristic for some permutations. Expected values calculated by hand.
  */
@@ -83,4 +95,110 @@ TEST(GapHeuristicTests, getSettingsTest) {
     ASSERT_EQ(settings.m_main_settings.size(), 1);
     ASSERT_EQ(settings.m_main_settings[SETTING_COST_TYPE], COST_HEAVY);
     ASSERT_EQ(settings.m_sub_component_settings.size(), 0);
-}
\ No newline at end of file
+}
+
+/**
+ * Tests that incremental evaluation gives the same values as full evaluation for every child generated along a random
+ * walk, for both cost types.
+ */
+TEST(GapHeuristicTests, incrementalEvaluationTest) {
+    const int num_pancakes = 12;
+    std::mt19937 rand_gen(7);
+
+    for (auto cost_type : {PancakePuzzleCostType::unit, PancakePuzzleCostType::heavy}) {
+        PancakeTransitions transitions(num_pancakes, cost_type);
+        GapHeuristic full_heuristic(cost_type);
+        GapHeuristic incremental_heuristic(cost_type);
+        incremental_heuristic.setUseIncrementalEvaluation(true);
+
+        NodeList<PancakeState, NumToFlip> nodes;
+        full_heuristic.setNodeContainer(nodes);
+        incremental_heuristic.setNodeContainer(nodes);
+
+        std::vector<Pancake> perm(num_pancakes);
+        std::iota(perm.begin(), perm.end(), 0);
+        std::shuffle(perm.begin(), perm.end(), rand_gen);
+        NodeID parent_id = nodes.addNode(PancakeState(perm));
+        incremental_heuristic.prepareToEvaluate();
+        incremental_heuristic.evaluate(parent_id);
+
+        for (int step = 0; step < 100; ++step) {
+            PancakeState parent = nodes.getState(parent_id);
+            std::vector<NodeID> children;
+
+            for (NumToFlip action : transitions.getActions(parent)) {
+                PancakeState child = transitions.getChildState(parent, action);
+                NodeID child_id = nodes.addNode(child, parent_id, 0.0, action, 1.0);
+                children.push_back(child_id);
+
+                full_heuristic.prepareToEvaluate();
+                full_heuristic.evaluate(child_id);
+                incremental_heuristic.prepareToEvaluate();
+                incremental_heuristic.evaluate(child_id);
+
+                ASSERT_EQ(incremental_heuristic.getLastNodeEval(), full_heuristic.getLastNodeEval());
+                ASSERT_EQ(incremental_heuristic.getLastDistanceToGoEval(), full_heuristic.getLastDistanceToGoEval());
+            }
+            std::uniform_int_distribution<std::size_t> dist(0, children.size() - 1);
+            parent_id = children[dist(rand_gen)];
+        }
+    }
+}
+
+/**
+ * Tests that external A* and breadth-first heuristic search do the same search with incremental evaluation as without
+ * it. Both engines reuse node IDs for each batch of children, so the cached values of earlier nodes must not be used.
+ */
+TEST(GapHeuristicTests, incrementalEngineTest) {
+    const int num_pancakes = 8;
+    std::mt19937 rand_gen(3);
+    PancakeTransitions transitions(num_pancakes);
+    PancakeHashFunction hash_function;
+
+    std::vector<Pancake> goal_perm(num_pancakes);
+    std::iota(goal_perm.begin(), goal_perm.end(), 0);
+    SingleStateGoalTest<PancakeState> goal_test{PancakeState(goal_perm)};
+
+    for (int trial = 0; trial < 3; ++trial) {
+        std::vector<Pancake> perm = goal_perm;
+        std::shuffle(perm.begin(), perm.end(), rand_gen);
+        PancakeState init_state(perm);
+
+        std::vector<double> external_costs;
+        std::vector<std::string> external_expansions;
+        std::vector<double> bfhs_costs;
+        std::vector<int64_t> bfhs_evals;
+        for (bool use_incremental_evaluation : {false, true}) {
+            GapHeuristic heuristic;
+            heuristic.setUseIncrementalEvaluation(use_incremental_evaluation);
+
+            ExternalAStarParams external_params;
+            ExternalAStar<PancakeState, NumToFlip> external_a_star(external_params);
+            external_a_star.setHeuristic(heuristic);
+            external_a_star.setTransitionSystem(transitions);
+            external_a_star.setGoalTest(goal_test);
+            external_a_star.setHashFunction(hash_function);
+            external_a_star.searchForPlan(init_state);
+            ASSERT_TRUE(external_a_star.hasFoundSolution());
+            external_costs.push_back(external_a_star.getLastSolutionPlanCost());
+            external_expansions.push_back(external_a_star.getEngineSpecificStatistics().at("num_expansions"));
+
+            BreadthFirstHeuristicSearchParams bfhs_params;
+            BreadthFirstHeuristicSearch<PancakeState, NumToFlip, uint64_t> bfhs(bfhs_params);
+            bfhs.setHeuristic(heuristic);
+            bfhs.setTransitionSystem(transitions);
+            bfhs.setGoalTest(goal_test);
+            bfhs.setHashFunction(hash_function);
+            bfhs.searchForPlan(init_state);
+            ASSERT_TRUE(bfhs.hasFoundSolution());
+            bfhs_costs.push_back(bfhs.getLastSolutionPlanCost());
+            bfhs_evals.push_back(bfhs.getStandardEngineStatistics().m_num_evals);
+        }
+
+        ASSERT_DOUBLE_EQ(external_costs[0], external_costs[1]);
+        ASSERT_EQ(external_expansions[0], external_expansions[1]);
+        ASSERT_DOUBLE_EQ(bfhs_costs[0], bfhs_costs[1]);
+        ASSERT_DOUBLE_EQ(bfhs_costs[0], external_costs[0]);
+        ASSERT_EQ(bfhs_evals[0], bfhs_evals[1]);
+    }
+}
@@ -0,0 +1,69 @@
+#include <gtest/gtest.h>
+
+#include "engines/engine_components/node_containers/node_list.h"
+#include "environments/pancake_puzzle/gap_heuristic.h"
+#include "environments/pancake_puzzle/gap_operator_selection_function.h"
+#include "environments/pancake_puzzle/pancake_state.h"
+#include "environments/pancake_puzzle/pancake_transitions.h"
+#include "utils/floating_point_utils.h"
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <vector>
+
+/**
+ * Checks that the change in f-cost of every flip matches the flip cost plus the change in the gap heuristic, and that
+ * the actions are selected by their change in f-cost, for both cost types.
+ */
+TEST(GapOperatorSelectionFunctionTests, fCostChangeTest) {
+    const int num_pancakes = 12;
+    std::mt19937 rand_gen(7);
+
+    for (PancakePuzzleCostType cost_type : {PancakePuzzleCostType::unit, PancakePuzzleCostType::heavy}) {
+        PancakeTransitions transitions(num_pancakes, cost_type);
+        GapHeuristic heuristic(cost_type);
+        GapOperatorSelectionFunction op_selection(cost_type);
+
+        for (int trial = 0; trial < 20; ++trial) {
+            std::vector<Pancake> perm(num_pancakes);
+            std::iota(perm.begin(), perm.end(), 0);
+            std::shuffle(perm.begin(), perm.end(), rand_gen);
+            PancakeState state(perm);
+
+            NodeList<PancakeState, NumToFlip> nodes;
+            heuristic.setNodeContainer(nodes);
+            NodeID parent_id = nodes.addNode(state);
+            heuristic.prepareToEvaluate();
+            heuristic.evaluate(parent_id);
+
+            std::vector<double> changes;
+            for (NumToFlip action : transitions.getActions(state)) {
+                double cost = transitions.getActionCost(state, action);
+                NodeID child_id = nodes.addNode(transitions.getChildState(state, action), parent_id, cost, action, cost);
+                heuristic.prepareToEvaluate();
+                heuristic.evaluate(child_id);
+
+                double expected = cost + heuristic.getCachedEval(child_id) - heuristic.getCachedEval(parent_id);
+                ASSERT_DOUBLE_EQ(op_selection.getFCostChange(state, action), expected);
+                changes.push_back(expected);
+            }
+
+            // Selecting by the smallest change returns exactly the flips with that change
+            double min_change = *std::min_element(changes.begin(), changes.end());
+            std::vector<NumToFlip> actions;
+            double next_change = op_selection.getActionsWithFCostChange(state, min_change, actions);
+            ASSERT_EQ(actions.size(), static_cast<std::size_t>(std::count_if(changes.begin(), changes.end(),
+                                                [min_change](double change) { return fpEqual(change, min_change); })));
+
+            double expected_next = std::numeric_limits<double>::infinity();
+            for (double change : changes) {
+                if (fpGreater(change, min_change)) {
+                    expected_next = std::min(expected_next, change);
+                }
+            }
+            ASSERT_EQ(next_change, expected_next);
+        }
+    }
+}
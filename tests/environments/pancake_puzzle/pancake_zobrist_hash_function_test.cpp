@@ -0,0 +1,72 @@
+#include <gtest/gtest.h>
+
+#include "building_tools/hashing/hash_128.h"
+#include "environments/pancake_puzzle/pancake_state.h"
+#include "environments/pancake_puzzle/pancake_transitions.h"
+#include "environments/pancake_puzzle/pancake_zobrist_hash_function.h"
+#include "test_helpers.h"
+#include "utils/combinatorics.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <unordered_set>
+#include <vector>
+
+/**
+ * Tests that incremental hashing matches full hashing for 64-bit hash values.
+ */
+TEST(PancakeZobristHashFunctionTests, incrementalHashTest) {
+    std::mt19937 rand_gen(3);
+    PancakeTransitions transitions(12);
+    PancakeZobristHashFunction<uint64_t> hasher(12, 11);
+    PancakeState state(getRandomPermutation(12, rand_gen));
+    checkIncrementalHashing(hasher, transitions, state, 200, rand_gen);
+}
+
+/**
+ * Tests that incremental hashing matches full hashing for 128-bit hash values.
+ */
+TEST(PancakeZobristHashFunctionTests, incrementalHash128Test) {
+    std::mt19937 rand_gen(3);
+    PancakeTransitions transitions(12);
+    PancakeZobristHashFunction<Hash128> hasher(12, 11);
+    PancakeState state(getRandomPermutation(12, rand_gen));
+    checkIncrementalHashing(hasher, transitions, state, 200, rand_gen);
+}
+
+/**
+ * Tests that all permutations of a small stack get different hash values, and that the seed determines the keys.
+ */
+TEST(PancakeZobristHashFunctionTests, distinctHashValuesTest) {
+    PancakeZobristHashFunction<> hasher(6, 5);
+    PancakeZobristHashFunction<> same_seed_hasher(6, 5);
+    PancakeZobristHashFunction<> other_seed_hasher(6, 6);
+
+    std::vector<int> perm = {0, 1, 2, 3, 4, 5};
+    std::unordered_set<uint64_t> hash_values;
+    do {
+        PancakeState state(perm);
+        hash_values.insert(hasher.getHashValue(state));
+        ASSERT_EQ(hasher.getHashValue(state), same_seed_hasher.getHashValue(state));
+    } while (std::next_permutation(perm.begin(), perm.end()));
+
+    ASSERT_EQ(hash_values.size(), 720);
+
+    PancakeState goal_state(std::vector<int>{0, 1, 2, 3, 4, 5});
+    ASSERT_NE(hasher.getHashValue(goal_state), other_seed_hasher.getHashValue(goal_state));
+    ASSERT_FALSE(hasher.isPerfectHashFunction());
+}
+
+/**
+ * Checks that getAllSettings returns the correct values.
+ */
+TEST(PancakeZobristHashFunctionTests, getSettingsTest) {
+    PancakeZobristHashFunction<> hasher(6, 5);
+
+    auto settings = hasher.getAllSettings();
+    ASSERT_EQ(settings.m_name, PancakeZobristHashFunction<>::CLASS_NAME);
+    ASSERT_EQ(settings.m_main_settings.size(), 1);
+    ASSERT_EQ(settings.m_main_settings.at("seed"), "5");
+    ASSERT_EQ(settings.m_sub_component_settings.size(), 0);
+}
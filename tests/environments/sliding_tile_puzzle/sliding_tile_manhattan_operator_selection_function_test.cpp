@@ -0,0 +1,65 @@
+#include <gtest/gtest.h>
+
+#include "engines/engine_components/node_containers/node_list.h"
+#include "environments/sliding_tile_puzzle/sliding_tile_action.h"
+#include "environments/sliding_tile_puzzle/sliding_tile_manhattan_heuristic.h"
+#include "environments/sliding_tile_puzzle/sliding_tile_manhattan_operator_selection_function.h"
+#include "environments/sliding_tile_puzzle/sliding_tile_state.h"
+#include "environments/sliding_tile_puzzle/sliding_tile_transitions.h"
+#include "utils/floating_point_utils.h"
+
+#include <cstddef>
+#include <limits>
+#include <random>
+#include <vector>
+
+/**
+ * Checks that the change in f-cost of every move matches the move cost plus the change in the Manhattan distance
+ * heuristic along a random walk, for each cost type.
+ */
+TEST(SlidingTileManhattanOperatorSelectionFunctionTests, fCostChangeTest) {
+    SlidingTileState goal_state(3, 4);
+    std::mt19937 rand_gen(7);
+
+    for (SlidingTileCostType cost_type : {SlidingTileCostType::unit, SlidingTileCostType::heavy, SlidingTileCostType::inverse}) {
+        SlidingTileTransitions transitions(3, 4, cost_type);
+        SlidingTileManhattanHeuristic heuristic(goal_state, cost_type);
+        SlidingTileManhattanOperatorSelectionFunction op_selection(goal_state, cost_type);
+        NodeList<SlidingTileState, BlankSlide> nodes;
+        heuristic.setNodeContainer(nodes);
+
+        SlidingTileState state = goal_state;
+        for (int step = 0; step < 50; ++step) {
+            NodeID parent_id = nodes.addNode(state);
+            heuristic.prepareToEvaluate();
+            heuristic.evaluate(parent_id);
+
+            std::vector<BlankSlide> actions = transitions.getActions(state);
+            std::size_t num_selected = 0;
+            for (BlankSlide action : actions) {
+                double cost = transitions.getActionCost(state, action);
+                NodeID child_id = nodes.addNode(transitions.getChildState(state, action), parent_id, cost, action, cost);
+                heuristic.prepareToEvaluate();
+                heuristic.evaluate(child_id);
+
+                double expected = cost + heuristic.getCachedEval(child_id) - heuristic.getCachedEval(parent_id);
+                ASSERT_TRUE(fpEqual(op_selection.getFCostChange(state, action), expected));
+
+                std::vector<BlankSlide> selected;
+                op_selection.getActionsWithFCostChange(state, expected, selected);
+                num_selected += selected.size();
+            }
+
+            // Each move is selected once for each move with the same change, so the total is at least the number of moves
+            ASSERT_GE(num_selected, actions.size());
+
+            std::vector<BlankSlide> selected;
+            ASSERT_EQ(op_selection.getActionsWithFCostChange(state, std::numeric_limits<double>::max(), selected),
+                      std::numeric_limits<double>::infinity());
+            ASSERT_TRUE(selected.empty());
+
+            std::uniform_int_distribution<std::size_t> dist(0, actions.size() - 1);
+            transitions.applyAction(state, actions[dist(rand_gen)]);
+        }
+    }
+}
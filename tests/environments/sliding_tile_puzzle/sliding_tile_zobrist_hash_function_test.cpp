@@ -0,0 +1,75 @@
+#include <gtest/gtest.h>
+
+#include "building_tools/hashing/hash_128.h"
+#include "environments/sliding_tile_puzzle/sliding_tile_state.h"
+#include "environments/sliding_tile_puzzle/sliding_tile_transitions.h"
+#include "environments/sliding_tile_puzzle/sliding_tile_zobrist_hash_function.h"
+#include "test_helpers.h"
+
+#include <cstdint>
+#include <random>
+#include <utility>
+#include <vector>
+
+/**
+ * Tests that incremental hashing matches full hashing for 64-bit hash values.
+ */
+TEST(SlidingTileZobristHashFunctionTests, incrementalHashTest) {
+    for (auto [num_rows, num_cols] : {std::pair{4, 4}, std::pair{3, 5}}) {
+        std::mt19937 rand_gen(3);
+        SlidingTileTransitions transitions(num_rows, num_cols);
+        SlidingTileZobristHashFunction<uint64_t> hasher(num_rows, num_cols, 11);
+        checkIncrementalHashing(hasher, transitions, SlidingTileState(num_rows, num_cols), 500, rand_gen);
+    }
+}
+
+/**
+ * Tests that incremental hashing matches full hashing for 128-bit hash values.
+ */
+TEST(SlidingTileZobristHashFunctionTests, incrementalHash128Test) {
+    std::mt19937 rand_gen(3);
+    SlidingTileTransitions transitions(4, 4);
+    SlidingTileZobristHashFunction<Hash128> hasher(4, 4, 11);
+    checkIncrementalHashing(hasher, transitions, SlidingTileState(4, 4), 500, rand_gen);
+}
+
+/**
+ * Tests that all states reachable within a few moves of the goal get different hash values.
+ */
+TEST(SlidingTileZobristHashFunctionTests, distinctHashValuesTest) {
+    SlidingTileTransitions transitions(3, 3);
+    SlidingTileZobristHashFunction<> hasher(3, 3, 5);
+
+    std::vector<SlidingTileState> layer = {SlidingTileState(3, 3)};
+    std::vector<SlidingTileState> states = layer;
+    for (int depth = 0; depth < 6; ++depth) {
+        std::vector<SlidingTileState> next_layer;
+        for (const auto& state : layer) {
+            for (BlankSlide action : transitions.getActions(state)) {
+                next_layer.push_back(transitions.getChildState(state, action));
+            }
+        }
+        states.insert(states.end(), next_layer.begin(), next_layer.end());
+        layer = next_layer;
+    }
+
+    for (const auto& state1 : states) {
+        for (const auto& state2 : states) {
+            ASSERT_EQ(state1 == state2, hasher.getHashValue(state1) == hasher.getHashValue(state2));
+        }
+    }
+    ASSERT_FALSE(hasher.isPerfectHashFunction());
+}
+
+/**
+ * Checks that getAllSettings returns the correct values.
+ */
+TEST(SlidingTileZobristHashFunctionTests, getSettingsTest) {
+    SlidingTileZobristHashFunction<> hasher(3, 3, 5);
+
+    auto settings = hasher.getAllSettings();
+    ASSERT_EQ(settings.m_name, SlidingTileZobristHashFunction<>::CLASS_NAME);
+    ASSERT_EQ(settings.m_main_settings.size(), 1);
+    ASSERT_EQ(settings.m_main_settings.at("seed"), "5");
+    ASSERT_EQ(settings.m_sub_component_settings.size(), 0);
+}
@@ -78,8 +78,10 @@ TEST(SearchComponentSettingsTests, bestFirstSearchGetYMALStringTest) {
     ASSERT_EQ(getYAMLString(engine.getAllSettings()),
               "name: BestFirstSearch\n"
               "settings: \n"
+              "\t- verify_hash_matches: false\n"
               "\t- use_stored_seed: false\n"
               "\t- use_reopened: true\n"
+              "\t- use_deferred_evaluation: false\n"
               "\t- store_expansion_order: false\n"
               "\t- random_seed: 0\n"
               "components: \n"
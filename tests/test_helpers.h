@@ -1,12 +1,27 @@
 #ifndef TEST_HELPERS_H_
 #define TEST_HELPERS_H_
 
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <filesystem>
 #include <iostream>
+#include <random>
+#include <string>
+#include <vector>
 
 #include "building_tools/evaluators/cost_and_distance_to_go_evaluator.h"
+#include "building_tools/hashing/state_hash_function.h"
+#include "engines/best_first_search/best_first_search.h"
+#include "engines/best_first_search/best_first_search_params.h"
+#include "engines/engine_components/eval_functions/f_cost_evaluator.h"
 #include "engines/engine_components/node_containers/node_list.h"
+#include "environments/grid_pathfinding/grid_location.h"
+#include "environments/grid_pathfinding/grid_map.h"
+#include "search_basics/goal_test.h"
 #include "search_basics/node_container.h"
 #include "search_basics/node_evaluator.h"
+#include "search_basics/transition_system.h"
 #include "utils/floating_point_utils.h"
 
 /**
@@ -46,6 +61,175 @@ template<class State_t, class Action_t>
 bool checkDistanceToGoStateEvaluation(CostAndDistanceToGoEvaluator<State_t, Action_t>& evaluator, const State_t& state,
           double expected_eval, bool expected_is_dead_end, double expected_distance);
 
+/**
+ * The result of running A* on a problem.
+ */
+struct AStarResult {
+    double m_cost = -1.0;  ///< The cost of the solution found, or -1 if there is none
+    std::size_t m_num_nodes = 0;  ///< The number of nodes stored
+};
+
+/**
+ * Runs A* on the given problem and returns the cost of the solution found and the number of nodes stored.
+ *
+ * @param init_state The initial state
+ * @param transitions The transition system
+ * @param goal_test The goal test
+ * @param heuristic The heuristic A* uses
+ * @param hash_function The hash function A* uses
+ * @return The solution cost, which is -1 if there is no solution, and the number of nodes stored
+ */
+template<class State_t, class Action_t, class Hash_t>
+AStarResult runAStar(const State_t& init_state, const TransitionSystem<State_t, Action_t>& transitions,
+          const GoalTest<State_t>& goal_test, NodeEvaluator<State_t, Action_t>& heuristic,
+          const StateHashFunction<State_t, Hash_t>& hash_function);
+
+/**
+ * Runs A* on the given problem and returns the cost of the solution found, or -1 if there is none.
+ *
+ * @param init_state The initial state
+ * @param transitions The transition system
+ * @param goal_test The goal test
+ * @param heuristic The heuristic A* uses
+ * @param hash_function The hash function A* uses
+ * @return The optimal solution cost, or -1 if there is no solution
+ */
+template<class State_t, class Action_t, class Hash_t>
+double getAStarCost(const State_t& init_state, const TransitionSystem<State_t, Action_t>& transitions,
+          const GoalTest<State_t>& goal_test, NodeEvaluator<State_t, Action_t>& heuristic,
+          const StateHashFunction<State_t, Hash_t>& hash_function);
+
+/**
+ * Generates the state at the end of a random walk of the given length from the given state.
+ *
+ * @param state The state the walk starts from
+ * @param transitions The transition system
+ * @param walk_length The number of actions in the walk
+ * @param rand_gen The random number generator used to pick each action
+ * @return The state at the end of the walk
+ */
+template<class State_t, class Action_t>
+State_t getRandomWalkState(State_t state, const TransitionSystem<State_t, Action_t>& transitions, int walk_length,
+          std::mt19937& rand_gen);
+
+/**
+ * Checks that the child hash values that the given hash function calculates incrementally match those calculated from
+ * scratch, for every child of each state along a random walk from the given state.
+ *
+ * @param hasher The hash function, which calculates child hash values with getChildHash
+ * @param transitions The transition system
+ * @param state The state the walk starts from
+ * @param walk_length The number of actions in the walk
+ * @param rand_gen The random number generator used to pick each action
+ */
+template<class State_t, class Action_t, class Hasher_t>
+void checkIncrementalHashing(const Hasher_t& hasher, const TransitionSystem<State_t, Action_t>& transitions,
+          State_t state, int walk_length, std::mt19937& rand_gen);
+
+/**
+ * Gets a path in the temporary directory for a file used by the given test, removing any file already there.
+ *
+ * @param test_name The name of the test, which keeps the files of different tests apart
+ * @param file_name The name of the file
+ * @return The path to the file
+ */
+inline std::string getTestFilePath(const std::string& test_name, const std::string& file_name) {
+    std::filesystem::path path = std::filesystem::temp_directory_path() / (test_name + "_" + file_name);
+    std::filesystem::remove(path);
+    return path.string();
+}
+
+/**
+ * Creates a square map of the given size in which each location is an obstacle with the given probability.
+ *
+ * @param map_size The width and height of the map
+ * @param obstacle_prob The probability that each location is an obstacle
+ * @param rand_gen The random number generator
+ * @return The map
+ */
+inline GridMap createRandomMap(int map_size, double obstacle_prob, std::mt19937& rand_gen) {
+    GridMap map(map_size, map_size);
+    std::bernoulli_distribution is_obstacle(obstacle_prob);
+    for (int y = 0; y < map_size; ++y) {
+        for (int x = 0; x < map_size; ++x) {
+            if (is_obstacle(rand_gen)) {
+                map.setLocationType(x, y, GridLocationType::obstacle);
+            }
+        }
+    }
+    return map;
+}
+
+/**
+ * Gets the locations in the map that can be occupied.
+ *
+ * @param map The map
+ * @return The locations that can be occupied, in row-major order
+ */
+inline std::vector<GridLocation> getOpenLocations(const GridMap& map) {
+    std::vector<GridLocation> open_locations;
+    for (int y = 0; y < map.getHeight(); ++y) {
+        for (int x = 0; x < map.getWidth(); ++x) {
+            if (map.canOccupyLocation(x, y)) {
+                open_locations.emplace_back(x, y);
+            }
+        }
+    }
+    return open_locations;
+}
+
+template<class State_t, class Action_t, class Hash_t>
+AStarResult runAStar(const State_t& init_state, const TransitionSystem<State_t, Action_t>& transitions,
+          const GoalTest<State_t>& goal_test, NodeEvaluator<State_t, Action_t>& heuristic,
+          const StateHashFunction<State_t, Hash_t>& hash_function) {
+    FCostEvaluator<State_t, Action_t> f_cost_evaluator(heuristic);
+
+    BestFirstSearchParams params;
+    BestFirstSearch<State_t, Action_t, Hash_t> engine(params);
+    engine.setEvaluator(f_cost_evaluator);
+    engine.setTransitionSystem(transitions);
+    engine.setGoalTest(goal_test);
+    engine.setHashFunction(hash_function);
+    engine.searchForPlan(init_state);
+
+    return {engine.getLastSolutionPlanCost(), engine.getNodes().size()};
+}
+
+template<class State_t, class Action_t, class Hash_t>
+double getAStarCost(const State_t& init_state, const TransitionSystem<State_t, Action_t>& transitions,
+          const GoalTest<State_t>& goal_test, NodeEvaluator<State_t, Action_t>& heuristic,
+          const StateHashFunction<State_t, Hash_t>& hash_function) {
+    return runAStar(init_state, transitions, goal_test, heuristic, hash_function).m_cost;
+}
+
+template<class State_t, class Action_t>
+State_t getRandomWalkState(State_t state, const TransitionSystem<State_t, Action_t>& transitions, int walk_length,
+          std::mt19937& rand_gen) {
+    for (int step = 0; step < walk_length; ++step) {
+        std::vector<Action_t> actions = transitions.getActions(state);
+        std::uniform_int_distribution<std::size_t> dist(0, actions.size() - 1);
+        transitions.applyAction(state, actions[dist(rand_gen)]);
+    }
+    return state;
+}
+
+template<class State_t, class Action_t, class Hasher_t>
+void checkIncrementalHashing(const Hasher_t& hasher, const TransitionSystem<State_t, Action_t>& transitions,
+          State_t state, int walk_length, std::mt19937& rand_gen) {
+    auto hash_value = hasher.getHashValue(state);
+
+    for (int step = 0; step < walk_length; ++step) {
+        std::vector<Action_t> actions = transitions.getActions(state);
+        for (const Action_t& action : actions) {
+            ASSERT_EQ(hasher.getChildHash(hash_value, state, action), hasher.getHashValue(transitions.getChildState(state, action)));
+        }
+
+        Action_t action = actions[std::uniform_int_distribution<std::size_t>(0, actions.size() - 1)(rand_gen)];
+        hash_value = hasher.getChildHash(hash_value, state, action);
+        state = transitions.getChildState(state, action);
+    }
+}
+
 template<class State_t, class Action_t>
 bool checkStateEvaluation(NodeEvaluator<State_t, Action_t>& evaluator, const State_t& state,
           double expected_eval, bool expected_is_dead_end) {
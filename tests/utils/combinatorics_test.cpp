@@ -101,6 +101,124 @@ TEST(CombinatoricsTests, getPermutationRankTest) {
     ASSERT_EQ(getPermutationRank(nums3), 15);
 }
 
+/**
+ * Tests that getPermutationRank ranks every permutation of size 5 in lexicographic order, and that
+ * getPermutationFromRank inverts it
+ */
+TEST(CombinatoricsTests, permutationRankLexicographicOrderTest) {
+    std::vector<int> perm = {0, 1, 2, 3, 4};
+    uint64_t expected_rank = 0;
+
+    do {
+        ASSERT_EQ(getPermutationRank(perm), expected_rank);
+        ASSERT_EQ(getPermutationRank(perm.data(), perm.size()), expected_rank);
+        ASSERT_EQ(getPermutationFromRank(expected_rank, 5), perm);
+        expected_rank++;
+    } while (std::next_permutation(perm.begin(), perm.end()));
+
+    ASSERT_EQ(expected_rank, get64BitFactorial(5));
+}
+
+/**
+ * Tests that ranking and unranking random permutations of sizes 12 and 20 round trips
+ */
+TEST(CombinatoricsTests, permutationRankRoundTripTest) {
+    auto seed = std::random_device{}();
+    std::mt19937 gen(seed);
+
+    for (unsigned size : {12U, 20U}) {
+        for (int i = 0; i < 100; i++) {
+            std::vector<int> perm = getRandomPermutation(size, gen);
+            uint64_t rank = getPermutationRank(perm);
+
+            ASSERT_LT(rank, get64BitFactorial(size)) << "Seed: " << seed;
+            ASSERT_EQ(getPermutationFromRank(rank, size), perm) << "Seed: " << seed;
+        }
+    }
+
+    std::vector<int> last_perm = {19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0};
+    ASSERT_EQ(getPermutationRank(last_perm), get64BitFactorial(20) - 1);
+}
+
+/**
+ * Tests that the 128-bit ranks match the 64-bit ranks for small permutations, can be inverted, and reach the largest
+ * rank for 34 elements.
+ */
+TEST(CombinatoricsTests, permutationRank128Test) {
+    auto seed = std::random_device{}();
+    std::mt19937 gen(seed);
+
+    for (int i = 0; i < 100; i++) {
+        std::vector<int> perm = getRandomPermutation(20, gen);
+        Hash128 rank = getPermutationRank128(perm.data(), perm.size());
+        ASSERT_EQ(rank.m_high, 0U) << "Seed: " << seed;
+        ASSERT_EQ(rank.m_low, getPermutationRank(perm)) << "Seed: " << seed;
+    }
+
+    for (unsigned size : {25U, 34U}) {
+        for (int i = 0; i < 100; i++) {
+            std::vector<int> perm = getRandomPermutation(size, gen);
+            std::vector<int> unranked_perm(size);
+            getPermutationFromRank128(getPermutationRank128(perm.data(), perm.size()), unranked_perm.data(), size);
+            ASSERT_EQ(unranked_perm, perm) << "Seed: " << seed;
+        }
+    }
+
+    std::vector<int> last_perm(34);
+    for (int i = 0; i < 34; i++) {
+        last_perm[static_cast<std::size_t>(i)] = 33 - i;
+    }
+    Hash128 last_rank = getPermutationRank128(last_perm.data(), last_perm.size());
+    ASSERT_EQ(last_rank.m_high, 0xde1bc4d19efcac82ULL);  // 34! - 1
+    ASSERT_EQ(last_rank.m_low, 0x445da75affffffffULL);
+}
+
+/**
+ * Tests that the 128-bit signed ranks match the ranks of the signed permutation hash function for small permutations,
+ * and can be inverted for large ones.
+ */
+TEST(CombinatoricsTests, signedPermutationRank128Test) {
+    std::vector<int> small_perm = {1, -3, -4, 2};
+    Hash128 small_rank = getSignedPermutationRank128(small_perm.data(), small_perm.size());
+    ASSERT_EQ(small_rank.m_high, 0U);
+    ASSERT_EQ(small_rank.m_low, 147U);
+
+    auto seed = std::random_device{}();
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<int> sign_dist(0, 1);
+    for (unsigned size : {4U, 20U, 28U}) {
+        for (int i = 0; i < 100; i++) {
+            std::vector<int> perm = getRandomPermutation(size, gen);
+            for (int& value : perm) {
+                value = sign_dist(gen) == 0 ? value + 1 : -(value + 1);
+            }
+            std::vector<int> unranked_perm(size);
+            getSignedPermutationFromRank128(getSignedPermutationRank128(perm.data(), perm.size()), unranked_perm.data(), size);
+            ASSERT_EQ(unranked_perm, perm) << "Seed: " << seed;
+        }
+    }
+
+    std::vector<int> last_perm(28);
+    for (int i = 0; i < 28; i++) {
+        last_perm[static_cast<std::size_t>(i)] = -(28 - i);
+    }
+    Hash128 last_rank = getSignedPermutationRank128(last_perm.data(), last_perm.size());
+    ASSERT_EQ(last_rank.m_high, 0x3d925ba47ad2cd59ULL);  // 28! * 2^28 - 1
+    ASSERT_EQ(last_rank.m_low, 0xdadfffffffffffffULL);
+}
+
+/**
+ * Tests that getUnsignedPermutationRank matches ranking the permutation after applying convertPermutationState
+ */
+TEST(CombinatoricsTests, getUnsignedPermutationRankTest) {
+    std::vector<int> signed_perm = {-3, 1, 4, -2};
+    std::vector<int> converted_perm = signed_perm;
+    convertPermutationState(converted_perm);
+
+    ASSERT_EQ(getUnsignedPermutationRank(signed_perm.data(), signed_perm.size()), getPermutationRank(converted_perm));
+    ASSERT_EQ(getBitVectorRanking(signed_perm.data(), signed_perm.size()), getBitVectorRanking(signed_perm));
+}
+
 /**
  * Generates two random permutations and checks if they are both different in order.
  * This test might be a bit weak.